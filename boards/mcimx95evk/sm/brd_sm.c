@@ -199,6 +199,18 @@ void BRD_SM_TimerTick(uint32_t msec)
 {
     /* Kick the dog */
     BOARD_WdogRefresh();
+
+    /* Sample PMIC sensors */
+    BRD_SM_SensorTick(msec);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Board deferred handler                                                   */
+/*--------------------------------------------------------------------------*/
+void BRD_SM_DeferredHandler(void)
+{
+    /* Sample PMIC sensors */
+    BRD_SM_SensorSampleHandler();
 }
 
 /*--------------------------------------------------------------------------*/
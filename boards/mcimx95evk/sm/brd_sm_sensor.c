@@ -46,9 +46,26 @@
 
 /* Local types */
 
+/* Board sensor sample cache */
+typedef struct
+{
+    int64_t value;
+    uint64_t timestamp;
+    int32_t status;
+    bool valid;
+} brd_sm_sensor_cache_t;
+
 /* Local variables */
 
 static bool sensorEnb[BRD_SM_NUM_SENSOR];
+static bool s_sensorTsEnb[BRD_SM_NUM_SENSOR];
+static brd_sm_sensor_cache_t s_sensorCache[BRD_SM_NUM_SENSOR];
+static uint32_t s_sensorSampleMsec = 0U;
+static uint32_t s_sensorSampleNext = BRD_SM_NUM_SENSOR;
+
+/* Local functions */
+
+static int32_t BRD_SM_SensorRead(uint32_t sensorId);
 
 /*--------------------------------------------------------------------------*/
 /* Return sensor name                                                       */
@@ -115,8 +132,9 @@ int32_t BRD_SM_SensorDescribe(uint32_t sensorId,
             desc->sensorType = 2U;
             desc->sensorExponent = 0;
             desc->numTripPoints = 0U;
-            desc->timestampSupport = false;
-            desc->timestampExponent = 0;
+            desc->timestampSupport = true;
+            desc->timestampExponent = -6;
+            desc->asyncSupport = true;
 
             /* PF09? */
             if (sensorId == BRD_SM_SENSOR_TEMP_PF09)
@@ -158,31 +176,22 @@ int32_t BRD_SM_SensorReadingGet(uint32_t sensorId, int64_t *sensorValue,
             /* Check if enabled */
             if (sensorEnb[brdSensorId])
             {
-                int32_t temp;
-                bool rc = false;
+                const brd_sm_sensor_cache_t *cache
+                    = &s_sensorCache[brdSensorId];
 
-                /* Read sensor */
-                switch (sensorId)
+                /* Sample now if not yet sampled in the background */
+                if (!cache->valid)
                 {
-                    case BRD_SM_SENSOR_TEMP_PF09:
-                        rc = PF09_TempGet(&pf09Dev, &temp);
-                        break;
-                    case BRD_SM_SENSOR_TEMP_PF5301:
-                        rc = PF53_TempGet(&pf5301Dev, &temp);
-                        break;
-                    default:
-                        rc = PF53_TempGet(&pf5302Dev, &temp);
-                        break;
+                    (void) BRD_SM_SensorRead(sensorId);
                 }
 
-                if (rc)
+                /* Return last sample */
+                status = cache->status;
+                if (status == SM_ERR_SUCCESS)
                 {
-                    *sensorValue = (int64_t) temp;
-                    *sensorTimestamp = 0ULL;
-                }
-                else
-                {
-                    status = SM_ERR_HARDWARE_ERROR;
+                    *sensorValue = cache->value;
+                    *sensorTimestamp = s_sensorTsEnb[brdSensorId]
+                        ? cache->timestamp : 0ULL;
                 }
             }
             else
@@ -290,24 +299,20 @@ int32_t BRD_SM_SensorEnable(uint32_t sensorId, bool enable,
         {
             uint32_t brdSensorId = sensorId - DEV_SM_NUM_SENSOR;
 
-            /* Timestamp not supported */
-            if (timestampReporting)
-            {
-                status = SM_ERR_NOT_SUPPORTED;
-            }
-            else
-            {
-                /* Record sensor enable */
-                sensorEnb[brdSensorId] = enable;
+            /* Record sensor enable */
+            sensorEnb[brdSensorId] = enable;
+            s_sensorTsEnb[brdSensorId] = timestampReporting;
+
+            /* Discard any old sample */
+            s_sensorCache[brdSensorId].valid = false;
 
-                /* Disable alarm */
-                if ((sensorId == BRD_SM_SENSOR_TEMP_PF09)
-                    && !sensorEnb[brdSensorId])
+            /* Disable alarm */
+            if ((sensorId == BRD_SM_SENSOR_TEMP_PF09)
+                && !sensorEnb[brdSensorId])
+            {
+                if (!PF09_TempAlarmSet(&pf09Dev, 500))
                 {
-                    if (!PF09_TempAlarmSet(&pf09Dev, 500))
-                    {
-                        status = SM_ERR_HARDWARE_ERROR;
-                    }
+                    status = SM_ERR_HARDWARE_ERROR;
                 }
             }
         }
@@ -344,7 +349,7 @@ int32_t BRD_SM_SensorIsEnabled(uint32_t sensorId, bool *enabled,
         {
             /* Return sensor enable */
             *enabled = sensorEnb[brdSensorId];
-            *timestampReporting = false;
+            *timestampReporting = s_sensorTsEnb[brdSensorId];
         }
     }
     else
@@ -365,3 +370,123 @@ void BRD_SM_SensorHandler(void)
     LMM_SensorEvent(BRD_SM_SENSOR_TEMP_PF09, 0U, 1U);
 }
 
+
+/*--------------------------------------------------------------------------*/
+/* Take a fresh sensor sample                                               */
+/*--------------------------------------------------------------------------*/
+int32_t BRD_SM_SensorSample(uint32_t sensorId)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check to see if sensorId is within bounds*/
+    if(sensorId < SM_NUM_SENSOR)
+    {
+        /* Device sensors are always read directly */
+        if (sensorId >= DEV_SM_NUM_SENSOR)
+        {
+            uint32_t brdSensorId = sensorId - DEV_SM_NUM_SENSOR;
+
+            /* Check if enabled */
+            if (sensorEnb[brdSensorId])
+            {
+                status = BRD_SM_SensorRead(sensorId);
+            }
+            else
+            {
+                status = SM_ERR_NOT_SUPPORTED;
+            }
+        }
+    }
+    else
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Sample board sensors in the background                                   */
+/*--------------------------------------------------------------------------*/
+void BRD_SM_SensorTick(uint32_t msec)
+{
+    s_sensorSampleMsec += msec;
+
+    /* Sample period elapsed and last sweep done? */
+    if ((s_sensorSampleMsec >= BRD_SM_SENSOR_SAMPLE_MSEC)
+        && (s_sensorSampleNext >= BRD_SM_NUM_SENSOR))
+    {
+        s_sensorSampleMsec = 0U;
+
+        /* Defer the I2C reads to the PendSV handler */
+        s_sensorSampleNext = 0U;
+        PENDSV_Trigger();
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Do background sample requested by the tick                               */
+/*--------------------------------------------------------------------------*/
+void BRD_SM_SensorSampleHandler(void)
+{
+    /* Skip disabled sensors */
+    while ((s_sensorSampleNext < BRD_SM_NUM_SENSOR)
+        && !sensorEnb[s_sensorSampleNext])
+    {
+        s_sensorSampleNext++;
+    }
+
+    /* Refresh one sensor per call */
+    if (s_sensorSampleNext < BRD_SM_NUM_SENSOR)
+    {
+        (void) BRD_SM_SensorRead(s_sensorSampleNext + DEV_SM_NUM_SENSOR);
+        s_sensorSampleNext++;
+
+        /* Come back for the rest after any pending requests */
+        PENDSV_Trigger();
+    }
+}
+
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Read a PMIC sensor and update the cache                                  */
+/*--------------------------------------------------------------------------*/
+static int32_t BRD_SM_SensorRead(uint32_t sensorId)
+{
+    brd_sm_sensor_cache_t *cache
+        = &s_sensorCache[sensorId - DEV_SM_NUM_SENSOR];
+    int32_t temp;
+    bool rc = false;
+
+    /* Read sensor */
+    switch (sensorId)
+    {
+        case BRD_SM_SENSOR_TEMP_PF09:
+            rc = PF09_TempGet(&pf09Dev, &temp);
+            break;
+        case BRD_SM_SENSOR_TEMP_PF5301:
+            rc = PF53_TempGet(&pf5301Dev, &temp);
+            break;
+        default:
+            rc = PF53_TempGet(&pf5302Dev, &temp);
+            break;
+    }
+
+    /* Update cache */
+    if (rc)
+    {
+        cache->value = (int64_t) temp;
+        cache->timestamp = DEV_SM_Usec64Get();
+        cache->status = SM_ERR_SUCCESS;
+    }
+    else
+    {
+        cache->status = SM_ERR_HARDWARE_ERROR;
+    }
+    cache->valid = true;
+
+    /* Return status */
+    return cache->status;
+}
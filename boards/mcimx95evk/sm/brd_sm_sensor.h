@@ -64,8 +64,14 @@
 #define SM_SENSORTRIPPOINTSET  BRD_SM_SensorTripPointSet  /*!< Sensor trip point */
 #define SM_SENSORENABLE        BRD_SM_SensorEnable        /*!< Sensor enable */
 #define SM_SENSORISENABLED     BRD_SM_SensorIsEnabled     /*!< Sensor status */
+#define SM_SENSORSAMPLE        BRD_SM_SensorSample        /*!< Sensor sample */
 /** @} */
 
+#ifndef BRD_SM_SENSOR_SAMPLE_MSEC
+/*! Background sample period for PMIC sensors (mS) */
+#define BRD_SM_SENSOR_SAMPLE_MSEC  100U
+#endif
+
 /*! Number of board sensors */
 #define BRD_SM_NUM_SENSOR  3UL
 
@@ -131,11 +137,14 @@ int32_t BRD_SM_SensorDescribe(uint32_t sensorId,
  * @param[out]    sensorTimestamp  Return pointer to timestamp
  *
  * This function allows the caller to read the value of a sensor.
+ * PMIC sensors return the last background sample and the SYSCTR
+ * time (uS) it was taken. Device sensors are read directly.
  *
  * @return Returns the status (::SM_ERR_SUCCESS = success).
  *
  * Return errors (see @ref STATUS "SM error codes"):
  * - ::SM_ERR_NOT_FOUND: if \a sensorId is invalid.
+ * - ::SM_ERR_HARDWARE_ERROR: if the last PMIC sample failed.
  */
 int32_t BRD_SM_SensorReadingGet(uint32_t sensorId, int64_t *sensorValue,
     uint64_t *sensorTimestamp);
@@ -195,6 +204,46 @@ int32_t BRD_SM_SensorEnable(uint32_t sensorId, bool enable,
 int32_t BRD_SM_SensorIsEnabled(uint32_t sensorId, bool *enabled,
     bool *timestampReporting);
 
+/*!
+ * Take a fresh sample of a board sensor.
+ *
+ * @param[in]     sensorId         Sensor to sample
+ *
+ * This function allows the caller to bypass the background sample
+ * and read a PMIC sensor now. The result is stored for the next
+ * BRD_SM_SensorReadingGet(). Device sensors are always read directly
+ * so this is a no-op for them.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_FOUND: if \a sensorId is invalid.
+ * - ::SM_ERR_NOT_SUPPORTED: if the sensor is disabled.
+ * - ::SM_ERR_HARDWARE_ERROR: if the PMIC read failed.
+ */
+int32_t BRD_SM_SensorSample(uint32_t sensorId);
+
+/*!
+ * Sample board sensors in the background.
+ *
+ * @param[in]     msec  Time since last call (mS)
+ *
+ * Called from the board timer tick. Every ::BRD_SM_SENSOR_SAMPLE_MSEC
+ * it requests a sample by BRD_SM_SensorSampleHandler() so SCMI reads do
+ * not wait on I2C. No I2C is done in the tick.
+ */
+void BRD_SM_SensorTick(uint32_t msec);
+
+/*!
+ * Sample board sensors requested by the tick.
+ *
+ * Called from the board deferred handler (PendSV). Once
+ * BRD_SM_SensorTick() requested a sample, reads the next enabled PMIC
+ * sensor and triggers PendSV again until all have been read. Each call
+ * does at most one I2C read so pending SCMI requests run in between.
+ */
+void BRD_SM_SensorSampleHandler(void);
+
 /*!
  * Sensor interrupt handler.
  *
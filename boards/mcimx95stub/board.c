@@ -69,6 +69,9 @@
 /* SWI configuration */
 #define BOARD_SWI_PRIO              BOARD_HANDLER_PRIO_NOPREEMPT_NORMAL
 
+/* PendSV (deferred RPC) configuration */
+#define BOARD_PENDSV_PRIO           BOARD_HANDLER_PRIO_NOPREEMPT_VERY_LOW
+
 /*******************************************************************************
  * Variables
  ******************************************************************************/
@@ -306,6 +309,9 @@ void BOARD_InitHandlers(void)
     NVIC_SetPriority(BOARD_SWI_IRQn, BOARD_SWI_PRIO);
     NVIC_EnableIRQ(BOARD_SWI_IRQn);
 
+    /* Configure PendSV handler */
+    NVIC_SetPriority(PendSV_IRQn, BOARD_PENDSV_PRIO);
+
     /* Enable BBNSM handler */
     NVIC_EnableIRQ(BBNSM_IRQn);
 
@@ -193,6 +193,14 @@ void BRD_SM_TimerTick(uint32_t msec)
     BOARD_WdogRefresh();
 }
 
+/*--------------------------------------------------------------------------*/
+/* Board deferred handler                                                   */
+/*--------------------------------------------------------------------------*/
+void BRD_SM_DeferredHandler(void)
+{
+    ; /* Intentional empty function */
+}
+
 /*--------------------------------------------------------------------------*/
 /* Custom monitor function                                                  */
 /*--------------------------------------------------------------------------*/
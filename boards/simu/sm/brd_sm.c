@@ -94,6 +94,14 @@ void BRD_SM_TimerTick(uint32_t msec)
     BRD_SM_SensorHandler();
 }
 
+/*--------------------------------------------------------------------------*/
+/* Board deferred handler                                                   */
+/*--------------------------------------------------------------------------*/
+void BRD_SM_DeferredHandler(void)
+{
+    ; /* Intentional empty function */
+}
+
 /*--------------------------------------------------------------------------*/
 /* Custom monitor function                                                  */
 /*--------------------------------------------------------------------------*/
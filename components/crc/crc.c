@@ -46,8 +46,291 @@
 
 /* Types */
 
+/* Local Variables */
+
+/* CRC32 nibble table (used for unaligned head/tail bytes) */
+static uint32_t const s_crcNibble[16] =
+{
+    0x4DBDF21CU, 0x500AE278U, 0x76D3D2D4U, 0x6B64C2B0U,
+    0x3B61B38CU, 0x26D6A3E8U, 0x000F9344U, 0x1DB88320U,
+    0xA005713CU, 0xBDB26158U, 0x9B6B51F4U, 0x86DC4190U,
+    0xD6D930ACU, 0xCB6E20C8U, 0xEDB71064U, 0xF0000000U
+};
+
+/* Slice-by-4 tables (byte lanes 0..3 of a little-endian data word) */
+static uint32_t const s_crcSlice[4][256] =
+{
+    {
+        0x00000000U, 0xB8BC6765U, 0xAA09C88BU, 0x12B5AFEEU,
+        0x8F629757U, 0x37DEF032U, 0x256B5FDCU, 0x9DD738B9U,
+        0xC5B428EFU, 0x7D084F8AU, 0x6FBDE064U, 0xD7018701U,
+        0x4AD6BFB8U, 0xF26AD8DDU, 0xE0DF7733U, 0x58631056U,
+        0x5019579FU, 0xE8A530FAU, 0xFA109F14U, 0x42ACF871U,
+        0xDF7BC0C8U, 0x67C7A7ADU, 0x75720843U, 0xCDCE6F26U,
+        0x95AD7F70U, 0x2D111815U, 0x3FA4B7FBU, 0x8718D09EU,
+        0x1ACFE827U, 0xA2738F42U, 0xB0C620ACU, 0x087A47C9U,
+        0xA032AF3EU, 0x188EC85BU, 0x0A3B67B5U, 0xB28700D0U,
+        0x2F503869U, 0x97EC5F0CU, 0x8559F0E2U, 0x3DE59787U,
+        0x658687D1U, 0xDD3AE0B4U, 0xCF8F4F5AU, 0x7733283FU,
+        0xEAE41086U, 0x525877E3U, 0x40EDD80DU, 0xF851BF68U,
+        0xF02BF8A1U, 0x48979FC4U, 0x5A22302AU, 0xE29E574FU,
+        0x7F496FF6U, 0xC7F50893U, 0xD540A77DU, 0x6DFCC018U,
+        0x359FD04EU, 0x8D23B72BU, 0x9F9618C5U, 0x272A7FA0U,
+        0xBAFD4719U, 0x0241207CU, 0x10F48F92U, 0xA848E8F7U,
+        0x9B14583DU, 0x23A83F58U, 0x311D90B6U, 0x89A1F7D3U,
+        0x1476CF6AU, 0xACCAA80FU, 0xBE7F07E1U, 0x06C36084U,
+        0x5EA070D2U, 0xE61C17B7U, 0xF4A9B859U, 0x4C15DF3CU,
+        0xD1C2E785U, 0x697E80E0U, 0x7BCB2F0EU, 0xC377486BU,
+        0xCB0D0FA2U, 0x73B168C7U, 0x6104C729U, 0xD9B8A04CU,
+        0x446F98F5U, 0xFCD3FF90U, 0xEE66507EU, 0x56DA371BU,
+        0x0EB9274DU, 0xB6054028U, 0xA4B0EFC6U, 0x1C0C88A3U,
+        0x81DBB01AU, 0x3967D77FU, 0x2BD27891U, 0x936E1FF4U,
+        0x3B26F703U, 0x839A9066U, 0x912F3F88U, 0x299358EDU,
+        0xB4446054U, 0x0CF80731U, 0x1E4DA8DFU, 0xA6F1CFBAU,
+        0xFE92DFECU, 0x462EB889U, 0x549B1767U, 0xEC277002U,
+        0x71F048BBU, 0xC94C2FDEU, 0xDBF98030U, 0x6345E755U,
+        0x6B3FA09CU, 0xD383C7F9U, 0xC1366817U, 0x798A0F72U,
+        0xE45D37CBU, 0x5CE150AEU, 0x4E54FF40U, 0xF6E89825U,
+        0xAE8B8873U, 0x1637EF16U, 0x048240F8U, 0xBC3E279DU,
+        0x21E91F24U, 0x99557841U, 0x8BE0D7AFU, 0x335CB0CAU,
+        0xED59B63BU, 0x55E5D15EU, 0x47507EB0U, 0xFFEC19D5U,
+        0x623B216CU, 0xDA874609U, 0xC832E9E7U, 0x708E8E82U,
+        0x28ED9ED4U, 0x9051F9B1U, 0x82E4565FU, 0x3A58313AU,
+        0xA78F0983U, 0x1F336EE6U, 0x0D86C108U, 0xB53AA66DU,
+        0xBD40E1A4U, 0x05FC86C1U, 0x1749292FU, 0xAFF54E4AU,
+        0x322276F3U, 0x8A9E1196U, 0x982BBE78U, 0x2097D91DU,
+        0x78F4C94BU, 0xC048AE2EU, 0xD2FD01C0U, 0x6A4166A5U,
+        0xF7965E1CU, 0x4F2A3979U, 0x5D9F9697U, 0xE523F1F2U,
+        0x4D6B1905U, 0xF5D77E60U, 0xE762D18EU, 0x5FDEB6EBU,
+        0xC2098E52U, 0x7AB5E937U, 0x680046D9U, 0xD0BC21BCU,
+        0x88DF31EAU, 0x3063568FU, 0x22D6F961U, 0x9A6A9E04U,
+        0x07BDA6BDU, 0xBF01C1D8U, 0xADB46E36U, 0x15080953U,
+        0x1D724E9AU, 0xA5CE29FFU, 0xB77B8611U, 0x0FC7E174U,
+        0x9210D9CDU, 0x2AACBEA8U, 0x38191146U, 0x80A57623U,
+        0xD8C66675U, 0x607A0110U, 0x72CFAEFEU, 0xCA73C99BU,
+        0x57A4F122U, 0xEF189647U, 0xFDAD39A9U, 0x45115ECCU,
+        0x764DEE06U, 0xCEF18963U, 0xDC44268DU, 0x64F841E8U,
+        0xF92F7951U, 0x41931E34U, 0x5326B1DAU, 0xEB9AD6BFU,
+        0xB3F9C6E9U, 0x0B45A18CU, 0x19F00E62U, 0xA14C6907U,
+        0x3C9B51BEU, 0x842736DBU, 0x96929935U, 0x2E2EFE50U,
+        0x2654B999U, 0x9EE8DEFCU, 0x8C5D7112U, 0x34E11677U,
+        0xA9362ECEU, 0x118A49ABU, 0x033FE645U, 0xBB838120U,
+        0xE3E09176U, 0x5B5CF613U, 0x49E959FDU, 0xF1553E98U,
+        0x6C820621U, 0xD43E6144U, 0xC68BCEAAU, 0x7E37A9CFU,
+        0xD67F4138U, 0x6EC3265DU, 0x7C7689B3U, 0xC4CAEED6U,
+        0x591DD66FU, 0xE1A1B10AU, 0xF3141EE4U, 0x4BA87981U,
+        0x13CB69D7U, 0xAB770EB2U, 0xB9C2A15CU, 0x017EC639U,
+        0x9CA9FE80U, 0x241599E5U, 0x36A0360BU, 0x8E1C516EU,
+        0x866616A7U, 0x3EDA71C2U, 0x2C6FDE2CU, 0x94D3B949U,
+        0x090481F0U, 0xB1B8E695U, 0xA30D497BU, 0x1BB12E1EU,
+        0x43D23E48U, 0xFB6E592DU, 0xE9DBF6C3U, 0x516791A6U,
+        0xCCB0A91FU, 0x740CCE7AU, 0x66B96194U, 0xDE0506F1U
+    },
+    {
+        0x00000000U, 0x01C26A37U, 0x0384D46EU, 0x0246BE59U,
+        0x0709A8DCU, 0x06CBC2EBU, 0x048D7CB2U, 0x054F1685U,
+        0x0E1351B8U, 0x0FD13B8FU, 0x0D9785D6U, 0x0C55EFE1U,
+        0x091AF964U, 0x08D89353U, 0x0A9E2D0AU, 0x0B5C473DU,
+        0x1C26A370U, 0x1DE4C947U, 0x1FA2771EU, 0x1E601D29U,
+        0x1B2F0BACU, 0x1AED619BU, 0x18ABDFC2U, 0x1969B5F5U,
+        0x1235F2C8U, 0x13F798FFU, 0x11B126A6U, 0x10734C91U,
+        0x153C5A14U, 0x14FE3023U, 0x16B88E7AU, 0x177AE44DU,
+        0x384D46E0U, 0x398F2CD7U, 0x3BC9928EU, 0x3A0BF8B9U,
+        0x3F44EE3CU, 0x3E86840BU, 0x3CC03A52U, 0x3D025065U,
+        0x365E1758U, 0x379C7D6FU, 0x35DAC336U, 0x3418A901U,
+        0x3157BF84U, 0x3095D5B3U, 0x32D36BEAU, 0x331101DDU,
+        0x246BE590U, 0x25A98FA7U, 0x27EF31FEU, 0x262D5BC9U,
+        0x23624D4CU, 0x22A0277BU, 0x20E69922U, 0x2124F315U,
+        0x2A78B428U, 0x2BBADE1FU, 0x29FC6046U, 0x283E0A71U,
+        0x2D711CF4U, 0x2CB376C3U, 0x2EF5C89AU, 0x2F37A2ADU,
+        0x709A8DC0U, 0x7158E7F7U, 0x731E59AEU, 0x72DC3399U,
+        0x7793251CU, 0x76514F2BU, 0x7417F172U, 0x75D59B45U,
+        0x7E89DC78U, 0x7F4BB64FU, 0x7D0D0816U, 0x7CCF6221U,
+        0x798074A4U, 0x78421E93U, 0x7A04A0CAU, 0x7BC6CAFDU,
+        0x6CBC2EB0U, 0x6D7E4487U, 0x6F38FADEU, 0x6EFA90E9U,
+        0x6BB5866CU, 0x6A77EC5BU, 0x68315202U, 0x69F33835U,
+        0x62AF7F08U, 0x636D153FU, 0x612BAB66U, 0x60E9C151U,
+        0x65A6D7D4U, 0x6464BDE3U, 0x662203BAU, 0x67E0698DU,
+        0x48D7CB20U, 0x4915A117U, 0x4B531F4EU, 0x4A917579U,
+        0x4FDE63FCU, 0x4E1C09CBU, 0x4C5AB792U, 0x4D98DDA5U,
+        0x46C49A98U, 0x4706F0AFU, 0x45404EF6U, 0x448224C1U,
+        0x41CD3244U, 0x400F5873U, 0x4249E62AU, 0x438B8C1DU,
+        0x54F16850U, 0x55330267U, 0x5775BC3EU, 0x56B7D609U,
+        0x53F8C08CU, 0x523AAABBU, 0x507C14E2U, 0x51BE7ED5U,
+        0x5AE239E8U, 0x5B2053DFU, 0x5966ED86U, 0x58A487B1U,
+        0x5DEB9134U, 0x5C29FB03U, 0x5E6F455AU, 0x5FAD2F6DU,
+        0xE1351B80U, 0xE0F771B7U, 0xE2B1CFEEU, 0xE373A5D9U,
+        0xE63CB35CU, 0xE7FED96BU, 0xE5B86732U, 0xE47A0D05U,
+        0xEF264A38U, 0xEEE4200FU, 0xECA29E56U, 0xED60F461U,
+        0xE82FE2E4U, 0xE9ED88D3U, 0xEBAB368AU, 0xEA695CBDU,
+        0xFD13B8F0U, 0xFCD1D2C7U, 0xFE976C9EU, 0xFF5506A9U,
+        0xFA1A102CU, 0xFBD87A1BU, 0xF99EC442U, 0xF85CAE75U,
+        0xF300E948U, 0xF2C2837FU, 0xF0843D26U, 0xF1465711U,
+        0xF4094194U, 0xF5CB2BA3U, 0xF78D95FAU, 0xF64FFFCDU,
+        0xD9785D60U, 0xD8BA3757U, 0xDAFC890EU, 0xDB3EE339U,
+        0xDE71F5BCU, 0xDFB39F8BU, 0xDDF521D2U, 0xDC374BE5U,
+        0xD76B0CD8U, 0xD6A966EFU, 0xD4EFD8B6U, 0xD52DB281U,
+        0xD062A404U, 0xD1A0CE33U, 0xD3E6706AU, 0xD2241A5DU,
+        0xC55EFE10U, 0xC49C9427U, 0xC6DA2A7EU, 0xC7184049U,
+        0xC25756CCU, 0xC3953CFBU, 0xC1D382A2U, 0xC011E895U,
+        0xCB4DAFA8U, 0xCA8FC59FU, 0xC8C97BC6U, 0xC90B11F1U,
+        0xCC440774U, 0xCD866D43U, 0xCFC0D31AU, 0xCE02B92DU,
+        0x91AF9640U, 0x906DFC77U, 0x922B422EU, 0x93E92819U,
+        0x96A63E9CU, 0x976454ABU, 0x9522EAF2U, 0x94E080C5U,
+        0x9FBCC7F8U, 0x9E7EADCFU, 0x9C381396U, 0x9DFA79A1U,
+        0x98B56F24U, 0x99770513U, 0x9B31BB4AU, 0x9AF3D17DU,
+        0x8D893530U, 0x8C4B5F07U, 0x8E0DE15EU, 0x8FCF8B69U,
+        0x8A809DECU, 0x8B42F7DBU, 0x89044982U, 0x88C623B5U,
+        0x839A6488U, 0x82580EBFU, 0x801EB0E6U, 0x81DCDAD1U,
+        0x8493CC54U, 0x8551A663U, 0x8717183AU, 0x86D5720DU,
+        0xA9E2D0A0U, 0xA820BA97U, 0xAA6604CEU, 0xABA46EF9U,
+        0xAEEB787CU, 0xAF29124BU, 0xAD6FAC12U, 0xACADC625U,
+        0xA7F18118U, 0xA633EB2FU, 0xA4755576U, 0xA5B73F41U,
+        0xA0F829C4U, 0xA13A43F3U, 0xA37CFDAAU, 0xA2BE979DU,
+        0xB5C473D0U, 0xB40619E7U, 0xB640A7BEU, 0xB782CD89U,
+        0xB2CDDB0CU, 0xB30FB13BU, 0xB1490F62U, 0xB08B6555U,
+        0xBBD72268U, 0xBA15485FU, 0xB853F606U, 0xB9919C31U,
+        0xBCDE8AB4U, 0xBD1CE083U, 0xBF5A5EDAU, 0xBE9834EDU
+    },
+    {
+        0x00000000U, 0x191B3141U, 0x32366282U, 0x2B2D53C3U,
+        0x646CC504U, 0x7D77F445U, 0x565AA786U, 0x4F4196C7U,
+        0xC8D98A08U, 0xD1C2BB49U, 0xFAEFE88AU, 0xE3F4D9CBU,
+        0xACB54F0CU, 0xB5AE7E4DU, 0x9E832D8EU, 0x87981CCFU,
+        0x4AC21251U, 0x53D92310U, 0x78F470D3U, 0x61EF4192U,
+        0x2EAED755U, 0x37B5E614U, 0x1C98B5D7U, 0x05838496U,
+        0x821B9859U, 0x9B00A918U, 0xB02DFADBU, 0xA936CB9AU,
+        0xE6775D5DU, 0xFF6C6C1CU, 0xD4413FDFU, 0xCD5A0E9EU,
+        0x958424A2U, 0x8C9F15E3U, 0xA7B24620U, 0xBEA97761U,
+        0xF1E8E1A6U, 0xE8F3D0E7U, 0xC3DE8324U, 0xDAC5B265U,
+        0x5D5DAEAAU, 0x44469FEBU, 0x6F6BCC28U, 0x7670FD69U,
+        0x39316BAEU, 0x202A5AEFU, 0x0B07092CU, 0x121C386DU,
+        0xDF4636F3U, 0xC65D07B2U, 0xED705471U, 0xF46B6530U,
+        0xBB2AF3F7U, 0xA231C2B6U, 0x891C9175U, 0x9007A034U,
+        0x179FBCFBU, 0x0E848DBAU, 0x25A9DE79U, 0x3CB2EF38U,
+        0x73F379FFU, 0x6AE848BEU, 0x41C51B7DU, 0x58DE2A3CU,
+        0xF0794F05U, 0xE9627E44U, 0xC24F2D87U, 0xDB541CC6U,
+        0x94158A01U, 0x8D0EBB40U, 0xA623E883U, 0xBF38D9C2U,
+        0x38A0C50DU, 0x21BBF44CU, 0x0A96A78FU, 0x138D96CEU,
+        0x5CCC0009U, 0x45D73148U, 0x6EFA628BU, 0x77E153CAU,
+        0xBABB5D54U, 0xA3A06C15U, 0x888D3FD6U, 0x91960E97U,
+        0xDED79850U, 0xC7CCA911U, 0xECE1FAD2U, 0xF5FACB93U,
+        0x7262D75CU, 0x6B79E61DU, 0x4054B5DEU, 0x594F849FU,
+        0x160E1258U, 0x0F152319U, 0x243870DAU, 0x3D23419BU,
+        0x65FD6BA7U, 0x7CE65AE6U, 0x57CB0925U, 0x4ED03864U,
+        0x0191AEA3U, 0x188A9FE2U, 0x33A7CC21U, 0x2ABCFD60U,
+        0xAD24E1AFU, 0xB43FD0EEU, 0x9F12832DU, 0x8609B26CU,
+        0xC94824ABU, 0xD05315EAU, 0xFB7E4629U, 0xE2657768U,
+        0x2F3F79F6U, 0x362448B7U, 0x1D091B74U, 0x04122A35U,
+        0x4B53BCF2U, 0x52488DB3U, 0x7965DE70U, 0x607EEF31U,
+        0xE7E6F3FEU, 0xFEFDC2BFU, 0xD5D0917CU, 0xCCCBA03DU,
+        0x838A36FAU, 0x9A9107BBU, 0xB1BC5478U, 0xA8A76539U,
+        0x3B83984BU, 0x2298A90AU, 0x09B5FAC9U, 0x10AECB88U,
+        0x5FEF5D4FU, 0x46F46C0EU, 0x6DD93FCDU, 0x74C20E8CU,
+        0xF35A1243U, 0xEA412302U, 0xC16C70C1U, 0xD8774180U,
+        0x9736D747U, 0x8E2DE606U, 0xA500B5C5U, 0xBC1B8484U,
+        0x71418A1AU, 0x685ABB5BU, 0x4377E898U, 0x5A6CD9D9U,
+        0x152D4F1EU, 0x0C367E5FU, 0x271B2D9CU, 0x3E001CDDU,
+        0xB9980012U, 0xA0833153U, 0x8BAE6290U, 0x92B553D1U,
+        0xDDF4C516U, 0xC4EFF457U, 0xEFC2A794U, 0xF6D996D5U,
+        0xAE07BCE9U, 0xB71C8DA8U, 0x9C31DE6BU, 0x852AEF2AU,
+        0xCA6B79EDU, 0xD37048ACU, 0xF85D1B6FU, 0xE1462A2EU,
+        0x66DE36E1U, 0x7FC507A0U, 0x54E85463U, 0x4DF36522U,
+        0x02B2F3E5U, 0x1BA9C2A4U, 0x30849167U, 0x299FA026U,
+        0xE4C5AEB8U, 0xFDDE9FF9U, 0xD6F3CC3AU, 0xCFE8FD7BU,
+        0x80A96BBCU, 0x99B25AFDU, 0xB29F093EU, 0xAB84387FU,
+        0x2C1C24B0U, 0x350715F1U, 0x1E2A4632U, 0x07317773U,
+        0x4870E1B4U, 0x516BD0F5U, 0x7A468336U, 0x635DB277U,
+        0xCBFAD74EU, 0xD2E1E60FU, 0xF9CCB5CCU, 0xE0D7848DU,
+        0xAF96124AU, 0xB68D230BU, 0x9DA070C8U, 0x84BB4189U,
+        0x03235D46U, 0x1A386C07U, 0x31153FC4U, 0x280E0E85U,
+        0x674F9842U, 0x7E54A903U, 0x5579FAC0U, 0x4C62CB81U,
+        0x8138C51FU, 0x9823F45EU, 0xB30EA79DU, 0xAA1596DCU,
+        0xE554001BU, 0xFC4F315AU, 0xD7626299U, 0xCE7953D8U,
+        0x49E14F17U, 0x50FA7E56U, 0x7BD72D95U, 0x62CC1CD4U,
+        0x2D8D8A13U, 0x3496BB52U, 0x1FBBE891U, 0x06A0D9D0U,
+        0x5E7EF3ECU, 0x4765C2ADU, 0x6C48916EU, 0x7553A02FU,
+        0x3A1236E8U, 0x230907A9U, 0x0824546AU, 0x113F652BU,
+        0x96A779E4U, 0x8FBC48A5U, 0xA4911B66U, 0xBD8A2A27U,
+        0xF2CBBCE0U, 0xEBD08DA1U, 0xC0FDDE62U, 0xD9E6EF23U,
+        0x14BCE1BDU, 0x0DA7D0FCU, 0x268A833FU, 0x3F91B27EU,
+        0x70D024B9U, 0x69CB15F8U, 0x42E6463BU, 0x5BFD777AU,
+        0xDC656BB5U, 0xC57E5AF4U, 0xEE530937U, 0xF7483876U,
+        0xB809AEB1U, 0xA1129FF0U, 0x8A3FCC33U, 0x9324FD72U
+    },
+    {
+        0x2144DF1CU, 0x5643EF8AU, 0xCF4ABE30U, 0xB84D8EA6U,
+        0x26291B05U, 0x512E2B93U, 0xC8277A29U, 0xBF204ABFU,
+        0x2F9F572EU, 0x589867B8U, 0xC1913602U, 0xB6960694U,
+        0x28F29337U, 0x5FF5A3A1U, 0xC6FCF21BU, 0xB1FBC28DU,
+        0x3CF3CF78U, 0x4BF4FFEEU, 0xD2FDAE54U, 0xA5FA9EC2U,
+        0x3B9E0B61U, 0x4C993BF7U, 0xD5906A4DU, 0xA2975ADBU,
+        0x3228474AU, 0x452F77DCU, 0xDC262666U, 0xAB2116F0U,
+        0x35458353U, 0x4242B3C5U, 0xDB4BE27FU, 0xAC4CD2E9U,
+        0x1A2AFFD4U, 0x6D2DCF42U, 0xF4249EF8U, 0x8323AE6EU,
+        0x1D473BCDU, 0x6A400B5BU, 0xF3495AE1U, 0x844E6A77U,
+        0x14F177E6U, 0x63F64770U, 0xFAFF16CAU, 0x8DF8265CU,
+        0x139CB3FFU, 0x649B8369U, 0xFD92D2D3U, 0x8A95E245U,
+        0x079DEFB0U, 0x709ADF26U, 0xE9938E9CU, 0x9E94BE0AU,
+        0x00F02BA9U, 0x77F71B3FU, 0xEEFE4A85U, 0x99F97A13U,
+        0x09466782U, 0x7E415714U, 0xE74806AEU, 0x904F3638U,
+        0x0E2BA39BU, 0x792C930DU, 0xE025C2B7U, 0x9722F221U,
+        0x57989E8CU, 0x209FAE1AU, 0xB996FFA0U, 0xCE91CF36U,
+        0x50F55A95U, 0x27F26A03U, 0xBEFB3BB9U, 0xC9FC0B2FU,
+        0x594316BEU, 0x2E442628U, 0xB74D7792U, 0xC04A4704U,
+        0x5E2ED2A7U, 0x2929E231U, 0xB020B38BU, 0xC727831DU,
+        0x4A2F8EE8U, 0x3D28BE7EU, 0xA421EFC4U, 0xD326DF52U,
+        0x4D424AF1U, 0x3A457A67U, 0xA34C2BDDU, 0xD44B1B4BU,
+        0x44F406DAU, 0x33F3364CU, 0xAAFA67F6U, 0xDDFD5760U,
+        0x4399C2C3U, 0x349EF255U, 0xAD97A3EFU, 0xDA909379U,
+        0x6CF6BE44U, 0x1BF18ED2U, 0x82F8DF68U, 0xF5FFEFFEU,
+        0x6B9B7A5DU, 0x1C9C4ACBU, 0x85951B71U, 0xF2922BE7U,
+        0x622D3676U, 0x152A06E0U, 0x8C23575AU, 0xFB2467CCU,
+        0x6540F26FU, 0x1247C2F9U, 0x8B4E9343U, 0xFC49A3D5U,
+        0x7141AE20U, 0x06469EB6U, 0x9F4FCF0CU, 0xE848FF9AU,
+        0x762C6A39U, 0x012B5AAFU, 0x98220B15U, 0xEF253B83U,
+        0x7F9A2612U, 0x089D1684U, 0x9194473EU, 0xE69377A8U,
+        0x78F7E20BU, 0x0FF0D29DU, 0x96F98327U, 0xE1FEB3B1U,
+        0xCCFC5C3CU, 0xBBFB6CAAU, 0x22F23D10U, 0x55F50D86U,
+        0xCB919825U, 0xBC96A8B3U, 0x259FF909U, 0x5298C99FU,
+        0xC227D40EU, 0xB520E498U, 0x2C29B522U, 0x5B2E85B4U,
+        0xC54A1017U, 0xB24D2081U, 0x2B44713BU, 0x5C4341ADU,
+        0xD14B4C58U, 0xA64C7CCEU, 0x3F452D74U, 0x48421DE2U,
+        0xD6268841U, 0xA121B8D7U, 0x3828E96DU, 0x4F2FD9FBU,
+        0xDF90C46AU, 0xA897F4FCU, 0x319EA546U, 0x469995D0U,
+        0xD8FD0073U, 0xAFFA30E5U, 0x36F3615FU, 0x41F451C9U,
+        0xF7927CF4U, 0x80954C62U, 0x199C1DD8U, 0x6E9B2D4EU,
+        0xF0FFB8EDU, 0x87F8887BU, 0x1EF1D9C1U, 0x69F6E957U,
+        0xF949F4C6U, 0x8E4EC450U, 0x174795EAU, 0x6040A57CU,
+        0xFE2430DFU, 0x89230049U, 0x102A51F3U, 0x672D6165U,
+        0xEA256C90U, 0x9D225C06U, 0x042B0DBCU, 0x732C3D2AU,
+        0xED48A889U, 0x9A4F981FU, 0x0346C9A5U, 0x7441F933U,
+        0xE4FEE4A2U, 0x93F9D434U, 0x0AF0858EU, 0x7DF7B518U,
+        0xE39320BBU, 0x9494102DU, 0x0D9D4197U, 0x7A9A7101U,
+        0xBA201DACU, 0xCD272D3AU, 0x542E7C80U, 0x23294C16U,
+        0xBD4DD9B5U, 0xCA4AE923U, 0x5343B899U, 0x2444880FU,
+        0xB4FB959EU, 0xC3FCA508U, 0x5AF5F4B2U, 0x2DF2C424U,
+        0xB3965187U, 0xC4916111U, 0x5D9830ABU, 0x2A9F003DU,
+        0xA7970DC8U, 0xD0903D5EU, 0x49996CE4U, 0x3E9E5C72U,
+        0xA0FAC9D1U, 0xD7FDF947U, 0x4EF4A8FDU, 0x39F3986BU,
+        0xA94C85FAU, 0xDE4BB56CU, 0x4742E4D6U, 0x3045D440U,
+        0xAE2141E3U, 0xD9267175U, 0x402F20CFU, 0x37281059U,
+        0x814E3D64U, 0xF6490DF2U, 0x6F405C48U, 0x18476CDEU,
+        0x8623F97DU, 0xF124C9EBU, 0x682D9851U, 0x1F2AA8C7U,
+        0x8F95B556U, 0xF89285C0U, 0x619BD47AU, 0x169CE4ECU,
+        0x88F8714FU, 0xFFFF41D9U, 0x66F61063U, 0x11F120F5U,
+        0x9CF92D00U, 0xEBFE1D96U, 0x72F74C2CU, 0x05F07CBAU,
+        0x9B94E919U, 0xEC93D98FU, 0x759A8835U, 0x029DB8A3U,
+        0x9222A532U, 0xE52595A4U, 0x7C2CC41EU, 0x0B2BF488U,
+        0x954F612BU, 0xE24851BDU, 0x7B410007U, 0x0C463091U
+    }
+};
+
 /* Local Functions */
 
+static uint32_t CRC_Crc32Byte(uint32_t crc, uint32_t data);
+static uint32_t CRC_Crc32Word(uint32_t crc, uint32_t data);
+
 /*--------------------------------------------------------------------------*/
 /* Calculate XOR CRC                                                        */
 /*--------------------------------------------------------------------------*/
@@ -70,6 +353,46 @@ uint32_t CRC_Xor(const uint32_t *addr, uint32_t size)
     return crc;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Copy data and calculate XOR CRC                                          */
+/*--------------------------------------------------------------------------*/
+uint32_t CRC_XorCopy(uint32_t *dst, const uint32_t *src, uint32_t size)
+{
+    uint32_t *d = dst;
+    const uint32_t *s = src;
+    uint32_t sz = size / 4U;
+    uint32_t crc = 0U;
+
+    /* Loop over whole words */
+    while (sz > 0U)
+    {
+        uint32_t data = *s;
+
+        /* Copy and update CRC */
+        *d = data;
+        crc ^= data;
+        d++;
+        s++;
+        sz--;
+    }
+
+    /* Copy trailing bytes (not included in CRC) */
+    sz = size % 4U;
+    if (sz > 0U)
+    {
+        uint32_t data = *s;
+        uint8_t *db = (uint8_t*) d;
+
+        for (uint32_t i = 0U; i < sz; i++)
+        {
+            db[i] = (uint8_t) (data >> (i * 8U));
+        }
+    }
+
+    /* Return CRC */
+    return crc;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Calculate J1850                                                          */
 /*--------------------------------------------------------------------------*/
@@ -108,22 +431,26 @@ uint32_t CRC_Crc32(const uint8_t *addr, uint32_t size)
     uint32_t sz = size;
     uint32_t crc = 0U;
 
-    /* Poly table */
-    static uint32_t const s_crcTable[] =
+    /* Process leading bytes up to word alignment */
+    while ((sz > 0U) && ((((uintptr_t) a) & 0x3U) != 0U))
     {
-        0x4DBDF21CU, 0x500AE278U, 0x76D3D2D4U, 0x6B64C2B0U,
-        0x3B61B38CU, 0x26D6A3E8U, 0x000F9344U, 0x1DB88320U,
-        0xA005713CU, 0xBDB26158U, 0x9B6B51F4U, 0x86DC4190U,
-        0xD6D930ACU, 0xCB6E20C8U, 0xEDB71064U, 0xF0000000U
-    };
+        crc = CRC_Crc32Byte(crc, *a);
+        a++;
+        sz--;
+    }
 
-    /* Loop over data */
+    /* Process aligned words */
+    while (sz >= 4U)
+    {
+        crc = CRC_Crc32Word(crc, *((const uint32_t*) a));
+        a = &a[4];
+        sz -= 4U;
+    }
+
+    /* Process trailing bytes */
     while (sz > 0U)
     {
-        crc = (crc >> 4U) ^ s_crcTable[(crc ^ (((uint32_t)(*a)) >> 0U))
-                & 0x0FU];
-        crc = (crc >> 4U) ^ s_crcTable[(crc ^ (((uint32_t) (*a)) >> 4U))
-                & 0x0FU];
+        crc = CRC_Crc32Byte(crc, *a);
         a++;
         sz--;
     }
@@ -132,3 +459,74 @@ uint32_t CRC_Crc32(const uint8_t *addr, uint32_t size)
     return crc;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Copy data and calculate CRC32                                            */
+/*--------------------------------------------------------------------------*/
+uint32_t CRC_Crc32Copy(uint32_t *dst, const uint32_t *src, uint32_t size)
+{
+    uint32_t *d = dst;
+    const uint32_t *s = src;
+    uint32_t sz = size / 4U;
+    uint32_t crc = 0U;
+
+    /* Loop over whole words */
+    while (sz > 0U)
+    {
+        uint32_t data = *s;
+
+        /* Copy and update CRC */
+        *d = data;
+        crc = CRC_Crc32Word(crc, data);
+        d++;
+        s++;
+        sz--;
+    }
+
+    /* Copy trailing bytes from a single word read */
+    sz = size % 4U;
+    if (sz > 0U)
+    {
+        uint32_t data = *s;
+        uint8_t *db = (uint8_t*) d;
+
+        for (uint32_t i = 0U; i < sz; i++)
+        {
+            uint32_t byte = (data >> (i * 8U)) & 0xFFU;
+
+            db[i] = (uint8_t) byte;
+            crc = CRC_Crc32Byte(crc, byte);
+        }
+    }
+
+    /* Return CRC */
+    return crc;
+}
+
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Update CRC32 with one byte                                               */
+/*--------------------------------------------------------------------------*/
+static uint32_t CRC_Crc32Byte(uint32_t crc, uint32_t data)
+{
+    uint32_t c = crc;
+
+    c = (c >> 4U) ^ s_crcNibble[(c ^ (data >> 0U)) & 0x0FU];
+    c = (c >> 4U) ^ s_crcNibble[(c ^ (data >> 4U)) & 0x0FU];
+
+    /* Return CRC */
+    return c;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Update CRC32 with one little-endian word                                 */
+/*--------------------------------------------------------------------------*/
+static uint32_t CRC_Crc32Word(uint32_t crc, uint32_t data)
+{
+    uint32_t x = crc ^ data;
+
+    /* Return CRC */
+    return s_crcSlice[0][x & 0xFFU] ^ s_crcSlice[1][(x >> 8U) & 0xFFU]
+        ^ s_crcSlice[2][(x >> 16U) & 0xFFU] ^ s_crcSlice[3][x >> 24U];
+}
+
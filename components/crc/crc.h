@@ -69,6 +69,21 @@
  */
 uint32_t CRC_Xor(const uint32_t *addr, uint32_t size);
 
+/*!
+ * Copy data and calculate CRC based on 32-bit XOR.
+ *
+ * @param[out] dst   Pointer to destination
+ * @param[in]  src   Pointer to source data to copy and CRC
+ * @param[in]  size  Size of data in bytes
+ *
+ * Single-pass copy with the same CRC as CRC_Xor() of size/4 words.
+ * The source is only read with aligned word accesses so it can be
+ * device memory. Trailing bytes are copied but not included in the CRC.
+ *
+ * @return Returns the checksum.
+ */
+uint32_t CRC_XorCopy(uint32_t *dst, const uint32_t *src, uint32_t size);
+
 /*!
  * Calculate CRC based on the J1850 algorithm.
  *
@@ -94,6 +109,22 @@ uint8_t CRC_J1850(const uint8_t *addr, uint32_t size);
  */
 uint32_t CRC_Crc32(const uint8_t *addr, uint32_t size);
 
+/*!
+ * Copy data and calculate CRC based on the CRC32 algorithm.
+ *
+ * @param[out] dst   Pointer to destination
+ * @param[in]  src   Pointer to source data to copy and CRC
+ * @param[in]  size  Size of data in bytes
+ *
+ * Single-pass copy with the same CRC as CRC_Crc32(). The source is
+ * only read with aligned word accesses so it can be device memory.
+ * Measured slower than memcpy() followed by CRC_Crc32(), which is what
+ * the SMT transport uses.
+ *
+ * @return Returns the CRC.
+ */
+uint32_t CRC_Crc32Copy(uint32_t *dst, const uint32_t *src, uint32_t size);
+
 /** @} */
 
 #endif /* CRC_H */
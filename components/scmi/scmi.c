@@ -292,8 +292,8 @@ int32_t SCMI_P2aRx(uint32_t channel, uint32_t protocolId,
     {
         *header = msg->header;
 
-        /* Check message type */
-        if (SCMI_HEADER_TYPE_EX(*header) != 3U)
+        /* Check message type (delayed response or notification) */
+        if (SCMI_HEADER_TYPE_EX(*header) < 2U)
         {
             status = SCMI_ERR_PROTOCOL_ERROR;
         }
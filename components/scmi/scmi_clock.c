@@ -399,6 +399,108 @@ int32_t SCMI_ClockConfigSet(uint32_t channel, uint32_t clockId,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Configure clock rate change notification                                 */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_ClockRateNotify(uint32_t channel, uint32_t clockId,
+    uint32_t notifyEnable)
+{
+    int32_t status;
+    uint32_t header;
+    void *msg;
+
+    /* Acquire lock */
+    SCMI_A2P_LOCK(channel);
+
+    /* Init buffer */
+    status = SCMI_BufInit(channel, &msg);
+
+    /* Send request */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        /* Request message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t clockId;
+            uint32_t notifyEnable;
+        } msg_tclockd9_t;
+        msg_tclockd9_t *msgTx = (msg_tclockd9_t*) msg;
+
+        /* Fill in parameters */
+        msgTx->clockId = clockId;
+        msgTx->notifyEnable = notifyEnable;
+
+        /* Send message */
+        status = SCMI_A2pTx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_CLOCK_RATE_NOTIFY,
+            sizeof(msg_tclockd9_t), &header);
+    }
+
+    /* Receive response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_A2pRx(channel, sizeof(msg_status_t), header);
+    }
+
+    /* Release lock */
+    SCMI_A2P_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Configure clock rate change requested notification                       */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_ClockRateChangeRequestedNotify(uint32_t channel, uint32_t clockId,
+    uint32_t notifyEnable)
+{
+    int32_t status;
+    uint32_t header;
+    void *msg;
+
+    /* Acquire lock */
+    SCMI_A2P_LOCK(channel);
+
+    /* Init buffer */
+    status = SCMI_BufInit(channel, &msg);
+
+    /* Send request */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        /* Request message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t clockId;
+            uint32_t notifyEnable;
+        } msg_tclockd10_t;
+        msg_tclockd10_t *msgTx = (msg_tclockd10_t*) msg;
+
+        /* Fill in parameters */
+        msgTx->clockId = clockId;
+        msgTx->notifyEnable = notifyEnable;
+
+        /* Send message */
+        status = SCMI_A2pTx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_CLOCK_RATE_CHANGE_REQUESTED_NOTIFY,
+            sizeof(msg_tclockd10_t), &header);
+    }
+
+    /* Receive response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_A2pRx(channel, sizeof(msg_status_t), header);
+    }
+
+    /* Release lock */
+    SCMI_A2P_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Get clock configuration                                                  */
 /*--------------------------------------------------------------------------*/
@@ -761,3 +863,212 @@ int32_t SCMI_ClockNegotiateProtocolVersion(uint32_t channel,
     return SCMI_NegotiateProtocolVersion(channel, COMMAND_PROTOCOL, version);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Read async clock rate set delayed response                               */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_ClockRateSetComplete(uint32_t channel, uint32_t *clockId,
+    scmi_clock_rate_t *rate)
+{
+    int32_t status;
+    uint32_t header;
+    const void *msg;
+
+    /* Acquire lock */
+    SCMI_P2A_LOCK(channel);
+
+    /* Get transport buffer address */
+    msg = SCMI_HdrAddrGet(channel);
+
+    /* Read message */
+    {
+        /* Read message structure */
+        typedef struct
+        {
+            uint32_t header;
+            int32_t status;
+            uint32_t clockId;
+            scmi_clock_rate_t rate;
+        } msg_rclockd5_t;
+        const msg_rclockd5_t *msgRx = (const msg_rclockd5_t*) msg;
+
+        /* Receive message */
+        status = SCMI_P2aRx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_CLOCK_RATE_SET_COMPLETE, sizeof(msg_rclockd5_t),
+            &header);
+
+        /* Copy out if no error */
+        if (status == SCMI_ERR_SUCCESS)
+        {
+            /* Extract clockId */
+            if (clockId != NULL)
+            {
+                *clockId = msgRx->clockId;
+            }
+
+            /* Extract rate */
+            if (rate != NULL)
+            {
+                *rate = msgRx->rate;
+            }
+        }
+
+        /* Send response */
+        if (status == SCMI_ERR_SUCCESS)
+        {
+            int32_t rateStatus = msgRx->status;
+
+            status = SCMI_P2aTx(channel, sizeof(header), header);
+
+            /* Return status of the rate change */
+            if (status == SCMI_ERR_SUCCESS)
+            {
+                status = rateStatus;
+            }
+        }
+    }
+
+    /* Release lock */
+    SCMI_P2A_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Read clock rate change event                                             */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_ClockRateChanged(uint32_t channel, uint32_t *agentId,
+    uint32_t *clockId, scmi_clock_rate_t *rate)
+{
+    int32_t status;
+    uint32_t header;
+    const void *msg;
+
+    /* Acquire lock */
+    SCMI_P2A_LOCK(channel);
+
+    /* Get transport buffer address */
+    msg = SCMI_HdrAddrGet(channel);
+
+    /* Read message */
+    {
+        /* Read message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t agentId;
+            uint32_t clockId;
+            scmi_clock_rate_t rate;
+        } msg_rclockd32_t;
+        const msg_rclockd32_t *msgRx = (const msg_rclockd32_t*) msg;
+
+        /* Receive message */
+        status = SCMI_P2aRx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_CLOCK_RATE_CHANGED, sizeof(msg_rclockd32_t),
+            &header);
+
+        /* Copy out if no error */
+        if (status == SCMI_ERR_SUCCESS)
+        {
+            /* Extract agentId */
+            if (agentId != NULL)
+            {
+                *agentId = msgRx->agentId;
+            }
+
+            /* Extract clockId */
+            if (clockId != NULL)
+            {
+                *clockId = msgRx->clockId;
+            }
+
+            /* Extract rate */
+            if (rate != NULL)
+            {
+                *rate = msgRx->rate;
+            }
+        }
+    }
+
+    /* Send response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_P2aTx(channel, sizeof(header), header);
+    }
+
+    /* Release lock */
+    SCMI_P2A_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Read clock rate change requested event                                   */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_ClockRateChangeRequested(uint32_t channel, uint32_t *agentId,
+    uint32_t *clockId, scmi_clock_rate_t *rate)
+{
+    int32_t status;
+    uint32_t header;
+    const void *msg;
+
+    /* Acquire lock */
+    SCMI_P2A_LOCK(channel);
+
+    /* Get transport buffer address */
+    msg = SCMI_HdrAddrGet(channel);
+
+    /* Read message */
+    {
+        /* Read message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t agentId;
+            uint32_t clockId;
+            scmi_clock_rate_t rate;
+        } msg_rclockd33_t;
+        const msg_rclockd33_t *msgRx = (const msg_rclockd33_t*) msg;
+
+        /* Receive message */
+        status = SCMI_P2aRx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_CLOCK_RATE_CHANGE_REQUESTED, sizeof(msg_rclockd33_t),
+            &header);
+
+        /* Copy out if no error */
+        if (status == SCMI_ERR_SUCCESS)
+        {
+            /* Extract agentId */
+            if (agentId != NULL)
+            {
+                *agentId = msgRx->agentId;
+            }
+
+            /* Extract clockId */
+            if (clockId != NULL)
+            {
+                *clockId = msgRx->clockId;
+            }
+
+            /* Extract rate */
+            if (rate != NULL)
+            {
+                *rate = msgRx->rate;
+            }
+        }
+    }
+
+    /* Send response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_P2aTx(channel, sizeof(header), header);
+    }
+
+    /* Release lock */
+    SCMI_P2A_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
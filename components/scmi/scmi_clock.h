@@ -62,6 +62,10 @@
 #define SCMI_MSG_CLOCK_RATE_GET              0x6U
 /*! Set clock configuration */
 #define SCMI_MSG_CLOCK_CONFIG_SET            0x7U
+/*! Configure clock rate change notification */
+#define SCMI_MSG_CLOCK_RATE_NOTIFY           0x9U
+/*! Configure clock rate change requested notification */
+#define SCMI_MSG_CLOCK_RATE_CHANGE_REQUESTED_NOTIFY  0xAU
 /*! Get clock configuration */
 #define SCMI_MSG_CLOCK_CONFIG_GET            0xBU
 /*! Get all possible parents */
@@ -72,6 +76,12 @@
 #define SCMI_MSG_CLOCK_PARENT_GET            0xEU
 /*! Get clock permissions */
 #define SCMI_MSG_CLOCK_GET_PERMISSIONS       0xFU
+/*! Async clock rate set complete (delayed response) */
+#define SCMI_MSG_CLOCK_RATE_SET_COMPLETE     0x5U
+/*! Read clock rate change event */
+#define SCMI_MSG_CLOCK_RATE_CHANGED          0x0U
+/*! Read clock rate change requested event */
+#define SCMI_MSG_CLOCK_RATE_CHANGE_REQUESTED  0x1U
 /** @} */
 
 /*!
@@ -108,6 +118,14 @@
 #define SCMI_CLOCK_ROUND_AUTO  2U
 /** @} */
 
+/*!
+ * @name SCMI clock extended config types
+ */
+/** @{ */
+/*! Rate set selects the best parent (vendor, value 1 = enable) */
+#define SCMI_CLOCK_EXT_CONFIG_PARENT_SEL  0x80U
+/** @} */
+
 /* Macros */
 
 /*!
@@ -213,6 +231,14 @@
 #define SCMI_CLOCK_PERM_RATE(x)    (((x) & 0x20000000U) >> 29U)
 /** @} */
 
+/*!
+ * @name SCMI clock notification enable
+ */
+/** @{ */
+/*! Notify enable */
+#define SCMI_CLOCK_NOTIFY_ENABLE(x)  (((x) & 0x1U) << 0U)
+/** @} */
+
 /* Types */
 
 /*!
@@ -505,7 +531,10 @@ int32_t SCMI_ClockDescribeRates(uint32_t channel, uint32_t clockId,
  *
  * The function returns when the clock rate has been changed. If a clock is in
  * disabled state, the new rate takes effect when the clock has been
- * re-enabled. An example rounding value is ::SCMI_CLOCK_ROUND_DOWN. See
+ * re-enabled. If the async flag is set, the function returns once the request
+ * is queued. Completion is then reported on the P2A notify channel and read
+ * with SCMI_ClockRateSetComplete() unless the ignore delayed response flag is
+ * also set. An example rounding value is ::SCMI_CLOCK_ROUND_DOWN. See
  * section 4.6.2.7 CLOCK_RATE_SET in the [SCMI Spec](@ref DOCS).
  *
  * Access macros:
@@ -597,6 +626,12 @@ int32_t SCMI_ClockRateGet(uint32_t channel, uint32_t clockId,
  * agents request it be enabled. See section 4.6.2.9 CLOCK_CONFIG_SET in the
  * [SCMI Spec](@ref DOCS).
  *
+ * The ::SCMI_CLOCK_EXT_CONFIG_PARENT_SEL extended config type is supported
+ * by clocks with parents. If set to 1, SCMI_ClockRateSet() from this agent
+ * searches all enabled parents and dividers of the clock for the rate
+ * closest to the request under the rounding rule, and switches parent if
+ * required. Set to 0 to adjust only the divider of the current parent.
+ *
  * Access macros:
  * - ::SCMI_CLOCK_CONFIG_SET_EXT_CONFIG() - Extended config type
  * - ::SCMI_CLOCK_CONFIG_SET_ENABLE() - Enable/Disable
@@ -616,6 +651,68 @@ int32_t SCMI_ClockRateGet(uint32_t channel, uint32_t clockId,
 int32_t SCMI_ClockConfigSet(uint32_t channel, uint32_t clockId,
     uint32_t attributes, uint32_t extendedConfigVal);
 
+/*!
+ * Configure clock rate change notification.
+ *
+ * @param[in]     channel       A2P channel for comms
+ * @param[in]     clockId       Identifier for the clock device
+ * @param[in]     notifyEnable  Notification flags:<BR>
+ *                              Bits[31:1] Reserved, must be zero.<BR>
+ *                              Bit[0] Notify enable
+ *
+ * This function allows the caller to request a SCMI_ClockRateChanged()
+ * notification whenever the rate of a clock changes. This includes changes
+ * made on behalf of other agents or LMs and changes of a parent clock. See
+ * section 4.6.2.12 CLOCK_RATE_NOTIFY in the [SCMI Spec](@ref DOCS).
+ *
+ * Access macros:
+ * - ::SCMI_CLOCK_NOTIFY_ENABLE() - Notify enable
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the notification state was successfully updated.
+ * - ::SCMI_ERR_NOT_FOUND: if the clock identified by \a clockId does not
+ *   exist.
+ * - ::SCMI_ERR_DENIED: if the calling agent is not permitted to request the
+ *   notification.
+ * - ::SCMI_ERR_INVALID_PARAMETERS: if notifyEnable specifies values that
+ *   are either illegal or incorrect.
+ */
+int32_t SCMI_ClockRateNotify(uint32_t channel, uint32_t clockId,
+    uint32_t notifyEnable);
+
+/*!
+ * Configure clock rate change requested notification.
+ *
+ * @param[in]     channel       A2P channel for comms
+ * @param[in]     clockId       Identifier for the clock device
+ * @param[in]     notifyEnable  Notification flags:<BR>
+ *                              Bits[31:1] Reserved, must be zero.<BR>
+ *                              Bit[0] Notify enable
+ *
+ * This function allows the caller to request a
+ * SCMI_ClockRateChangeRequested() notification whenever another agent of
+ * the same LM requests a rate for a clock. See section 4.6.2.13
+ * CLOCK_RATE_CHANGE_REQUESTED_NOTIFY in the [SCMI Spec](@ref DOCS).
+ *
+ * Access macros:
+ * - ::SCMI_CLOCK_NOTIFY_ENABLE() - Notify enable
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the notification state was successfully updated.
+ * - ::SCMI_ERR_NOT_FOUND: if the clock identified by \a clockId does not
+ *   exist.
+ * - ::SCMI_ERR_DENIED: if the calling agent is not permitted to request the
+ *   notification.
+ * - ::SCMI_ERR_INVALID_PARAMETERS: if notifyEnable specifies values that
+ *   are either illegal or incorrect.
+ */
+int32_t SCMI_ClockRateChangeRequestedNotify(uint32_t channel,
+    uint32_t clockId, uint32_t notifyEnable);
+
 /*!
  * Get clock configuration.
  *
@@ -841,6 +938,79 @@ int32_t SCMI_ClockGetPermissions(uint32_t channel, uint32_t clockId,
 int32_t SCMI_ClockNegotiateProtocolVersion(uint32_t channel,
     uint32_t version);
 
+/*!
+ * Read async clock rate set delayed response.
+ *
+ * @param[in]     channel  P2A notify channel for comms.
+ * @param[out]    clockId  Identifier for the clock device
+ * @param[out]    rate     Clock rate that was set:<BR>
+ *                         Lower word: Lower 32 bits of the physical rate in
+ *                         Hertz.<BR>
+ *                         Upper word: Upper 32 bits of the physical rate in
+ *                         Hertz
+ *
+ * If an agent requested an asynchronous rate change with
+ * SCMI_ClockRateSet(), the platform sends the CLOCK_RATE_SET_COMPLETE
+ * delayed response to the agent once the rate change has been executed.
+ * See section 4.6.3.1 CLOCK_RATE_SET_COMPLETE in the
+ * [SCMI Spec](@ref DOCS).
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the clock rate was set successfully.
+ * - ::SCMI_ERR_PROTOCOL_ERROR: if no delayed response is pending.
+ * - others returned by the rate change, see SCMI_ClockRateSet().
+ */
+int32_t SCMI_ClockRateSetComplete(uint32_t channel, uint32_t *clockId,
+    scmi_clock_rate_t *rate);
+
+/*!
+ * Read clock rate change event.
+ *
+ * @param[in]     channel  P2A notify channel for comms.
+ * @param[out]    agentId  Refers to the agent that caused this event. Always
+ *                         0, the platform is the generator of all clock rate
+ *                         change events.
+ * @param[out]    clockId  Identifier for the clock device
+ * @param[out]    rate     New clock rate:<BR>
+ *                         Lower word: Lower 32 bits of the physical rate in
+ *                         Hertz.<BR>
+ *                         Upper word: Upper 32 bits of the physical rate in
+ *                         Hertz
+ *
+ * This notification is issued by the platform when the rate of a clock
+ * changes and the agent has requested it using SCMI_ClockRateNotify(). See
+ * section 4.6.4.1 CLOCK_RATE_CHANGED in the [SCMI Spec](@ref DOCS).
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ */
+int32_t SCMI_ClockRateChanged(uint32_t channel, uint32_t *agentId,
+    uint32_t *clockId, scmi_clock_rate_t *rate);
+
+/*!
+ * Read clock rate change requested event.
+ *
+ * @param[in]     channel  P2A notify channel for comms.
+ * @param[out]    agentId  Identifier of the agent that requested the rate
+ *                         change
+ * @param[out]    clockId  Identifier for the clock device
+ * @param[out]    rate     Requested clock rate:<BR>
+ *                         Lower word: Lower 32 bits of the physical rate in
+ *                         Hertz.<BR>
+ *                         Upper word: Upper 32 bits of the physical rate in
+ *                         Hertz
+ *
+ * This notification is issued by the platform when another agent requests
+ * a rate for a clock and the agent has requested it using
+ * SCMI_ClockRateChangeRequestedNotify(). See section 4.6.4.2
+ * CLOCK_RATE_CHANGE_REQUESTED in the [SCMI Spec](@ref DOCS).
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ */
+int32_t SCMI_ClockRateChangeRequested(uint32_t channel, uint32_t *agentId,
+    uint32_t *clockId, scmi_clock_rate_t *rate);
+
 #endif /* SCMI_CLOCK_H */
 
 /** @} */
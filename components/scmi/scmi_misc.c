@@ -717,6 +717,352 @@ int32_t SCMI_MiscSiInfo(uint32_t channel, uint32_t *deviceId,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Execute a batch of commands                                              */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_MiscBatch(uint32_t channel, uint32_t flags, uint32_t numCmds,
+    uint32_t numWords, const uint32_t *cmds, uint32_t *numStatus,
+    int32_t *cmdStatus)
+{
+    int32_t status = SCMI_ERR_SUCCESS;
+    uint32_t header;
+    void *msg;
+
+    /* Response message structure */
+    typedef struct
+    {
+        uint32_t header;
+        int32_t status;
+        uint32_t numStatus;
+        int32_t cmdStatus[SCMI_MISC_MAX_STATUS];
+    } msg_rmiscd12_t;
+
+    /* Check command list size */
+    if (numWords > SCMI_MISC_MAX_CMDS_T)
+    {
+        status = SCMI_ERR_INVALID_PARAMETERS;
+    }
+
+    /* Acquire lock */
+    SCMI_A2P_LOCK(channel);
+
+    /* Init buffer */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_BufInit(channel, &msg);
+    }
+
+    /* Send request */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        /* Request message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t flags;
+            uint32_t numCmds;
+            uint32_t cmds[SCMI_MISC_MAX_CMDS_T];
+        } msg_tmiscd12_t;
+        msg_tmiscd12_t *msgTx = (msg_tmiscd12_t*) msg;
+
+        /* Fill in parameters */
+        msgTx->flags = flags;
+        msgTx->numCmds = numCmds;
+
+        SCMI_MemCpy((uint8_t*) &msgTx->cmds, (const uint8_t*) cmds,
+            (numWords * sizeof(uint32_t)));
+
+        /* Send message */
+        status = SCMI_A2pTx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_MISC_BATCH, (3U + numWords) * sizeof(uint32_t),
+            &header);
+    }
+
+    /* Receive response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_A2pRx(channel,
+            sizeof(msg_status_t) + sizeof(uint32_t), header);
+    }
+
+    /* Copy out if no error */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        const msg_rmiscd12_t *msgRx = (const msg_rmiscd12_t*) msg;
+
+        /* Extract numStatus */
+        if (numStatus != NULL)
+        {
+            *numStatus = msgRx->numStatus;
+        }
+
+        /* Extract cmdStatus */
+        if (cmdStatus != NULL)
+        {
+            SCMI_MemCpy((uint8_t*) cmdStatus, (const uint8_t*)
+                &msgRx->cmdStatus, (SCMI_MISC_NUM_STATUS * sizeof(int32_t)));
+        }
+    }
+
+    /* Release lock */
+    SCMI_A2P_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get notification counters                                                */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_MiscNotifyCounters(uint32_t channel, uint32_t flags,
+    uint32_t *depth, uint32_t *queued, uint32_t *coalesced,
+    uint32_t *dropped)
+{
+    int32_t status;
+    uint32_t header;
+    void *msg;
+
+    /* Response message structure */
+    typedef struct
+    {
+        uint32_t header;
+        int32_t status;
+        uint32_t depth;
+        uint32_t queued;
+        uint32_t coalesced;
+        uint32_t dropped;
+    } msg_rmiscd13_t;
+
+    /* Acquire lock */
+    SCMI_A2P_LOCK(channel);
+
+    /* Init buffer */
+    status = SCMI_BufInit(channel, &msg);
+
+    /* Send request */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        /* Request message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t flags;
+        } msg_tmiscd13_t;
+        msg_tmiscd13_t *msgTx = (msg_tmiscd13_t*) msg;
+
+        /* Fill in parameters */
+        msgTx->flags = flags;
+
+        /* Send message */
+        status = SCMI_A2pTx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_MISC_NOTIFY_COUNTERS, sizeof(msg_tmiscd13_t),
+            &header);
+    }
+
+    /* Receive response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_A2pRx(channel, sizeof(msg_rmiscd13_t), header);
+    }
+
+    /* Copy out if no error */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        const msg_rmiscd13_t *msgRx = (const msg_rmiscd13_t*) msg;
+
+        /* Extract depth */
+        if (depth != NULL)
+        {
+            *depth = msgRx->depth;
+        }
+
+        /* Extract queued */
+        if (queued != NULL)
+        {
+            *queued = msgRx->queued;
+        }
+
+        /* Extract coalesced */
+        if (coalesced != NULL)
+        {
+            *coalesced = msgRx->coalesced;
+        }
+
+        /* Extract dropped */
+        if (dropped != NULL)
+        {
+            *dropped = msgRx->dropped;
+        }
+    }
+
+    /* Release lock */
+    SCMI_A2P_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get SCMI service time statistics                                         */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_MiscScmiStats(uint32_t channel, uint32_t type, uint32_t index,
+    uint32_t *id, uint32_t *count, uint32_t *errors, uint32_t *minTime,
+    uint32_t *avgTime, uint32_t *maxTime, uint32_t *hist)
+{
+    int32_t status;
+    uint32_t header;
+    void *msg;
+
+    /* Response message structure */
+    typedef struct
+    {
+        uint32_t header;
+        int32_t status;
+        uint32_t id;
+        uint32_t count;
+        uint32_t errors;
+        uint32_t minTime;
+        uint32_t avgTime;
+        uint32_t maxTime;
+        uint32_t hist[SCMI_MISC_MAX_HIST];
+    } msg_rmiscd14_t;
+
+    /* Acquire lock */
+    SCMI_A2P_LOCK(channel);
+
+    /* Init buffer */
+    status = SCMI_BufInit(channel, &msg);
+
+    /* Send request */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        /* Request message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t type;
+            uint32_t index;
+        } msg_tmiscd14_t;
+        msg_tmiscd14_t *msgTx = (msg_tmiscd14_t*) msg;
+
+        /* Fill in parameters */
+        msgTx->type = type;
+        msgTx->index = index;
+
+        /* Send message */
+        status = SCMI_A2pTx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_MISC_SCMI_STATS, sizeof(msg_tmiscd14_t), &header);
+    }
+
+    /* Receive response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_A2pRx(channel, sizeof(msg_rmiscd14_t), header);
+    }
+
+    /* Copy out if no error */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        const msg_rmiscd14_t *msgRx = (const msg_rmiscd14_t*) msg;
+
+        /* Extract id */
+        if (id != NULL)
+        {
+            *id = msgRx->id;
+        }
+
+        /* Extract count */
+        if (count != NULL)
+        {
+            *count = msgRx->count;
+        }
+
+        /* Extract errors */
+        if (errors != NULL)
+        {
+            *errors = msgRx->errors;
+        }
+
+        /* Extract minTime */
+        if (minTime != NULL)
+        {
+            *minTime = msgRx->minTime;
+        }
+
+        /* Extract avgTime */
+        if (avgTime != NULL)
+        {
+            *avgTime = msgRx->avgTime;
+        }
+
+        /* Extract maxTime */
+        if (maxTime != NULL)
+        {
+            *maxTime = msgRx->maxTime;
+        }
+
+        /* Extract hist */
+        if (hist != NULL)
+        {
+            SCMI_MemCpy((uint8_t*) hist, (const uint8_t*) &msgRx->hist,
+                (SCMI_MISC_MAX_HIST * sizeof(uint32_t)));
+        }
+    }
+
+    /* Release lock */
+    SCMI_A2P_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Configure packed notifications                                           */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_MiscNotifyPack(uint32_t channel, uint32_t flags)
+{
+    int32_t status;
+    uint32_t header;
+    void *msg;
+
+    /* Acquire lock */
+    SCMI_A2P_LOCK(channel);
+
+    /* Init buffer */
+    status = SCMI_BufInit(channel, &msg);
+
+    /* Send request */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        /* Request message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t flags;
+        } msg_tmiscd15_t;
+        msg_tmiscd15_t *msgTx = (msg_tmiscd15_t*) msg;
+
+        /* Fill in parameters */
+        msgTx->flags = flags;
+
+        /* Send message */
+        status = SCMI_A2pTx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_MISC_NOTIFY_PACK, sizeof(msg_tmiscd15_t), &header);
+    }
+
+    /* Receive response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_A2pRx(channel, sizeof(msg_status_t), header);
+    }
+
+    /* Release lock */
+    SCMI_A2P_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Negotiate the protocol version                                           */
 /*--------------------------------------------------------------------------*/
@@ -788,3 +1134,78 @@ int32_t SCMI_MiscControlEvent(uint32_t channel, uint32_t *ctrlId,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Read packed notification event                                           */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_MiscPackedEvent(uint32_t channel, uint32_t *numEvents,
+    uint32_t *numWords, uint32_t *events)
+{
+    int32_t status;
+    uint32_t header;
+    const void *msg;
+
+    /* Acquire lock */
+    SCMI_P2A_LOCK(channel);
+
+    /* Get transport buffer address */
+    msg = SCMI_HdrAddrGet(channel);
+
+    /* Read message */
+    {
+        /* Read message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t numEvents;
+            uint32_t numWords;
+            uint32_t events[SCMI_MISC_MAX_EVENTS];
+        } msg_rmisced33_t;
+        const msg_rmisced33_t *msgRx = (const msg_rmisced33_t*) msg;
+
+        /* Receive message */
+        status = SCMI_P2aRx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_MISC_PACKED_EVENT, 12U, &header);
+
+        /* Copy out if no error */
+        if (status == SCMI_ERR_SUCCESS)
+        {
+            uint32_t words = msgRx->numWords;
+
+            if (words > SCMI_MISC_MAX_EVENTS)
+            {
+                words = SCMI_MISC_MAX_EVENTS;
+            }
+
+            /* Extract numEvents */
+            if (numEvents != NULL)
+            {
+                *numEvents = msgRx->numEvents;
+            }
+
+            /* Extract numWords */
+            if (numWords != NULL)
+            {
+                *numWords = words;
+            }
+
+            /* Extract events */
+            if (events != NULL)
+            {
+                SCMI_MemCpy((uint8_t*) events, (const uint8_t*)
+                    &msgRx->events, (words * sizeof(uint32_t)));
+            }
+        }
+    }
+
+    /* Send response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_P2aTx(channel, sizeof(header), header);
+    }
+
+    /* Release lock */
+    SCMI_P2A_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
@@ -70,8 +70,18 @@
 #define SCMI_MSG_MISC_RESET_REASON         0xAU
 /*! Get silicon info */
 #define SCMI_MSG_MISC_SI_INFO              0xBU
+/*! Execute a batch of commands */
+#define SCMI_MSG_MISC_BATCH                0xCU
+/*! Get notification counters */
+#define SCMI_MSG_MISC_NOTIFY_COUNTERS      0xDU
+/*! Get SCMI service time statistics */
+#define SCMI_MSG_MISC_SCMI_STATS           0xEU
+/*! Configure packed notifications */
+#define SCMI_MSG_MISC_NOTIFY_PACK          0xFU
 /*! Read control notification event */
 #define SCMI_MSG_MISC_CONTROL_EVENT        0x0U
+/*! Read packed notification event */
+#define SCMI_MSG_MISC_PACKED_EVENT         0x1U
 /** @} */
 
 /*!
@@ -98,6 +108,14 @@
 #define SCMI_MISC_MAX_PASSOVER   SCMI_ARRAY(8U, uint32_t)
 /*! Max number of extended shutdown info words */
 #define SCMI_MISC_MAX_EXTINFO    SCMI_ARRAY(16U, uint32_t)
+/*! Max number of command list words */
+#define SCMI_MISC_MAX_CMDS_T     SCMI_ARRAY(8U, uint32_t)
+/*! Max number of command status words */
+#define SCMI_MISC_MAX_STATUS     SCMI_ARRAY(8U, int32_t)
+/*! Number of service time histogram buckets */
+#define SCMI_MISC_MAX_HIST       8U
+/*! Max number of packed event words */
+#define SCMI_MISC_MAX_EVENTS     SCMI_ARRAY(8U, uint32_t)
 /** @} */
 
 /*!
@@ -116,6 +134,8 @@
 #define SCMI_MISC_NUM_PASSOVER  msgRx->numPassover
 /*! Actual number of extended shutdown info words returned */
 #define SCMI_MISC_NUM_EXTINFO   SCMI_MISC_SHUTDOWN_FLAG_EXT_LEN(msgRx->shutdownFlags)
+/*! Actual number of command status words returned */
+#define SCMI_MISC_NUM_STATUS    msgRx->numStatus
 /** @} */
 
 /* Macros */
@@ -124,6 +144,8 @@
  * @name SCMI misc protocol attributes
  */
 /** @{ */
+/*! Packed notifications supported */
+#define SCMI_MISC_PROTO_ATTR_NOTIFY_PACK(x)  (((x) & 0x1000000U) >> 24U)
 /*! Number of reasons */
 #define SCMI_MISC_PROTO_ATTR_NUM_REASON(x)  (((x) & 0xFF0000U) >> 16U)
 /*! Number of controls */
@@ -138,6 +160,49 @@
 #define SCMI_MISC_REASON_FLAG_SYSTEM(x)  (((x) & 0x1U) << 0U)
 /** @} */
 
+/*!
+ * @name SCMI batch flags
+ */
+/** @{ */
+/*! Stop on error */
+#define SCMI_MISC_BATCH_FLAG_STOP(x)  (((x) & 0x1U) << 0U)
+/** @} */
+
+/*!
+ * @name SCMI notify counter flags
+ */
+/** @{ */
+/*! Reset counters */
+#define SCMI_MISC_NOTIFY_FLAG_RESET(x)  (((x) & 0x1U) << 0U)
+/** @} */
+
+/*!
+ * @name SCMI notify pack flags
+ */
+/** @{ */
+/*! Enable packing */
+#define SCMI_MISC_NOTIFY_PACK_ENABLE(x)  (((x) & 0x1U) << 0U)
+/** @} */
+
+/*!
+ * @name SCMI statistics types
+ */
+/** @{ */
+/*! Channel statistics */
+#define SCMI_MISC_STATS_TYPE_CHANNEL  0U
+/*! Protocol message statistics */
+#define SCMI_MISC_STATS_TYPE_MSG      1U
+/** @} */
+
+/*!
+ * @name SCMI batch command header
+ */
+/** @{ */
+/*! Header of a command in a batch command list */
+#define SCMI_MISC_BATCH_HEADER(p, m)  ((((p) & 0xFFU) << 10U) \
+    | (((m) & 0xFFU) << 0U))
+/** @} */
+
 /*!
  * @name SCMI boot reason flags
  */
@@ -198,7 +263,8 @@ int32_t SCMI_MiscProtocolVersion(uint32_t channel, uint32_t *version);
  *
  * @param[in]     channel     A2P channel for comms
  * @param[out]    attributes  Protocol attributes:<BR>
- *                            Bits[31:24] Reserved, must be zero.<BR>
+ *                            Bits[31:25] Reserved, must be zero.<BR>
+ *                            Bit[24] Packed notifications supported.<BR>
  *                            Bits[23:16] Number of reasons.<BR>
  *                            Bits[15:0] Number of controls
  *
@@ -206,6 +272,7 @@ int32_t SCMI_MiscProtocolVersion(uint32_t channel, uint32_t *version);
  * protocol.
  *
  * Access macros:
+ * - ::SCMI_MISC_PROTO_ATTR_NOTIFY_PACK() - Packed notifications supported
  * - ::SCMI_MISC_PROTO_ATTR_NUM_REASON() - Number of reasons
  * - ::SCMI_MISC_PROTO_ATTR_NUM_CTRL() - Number of controls
  *
@@ -497,6 +564,140 @@ int32_t SCMI_MiscResetReason(uint32_t channel, uint32_t flags,
 int32_t SCMI_MiscSiInfo(uint32_t channel, uint32_t *deviceId,
     uint32_t *siRev, uint32_t *partNum, uint8_t *siName);
 
+/*!
+ * Execute a batch of commands.
+ *
+ * @param[in]     channel    A2P channel for comms
+ * @param[in]     flags      Batch flags:<BR>
+ *                           Bits[31:1] Reserved, must be zero.<BR>
+ *                           Bit[0] Stop on error. Set to 1 to stop executing
+ *                           commands after the first command that fails
+ * @param[in]     numCmds    Number of commands
+ * @param[in]     numWords   Size of the command list in words
+ * @param[in]     cmds       Packed command list
+ * @param[out]    numStatus  Number of commands executed
+ * @param[out]    cmdStatus  Array of command status
+ *
+ * This function allows the calling agent to execute a list of commands with
+ * one message. Each command in \a cmds is a length word followed by the
+ * command message. The length is the size of the message in bytes, including
+ * the header word, and must be a multiple of 4. The header is built with
+ * SCMI_MISC_BATCH_HEADER(). Commands are executed in order with the
+ * permissions of the calling agent. Only the status of each command is
+ * returned. Batches cannot be nested. Max number of command list words is
+ * ::SCMI_MISC_MAX_CMDS_T. Max number of status words is
+ * ::SCMI_MISC_MAX_STATUS.
+ *
+ * Access macros:
+ * - ::SCMI_MISC_BATCH_FLAG_STOP() - Stop on error
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the commands were executed. The status of each
+ *   command is returned in \a cmdStatus.
+ * - ::SCMI_ERR_INVALID_PARAMETERS: if \a numCmds is larger than the status
+ *   array that fits in the channel.
+ * - ::SCMI_ERR_NOT_SUPPORTED: if called from within a batch.
+ * - ::SCMI_ERR_PROTOCOL_ERROR: if the command list is malformed.
+ */
+int32_t SCMI_MiscBatch(uint32_t channel, uint32_t flags, uint32_t numCmds,
+    uint32_t numWords, const uint32_t *cmds, uint32_t *numStatus,
+    int32_t *cmdStatus);
+
+/*!
+ * Get notification counters.
+ *
+ * @param[in]     channel    A2P channel for comms
+ * @param[in]     flags      Counter flags:<BR>
+ *                           Bits[31:1] Reserved, must be zero.<BR>
+ *                           Bit[0] Reset. Set to 1 to reset the counters
+ *                           after reading them
+ * @param[out]    depth      Depth of the notification queue in messages
+ * @param[out]    queued     Number of notifications queued
+ * @param[out]    coalesced  Number of notifications merged into a queued
+ *                           notification for the same resource
+ * @param[out]    dropped    Number of notifications dropped as the queue was
+ *                           full
+ *
+ * This function returns the notification queue counters of the calling
+ * agent. Counters include notifications on the priority channel and
+ * delayed responses.
+ *
+ * Access macros:
+ * - ::SCMI_MISC_NOTIFY_FLAG_RESET() - Reset counters
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ */
+int32_t SCMI_MiscNotifyCounters(uint32_t channel, uint32_t flags,
+    uint32_t *depth, uint32_t *queued, uint32_t *coalesced,
+    uint32_t *dropped);
+
+/*!
+ * Get SCMI service time statistics.
+ *
+ * @param[in]     channel  A2P channel for comms
+ * @param[in]     type     Statistics type:<BR>
+ *                         ::SCMI_MISC_STATS_TYPE_CHANNEL or
+ *                         ::SCMI_MISC_STATS_TYPE_MSG
+ * @param[in]     index    Index of the entry, entries without messages are
+ *                         skipped
+ * @param[out]    id       Channel or protocol/message ID. For channels this
+ *                         is the SCMI channel. For messages bits[15:8] are
+ *                         the protocol ID and bits[7:0] the message ID
+ * @param[out]    count    Number of messages
+ * @param[out]    errors   Number of error responses
+ * @param[out]    minTime  Minimum service time in nS
+ * @param[out]    avgTime  Average service time in nS
+ * @param[out]    maxTime  Maximum service time in nS
+ * @param[out]    hist     Service time histogram (::SCMI_MISC_MAX_HIST
+ *                         words). Entry n counts messages taking less than
+ *                         2^n uS, the last entry counts all longer messages
+ *
+ * This function returns read-only service time statistics for the SCMI
+ * instance of the calling agent. Service time is measured from the
+ * doorbell to the response. Iterate \a index from 0 until
+ * ::SCMI_ERR_NOT_FOUND is returned to read all entries.
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the statistics are returned.
+ * - ::SCMI_ERR_NOT_FOUND: if the index is beyond the last entry.
+ * - ::SCMI_ERR_INVALID_PARAMETERS: if the type is invalid.
+ * - ::SCMI_ERR_NOT_SUPPORTED: if statistics are not built in.
+ */
+int32_t SCMI_MiscScmiStats(uint32_t channel, uint32_t type, uint32_t index,
+    uint32_t *id, uint32_t *count, uint32_t *errors, uint32_t *minTime,
+    uint32_t *avgTime, uint32_t *maxTime, uint32_t *hist);
+
+/*!
+ * Configure packed notifications.
+ *
+ * @param[in]     channel  A2P channel for comms
+ * @param[in]     flags    Pack flags:<BR>
+ *                         Bits[31:1] Reserved, must be zero.<BR>
+ *                         Bit[0] Enable. Set to 1 to receive packed
+ *                         notifications
+ *
+ * This function configures how notifications are sent to the calling
+ * agent. When enabled, several notifications queued for the agent are
+ * sent together in one notification read with SCMI_MiscPackedEvent().
+ * A single queued notification and delayed responses are still sent
+ * as-is. Packing is disabled when the agent is reset. Support is
+ * indicated by ::SCMI_MISC_PROTO_ATTR_NOTIFY_PACK().
+ *
+ * Access macros:
+ * - ::SCMI_MISC_NOTIFY_PACK_ENABLE() - Enable packing
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if packing is configured.
+ * - ::SCMI_ERR_INVALID_PARAMETERS: if reserved flags are set.
+ */
+int32_t SCMI_MiscNotifyPack(uint32_t channel, uint32_t flags);
+
 /*!
  * Negotiate the protocol version.
  *
@@ -539,6 +740,26 @@ int32_t SCMI_MiscNegotiateProtocolVersion(uint32_t channel,
 int32_t SCMI_MiscControlEvent(uint32_t channel, uint32_t *ctrlId,
     uint32_t *flags);
 
+/*!
+ * Read packed notification event.
+ *
+ * @param[in]     channel    P2A notify channel for comms.
+ * @param[out]    numEvents  Number of packed notifications.
+ * @param[out]    numWords   Number of event words.
+ * @param[out]    events     Event words. Each notification is its header
+ *                           (token is zero), its payload length in bytes,
+ *                           and its payload words.
+ *
+ * If an agent has enabled packing with SCMI_MiscNotifyPack(), the
+ * platform sends this notification when several notifications are
+ * queued for the agent. Max number of event words is
+ * ::SCMI_MISC_MAX_EVENTS.
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ */
+int32_t SCMI_MiscPackedEvent(uint32_t channel, uint32_t *numEvents,
+    uint32_t *numWords, uint32_t *events);
+
 #endif /* SCMI_MISC_H */
 
 /** @} */
@@ -566,6 +566,215 @@ int32_t SCMI_PerformanceLevelGet(uint32_t channel, uint32_t domainId,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Configure performance limits notification                                */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_PerformanceNotifyLimits(uint32_t channel, uint32_t domainId,
+    uint32_t notifyEnable)
+{
+    int32_t status;
+    uint32_t header;
+    void *msg;
+
+    /* Acquire lock */
+    SCMI_A2P_LOCK(channel);
+
+    /* Init buffer */
+    status = SCMI_BufInit(channel, &msg);
+
+    /* Send request */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        /* Request message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t domainId;
+            uint32_t notifyEnable;
+        } msg_tperfd9_t;
+        msg_tperfd9_t *msgTx = (msg_tperfd9_t*) msg;
+
+        /* Fill in parameters */
+        msgTx->domainId = domainId;
+        msgTx->notifyEnable = notifyEnable;
+
+        /* Send message */
+        status = SCMI_A2pTx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_PERFORMANCE_NOTIFY_LIMITS, sizeof(msg_tperfd9_t),
+            &header);
+    }
+
+    /* Receive response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_A2pRx(channel, sizeof(msg_status_t), header);
+    }
+
+    /* Release lock */
+    SCMI_A2P_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Configure performance level notification                                 */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_PerformanceNotifyLevel(uint32_t channel, uint32_t domainId,
+    uint32_t notifyEnable)
+{
+    int32_t status;
+    uint32_t header;
+    void *msg;
+
+    /* Acquire lock */
+    SCMI_A2P_LOCK(channel);
+
+    /* Init buffer */
+    status = SCMI_BufInit(channel, &msg);
+
+    /* Send request */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        /* Request message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t domainId;
+            uint32_t notifyEnable;
+        } msg_tperfd10_t;
+        msg_tperfd10_t *msgTx = (msg_tperfd10_t*) msg;
+
+        /* Fill in parameters */
+        msgTx->domainId = domainId;
+        msgTx->notifyEnable = notifyEnable;
+
+        /* Send message */
+        status = SCMI_A2pTx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_PERFORMANCE_NOTIFY_LEVEL, sizeof(msg_tperfd10_t),
+            &header);
+    }
+
+    /* Receive response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_A2pRx(channel, sizeof(msg_status_t), header);
+    }
+
+    /* Release lock */
+    SCMI_A2P_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get performance FastChannel info                                         */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_PerformanceDescribeFastchannel(uint32_t channel,
+    uint32_t domainId, uint32_t messageId, uint32_t *attributes,
+    uint32_t *rateLimit, uint32_t *chanAddrLow, uint32_t *chanAddrHigh,
+    uint32_t *chanSize)
+{
+    int32_t status;
+    uint32_t header;
+    void *msg;
+
+    /* Response message structure */
+    typedef struct
+    {
+        uint32_t header;
+        int32_t status;
+        uint32_t attributes;
+        uint32_t rateLimit;
+        uint32_t chanAddrLow;
+        uint32_t chanAddrHigh;
+        uint32_t chanSize;
+        uint32_t doorbellAddrLow;
+        uint32_t doorbellAddrHigh;
+        uint32_t doorbellSetMaskLow;
+        uint32_t doorbellSetMaskHigh;
+        uint32_t doorbellPreserveMaskLow;
+        uint32_t doorbellPreserveMaskHigh;
+    } msg_rperfd11_t;
+
+    /* Acquire lock */
+    SCMI_A2P_LOCK(channel);
+
+    /* Init buffer */
+    status = SCMI_BufInit(channel, &msg);
+
+    /* Send request */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        /* Request message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t domainId;
+            uint32_t messageId;
+        } msg_tperfd11_t;
+        msg_tperfd11_t *msgTx = (msg_tperfd11_t*) msg;
+
+        /* Fill in parameters */
+        msgTx->domainId = domainId;
+        msgTx->messageId = messageId;
+
+        /* Send message */
+        status = SCMI_A2pTx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_PERFORMANCE_DESCRIBE_FASTCHANNEL,
+            sizeof(msg_tperfd11_t), &header);
+    }
+
+    /* Receive response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_A2pRx(channel, sizeof(msg_rperfd11_t), header);
+    }
+
+    /* Copy out if no error */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        const msg_rperfd11_t *msgRx = (const msg_rperfd11_t*) msg;
+
+        /* Extract attributes */
+        if (attributes != NULL)
+        {
+            *attributes = msgRx->attributes;
+        }
+
+        /* Extract rateLimit */
+        if (rateLimit != NULL)
+        {
+            *rateLimit = msgRx->rateLimit;
+        }
+
+        /* Extract chanAddrLow */
+        if (chanAddrLow != NULL)
+        {
+            *chanAddrLow = msgRx->chanAddrLow;
+        }
+
+        /* Extract chanAddrHigh */
+        if (chanAddrHigh != NULL)
+        {
+            *chanAddrHigh = msgRx->chanAddrHigh;
+        }
+
+        /* Extract chanSize */
+        if (chanSize != NULL)
+        {
+            *chanSize = msgRx->chanSize;
+        }
+    }
+
+    /* Release lock */
+    SCMI_A2P_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Negotiate the protocol version                                           */
 /*--------------------------------------------------------------------------*/
@@ -576,3 +785,72 @@ int32_t SCMI_PerfNegotiateProtocolVersion(uint32_t channel,
     return SCMI_NegotiateProtocolVersion(channel, COMMAND_PROTOCOL, version);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Read performance level change event                                      */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_PerformanceLevelChanged(uint32_t channel, uint32_t *agentId,
+    uint32_t *domainId, uint32_t *performanceLevel)
+{
+    int32_t status;
+    uint32_t header;
+    const void *msg;
+
+    /* Acquire lock */
+    SCMI_P2A_LOCK(channel);
+
+    /* Get transport buffer address */
+    msg = SCMI_HdrAddrGet(channel);
+
+    /* Read message */
+    {
+        /* Read message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t agentId;
+            uint32_t domainId;
+            uint32_t performanceLevel;
+        } msg_rperfd33_t;
+        const msg_rperfd33_t *msgRx = (const msg_rperfd33_t*) msg;
+
+        /* Receive message */
+        status = SCMI_P2aRx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_PERFORMANCE_LEVEL_CHANGED, sizeof(msg_rperfd33_t),
+            &header);
+
+        /* Copy out if no error */
+        if (status == SCMI_ERR_SUCCESS)
+        {
+            /* Extract agentId */
+            if (agentId != NULL)
+            {
+                *agentId = msgRx->agentId;
+            }
+
+            /* Extract domainId */
+            if (domainId != NULL)
+            {
+                *domainId = msgRx->domainId;
+            }
+
+            /* Extract performanceLevel */
+            if (performanceLevel != NULL)
+            {
+                *performanceLevel = msgRx->performanceLevel;
+            }
+        }
+    }
+
+    /* Send response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_P2aTx(channel, sizeof(header), header);
+    }
+
+    /* Release lock */
+    SCMI_P2A_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
@@ -64,6 +64,14 @@
 #define SCMI_MSG_PERFORMANCE_LEVEL_SET          0x7U
 /*! Get performance level */
 #define SCMI_MSG_PERFORMANCE_LEVEL_GET          0x8U
+/*! Configure performance limits notification */
+#define SCMI_MSG_PERFORMANCE_NOTIFY_LIMITS      0x9U
+/*! Configure performance level notification */
+#define SCMI_MSG_PERFORMANCE_NOTIFY_LEVEL       0xAU
+/*! Get performance FastChannel info */
+#define SCMI_MSG_PERFORMANCE_DESCRIBE_FASTCHANNEL  0xBU
+/*! Read performance level change event */
+#define SCMI_MSG_PERFORMANCE_LEVEL_CHANGED      0x1U
 /** @} */
 
 /*!
@@ -156,6 +164,22 @@
 #define SCMI_PERF_NUM_LEVELS_NUM_LEVELS(x)      (((x) & 0xFFFU) >> 0U)
 /** @} */
 
+/*!
+ * @name SCMI performance FastChannel attributes
+ */
+/** @{ */
+/*! Doorbell support */
+#define SCMI_PERF_FC_ATTR_DOORBELL(x)  (((x) & 0x1U) >> 0U)
+/** @} */
+
+/*!
+ * @name SCMI performance notification enable
+ */
+/** @{ */
+/*! Notify enable */
+#define SCMI_PERF_NOTIFY_ENABLE(x)  (((x) & 0x1U) << 0U)
+/** @} */
+
 /*!
  * @name SCMI performance level attributes
  */
@@ -591,6 +615,106 @@ int32_t SCMI_PerformanceLevelSet(uint32_t channel, uint32_t domainId,
 int32_t SCMI_PerformanceLevelGet(uint32_t channel, uint32_t domainId,
     uint32_t *performanceLevel);
 
+/*!
+ * Configure performance limits notification.
+ *
+ * @param[in]     channel       A2P channel for comms
+ * @param[in]     domainId      Identifier for the performance domain
+ * @param[in]     notifyEnable  Notification flags:<BR>
+ *                              Bits[31:1] Reserved, must be zero.<BR>
+ *                              Bit[0] Notify enable
+ *
+ * This function allows the caller to request notifications when the
+ * performance limits of a domain change. Limits in this platform are fixed
+ * by the level table of the domain, so the request is accepted but no
+ * notification is ever sent. See section 4.5.3.11 PERFORMANCE_NOTIFY_LIMITS
+ * in the [SCMI Spec](@ref DOCS).
+ *
+ * Access macros:
+ * - ::SCMI_PERF_NOTIFY_ENABLE() - Notify enable
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the notification state was successfully updated.
+ * - ::SCMI_ERR_NOT_FOUND: if domainId does not point to a valid domain.
+ * - ::SCMI_ERR_DENIED: if the calling agent is not permitted to request the
+ *   notification.
+ * - ::SCMI_ERR_INVALID_PARAMETERS: if notifyEnable specifies values that
+ *   are either illegal or incorrect.
+ */
+int32_t SCMI_PerformanceNotifyLimits(uint32_t channel, uint32_t domainId,
+    uint32_t notifyEnable);
+
+/*!
+ * Configure performance level notification.
+ *
+ * @param[in]     channel       A2P channel for comms
+ * @param[in]     domainId      Identifier for the performance domain
+ * @param[in]     notifyEnable  Notification flags:<BR>
+ *                              Bits[31:1] Reserved, must be zero.<BR>
+ *                              Bit[0] Notify enable
+ *
+ * This function allows the caller to request a
+ * SCMI_PerformanceLevelChanged() notification whenever the current
+ * performance level of a domain changes, including changes caused by
+ * requests from other agents. See section 4.5.3.12 PERFORMANCE_NOTIFY_LEVEL
+ * in the [SCMI Spec](@ref DOCS).
+ *
+ * Access macros:
+ * - ::SCMI_PERF_NOTIFY_ENABLE() - Notify enable
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the notification state was successfully updated.
+ * - ::SCMI_ERR_NOT_FOUND: if domainId does not point to a valid domain.
+ * - ::SCMI_ERR_DENIED: if the calling agent is not permitted to request the
+ *   notification.
+ * - ::SCMI_ERR_INVALID_PARAMETERS: if notifyEnable specifies values that
+ *   are either illegal or incorrect.
+ */
+int32_t SCMI_PerformanceNotifyLevel(uint32_t channel, uint32_t domainId,
+    uint32_t notifyEnable);
+
+/*!
+ * Get performance FastChannel info.
+ *
+ * @param[in]     channel       A2P channel for comms
+ * @param[in]     domainId      Identifier for the performance domain
+ * @param[in]     messageId     Identifier for the message
+ * @param[out]    attributes    FastChannel attributes:<BR>
+ *                              Bits[31:1] Reserved, must be zero.<BR>
+ *                              Bit[0] Doorbell support
+ * @param[out]    rateLimit     Rate limit in microseconds, 0 if not
+ *                              reported
+ * @param[out]    chanAddrLow   Lower 32 bits of the FastChannel address
+ * @param[out]    chanAddrHigh  Upper 32 bits of the FastChannel address
+ * @param[out]    chanSize      Size of the FastChannel in bytes
+ *
+ * On success, this function returns the location of the FastChannel for a
+ * message and domain. Supported messages are
+ * ::SCMI_MSG_PERFORMANCE_LEVEL_SET, ::SCMI_MSG_PERFORMANCE_LEVEL_GET, and
+ * ::SCMI_MSG_PERFORMANCE_LIMITS_GET. The platform does not provide a
+ * doorbell, channels are polled. See section 4.5.3.12
+ * PERFORMANCE_DESCRIBE_FASTCHANNEL in the [SCMI Spec](@ref DOCS).
+ *
+ * Access macros:
+ * - ::SCMI_PERF_FC_ATTR_DOORBELL() - Doorbell support
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the FastChannel info is returned.
+ * - ::SCMI_ERR_NOT_FOUND: if domainId does not point to a valid domain.
+ * - ::SCMI_ERR_NOT_SUPPORTED: if there is no FastChannel for the message
+ *   and domain.
+ */
+int32_t SCMI_PerformanceDescribeFastchannel(uint32_t channel,
+    uint32_t domainId, uint32_t messageId, uint32_t *attributes,
+    uint32_t *rateLimit, uint32_t *chanAddrLow, uint32_t *chanAddrHigh,
+    uint32_t *chanSize);
+
 /*!
  * Negotiate the protocol version.
  *
@@ -619,6 +743,27 @@ int32_t SCMI_PerformanceLevelGet(uint32_t channel, uint32_t domainId,
 int32_t SCMI_PerfNegotiateProtocolVersion(uint32_t channel,
     uint32_t version);
 
+/*!
+ * Read performance level change event.
+ *
+ * @param[in]     channel           P2A notify channel for comms.
+ * @param[out]    agentId           Refers to the agent that caused this
+ *                                  event. Always 0, the platform is the
+ *                                  generator of all level change events.
+ * @param[out]    domainId          Identifier for the performance domain
+ * @param[out]    performanceLevel  New performance level, or level index,
+ *                                  of the domain
+ *
+ * This notification is issued by the platform when the current performance
+ * level of a domain changes and the agent has requested it using
+ * SCMI_PerformanceNotifyLevel(). See section 4.5.4.2
+ * PERFORMANCE_LEVEL_CHANGED in the [SCMI Spec](@ref DOCS).
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ */
+int32_t SCMI_PerformanceLevelChanged(uint32_t channel, uint32_t *agentId,
+    uint32_t *domainId, uint32_t *performanceLevel);
+
 #endif /* SCMI_PERF_H */
 
 /** @} */
@@ -58,6 +58,14 @@
 #define SCMI_MSG_POWER_STATE_SET          0x4U
 /*! Get power state */
 #define SCMI_MSG_POWER_STATE_GET          0x5U
+/*! Configure power state change notification */
+#define SCMI_MSG_POWER_STATE_NOTIFY       0x6U
+/*! Configure power state change requested notification */
+#define SCMI_MSG_POWER_STATE_CHANGE_REQUESTED_NOTIFY  0x7U
+/*! Read power state change event */
+#define SCMI_MSG_POWER_STATE_CHANGED      0x0U
+/*! Read power state change requested event */
+#define SCMI_MSG_POWER_STATE_CHANGE_REQUESTED  0x1U
 /** @} */
 
 /*!
@@ -112,6 +120,14 @@
 #define SCMI_POWER_FLAGS_ASYNC(x)  (((x) & 0x1U) << 0U)
 /** @} */
 
+/*!
+ * @name SCMI power notification enable
+ */
+/** @{ */
+/*! Notify enable */
+#define SCMI_POWER_NOTIFY_ENABLE(x)  (((x) & 0x1U) << 0U)
+/** @} */
+
 /* Functions */
 
 /*!
@@ -324,6 +340,67 @@ int32_t SCMI_PowerStateSet(uint32_t channel, uint32_t domainId,
 int32_t SCMI_PowerStateGet(uint32_t channel, uint32_t domainId,
     uint32_t *powerState);
 
+/*!
+ * Configure power state change notification.
+ *
+ * @param[in]     channel       A2P channel for comms
+ * @param[in]     domainId      Identifier for the power domain
+ * @param[in]     notifyEnable  Notification flags:<BR>
+ *                              Bits[31:1] Reserved, must be zero.<BR>
+ *                              Bit[0] Notify enable
+ *
+ * This function allows the caller to request a SCMI_PowerStateChanged()
+ * notification whenever the power state of a domain changes. This includes
+ * changes made on behalf of other agents or LMs and hardware-driven
+ * transitions. See section 4.3.2.8 POWER_STATE_NOTIFY in the
+ * [SCMI Spec](@ref DOCS).
+ *
+ * Access macros:
+ * - ::SCMI_POWER_NOTIFY_ENABLE() - Notify enable
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the notification state was successfully updated.
+ * - ::SCMI_ERR_NOT_FOUND: if domainId does not point to a valid domain.
+ * - ::SCMI_ERR_DENIED: if the calling agent is not permitted to request the
+ *   notification.
+ * - ::SCMI_ERR_INVALID_PARAMETERS: if notifyEnable specifies values that
+ *   are either illegal or incorrect.
+ */
+int32_t SCMI_PowerStateNotify(uint32_t channel, uint32_t domainId,
+    uint32_t notifyEnable);
+
+/*!
+ * Configure power state change requested notification.
+ *
+ * @param[in]     channel       A2P channel for comms
+ * @param[in]     domainId      Identifier for the power domain
+ * @param[in]     notifyEnable  Notification flags:<BR>
+ *                              Bits[31:1] Reserved, must be zero.<BR>
+ *                              Bit[0] Notify enable
+ *
+ * This function allows the caller to request a
+ * SCMI_PowerStateChangeRequested() notification whenever another agent of
+ * the same LM requests a power state for a domain. See section 4.3.2.9
+ * POWER_STATE_CHANGE_REQUESTED_NOTIFY in the [SCMI Spec](@ref DOCS).
+ *
+ * Access macros:
+ * - ::SCMI_POWER_NOTIFY_ENABLE() - Notify enable
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the notification state was successfully updated.
+ * - ::SCMI_ERR_NOT_FOUND: if domainId does not point to a valid domain.
+ * - ::SCMI_ERR_DENIED: if the calling agent is not permitted to request the
+ *   notification.
+ * - ::SCMI_ERR_INVALID_PARAMETERS: if notifyEnable specifies values that
+ *   are either illegal or incorrect.
+ */
+int32_t SCMI_PowerStateChangeRequestedNotify(uint32_t channel,
+    uint32_t domainId, uint32_t notifyEnable);
+
 /*!
  * Negotiate the protocol version.
  *
@@ -352,6 +429,47 @@ int32_t SCMI_PowerStateGet(uint32_t channel, uint32_t domainId,
 int32_t SCMI_PowerNegotiateProtocolVersion(uint32_t channel,
     uint32_t version);
 
+/*!
+ * Read power state change event.
+ *
+ * @param[in]     channel     P2A notify channel for comms.
+ * @param[out]    agentId     Refers to the agent that caused this event.
+ *                            Always 0, the platform is the generator of all
+ *                            power state change events.
+ * @param[out]    domainId    Identifier for the power domain
+ * @param[out]    powerState  New power state of the domain. Note
+ *                            platform-specific
+ *
+ * This notification is issued by the platform when the power state of a
+ * domain changes and the agent has requested it using
+ * SCMI_PowerStateNotify(). See section 4.3.3.1 POWER_STATE_CHANGED in the
+ * [SCMI Spec](@ref DOCS).
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ */
+int32_t SCMI_PowerStateChanged(uint32_t channel, uint32_t *agentId,
+    uint32_t *domainId, uint32_t *powerState);
+
+/*!
+ * Read power state change requested event.
+ *
+ * @param[in]     channel     P2A notify channel for comms.
+ * @param[out]    agentId     Identifier of the agent that requested the
+ *                            power state change
+ * @param[out]    domainId    Identifier for the power domain
+ * @param[out]    powerState  Requested power state of the domain. Note
+ *                            platform-specific
+ *
+ * This notification is issued by the platform when another agent requests
+ * a power state for a domain and the agent has requested it using
+ * SCMI_PowerStateChangeRequestedNotify(). See section 4.3.3.2
+ * POWER_STATE_CHANGE_REQUESTED in the [SCMI Spec](@ref DOCS).
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ */
+int32_t SCMI_PowerStateChangeRequested(uint32_t channel, uint32_t *agentId,
+    uint32_t *domainId, uint32_t *powerState);
+
 #endif /* SCMI_POWER_H */
 
 /** @} */
@@ -369,11 +369,20 @@ int32_t SCMI_SensorReadingGet(uint32_t channel, uint32_t sensorId,
             SCMI_MSG_SENSOR_READING_GET, sizeof(msg_tsensord6_t), &header);
     }
 
-    /* Receive response */
+    /* Receive response, async readings follow in a delayed response */
     if (status == SCMI_ERR_SUCCESS)
     {
-        status = SCMI_A2pRx(channel,
-            sizeof(msg_status_t) + sizeof(uint32_t), header);
+        if (SCMI_SENSOR_READ_FLAGS_ASYNC(1U) == (flags
+            & SCMI_SENSOR_READ_FLAGS_ASYNC(1U)))
+        {
+            status = SCMI_A2pRx(channel, sizeof(msg_status_t), header);
+            readings = NULL;
+        }
+        else
+        {
+            status = SCMI_A2pRx(channel,
+                sizeof(msg_status_t) + sizeof(uint32_t), header);
+        }
     }
 
     /* Copy out if no error */
@@ -514,6 +523,57 @@ int32_t SCMI_SensorConfigSet(uint32_t channel, uint32_t sensorId,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Configure sensor continuous update notification                          */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_SensorContinuousUpdateNotify(uint32_t channel,
+    uint32_t sensorId, uint32_t notifyEnable)
+{
+    int32_t status;
+    uint32_t header;
+    void *msg;
+
+    /* Acquire lock */
+    SCMI_A2P_LOCK(channel);
+
+    /* Init buffer */
+    status = SCMI_BufInit(channel, &msg);
+
+    /* Send request */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        /* Request message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t sensorId;
+            uint32_t notifyEnable;
+        } msg_tsensord11_t;
+        msg_tsensord11_t *msgTx = (msg_tsensord11_t*) msg;
+
+        /* Fill in parameters */
+        msgTx->sensorId = sensorId;
+        msgTx->notifyEnable = notifyEnable;
+
+        /* Send message */
+        status = SCMI_A2pTx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_SENSOR_CONTINUOUS_UPDATE_NOTIFY,
+            sizeof(msg_tsensord11_t), &header);
+    }
+
+    /* Receive response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_A2pRx(channel, sizeof(msg_status_t), header);
+    }
+
+    /* Release lock */
+    SCMI_A2P_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Negotiate the protocol version                                           */
 /*--------------------------------------------------------------------------*/
@@ -593,3 +653,143 @@ int32_t SCMI_SensorTripPointEvent(uint32_t channel, uint32_t *agentId,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Read sensor update                                                       */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_SensorUpdate(uint32_t channel, uint32_t *agentId,
+    uint32_t *sensorId, scmi_sensor_reading_t *readings)
+{
+    int32_t status;
+    uint32_t header;
+    const void *msg;
+
+    /* Acquire lock */
+    SCMI_P2A_LOCK(channel);
+
+    /* Get transport buffer address */
+    msg = SCMI_HdrAddrGet(channel);
+
+    /* Read message */
+    {
+        /* Read message structure */
+        typedef struct
+        {
+            uint32_t header;
+            uint32_t agentId;
+            uint32_t sensorId;
+            scmi_sensor_reading_t readings[1];
+        } msg_rsensored33_t;
+        const msg_rsensored33_t *msgRx = (const msg_rsensored33_t*) msg;
+
+        /* Receive message */
+        status = SCMI_P2aRx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_SENSOR_UPDATE, sizeof(msg_rsensored33_t), &header);
+
+        /* Copy out if no error */
+        if (status == SCMI_ERR_SUCCESS)
+        {
+            /* Extract agentId */
+            if (agentId != NULL)
+            {
+                *agentId = msgRx->agentId;
+            }
+
+            /* Extract sensorId */
+            if (sensorId != NULL)
+            {
+                *sensorId = msgRx->sensorId;
+            }
+
+            /* Extract readings */
+            if (readings != NULL)
+            {
+                SCMI_MemCpy((uint8_t*) readings, (const uint8_t*)
+                    &msgRx->readings, sizeof(scmi_sensor_reading_t));
+            }
+        }
+    }
+
+    /* Send response */
+    if (status == SCMI_ERR_SUCCESS)
+    {
+        status = SCMI_P2aTx(channel, sizeof(header), header);
+    }
+
+    /* Release lock */
+    SCMI_P2A_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Read async sensor reading delayed response                               */
+/*--------------------------------------------------------------------------*/
+int32_t SCMI_SensorReadingComplete(uint32_t channel, uint32_t *sensorId,
+    scmi_sensor_reading_t *readings)
+{
+    int32_t status;
+    uint32_t header;
+    const void *msg;
+
+    /* Acquire lock */
+    SCMI_P2A_LOCK(channel);
+
+    /* Get transport buffer address */
+    msg = SCMI_HdrAddrGet(channel);
+
+    /* Read message */
+    {
+        /* Read message structure */
+        typedef struct
+        {
+            uint32_t header;
+            int32_t status;
+            uint32_t sensorId;
+            scmi_sensor_reading_t readings[1];
+        } msg_rsensord6_t;
+        const msg_rsensord6_t *msgRx = (const msg_rsensord6_t*) msg;
+
+        /* Receive message */
+        status = SCMI_P2aRx(channel, COMMAND_PROTOCOL,
+            SCMI_MSG_SENSOR_READING_COMPLETE, sizeof(msg_rsensord6_t),
+            &header);
+
+        /* Copy out if no error */
+        if (status == SCMI_ERR_SUCCESS)
+        {
+            /* Extract sensorId */
+            if (sensorId != NULL)
+            {
+                *sensorId = msgRx->sensorId;
+            }
+
+            /* Extract readings */
+            if (readings != NULL)
+            {
+                SCMI_MemCpy((uint8_t*) readings, (const uint8_t*)
+                    &msgRx->readings, sizeof(scmi_sensor_reading_t));
+            }
+        }
+
+        /* Send response */
+        if (status == SCMI_ERR_SUCCESS)
+        {
+            int32_t readStatus = msgRx->status;
+
+            status = SCMI_P2aTx(channel, sizeof(header), header);
+
+            /* Return status of the read */
+            if (status == SCMI_ERR_SUCCESS)
+            {
+                status = readStatus;
+            }
+        }
+    }
+
+    /* Release lock */
+    SCMI_P2A_UNLOCK(channel);
+
+    /* Return status */
+    return status;
+}
@@ -64,8 +64,14 @@
 #define SCMI_MSG_SENSOR_CONFIG_GET         0x9U
 /*! Set sensor configuration */
 #define SCMI_MSG_SENSOR_CONFIG_SET         0xAU
+/*! Configure sensor continuous update notification */
+#define SCMI_MSG_SENSOR_CONTINUOUS_UPDATE_NOTIFY  0xBU
 /*! Read sensor event */
 #define SCMI_MSG_SENSOR_TRIP_POINT_EVENT   0x0U
+/*! Read sensor update */
+#define SCMI_MSG_SENSOR_UPDATE             0x1U
+/*! Read async sensor reading delayed response */
+#define SCMI_MSG_SENSOR_READING_COMPLETE   0x6U
 /** @} */
 
 /*!
@@ -180,12 +186,22 @@
 #define SCMI_SENSOR_TP_EV_CTRL(x)          (((x) & 0x3U) << 0U)
 /** @} */
 
+/*!
+ * @name SCMI sensor continuous update notify enable
+ */
+/** @{ */
+/*! Send update notifications */
+#define SCMI_SENSOR_UPDATE_NOTIFY_ENABLE(x)  (((x) & 0x1U) << 0U)
+/** @} */
+
 /*!
  * @name SCMI sensor read flags
  */
 /** @{ */
 /*! Async flag */
 #define SCMI_SENSOR_READ_FLAGS_ASYNC(x)  (((x) & 0x1U) << 0U)
+/*! Force fresh sample (vendor extension) */
+#define SCMI_SENSOR_READ_FLAGS_FRESH(x)  (((x) & 0x1U) << 1U)
 /** @} */
 
 /*!
@@ -537,8 +553,19 @@ int32_t SCMI_SensorTripPointConfig(uint32_t channel, uint32_t sensorId,
  * of readings is ::SCMI_SENSOR_MAX_READINGS. See section 4.7.2.12
  * SENSOR_READING_GET in the [SCMI Spec](@ref DOCS).
  *
+ * Sensors advertising async support via SCMI_SensorDescriptionGet() can be
+ * read asynchronously. The platform then takes a fresh sample after
+ * returning and sends the reading with the SENSOR_READING_COMPLETE delayed
+ * response, read with SCMI_SensorReadingComplete().
+ *
+ * Some board sensors (e.g. PMIC temperature) are sampled periodically in
+ * the background and reads return the last sample along with the time it
+ * was taken. Setting the fresh flag forces a new sample to be taken before
+ * the reading is returned.
+ *
  * Access macros:
  * - ::SCMI_SENSOR_READ_FLAGS_ASYNC() - Async flag
+ * - ::SCMI_SENSOR_READ_FLAGS_FRESH() - Force fresh sample (vendor extension)
  *
  * @return Returns the status (::SCMI_ERR_SUCCESS = success).
  *
@@ -550,6 +577,7 @@ int32_t SCMI_SensorTripPointConfig(uint32_t channel, uint32_t sensorId,
  *   sensor.
  * - ::SCMI_ERR_INVALID_PARAMETERS: if the flags input specifies illegal or
  *   invalid settings.
+ * - ::SCMI_ERR_BUSY: if there are too many asynchronous reads pending.
  * - ::SCMI_ERR_PROTOCOL_ERROR: if the function is used to read updates from
  *   a disabled sensor.
  */
@@ -651,8 +679,11 @@ int32_t SCMI_SensorConfigGet(uint32_t channel, uint32_t sensorId,
  *
  * If the sensor has been enabled, sensor values can be read using the
  * SCMI_SensorReadingGet() function or notified by the platform through
- * notifications. Sensor is enabled if any agent enables. See section 4.7.2.11
- * SENSOR_CONFIG_SET in the [SCMI Spec](@ref DOCS).
+ * notifications. Sensor is enabled if any agent enables. The update interval
+ * is kept per agent and sets the period of SENSOR_UPDATE notifications
+ * (see SCMI_SensorContinuousUpdateNotify()). The default is 1 second and the
+ * minimum 10 mS. See section 4.7.2.11 SENSOR_CONFIG_SET in the
+ * [SCMI Spec](@ref DOCS).
  *
  * Access macros:
  * - ::SCMI_SENSOR_CONFIG_SET_UPDATE_INTV_SEC() - Seconds
@@ -678,6 +709,39 @@ int32_t SCMI_SensorConfigGet(uint32_t channel, uint32_t sensorId,
 int32_t SCMI_SensorConfigSet(uint32_t channel, uint32_t sensorId,
     uint32_t sensorConfig);
 
+/*!
+ * Configure sensor continuous update notification.
+ *
+ * @param[in]     channel       A2P channel for comms
+ * @param[in]     sensorId      Identifier for the sensor
+ * @param[in]     notifyEnable  Notify enable:<BR>
+ *                              Bits[31:1] Reserved.<BR>
+ *                              Bit[0] Set to 1 to receive SENSOR_UPDATE
+ *                              notifications at the update interval. Set
+ *                              to 0 to stop them
+ *
+ * This function is used by the agent to request periodic notifications of
+ * the sensor value. The platform samples the sensor at the update interval
+ * set for the agent using SCMI_SensorConfigSet() and sends the reading to
+ * the agent. Notifications are only sent while the sensor is enabled. See
+ * section 4.7.2.13 SENSOR_CONTINUOUS_UPDATE_NOTIFY in the
+ * [SCMI Spec](@ref DOCS).
+ *
+ * Access macros:
+ * - ::SCMI_SENSOR_UPDATE_NOTIFY_ENABLE() - Send update notifications
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the notification state was updated.
+ * - ::SCMI_ERR_NOT_FOUND: if \a sensorId does not point to an existing
+ *   sensor.
+ * - ::SCMI_ERR_DENIED: if the calling agent is not permitted to request
+ *   notifications for this sensor.
+ */
+int32_t SCMI_SensorContinuousUpdateNotify(uint32_t channel,
+    uint32_t sensorId, uint32_t notifyEnable);
+
 /*!
  * Negotiate the protocol version.
  *
@@ -752,6 +816,48 @@ int32_t SCMI_SensorNegotiateProtocolVersion(uint32_t channel,
 int32_t SCMI_SensorTripPointEvent(uint32_t channel, uint32_t *agentId,
     uint32_t *sensorId, uint32_t *tripPointDesc);
 
+/*!
+ * Read sensor update.
+ *
+ * @param[in]     channel   P2A notify channel for comms.
+ * @param[out]    agentId   Refers to the agent that caused this event. Set
+ *                          to 0 as the platform generates all updates.
+ * @param[out]    sensorId  Identifier for the sensor that was updated.
+ * @param[out]    readings  Sensor reading (one for scalar sensors).
+ *
+ * This notification is issued by the platform at the update interval of a
+ * sensor that the agent requested updates for, by using the
+ * SCMI_SensorContinuousUpdateNotify() function. Updates not yet read by
+ * the agent are replaced by newer ones. See section 4.7.4.2 SENSOR_UPDATE
+ * in the [SCMI Spec](@ref DOCS).
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ */
+int32_t SCMI_SensorUpdate(uint32_t channel, uint32_t *agentId,
+    uint32_t *sensorId, scmi_sensor_reading_t *readings);
+
+/*!
+ * Read async sensor reading delayed response.
+ *
+ * @param[in]     channel   P2A notify channel for comms.
+ * @param[out]    sensorId  Identifier for the sensor that was read
+ * @param[out]    readings  Sensor reading (one for scalar sensors).
+ *
+ * If an agent requested an asynchronous read with SCMI_SensorReadingGet(),
+ * the platform sends the SENSOR_READING_COMPLETE delayed response to the
+ * agent once the sensor has been sampled. See section 4.7.3.1
+ * SENSOR_READING_COMPLETE in the [SCMI Spec](@ref DOCS).
+ *
+ * @return Returns the status (::SCMI_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref SCMI_STATUS "SCMI error codes"):
+ * - ::SCMI_ERR_SUCCESS: if the sensor was read successfully.
+ * - ::SCMI_ERR_PROTOCOL_ERROR: if no delayed response is pending.
+ * - others returned by the read, see SCMI_SensorReadingGet().
+ */
+int32_t SCMI_SensorReadingComplete(uint32_t channel, uint32_t *sensorId,
+    scmi_sensor_reading_t *readings);
+
 #endif /* SCMI_SENSOR_H */
 
 /** @} */
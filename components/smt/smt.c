@@ -63,6 +63,7 @@ typedef struct
     uint8_t mbInst;      /*!< Mailbox instance */
     uint8_t mbDoorbell;  /*!< Mailbox doorbell */
     uint32_t sma;        /*!< Shared memory address */
+    uint32_t size;       /*!< Shared memory buffer size */
 } smt_chn_config_t;
 
 typedef struct
@@ -88,20 +89,25 @@ static MU_Type *const s_muBases[] = MU_BASE_PTRS;
 /* Local functions */
 
 static smt_buf_t *SMT_SmaGet(uint32_t smtChannel);
+#ifndef SMT_LOOPBACK
+static uint32_t SMT_SmaSizeGet(uint8_t mbInst, uint8_t mbDoorbell);
+#endif
 
 /*--------------------------------------------------------------------------*/
 /* Configure an SMT channel                                                 */
 /*--------------------------------------------------------------------------*/
 int32_t SMT_ChannelConfig(uint32_t smtChannel, uint8_t mbInst,
-    uint8_t mbDoorbell, uint32_t sma)
+    uint8_t mbDoorbell, uint32_t sma, uint32_t size)
 {
     int32_t status = SMT_ERR_SUCCESS;
 
-    if (smtChannel < SMT_MAX_CHN)
+    if ((smtChannel < SMT_MAX_CHN) && ((size % 4U) == 0U))
     {
         s_smtConfig[smtChannel].mbInst = mbInst;
         s_smtConfig[smtChannel].mbDoorbell = mbDoorbell;
         s_smtConfig[smtChannel].sma = sma;
+        s_smtConfig[smtChannel].size = (size == 0U) ? SMT_BUFFER_SIZE
+            : size;
         s_smtConfig[smtChannel].valid = true;
     }
     else
@@ -191,7 +197,7 @@ int32_t SMT_Tx(uint32_t smtChannel, uint32_t len, bool callee,
     smt_buf_t *buf = (smt_buf_t*) SMT_SmaGet(smtChannel);
 
     /* Check length */
-    if (len > (SMT_BUFFER_SIZE - SMT_BUFFER_HEADER))
+    if (len > (s_smtConfig[smtChannel].size - SMT_BUFFER_HEADER))
     {
         status = SMT_ERR_PROTOCOL_ERROR;
     }
@@ -368,7 +374,10 @@ static smt_buf_t *SMT_SmaGet(uint32_t smtChannel)
         }
 
         /* Apply channel spacing */
-        sma += ((uint32_t) db) * SMT_BUFFER_SIZE;
+        for (uint8_t prev = 0U; prev < db; prev++)
+        {
+            sma += SMT_SmaSizeGet(inst, prev);
+        }
 
         /* Set return */
         rtn = (smt_buf_t*) sma;
@@ -381,3 +390,27 @@ static smt_buf_t *SMT_SmaGet(uint32_t smtChannel)
     return rtn;
 }
 
+#ifndef SMT_LOOPBACK
+/*--------------------------------------------------------------------------*/
+/* Get SMT SMA size of a mailbox doorbell                                   */
+/*--------------------------------------------------------------------------*/
+static uint32_t SMT_SmaSizeGet(uint8_t mbInst, uint8_t mbDoorbell)
+{
+    uint32_t size = SMT_BUFFER_SIZE;
+
+    /* Find configured channel */
+    for (uint32_t smtChannel = 0U; smtChannel < SMT_MAX_CHN; smtChannel++)
+    {
+        if ((s_smtConfig[smtChannel].valid)
+            && (s_smtConfig[smtChannel].mbInst == mbInst)
+            && (s_smtConfig[smtChannel].mbDoorbell == mbDoorbell))
+        {
+            size = s_smtConfig[smtChannel].size;
+            break;
+        }
+    }
+
+    return size;
+}
+#endif
+
@@ -54,7 +54,7 @@
 
 /* Defines */
 
-/*! SMT buffer size */
+/*! SMT buffer size (default) */
 #define SMT_BUFFER_SIZE     128U
 /*! SMT buffer header size */
 #define SMT_BUFFER_HEADER   24U
@@ -100,6 +100,7 @@
  * @param[in]     mbInst      Mailbox instance
  * @param[in]     mbDoorbell  Doorbell index
  * @param[in]     sma         Shared memory address
+ * @param[in]     size        Shared memory buffer size
  *
  * This function configures an SMT channel for client use. The \a
  * smtChannel parameter is the channel to configure. It is then used
@@ -114,6 +115,11 @@
  * an internal 1K SRAM, a value of 0 indicates to use that (128K per channel
  * spaced in order of doorbell).
  *
+ * The \a size parameter is the size of the shared memory buffer for the
+ * channel. A value of 0 indicates the default ::SMT_BUFFER_SIZE. Buffers
+ * of the doorbells of a mailbox are packed back-to-back in doorbell order.
+ * The size must match the SM configuration.
+ *
  * Note the SYstem Manager (SM) configuration will determine which MU is used
  * for a client and which doorbells are associated with A2P channels, P2A
  * notification channels, and FuSa notification channels.
@@ -121,7 +127,7 @@
  * @return Returns the status (::SCMI_ERR_SUCCESS = success).
  */
 int32_t SMT_ChannelConfig(uint32_t smtChannel, uint8_t mbInst,
-    uint8_t mbDoorbell, uint32_t sma);
+    uint8_t mbDoorbell, uint32_t sma, uint32_t size);
 
 /*!
  * Get SMT buffer address.
@@ -38,7 +38,7 @@ use Getopt::Std;
 use File::Basename;
 use lib dirname (__FILE__);
 use Data::Dumper;
-use List::Util qw(first);
+use List::Util qw(first max);
 
 # Subroutines
 sub load_config_files;
@@ -77,6 +77,8 @@ my @protocols = ('base', 'pd', 'sys', 'perf', 'clk', 'sensor',
     'pin', 'daisy', 'ctrl', 'fault', 'crc', 'fusa');
 my @mbTypes = ('MU', 'LOOPBACK');
 my @xportTypes = ('SMT');
+my $mbMuBufSize = 128;
+my $mbMuSramSize = 1024;
 	my @permTypes = ('none', 'get', 'notify', 'set', 'priv',
 	    'exclusive', 'all');
 my %makeInclude;
@@ -547,6 +549,13 @@ sub generate_mb
             my $x;
             my $xportType = '<invalid>';
             my %xportChannel;
+            my $rpcType = '<invalid>';
+            my %rpcChannel;
+            my $maxSize = 0;
+            my %dbSize;
+            my $curSma = 0;
+            my $curMb = '';
+            my @dispLst;
             
             # Open file
             open my $out, '>', $outDir . '/' . $fileName
@@ -597,6 +606,11 @@ sub generate_mb
 	                    $xportType = 'XPORT_' . uc $parm;
 	                    $xportChannel{$xportType}++;
 					}					
+	                if ((my $parm = &param($mb, 'rpc')) ne '!')
+	                {
+	                    $rpcType = 'RPC_' . uc $parm;
+	                    $rpcChannel{$rpcType}++;
+	                }
 	                if ((my $parm = &param($mb, 'db')) ne '!')
 	                {
 		                print $out '        .xportType[' . $parm
@@ -605,6 +619,42 @@ sub generate_mb
 		                print $out '        .xportChannel[' . $parm
 		                	. '] = ' . ($xportChannel{$xportType}
 		                    - 1) . 'U, \\' . "\n";
+		                push @dispLst, '    [' . $curMb . '][' . $parm
+		                    . '] = { SM_' . $xportType . ', '
+		                    . ($xportChannel{$xportType} - 1) . 'U, SM_'
+		                    . $rpcType . ', '
+		                    . ($rpcChannel{$rpcType} - 1) . 'U }';
+		                if ((my $size = &param($mb, 'size')) ne '!')
+		                {
+		                    if (($size !~ /^\d+$/) || (($size % 4) != 0)
+		                        || ($size < 128) || ($size > 4096))
+		                    {
+		                        error_line('invalid size', $mb);
+		                    }
+		                    print $out '        .bufSize[' . $parm
+		                        . '] = ' . $size . 'U, \\' . "\n";
+		                    if ($size > $maxSize)
+		                    {
+		                        $maxSize = $size;
+		                    }
+		                    $dbSize{$parm} = $size;
+		                }
+
+		                # Buffers are packed in db order in the MU SRAM
+		                if (($mbt eq 'MU') && !$curSma)
+		                {
+		                    my $end = 0;
+
+		                    foreach my $db (0 .. max(keys %dbSize, $parm))
+		                    {
+		                        $end += $dbSize{$db} // $mbMuBufSize;
+		                    }
+		                    if ($end > $mbMuSramSize)
+		                    {
+		                        error_line('buffers exceed MU SRAM, use sma',
+		                            $mb);
+		                    }
+		                }
 		                $x++;
 		            }
 		            else
@@ -636,11 +686,37 @@ sub generate_mb
 	                {
 	                    print $out '        .mu = ' . $parm . 'U, \\' . "\n";
 	                }
+	                %dbSize = ();
+	                $curSma = 0;
 	                if ((my $parm = &param($mb, 'sma')) ne '!')
 	                {
 	                    print $out '        .sma = ' . $parm . 'U, \\' . "\n";
+	                    $curSma = 1;
+	                }
+	                if (($mbt eq 'MU')
+	                    && ((my $parm = &param($mb, 'test')) ne '!'))
+	                {
+	                    print $out '        .muAgent = ' . $parm . 'U, \\'
+	                        . "\n";
+	                }
+	                if (($mbt eq 'MU')
+	                    && ((my $parm = &param($mb, 'asma')) ne '!'))
+	                {
+	                    print $out '        .smaAgent = ' . $parm . 'U, \\'
+	                        . "\n";
+	                }
+	                if ((my $parm = &param($mb, 'irqprio')) ne '!')
+	                {
+	                    # Only preemptive levels, 8-15 is the default group
+	                    if (($parm !~ /^\d+$/) || ($parm < 1) || ($parm > 7))
+	                    {
+	                        error_line('invalid irqprio', $mb);
+	                    }
+	                    print $out '        .irqPrio = ' . $parm . 'U, \\'
+	                        . "\n";
 	                }
 	                $defLst[$i] = $mu;
+	                $curMb = $mu;
 	            }
             }
             if ($x != -1)
@@ -655,6 +731,15 @@ sub generate_mb
             print $out '#define SM_NUM_MB_' . $mbt . '  '
                 . $num . 'U' . "\n\n";
 
+            # Output max buffer size
+            if ($maxSize != 0)
+            {
+                print $out '/*! Config for max ' . $mbt . ' MB buffer size */'
+                    . "\n";
+                print $out '#define SM_MB_' . $mbt . '_MAX_BUF_SIZE  '
+                    . $maxSize . 'U' . "\n\n";
+            }
+
             # Loop over the MB list
             $i = 0;
 			print $out '/*! Config data array for ' . $mbt . ' MB */' . "\n";
@@ -671,6 +756,15 @@ sub generate_mb
             }
             print $out "\n";
 
+            # Output flattened dispatch table
+            if ($mbt eq 'MU')
+            {
+                print $out "\n" . '/*! Config dispatch array for ' . $mbt
+                    . ' MB, indexed by [' . lc $mbt . '][db] */' . "\n";
+                print $out '#define SM_MB_' . $mbt . '_DISPATCH_DATA \\'
+                    . "\n" . join(', \\' . "\n", @dispLst) . "\n";
+            }
+
             # Output footer
             print $out &footer('MB_' . $mbt);
 
@@ -711,6 +805,7 @@ sub generate_xport
             my $mbType = '<invalid>';
             my %mbInst;
             my %crc;
+            my $maxSize = 0;
             
             # Open file
             open my $out, '>', $outDir . '/' . $fileName
@@ -791,6 +886,13 @@ sub generate_xport
 	                    print $out '        .mbDoorbell = ' . $parm
 	                        . 'U, \\' . "\n";
 	                }
+	                if ((my $parm = &param($mb, 'size')) ne '!')
+	                {
+	                    if ($parm > $maxSize)
+	                    {
+	                        $maxSize = $parm;
+	                    }
+	                }
 	                if ((my $parm = &param($mb, 'check')) ne '!')
 	                {
 	                    $crc{$parm}++;
@@ -810,6 +912,15 @@ sub generate_xport
             print $out '#define SM_NUM_' . $xpt . '_CHN  '
                 . $num . 'U' . "\n\n";
 
+            # Output max buffer size
+            if ($maxSize != 0)
+            {
+                print $out '/*! Config for max ' . $xpt . ' buffer size */'
+                    . "\n";
+                print $out '#define SM_' . $xpt . '_MAX_BUF_SIZE  '
+                    . $maxSize . 'U' . "\n\n";
+            }
+
             # Loop over the channel list
             $i = 0;
 			print $out '/*! Config data array for ' . $xpt . ' channels */' . "\n";
@@ -907,7 +1018,8 @@ sub generate_scmi
     my $numAgents = 0;
     my $firstAgent;
     my $chn = 0;
-    my $notify = 20;
+    my $numNotify = 0;
+    my %rsrcPerms;
     foreach my $dat (@list)
     {
         # Handle LM and EOF
@@ -1024,11 +1136,22 @@ sub generate_scmi
             print $out '        .scmiInst = ' . $scmiInst . 'U, \\' . "\n";
             print $out '        .domId = ' . $did . 'U, \\' . "\n";
             print $out '        .secure = ' . $secure . 'U, \\' . "\n";
+            if ((my $parm = &param($dat, 'prio')) ne '!')
+            {
+                print $out '        .priority = ' . $parm . 'U, \\' . "\n";
+            }
 
             # Loop over perms
             $i = 0;
             foreach my $perm (@perms)
             {
+                # Resource perms are packed across agents
+                if ($perm =~ /^\.(\w+)Perms\[(.+)\] = (\w+)$/)
+                {
+                    push @{$rsrcPerms{$1}{$2}}, 'SM_SCMI_PERM_PACK('
+                        . $agnt . 'U, ' . $3 . ')';
+                    next;
+                }
                 print $out '        ' . $perm . ', \\' . "\n";
                 $i++;
             }
@@ -1064,9 +1187,20 @@ sub generate_scmi
 	                print $out '        .xportChannel = '
 	                    . ($xportInst{$parm} - 1) . 'U, \\' . "\n";
 	            }
-	            if ((my $parm = &param($dat, 'notify')) ne '!')
+	            if ((my $parm = &param($dat, 'type')) =~ /^p2a_/)
 	            {
-	                $notify = $parm;
+	                my $depth = 6;
+
+	                if ((my $parm = &param($dat, 'notify')) ne '!')
+	                {
+	                    $depth = $parm;
+	                }
+	                if (($depth < 1) || ($depth > 255))
+	                {
+	                    error_line('invalid notify depth', $dat);
+	                }
+	                print $out '        .depth = ' . $depth . 'U, \\' . "\n";
+	                $numNotify += $depth;
 	            }
 	            print $out '    }' . "\n\n";
 	            $chn++;
@@ -1097,6 +1231,38 @@ sub generate_scmi
     }
     print $out "\n\n";
 
+    # Loop over the resource permissions
+    foreach my $proto (@protocols)
+    {
+        if (($proto eq 'sys') || ($proto eq 'fusa'))
+        {
+            next;
+        }
+
+        print $out '/*! Config data array for SCMI ' . $proto
+            . ' permissions */' . "\n";
+        print $out '#define SM_SCMI_' . uc $proto . '_PERMS_DATA';
+        if (!exists $rsrcPerms{$proto})
+        {
+            print $out '  0U' . "\n\n";
+            next;
+        }
+
+        my $first = 1;
+        foreach my $rsrc (sort keys %{$rsrcPerms{$proto}})
+        {
+            if (!$first)
+            {
+                print $out ',';
+            }
+            $first = 0;
+            print $out ' \\' . "\n" . '    [' . $rsrc . '] = '
+                . join(' \\' . "\n" . '        | ',
+                @{$rsrcPerms{$proto}{$rsrc}});
+        }
+        print $out "\n\n";
+    }
+
     # Output collected channel define
     print $out &banner('SCMI Channel Config');
 	print $out '/*! Config for number of SCMI channels */' . "\n";
@@ -1133,9 +1299,13 @@ sub generate_scmi
     }
     print $out "\n\n";
 
-    print $out '/*! Max words to buffer for notification messages */'
+    if ($numNotify == 0)
+    {
+        $numNotify = 1;
+    }
+    print $out '/*! Total P2A messages to buffer (sum of channel depths) */'
         . "\n";
-    print $out '#define SM_SCMI_MAX_NOTIFY  ' . $notify . 'U' . "\n";
+    print $out '#define SM_SCMI_NUM_NOTIFY  ' . $numNotify . 'U' . "\n";
 
     # Output footer
     print $out &footer('SCMI');
@@ -1905,6 +2075,11 @@ sub generate_test
             print $out '        .sma = ' . $mbSma
                 . 'U, \\' . "\n";
         }
+        if ((my $parm = &param($dat, 'size')) ne '!')
+        {
+            print $out '        .size = ' . $parm
+                . 'U, \\' . "\n";
+        }
         print $out '        .agentId = ' . $agnt
             . 'U, \\' . "\n";
         print $out '    }' . "\n\n";
@@ -2260,7 +2435,7 @@ sub get_tests
         # Handle channel
         if ($line =~ /^CHANNEL\b/)
         {
-            if ($line =~ /type=a2p/)
+            if ($line =~ /type=a2p\b/)
             {
                 $a2p = $chn;
             }
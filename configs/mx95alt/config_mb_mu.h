@@ -65,6 +65,7 @@
 #define SM_MB_MU9_CONFIG \
     { \
         .mu = 9U, \
+        .muAgent = 8U, \
         .xportType[0] = SM_XPORT_SMT, \
         .xportChannel[0] = 0U, \
         .xportType[1] = SM_XPORT_SMT, \
@@ -84,6 +85,12 @@
 #define SM_MB_MU_CONFIG_DATA \
     SM_MB_MU9_CONFIG
 
+/*! Config dispatch array for MU MB, indexed by [mu][db] */
+#define SM_MB_MU_DISPATCH_DATA \
+    [9][0] = { SM_XPORT_SMT, 0U, SM_RPC_SCMI, 0U }, \
+    [9][1] = { SM_XPORT_SMT, 1U, SM_RPC_SCMI, 1U }, \
+    [9][2] = { SM_XPORT_SMT, 2U, SM_RPC_SCMI, 2U }
+
 #endif /* CONFIG_MB_MU_H */
 
 /** @} */
@@ -65,6 +65,7 @@
 #define SM_MB_MU9_CONFIG \
     { \
         .mu = 9U, \
+        .muAgent = 8U, \
         .xportType[0] = SM_XPORT_SMT, \
         .xportChannel[0] = 0U, \
         .xportType[1] = SM_XPORT_SMT, \
@@ -81,6 +82,7 @@
 #define SM_MB_MU1_CONFIG \
     { \
         .mu = 1U, \
+        .muAgent = 0U, \
         .xportType[0] = SM_XPORT_SMT, \
         .xportChannel[0] = 3U, \
         .xportType[1] = SM_XPORT_SMT, \
@@ -91,10 +93,13 @@
 #define SM_MB_MU3_CONFIG \
     { \
         .mu = 3U, \
+        .muAgent = 2U, \
         .xportType[0] = SM_XPORT_SMT, \
         .xportChannel[0] = 5U, \
         .xportType[1] = SM_XPORT_SMT, \
         .xportChannel[1] = 6U, \
+        .xportType[2] = SM_XPORT_SMT, \
+        .xportChannel[2] = 7U, \
     }
 
 /*--------------------------------------------------------------------------*/
@@ -110,6 +115,17 @@
     SM_MB_MU1_CONFIG, \
     SM_MB_MU3_CONFIG
 
+/*! Config dispatch array for MU MB, indexed by [mu][db] */
+#define SM_MB_MU_DISPATCH_DATA \
+    [9][0] = { SM_XPORT_SMT, 0U, SM_RPC_SCMI, 0U }, \
+    [9][1] = { SM_XPORT_SMT, 1U, SM_RPC_SCMI, 1U }, \
+    [9][2] = { SM_XPORT_SMT, 2U, SM_RPC_SCMI, 2U }, \
+    [1][0] = { SM_XPORT_SMT, 3U, SM_RPC_SCMI, 3U }, \
+    [1][1] = { SM_XPORT_SMT, 4U, SM_RPC_SCMI, 4U }, \
+    [3][0] = { SM_XPORT_SMT, 5U, SM_RPC_SCMI, 5U }, \
+    [3][1] = { SM_XPORT_SMT, 6U, SM_RPC_SCMI, 6U }, \
+    [3][2] = { SM_XPORT_SMT, 7U, SM_RPC_SCMI, 7U }
+
 #endif /* CONFIG_MB_MU_H */
 
 /** @} */
@@ -138,12 +138,22 @@
         .mbDoorbell = 1U, \
     }
 
+/*! Config for SMT channel 7 */
+#define SM_SMT_CHN7_CONFIG \
+    { \
+        .rpcType = SM_RPC_SCMI, \
+        .rpcChannel = 7U, \
+        .mbType = SM_MB_MU, \
+        .mbInst = 2U, \
+        .mbDoorbell = 2U, \
+    }
+
 /*--------------------------------------------------------------------------*/
 /* SMT Config                                                               */
 /*--------------------------------------------------------------------------*/
 
 /*! Config for number of SMT channels */
-#define SM_NUM_SMT_CHN  7U
+#define SM_NUM_SMT_CHN  8U
 
 /*! Config data array for SMT channels */
 #define SM_SMT_CHN_CONFIG_DATA \
@@ -153,7 +163,8 @@
     SM_SMT_CHN3_CONFIG, \
     SM_SMT_CHN4_CONFIG, \
     SM_SMT_CHN5_CONFIG, \
-    SM_SMT_CHN6_CONFIG
+    SM_SMT_CHN6_CONFIG, \
+    SM_SMT_CHN7_CONFIG
 
 /* Mailbox and CRC types to support */
 /*! Config for MB_MU USE */
@@ -117,12 +117,20 @@
         .agentId = 2U, \
     }
 
+/*! Config for test channel 7 */
+#define SM_TEST_CHN7_CONFIG \
+    { \
+        .mbInst = 2U, \
+        .mbDoorbell = 2U, \
+        .agentId = 2U, \
+    }
+
 /*--------------------------------------------------------------------------*/
 /* Test Channel Config                                                      */
 /*--------------------------------------------------------------------------*/
 
 /*! Config for number of test channels */
-#define SM_NUM_TEST_CHN  7U
+#define SM_NUM_TEST_CHN  8U
 
 /*! Config data array for test channels */
 #define SM_TEST_CHN_CONFIG_DATA \
@@ -132,7 +140,8 @@
     SM_TEST_CHN3_CONFIG, \
     SM_TEST_CHN4_CONFIG, \
     SM_TEST_CHN5_CONFIG, \
-    SM_TEST_CHN6_CONFIG
+    SM_TEST_CHN6_CONFIG, \
+    SM_TEST_CHN7_CONFIG
 
 /*--------------------------------------------------------------------------*/
 /* Test Config                                                              */
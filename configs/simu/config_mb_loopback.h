@@ -81,17 +81,27 @@
     { \
         .xportType[0] = SM_XPORT_SMT, \
         .xportChannel[0] = 3U, \
+        .bufSize[0] = 512U, \
         .xportType[1] = SM_XPORT_SMT, \
         .xportChannel[1] = 4U, \
+        .xportType[2] = SM_XPORT_SMT, \
+        .xportChannel[2] = 5U, \
     }
 
 /*! Config for LOOPBACK2 MB */
 #define SM_MB_LOOPBACK2_CONFIG \
     { \
         .xportType[0] = SM_XPORT_SMT, \
-        .xportChannel[0] = 5U, \
+        .xportChannel[0] = 6U, \
         .xportType[1] = SM_XPORT_SMT, \
-        .xportChannel[1] = 6U, \
+        .xportChannel[1] = 7U, \
+    }
+
+/*! Config for LOOPBACK3 MB */
+#define SM_MB_LOOPBACK3_CONFIG \
+    { \
+        .xportType[0] = SM_XPORT_SMT, \
+        .xportChannel[0] = 8U, \
     }
 
 /*--------------------------------------------------------------------------*/
@@ -99,13 +109,17 @@
 /*--------------------------------------------------------------------------*/
 
 /*! Config for number of LOOPBACK MB */
-#define SM_NUM_MB_LOOPBACK  3U
+#define SM_NUM_MB_LOOPBACK  4U
+
+/*! Config for max LOOPBACK MB buffer size */
+#define SM_MB_LOOPBACK_MAX_BUF_SIZE  512U
 
 /*! Config data array for LOOPBACK MB */
 #define SM_MB_LOOPBACK_CONFIG_DATA \
     SM_MB_LOOPBACK0_CONFIG, \
     SM_MB_LOOPBACK1_CONFIG, \
-    SM_MB_LOOPBACK2_CONFIG
+    SM_MB_LOOPBACK2_CONFIG, \
+    SM_MB_LOOPBACK3_CONFIG
 
 #endif /* CONFIG_MB_LOOPBACK_H */
 
@@ -60,17 +60,8 @@
         .scmiInst = 0U, \
         .domId = 4U, \
         .secure = 0U, \
-        .clkPerms[DEV_SM_CLK_0] = SM_SCMI_PERM_ALL, \
-        .cpuPerms[DEV_SM_CPU_1] = SM_SCMI_PERM_ALL, \
-        .faultPerms[DEV_SM_FAULT_2] = SM_SCMI_PERM_ALL, \
-        .faultPerms[DEV_SM_FAULT_3] = SM_SCMI_PERM_ALL, \
-        .faultPerms[DEV_SM_FAULT_6] = SM_SCMI_PERM_ALL, \
-        .faultPerms[DEV_SM_FAULT_7] = SM_SCMI_PERM_ALL, \
+        .priority = 1U, \
         .fusaPerms = SM_SCMI_PERM_EXCLUSIVE, \
-        .gprPerms[DEV_SM_GPR_0] = SM_SCMI_PERM_ALL, \
-        .pdPerms[DEV_SM_PD_1] = SM_SCMI_PERM_ALL, \
-        .pdPerms[DEV_SM_PD_4] = SM_SCMI_PERM_ALL, \
-        .sensorPerms[DEV_SM_SENSOR_0] = SM_SCMI_PERM_ALL, \
         .sysPerms = SM_SCMI_PERM_EXCLUSIVE, \
     }
 
@@ -90,6 +81,7 @@
         .type = SM_SCMI_CHN_P2A_NOTIFY, \
         .xportType = SM_XPORT_SMT, \
         .xportChannel = 1U, \
+        .depth = 8U, \
     }
 
 /*! Config for SCMI channel 2 */
@@ -99,6 +91,7 @@
         .type = SM_SCMI_CHN_P2A_PRIORITY, \
         .xportType = SM_XPORT_SMT, \
         .xportChannel = 2U, \
+        .depth = 6U, \
     }
 
 /*--------------------------------------------------------------------------*/
@@ -124,28 +117,7 @@
         .scmiInst = 1U, \
         .domId = 3U, \
         .secure = 1U, \
-        .basePerms[DEV_SM_BASE_AGENT_1] = SM_SCMI_PERM_PRIV, \
-        .basePerms[DEV_SM_BASE_DEV_TEST] = SM_SCMI_PERM_PRIV, \
-        .buttonPerms[DEV_SM_BUTTON_0] = SM_SCMI_PERM_NOTIFY, \
-        .clkPerms[DEV_SM_CLK_0] = SM_SCMI_PERM_GET, \
-        .clkPerms[DEV_SM_CLK_1] = SM_SCMI_PERM_ALL, \
-        .cpuPerms[DEV_SM_CPU_2] = SM_SCMI_PERM_ALL, \
-        .ctrlPerms[DEV_SM_CTRL_TEST] = SM_SCMI_PERM_ALL, \
-        .faultPerms[DEV_SM_FAULT_4] = SM_SCMI_PERM_ALL, \
-        .faultPerms[DEV_SM_FAULT_5] = SM_SCMI_PERM_ALL, \
-        .gprPerms[DEV_SM_GPR_1] = SM_SCMI_PERM_ALL, \
-        .lmmPerms[1] = SM_SCMI_PERM_ALL, \
-        .lmmPerms[2] = SM_SCMI_PERM_ALL, \
-        .pdPerms[DEV_SM_PD_2] = SM_SCMI_PERM_ALL, \
-        .pdPerms[DEV_SM_PD_3] = SM_SCMI_PERM_ALL, \
-        .pdPerms[DEV_SM_PD_4] = SM_SCMI_PERM_GET, \
-        .pdPerms[DEV_SM_PD_5] = SM_SCMI_PERM_ALL, \
-        .perfPerms[DEV_SM_PERF_0] = SM_SCMI_PERM_ALL, \
-        .perfPerms[DEV_SM_PERF_1] = SM_SCMI_PERM_SET, \
-        .rstPerms[DEV_SM_RST_1] = SM_SCMI_PERM_ALL, \
-        .sensorPerms[DEV_SM_SENSOR_1] = SM_SCMI_PERM_ALL, \
         .sysPerms = SM_SCMI_PERM_ALL, \
-        .voltPerms[DEV_SM_VOLT_1] = SM_SCMI_PERM_SET, \
     }
 
 /*! Config for SCMI channel 3 */
@@ -164,6 +136,16 @@
         .type = SM_SCMI_CHN_P2A_NOTIFY, \
         .xportType = SM_XPORT_SMT, \
         .xportChannel = 4U, \
+        .depth = 6U, \
+    }
+
+/*! Config for SCMI channel 5 */
+#define SM_SCMI_CHN5_CONFIG \
+    { \
+        .agentId = 1U, \
+        .type = SM_SCMI_CHN_A2P_FAST, \
+        .xportType = SM_XPORT_SMT, \
+        .xportChannel = 5U, \
     }
 
 /*--------------------------------------------------------------------------*/
@@ -177,37 +159,47 @@
         .scmiInst = 1U, \
         .domId = 3U, \
         .secure = 0U, \
-        .buttonPerms[DEV_SM_BUTTON_0] = SM_SCMI_PERM_ALL, \
-        .clkPerms[DEV_SM_CLK_2] = SM_SCMI_PERM_ALL, \
-        .daisyPerms[DEV_SM_DAISY_0] = SM_SCMI_PERM_ALL, \
-        .gprPerms[DEV_SM_GPR_2] = SM_SCMI_PERM_ALL, \
-        .lmmPerms[1] = SM_SCMI_PERM_NOTIFY, \
-        .lmmPerms[2] = SM_SCMI_PERM_GET, \
-        .pdPerms[DEV_SM_PD_6] = SM_SCMI_PERM_ALL, \
-        .pinPerms[DEV_SM_PIN_0] = SM_SCMI_PERM_ALL, \
-        .rstPerms[DEV_SM_RST_2] = SM_SCMI_PERM_ALL, \
-        .rtcPerms[BRD_SM_RTC_PMIC] = SM_SCMI_PERM_ALL, \
-        .rtcPerms[DEV_SM_RTC_BBM] = SM_SCMI_PERM_ALL, \
-        .sensorPerms[BRD_SM_SENSOR_0] = SM_SCMI_PERM_ALL, \
-        .voltPerms[DEV_SM_VOLT_2] = SM_SCMI_PERM_ALL, \
     }
 
-/*! Config for SCMI channel 5 */
-#define SM_SCMI_CHN5_CONFIG \
+/*! Config for SCMI channel 6 */
+#define SM_SCMI_CHN6_CONFIG \
     { \
         .agentId = 2U, \
         .type = SM_SCMI_CHN_A2P, \
         .xportType = SM_XPORT_SMT, \
-        .xportChannel = 5U, \
+        .xportChannel = 6U, \
     }
 
-/*! Config for SCMI channel 6 */
-#define SM_SCMI_CHN6_CONFIG \
+/*! Config for SCMI channel 7 */
+#define SM_SCMI_CHN7_CONFIG \
     { \
         .agentId = 2U, \
         .type = SM_SCMI_CHN_P2A_NOTIFY, \
         .xportType = SM_XPORT_SMT, \
-        .xportChannel = 6U, \
+        .xportChannel = 7U, \
+        .depth = 6U, \
+    }
+
+/*--------------------------------------------------------------------------*/
+/* SCMI AGENT3 Config (AP-NP)                                               */
+/*--------------------------------------------------------------------------*/
+
+/*! Config for SCMI agent 3 */
+#define SM_SCMI_AGNT3_CONFIG \
+    { \
+        .name = "AP-NP", \
+        .scmiInst = 1U, \
+        .domId = 3U, \
+        .secure = 0U, \
+    }
+
+/*! Config for SCMI channel 8 */
+#define SM_SCMI_CHN8_CONFIG \
+    { \
+        .agentId = 3U, \
+        .type = SM_SCMI_CHN_A2P, \
+        .xportType = SM_XPORT_SMT, \
+        .xportChannel = 8U, \
     }
 
 /*--------------------------------------------------------------------------*/
@@ -218,7 +210,7 @@
 #define SM_SCMI1_CONFIG \
     { \
         .lmId = 2U, \
-        .numAgents = 2U, \
+        .numAgents = 3U, \
         .firstAgent = 1U, \
     }
 
@@ -227,20 +219,121 @@
 /*--------------------------------------------------------------------------*/
 
 /*! Config for number of SCMI agents */
-#define SM_SCMI_NUM_AGNT  3U
+#define SM_SCMI_NUM_AGNT  4U
 
 /*! Config data array for SCMI agents */
 #define SM_SCMI_AGNT_CONFIG_DATA \
     SM_SCMI_AGNT0_CONFIG, \
     SM_SCMI_AGNT1_CONFIG, \
-    SM_SCMI_AGNT2_CONFIG
+    SM_SCMI_AGNT2_CONFIG, \
+    SM_SCMI_AGNT3_CONFIG
+
+/*! Config data array for SCMI base permissions */
+#define SM_SCMI_BASE_PERMS_DATA \
+    [DEV_SM_BASE_AGENT_1] = SM_SCMI_PERM_PACK(1U, SM_SCMI_PERM_PRIV), \
+    [DEV_SM_BASE_DEV_TEST] = SM_SCMI_PERM_PACK(1U, SM_SCMI_PERM_PRIV)
+
+/*! Config data array for SCMI pd permissions */
+#define SM_SCMI_PD_PERMS_DATA \
+    [DEV_SM_PD_1] = SM_SCMI_PERM_PACK(0U, SM_SCMI_PERM_ALL), \
+    [DEV_SM_PD_2] = SM_SCMI_PERM_PACK(1U, SM_SCMI_PERM_ALL), \
+    [DEV_SM_PD_3] = SM_SCMI_PERM_PACK(1U, SM_SCMI_PERM_ALL), \
+    [DEV_SM_PD_4] = SM_SCMI_PERM_PACK(0U, SM_SCMI_PERM_ALL) \
+        | SM_SCMI_PERM_PACK(1U, SM_SCMI_PERM_GET), \
+    [DEV_SM_PD_5] = SM_SCMI_PERM_PACK(1U, SM_SCMI_PERM_ALL), \
+    [DEV_SM_PD_6] = SM_SCMI_PERM_PACK(2U, SM_SCMI_PERM_ALL)
+
+/*! Config data array for SCMI perf permissions */
+#define SM_SCMI_PERF_PERMS_DATA \
+    [DEV_SM_PERF_0] = SM_SCMI_PERM_PACK(1U, SM_SCMI_PERM_ALL), \
+    [DEV_SM_PERF_1] = SM_SCMI_PERM_PACK(1U, SM_SCMI_PERM_SET)
+
+/*! Config data array for SCMI clk permissions */
+#define SM_SCMI_CLK_PERMS_DATA \
+    [DEV_SM_CLK_0] = SM_SCMI_PERM_PACK(0U, SM_SCMI_PERM_ALL) \
+        | SM_SCMI_PERM_PACK(1U, SM_SCMI_PERM_GET), \
+    [DEV_SM_CLK_1] = SM_SCMI_PERM_PACK(1U, SM_SCMI_PERM_ALL) \
+        | SM_SCMI_PERM_PACK(3U, SM_SCMI_PERM_ALL), \
+    [DEV_SM_CLK_2] = SM_SCMI_PERM_PACK(2U, SM_SCMI_PERM_ALL)
+
+/*! Config data array for SCMI sensor permissions */
+#define SM_SCMI_SENSOR_PERMS_DATA \
+    [BRD_SM_SENSOR_0] = SM_SCMI_PERM_PACK(2U, SM_SCMI_PERM_ALL) \
+        | SM_SCMI_PERM_PACK(3U, SM_SCMI_PERM_ALL), \
+    [DEV_SM_SENSOR_0] = SM_SCMI_PERM_PACK(0U, SM_SCMI_PERM_ALL), \
+    [DEV_SM_SENSOR_1] = SM_SCMI_PERM_PACK(1U, SM_SCMI_PERM_ALL)
+
+/*! Config data array for SCMI rst permissions */
+#define SM_SCMI_RST_PERMS_DATA \
+    [DEV_SM_RST_1] = SM_SCMI_PERM_PACK(1U, SM_SCMI_PERM_ALL), \
+    [DEV_SM_RST_2] = SM_SCMI_PERM_PACK(2U, SM_SCMI_PERM_ALL)
+
+/*! Config data array for SCMI volt permissions */
+#define SM_SCMI_VOLT_PERMS_DATA \
+    [DEV_SM_VOLT_1] = SM_SCMI_PERM_PACK(1U, SM_SCMI_PERM_SET), \
+    [DEV_SM_VOLT_2] = SM_SCMI_PERM_PACK(2U, SM_SCMI_PERM_ALL)
+
+/*! Config data array for SCMI lmm permissions */
+#define SM_SCMI_LMM_PERMS_DATA \
+    [1] = SM_SCMI_PERM_PACK(1U, SM_SCMI_PERM_ALL) \
+        | SM_SCMI_PERM_PACK(2U, SM_SCMI_PERM_NOTIFY), \
+    [2] = SM_SCMI_PERM_PACK(1U, SM_SCMI_PERM_ALL) \
+        | SM_SCMI_PERM_PACK(2U, SM_SCMI_PERM_GET)
+
+/*! Config data array for SCMI gpr permissions */
+#define SM_SCMI_GPR_PERMS_DATA \
+    [DEV_SM_GPR_0] = SM_SCMI_PERM_PACK(0U, SM_SCMI_PERM_ALL), \
+    [DEV_SM_GPR_1] = SM_SCMI_PERM_PACK(1U, SM_SCMI_PERM_ALL), \
+    [DEV_SM_GPR_2] = SM_SCMI_PERM_PACK(2U, SM_SCMI_PERM_ALL)
+
+/*! Config data array for SCMI rtc permissions */
+#define SM_SCMI_RTC_PERMS_DATA \
+    [BRD_SM_RTC_PMIC] = SM_SCMI_PERM_PACK(2U, SM_SCMI_PERM_ALL), \
+    [DEV_SM_RTC_BBM] = SM_SCMI_PERM_PACK(2U, SM_SCMI_PERM_ALL)
+
+/*! Config data array for SCMI button permissions */
+#define SM_SCMI_BUTTON_PERMS_DATA \
+    [DEV_SM_BUTTON_0] = SM_SCMI_PERM_PACK(1U, SM_SCMI_PERM_NOTIFY) \
+        | SM_SCMI_PERM_PACK(2U, SM_SCMI_PERM_ALL)
+
+/*! Config data array for SCMI cpu permissions */
+#define SM_SCMI_CPU_PERMS_DATA \
+    [DEV_SM_CPU_1] = SM_SCMI_PERM_PACK(0U, SM_SCMI_PERM_ALL), \
+    [DEV_SM_CPU_2] = SM_SCMI_PERM_PACK(1U, SM_SCMI_PERM_ALL)
+
+/*! Config data array for SCMI perlpi permissions */
+#define SM_SCMI_PERLPI_PERMS_DATA  0U
+
+/*! Config data array for SCMI pin permissions */
+#define SM_SCMI_PIN_PERMS_DATA \
+    [DEV_SM_PIN_0] = SM_SCMI_PERM_PACK(2U, SM_SCMI_PERM_ALL)
+
+/*! Config data array for SCMI daisy permissions */
+#define SM_SCMI_DAISY_PERMS_DATA \
+    [DEV_SM_DAISY_0] = SM_SCMI_PERM_PACK(2U, SM_SCMI_PERM_ALL)
+
+/*! Config data array for SCMI ctrl permissions */
+#define SM_SCMI_CTRL_PERMS_DATA \
+    [DEV_SM_CTRL_TEST] = SM_SCMI_PERM_PACK(1U, SM_SCMI_PERM_ALL)
+
+/*! Config data array for SCMI fault permissions */
+#define SM_SCMI_FAULT_PERMS_DATA \
+    [DEV_SM_FAULT_2] = SM_SCMI_PERM_PACK(0U, SM_SCMI_PERM_ALL), \
+    [DEV_SM_FAULT_3] = SM_SCMI_PERM_PACK(0U, SM_SCMI_PERM_ALL), \
+    [DEV_SM_FAULT_4] = SM_SCMI_PERM_PACK(1U, SM_SCMI_PERM_ALL), \
+    [DEV_SM_FAULT_5] = SM_SCMI_PERM_PACK(1U, SM_SCMI_PERM_ALL), \
+    [DEV_SM_FAULT_6] = SM_SCMI_PERM_PACK(0U, SM_SCMI_PERM_ALL), \
+    [DEV_SM_FAULT_7] = SM_SCMI_PERM_PACK(0U, SM_SCMI_PERM_ALL)
+
+/*! Config data array for SCMI crc permissions */
+#define SM_SCMI_CRC_PERMS_DATA  0U
 
 /*--------------------------------------------------------------------------*/
 /* SCMI Channel Config                                                      */
 /*--------------------------------------------------------------------------*/
 
 /*! Config for number of SCMI channels */
-#define SM_SCMI_NUM_CHN  7U
+#define SM_SCMI_NUM_CHN  9U
 
 /*! Config data array for SCMI channels */
 #define SM_SCMI_CHN_CONFIG_DATA \
@@ -250,7 +343,9 @@
     SM_SCMI_CHN3_CONFIG, \
     SM_SCMI_CHN4_CONFIG, \
     SM_SCMI_CHN5_CONFIG, \
-    SM_SCMI_CHN6_CONFIG
+    SM_SCMI_CHN6_CONFIG, \
+    SM_SCMI_CHN7_CONFIG, \
+    SM_SCMI_CHN8_CONFIG
 
 /*--------------------------------------------------------------------------*/
 /* SCMI Config                                                              */
@@ -264,8 +359,8 @@
     SM_SCMI0_CONFIG, \
     SM_SCMI1_CONFIG
 
-/*! Max words to buffer for notification messages */
-#define SM_SCMI_MAX_NOTIFY  24U
+/*! Total P2A messages to buffer (sum of channel depths) */
+#define SM_SCMI_NUM_NOTIFY  26U
 
 #endif /* CONFIG_SCMI_H */
 
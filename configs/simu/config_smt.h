@@ -126,8 +126,8 @@
         .rpcType = SM_RPC_SCMI, \
         .rpcChannel = 5U, \
         .mbType = SM_MB_LOOPBACK, \
-        .mbInst = 2U, \
-        .mbDoorbell = 0U, \
+        .mbInst = 1U, \
+        .mbDoorbell = 2U, \
     }
 
 /*! Config for SMT channel 6 */
@@ -137,15 +137,38 @@
         .rpcChannel = 6U, \
         .mbType = SM_MB_LOOPBACK, \
         .mbInst = 2U, \
+        .mbDoorbell = 0U, \
+    }
+
+/*! Config for SMT channel 7 */
+#define SM_SMT_CHN7_CONFIG \
+    { \
+        .rpcType = SM_RPC_SCMI, \
+        .rpcChannel = 7U, \
+        .mbType = SM_MB_LOOPBACK, \
+        .mbInst = 2U, \
         .mbDoorbell = 1U, \
     }
 
+/*! Config for SMT channel 8 */
+#define SM_SMT_CHN8_CONFIG \
+    { \
+        .rpcType = SM_RPC_SCMI, \
+        .rpcChannel = 8U, \
+        .mbType = SM_MB_LOOPBACK, \
+        .mbInst = 3U, \
+        .mbDoorbell = 0U, \
+    }
+
 /*--------------------------------------------------------------------------*/
 /* SMT Config                                                               */
 /*--------------------------------------------------------------------------*/
 
 /*! Config for number of SMT channels */
-#define SM_NUM_SMT_CHN  7U
+#define SM_NUM_SMT_CHN  9U
+
+/*! Config for max SMT buffer size */
+#define SM_SMT_MAX_BUF_SIZE  512U
 
 /*! Config data array for SMT channels */
 #define SM_SMT_CHN_CONFIG_DATA \
@@ -155,7 +178,9 @@
     SM_SMT_CHN3_CONFIG, \
     SM_SMT_CHN4_CONFIG, \
     SM_SMT_CHN5_CONFIG, \
-    SM_SMT_CHN6_CONFIG
+    SM_SMT_CHN6_CONFIG, \
+    SM_SMT_CHN7_CONFIG, \
+    SM_SMT_CHN8_CONFIG
 
 /* Mailbox and CRC types to support */
 /*! Config for MB_LOOPBACK USE */
@@ -90,6 +90,7 @@
     { \
         .mbInst = 1U, \
         .mbDoorbell = 0U, \
+        .size = 512U, \
         .agentId = 1U, \
     }
 
@@ -103,26 +104,42 @@
 
 /*! Config for test channel 5 */
 #define SM_TEST_CHN5_CONFIG \
+    { \
+        .mbInst = 1U, \
+        .mbDoorbell = 2U, \
+        .agentId = 1U, \
+    }
+
+/*! Config for test channel 6 */
+#define SM_TEST_CHN6_CONFIG \
     { \
         .mbInst = 2U, \
         .mbDoorbell = 0U, \
         .agentId = 2U, \
     }
 
-/*! Config for test channel 6 */
-#define SM_TEST_CHN6_CONFIG \
+/*! Config for test channel 7 */
+#define SM_TEST_CHN7_CONFIG \
     { \
         .mbInst = 2U, \
         .mbDoorbell = 1U, \
         .agentId = 2U, \
     }
 
+/*! Config for test channel 8 */
+#define SM_TEST_CHN8_CONFIG \
+    { \
+        .mbInst = 3U, \
+        .mbDoorbell = 0U, \
+        .agentId = 3U, \
+    }
+
 /*--------------------------------------------------------------------------*/
 /* Test Channel Config                                                      */
 /*--------------------------------------------------------------------------*/
 
 /*! Config for number of test channels */
-#define SM_NUM_TEST_CHN  7U
+#define SM_NUM_TEST_CHN  9U
 
 /*! Config data array for test channels */
 #define SM_TEST_CHN_CONFIG_DATA \
@@ -132,7 +149,9 @@
     SM_TEST_CHN3_CONFIG, \
     SM_TEST_CHN4_CONFIG, \
     SM_TEST_CHN5_CONFIG, \
-    SM_TEST_CHN6_CONFIG
+    SM_TEST_CHN6_CONFIG, \
+    SM_TEST_CHN7_CONFIG, \
+    SM_TEST_CHN8_CONFIG
 
 /*--------------------------------------------------------------------------*/
 /* Test Config                                                              */
@@ -146,40 +165,40 @@
     {.testId = TEST_BASE, .channel = 0U, .rsrc = DEV_SM_BASE_AGENT_1}, \
     {.testId = TEST_BASE, .channel = 3U, .rsrc = DEV_SM_BASE_AGENT_1}, \
     {.testId = TEST_BUTTON, .channel = 0U, .rsrc = DEV_SM_BUTTON_0}, \
-    {.testId = TEST_BUTTON, .channel = 5U, .rsrc = DEV_SM_BUTTON_0}, \
+    {.testId = TEST_BUTTON, .channel = 6U, .rsrc = DEV_SM_BUTTON_0}, \
     {.testId = TEST_CLK, .channel = 3U, .rsrc = DEV_SM_CLK_0}, \
-    {.testId = TEST_CLK, .channel = 5U, .rsrc = DEV_SM_CLK_2}, \
+    {.testId = TEST_CLK, .channel = 6U, .rsrc = DEV_SM_CLK_2}, \
     {.testId = TEST_CPU, .channel = 0U, .rsrc = DEV_SM_CPU_1}, \
     {.testId = TEST_CPU, .channel = 3U, .rsrc = DEV_SM_CPU_2}, \
     {.testId = TEST_CTRL, .channel = 3U, .rsrc = DEV_SM_CTRL_TEST}, \
-    {.testId = TEST_CTRL, .channel = 5U, .rsrc = DEV_SM_CTRL_TEST}, \
-    {.testId = TEST_GPR, .channel = 5U, .rsrc = DEV_SM_GPR_2}, \
-    {.testId = TEST_GPR, .channel = 5U, .rsrc = DEV_SM_GPR_3}, \
+    {.testId = TEST_CTRL, .channel = 6U, .rsrc = DEV_SM_CTRL_TEST}, \
+    {.testId = TEST_GPR, .channel = 6U, .rsrc = DEV_SM_GPR_2}, \
+    {.testId = TEST_GPR, .channel = 6U, .rsrc = DEV_SM_GPR_3}, \
     {.testId = TEST_LMM, .channel = 0U, .rsrc = 2U}, \
     {.testId = TEST_LMM, .channel = 3U, .rsrc = 1U}, \
     {.testId = TEST_PD, .channel = 3U, .rsrc = DEV_SM_PD_2}, \
     {.testId = TEST_PD, .channel = 3U, .rsrc = DEV_SM_PD_4}, \
-    {.testId = TEST_PD, .channel = 5U, .rsrc = DEV_SM_PD_6}, \
+    {.testId = TEST_PD, .channel = 6U, .rsrc = DEV_SM_PD_6}, \
     {.testId = TEST_PERF, .channel = 3U, .rsrc = DEV_SM_PERF_0}, \
     {.testId = TEST_PERF, .channel = 3U, .rsrc = DEV_SM_PERF_1}, \
-    {.testId = TEST_PERF, .channel = 5U, .rsrc = DEV_SM_PERF_1}, \
-    {.testId = TEST_PIN, .channel = 5U, .rsrc = DEV_SM_PIN_0}, \
+    {.testId = TEST_PERF, .channel = 6U, .rsrc = DEV_SM_PERF_1}, \
+    {.testId = TEST_PIN, .channel = 6U, .rsrc = DEV_SM_PIN_0}, \
     {.testId = TEST_RST, .channel = 0U, .rsrc = DEV_SM_RST_0}, \
     {.testId = TEST_RST, .channel = 3U, .rsrc = DEV_SM_RST_1}, \
-    {.testId = TEST_RST, .channel = 5U, .rsrc = DEV_SM_RST_2}, \
+    {.testId = TEST_RST, .channel = 6U, .rsrc = DEV_SM_RST_2}, \
     {.testId = TEST_RTC, .channel = 0U, .rsrc = DEV_SM_RTC_BBM}, \
-    {.testId = TEST_RTC, .channel = 5U, .rsrc = BRD_SM_RTC_PMIC}, \
-    {.testId = TEST_RTC, .channel = 5U, .rsrc = DEV_SM_RTC_BBM}, \
+    {.testId = TEST_RTC, .channel = 6U, .rsrc = BRD_SM_RTC_PMIC}, \
+    {.testId = TEST_RTC, .channel = 6U, .rsrc = DEV_SM_RTC_BBM}, \
     {.testId = TEST_SENSOR, .channel = 0U, .rsrc = DEV_SM_SENSOR_0}, \
     {.testId = TEST_SENSOR, .channel = 0U, .rsrc = DEV_SM_SENSOR_1}, \
     {.testId = TEST_SENSOR, .channel = 3U, .rsrc = DEV_SM_SENSOR_0}, \
     {.testId = TEST_SENSOR, .channel = 3U, .rsrc = DEV_SM_SENSOR_1}, \
-    {.testId = TEST_SENSOR, .channel = 5U, .rsrc = BRD_SM_SENSOR_0}, \
+    {.testId = TEST_SENSOR, .channel = 6U, .rsrc = BRD_SM_SENSOR_0}, \
     {.testId = TEST_SYS, .channel = 3U, .rsrc = 0U}, \
-    {.testId = TEST_SYS, .channel = 5U, .rsrc = 0U}, \
+    {.testId = TEST_SYS, .channel = 6U, .rsrc = 0U}, \
     {.testId = TEST_VOLT, .channel = 0U, .rsrc = DEV_SM_VOLT_1}, \
     {.testId = TEST_VOLT, .channel = 3U, .rsrc = DEV_SM_VOLT_1}, \
-    {.testId = TEST_VOLT, .channel = 5U, .rsrc = DEV_SM_VOLT_2}
+    {.testId = TEST_VOLT, .channel = 6U, .rsrc = DEV_SM_VOLT_2}
 
 /*! Default channel for non-agent specific tests */
 #define SM_TEST_DEFAULT_CHN  0U
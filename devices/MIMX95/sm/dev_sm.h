@@ -118,6 +118,32 @@ int32_t DEV_SM_PowerUpPost(uint32_t domainId);
  */
 int32_t DEV_SM_PowerDownPre(uint32_t domainId);
 
+/*!
+ * Record a clock rate change.
+ *
+ * @param[in]  clockId     clock whose rate or parent was changed
+ *
+ * Changes are collected until DEV_SM_ClockRateReport() is called so a
+ * sequence of updates (e.g. a PLL relock) is reported once.
+ */
+void DEV_SM_ClockRateChanged(uint32_t clockId);
+
+/*!
+ * Report recorded clock rate changes.
+ *
+ * Reports the rate of each recorded clock and all clocks currently derived
+ * from it via the source, root mux, and GPR select parents.
+ */
+void DEV_SM_ClockRateReport(void);
+
+/*!
+ * Dump clock errors.
+ *
+ * Dumps the last clock rate cache mismatch found by a CLOCK_RATE_CHECK
+ * build.
+ */
+void DEV_SM_ClockErrorDump(void);
+
 #endif /* DEV_SM_H */
 
 /** @} */
@@ -40,13 +40,93 @@
 
 #include "sm.h"
 #include "dev_sm.h"
+#include "lmm.h"
 
 /* Local defines */
 
+/* Number of words in a clock bitmap */
+#define DEV_SM_CLOCK_WORDS  (((DEV_SM_NUM_CLOCK - 1U) / 32U) + 1U)
+
+/* Number of words in a root bitmap */
+#define DEV_SM_ROOT_WORDS  (((CLOCK_NUM_ROOT - 1U) / 32U) + 1U)
+
 /* Local types */
 
+#ifdef CLOCK_RATE_CHECK
+/* Clock rate cache mismatch record */
+typedef struct
+{
+    uint32_t clockId;
+    uint32_t count;
+    uint64_t cached;
+    uint64_t rate;
+} clock_rate_err_t;
+#endif
+
 /* Local variables */
 
+/* Parent of each derived clock source, 0 if none (EXT is never a parent) */
+static const uint8_t s_clockSrcParent[CLOCK_NUM_SRC] =
+{
+    [CLOCK_SRC_SYSPLL1_PFD0_UNGATED] = CLOCK_SRC_SYSPLL1_VCO,
+    [CLOCK_SRC_SYSPLL1_PFD0] =         CLOCK_SRC_SYSPLL1_PFD0_UNGATED,
+    [CLOCK_SRC_SYSPLL1_PFD0_DIV2] =    CLOCK_SRC_SYSPLL1_PFD0_UNGATED,
+    [CLOCK_SRC_SYSPLL1_PFD1_UNGATED] = CLOCK_SRC_SYSPLL1_VCO,
+    [CLOCK_SRC_SYSPLL1_PFD1] =         CLOCK_SRC_SYSPLL1_PFD1_UNGATED,
+    [CLOCK_SRC_SYSPLL1_PFD1_DIV2] =    CLOCK_SRC_SYSPLL1_PFD1_UNGATED,
+    [CLOCK_SRC_SYSPLL1_PFD2_UNGATED] = CLOCK_SRC_SYSPLL1_VCO,
+    [CLOCK_SRC_SYSPLL1_PFD2] =         CLOCK_SRC_SYSPLL1_PFD2_UNGATED,
+    [CLOCK_SRC_SYSPLL1_PFD2_DIV2] =    CLOCK_SRC_SYSPLL1_PFD2_UNGATED,
+    [CLOCK_SRC_AUDIOPLL1] =            CLOCK_SRC_AUDIOPLL1_VCO,
+    [CLOCK_SRC_AUDIOPLL2] =            CLOCK_SRC_AUDIOPLL2_VCO,
+    [CLOCK_SRC_VIDEOPLL1] =            CLOCK_SRC_VIDEOPLL1_VCO,
+    [CLOCK_SRC_ARMPLL_PFD0_UNGATED] =  CLOCK_SRC_ARMPLL_VCO,
+    [CLOCK_SRC_ARMPLL_PFD0] =          CLOCK_SRC_ARMPLL_PFD0_UNGATED,
+    [CLOCK_SRC_ARMPLL_PFD1_UNGATED] =  CLOCK_SRC_ARMPLL_VCO,
+    [CLOCK_SRC_ARMPLL_PFD1] =          CLOCK_SRC_ARMPLL_PFD1_UNGATED,
+    [CLOCK_SRC_ARMPLL_PFD2_UNGATED] =  CLOCK_SRC_ARMPLL_VCO,
+    [CLOCK_SRC_ARMPLL_PFD2] =          CLOCK_SRC_ARMPLL_PFD2_UNGATED,
+    [CLOCK_SRC_ARMPLL_PFD3_UNGATED] =  CLOCK_SRC_ARMPLL_VCO,
+    [CLOCK_SRC_ARMPLL_PFD3] =          CLOCK_SRC_ARMPLL_PFD3_UNGATED,
+    [CLOCK_SRC_DRAMPLL] =              CLOCK_SRC_DRAMPLL_VCO,
+    [CLOCK_SRC_HSIOPLL] =              CLOCK_SRC_HSIOPLL_VCO,
+    [CLOCK_SRC_LDBPLL] =               CLOCK_SRC_LDBPLL_VCO
+};
+
+/* Clocks changed since the last report, bitmap */
+static uint32_t s_clockRateChanged[DEV_SM_CLOCK_WORDS];
+
+/* Roots that can select each source, bitmap per source */
+static uint32_t s_clockSrcRoots[CLOCK_NUM_SRC][DEV_SM_ROOT_WORDS];
+static bool s_clockSrcRootsInit = false;
+
+/* Mux inputs usable by the root rate solver, bitmap per root */
+static uint8_t s_clockRootCand[CLOCK_NUM_ROOT];
+static bool s_clockRootCandInit = false;
+
+/* Cached clock rates, valid if set in the valid bitmap */
+static uint64_t s_clockRate[DEV_SM_NUM_CLOCK];
+static uint32_t s_clockRateValid[DEV_SM_CLOCK_WORDS];
+
+#ifdef CLOCK_RATE_CHECK
+/* Last clock rate cache mismatch */
+static clock_rate_err_t s_clockRateErr;
+#endif
+
+/* Local functions */
+
+static int32_t DEV_SM_ClockRateRead(uint32_t clockId, uint64_t *rate);
+static bool DEV_SM_ClockRateCacheable(uint32_t clockId);
+static void DEV_SM_ClockRateInvalidate(uint32_t clockId);
+static void DEV_SM_ClockAffectedGet(uint32_t *affected);
+static uint32_t DEV_SM_ClockSrcTop(uint32_t sourceIdx);
+static int32_t DEV_SM_ClockRootSolve(uint32_t rootIdx, uint64_t rate,
+    uint32_t roundRule);
+static bool DEV_SM_ClockRootDivGet(uint64_t srcRate, uint64_t rate,
+    uint32_t roundRule, uint32_t *divider);
+static void DEV_SM_ClockRootCandInit(void);
+static void DEV_SM_ClockSrcRootsInit(void);
+
 /*--------------------------------------------------------------------------*/
 /* Return clock name                                                        */
 /*--------------------------------------------------------------------------*/
@@ -715,10 +795,26 @@ int32_t DEV_SM_ClockRateSet(uint32_t clockId, uint64_t rate,
     uint32_t roundSel)
 {
     int32_t status = SM_ERR_SUCCESS;
+    uint32_t roundRule = roundSel & ~DEV_SM_CLOCK_ROUND_PARENT;
+    bool notify = LMM_ClockRateNotifyEnabled();
+    uint64_t oldRate = 0ULL;
 
-    if (clockId < CLOCK_NUM_SRC)
+    /* Save rate to detect change, only needed to notify */
+    if (notify)
+    {
+        (void) DEV_SM_ClockRateGet(clockId, &oldRate);
+    }
+
+    /* Search parents of a root for the best rate? */
+    if ((roundRule != roundSel) && (clockId >= CLOCK_NUM_SRC)
+        && ((clockId - CLOCK_NUM_SRC) < CLOCK_NUM_ROOT))
     {
-        switch(roundSel)
+        status = DEV_SM_ClockRootSolve(clockId - CLOCK_NUM_SRC, rate,
+            roundRule);
+    }
+    else if (clockId < CLOCK_NUM_SRC)
+    {
+        switch(roundRule)
         {
             case DEV_SM_CLOCK_ROUND_DOWN:
                 if (!CLOCK_SourceSetRate(clockId, rate,
@@ -755,7 +851,7 @@ int32_t DEV_SM_ClockRateSet(uint32_t clockId, uint64_t rate,
 
         if (clockIndex < CLOCK_NUM_ROOT)
         {
-            switch(roundSel)
+            switch(roundRule)
             {
                 case DEV_SM_CLOCK_ROUND_DOWN:
                     if (!CCM_RootSetRate(clockIndex, rate,
@@ -801,6 +897,23 @@ int32_t DEV_SM_ClockRateSet(uint32_t clockId, uint64_t rate,
         }
     }
 
+    /* Report rate change */
+    if (status == SM_ERR_SUCCESS)
+    {
+        uint64_t newRate = 0ULL;
+
+        /* Drop cached rates of the clock and derived clocks */
+        DEV_SM_ClockRateInvalidate(clockId);
+
+        /* Notify if the rate changed */
+        if (notify && (DEV_SM_ClockRateGet(clockId, &newRate)
+            == SM_ERR_SUCCESS) && (newRate != oldRate))
+        {
+            s_clockRateChanged[clockId / 32U] |= BIT32(clockId);
+            DEV_SM_ClockRateReport();
+        }
+    }
+
     /* Return status */
     return status;
 }
@@ -812,30 +925,40 @@ int32_t DEV_SM_ClockRateGet(uint32_t clockId, uint64_t *rate)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    if (clockId < CLOCK_NUM_SRC)
+    if ((clockId < DEV_SM_NUM_CLOCK)
+        && ((s_clockRateValid[clockId / 32U] & BIT32(clockId)) != 0U))
     {
-        *rate = CLOCK_SourceGetRate(clockId);
+        /* Return cached rate */
+        *rate = s_clockRate[clockId];
+
+#ifdef CLOCK_RATE_CHECK
+        uint64_t hwRate = 0ULL;
+
+        /* Cross-check with hardware, record and fix mismatch */
+        (void) DEV_SM_ClockRateRead(clockId, &hwRate);
+        if (hwRate != *rate)
+        {
+            s_clockRateErr.clockId = clockId;
+            s_clockRateErr.count++;
+            s_clockRateErr.cached = *rate;
+            s_clockRateErr.rate = hwRate;
+
+            s_clockRate[clockId] = hwRate;
+            *rate = hwRate;
+        }
+#endif
     }
     else
     {
-        uint32_t clockIndex = clockId - CLOCK_NUM_SRC;
+        /* Read rate from hardware */
+        status = DEV_SM_ClockRateRead(clockId, rate);
 
-        if (clockIndex < CLOCK_NUM_ROOT)
+        /* Cache rate */
+        if ((status == SM_ERR_SUCCESS)
+            && DEV_SM_ClockRateCacheable(clockId))
         {
-            *rate = CCM_RootGetRate(clockIndex);
-        }
-        else
-        {
-            clockIndex = clockIndex - CLOCK_NUM_ROOT;
-
-            if (clockIndex < CLOCK_NUM_GPR_SEL)
-            {
-                *rate = CCM_GprSelGetRate(clockIndex);
-            }
-            else
-            {
-                status = SM_ERR_NOT_FOUND;
-            }
+            s_clockRate[clockId] = *rate;
+            s_clockRateValid[clockId / 32U] |= BIT32(clockId);
         }
     }
 
@@ -931,6 +1054,10 @@ int32_t DEV_SM_ClockIsEnabled(uint32_t clockId, bool *enabled)
 int32_t DEV_SM_ClockParentSet(uint32_t clockId, uint32_t parent)
 {
     int32_t status = SM_ERR_SUCCESS;
+    uint32_t oldParent = 0U;
+
+    /* Save parent to detect change */
+    (void) DEV_SM_ClockParentGet(clockId, &oldParent);
 
     if (clockId < CLOCK_NUM_SRC)
     {
@@ -965,6 +1092,13 @@ int32_t DEV_SM_ClockParentSet(uint32_t clockId, uint32_t parent)
         }
     }
 
+    /* Report rate change */
+    if ((status == SM_ERR_SUCCESS) && (parent != oldParent))
+    {
+        DEV_SM_ClockRateChanged(clockId);
+        DEV_SM_ClockRateReport();
+    }
+
     /* Return status */
     return status;
 }
@@ -1013,3 +1147,492 @@ int32_t DEV_SM_ClockParentGet(uint32_t clockId, uint32_t *parent)
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Record clock rate change                                                 */
+/*--------------------------------------------------------------------------*/
+void DEV_SM_ClockRateChanged(uint32_t clockId)
+{
+    if (clockId < DEV_SM_NUM_CLOCK)
+    {
+        s_clockRateChanged[clockId / 32U] |= BIT32(clockId);
+    }
+
+    /* Drop cached rates of the clock and derived clocks */
+    DEV_SM_ClockRateInvalidate(clockId);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Report recorded clock rate changes                                       */
+/*--------------------------------------------------------------------------*/
+void DEV_SM_ClockRateReport(void)
+{
+    uint32_t affected[DEV_SM_CLOCK_WORDS];
+    bool changed = false;
+
+    /* Take recorded changes */
+    for (uint32_t idx = 0U; idx < DEV_SM_CLOCK_WORDS; idx++)
+    {
+        affected[idx] = s_clockRateChanged[idx];
+        s_clockRateChanged[idx] = 0U;
+        if (affected[idx] != 0U)
+        {
+            changed = true;
+        }
+    }
+
+    /* Skip the walk if no agent is notified */
+    if (changed && LMM_ClockRateNotifyEnabled())
+    {
+        /* Add clocks derived from changed clocks */
+        DEV_SM_ClockAffectedGet(affected);
+
+        /* Report new rates */
+        for (uint32_t clockId = 0U; clockId < DEV_SM_NUM_CLOCK; clockId++)
+        {
+            if ((affected[clockId / 32U] & BIT32(clockId)) != 0U)
+            {
+                uint64_t rate = 0ULL;
+
+                (void) DEV_SM_ClockRateGet(clockId, &rate);
+                LMM_ClockRateEvent(clockId, rate);
+            }
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Dump clock errors                                                        */
+/*--------------------------------------------------------------------------*/
+void DEV_SM_ClockErrorDump(void)
+{
+#if defined(CLOCK_RATE_CHECK) && defined(MONITOR)
+    if (s_clockRateErr.count != 0U)
+    {
+        printf("Clock rate cache err (clk=%u): ", s_clockRateErr.clockId);
+        printf("cached=%ukHz", (uint32_t) (s_clockRateErr.cached / 1000ULL));
+        printf(", rate=%ukHz", (uint32_t) (s_clockRateErr.rate / 1000ULL));
+        printf(", count=%u\n", s_clockRateErr.count);
+
+        /* Clear log */
+        s_clockRateErr.count = 0U;
+    }
+#endif
+}
+
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Read clock rate from hardware                                            */
+/*--------------------------------------------------------------------------*/
+static int32_t DEV_SM_ClockRateRead(uint32_t clockId, uint64_t *rate)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    if (clockId < CLOCK_NUM_SRC)
+    {
+        *rate = CLOCK_SourceGetRate(clockId);
+    }
+    else
+    {
+        uint32_t clockIndex = clockId - CLOCK_NUM_SRC;
+
+        if (clockIndex < CLOCK_NUM_ROOT)
+        {
+            *rate = CCM_RootGetRate(clockIndex);
+        }
+        else
+        {
+            clockIndex = clockIndex - CLOCK_NUM_ROOT;
+
+            if (clockIndex < CLOCK_NUM_GPR_SEL)
+            {
+                *rate = CCM_GprSelGetRate(clockIndex);
+            }
+            else
+            {
+                status = SM_ERR_NOT_FOUND;
+            }
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check if clock rate can be cached                                        */
+/*--------------------------------------------------------------------------*/
+static bool DEV_SM_ClockRateCacheable(uint32_t clockId)
+{
+    uint32_t id = clockId;
+    bool cacheable = false;
+    bool done = false;
+
+    /* Follow parents to the source at the top of the tree */
+    while (!done)
+    {
+        uint32_t parent = 0U;
+
+        if (id < CLOCK_NUM_SRC)
+        {
+            id = DEV_SM_ClockSrcTop(id);
+
+            /* PLLs in mixes read as 0Hz when the mix is powered down */
+            cacheable = (id != CLOCK_SRC_ARMPLL_VCO)
+                && (id != CLOCK_SRC_DRAMPLL_VCO)
+                && (id != CLOCK_SRC_HSIOPLL_VCO)
+                && (id != CLOCK_SRC_LDBPLL_VCO);
+            done = true;
+        }
+        else if ((DEV_SM_ClockParentGet(id, &parent) == SM_ERR_SUCCESS)
+            && (parent < id))
+        {
+            id = parent;
+        }
+        else
+        {
+            done = true;
+        }
+    }
+
+    /* Return result */
+    return cacheable;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Invalidate cached rate of a clock and all derived clocks                 */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_ClockRateInvalidate(uint32_t clockId)
+{
+    if (clockId < DEV_SM_NUM_CLOCK)
+    {
+        uint32_t stale[DEV_SM_CLOCK_WORDS] = { 0U };
+        uint32_t id = clockId;
+
+        /* PLL output changes can also change the (latched) VCO rate */
+        if (id < CLOCK_NUM_SRC)
+        {
+            id = DEV_SM_ClockSrcTop(id);
+        }
+        stale[id / 32U] |= BIT32(id);
+        stale[clockId / 32U] |= BIT32(clockId);
+
+        /* Add derived clocks */
+        DEV_SM_ClockAffectedGet(stale);
+
+        /* Invalidate */
+        for (uint32_t idx = 0U; idx < DEV_SM_CLOCK_WORDS; idx++)
+        {
+            s_clockRateValid[idx] &= ~stale[idx];
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Add all clocks currently derived from clocks in the bitmap               */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_ClockAffectedGet(uint32_t *affected)
+{
+    uint32_t roots[DEV_SM_ROOT_WORDS] = { 0U };
+
+    /* Build root child lists */
+    if (!s_clockSrcRootsInit)
+    {
+        DEV_SM_ClockSrcRootsInit();
+    }
+
+    /* EXT follows EXT1 through the EXT GPR select */
+    if (((affected[DEV_SM_CLK_EXT1 / 32U] & BIT32(DEV_SM_CLK_EXT1))
+        != 0U) || ((affected[DEV_SM_CLK_EXT_GPR_SEL / 32U]
+        & BIT32(DEV_SM_CLK_EXT_GPR_SEL)) != 0U))
+    {
+        affected[DEV_SM_CLK_EXT / 32U] |= BIT32(DEV_SM_CLK_EXT);
+    }
+
+    /* Sources, parents precede children */
+    for (uint32_t srcIdx = 0U; srcIdx < CLOCK_NUM_SRC; srcIdx++)
+    {
+        uint32_t parent = s_clockSrcParent[srcIdx];
+
+        /* Inherit change from parent */
+        if ((parent != 0U)
+            && ((affected[parent / 32U] & BIT32(parent)) != 0U))
+        {
+            affected[srcIdx / 32U] |= BIT32(srcIdx);
+        }
+
+        /* Collect roots that can select the source */
+        if ((affected[srcIdx / 32U] & BIT32(srcIdx)) != 0U)
+        {
+            for (uint32_t idx = 0U; idx < DEV_SM_ROOT_WORDS; idx++)
+            {
+                roots[idx] |= s_clockSrcRoots[srcIdx][idx];
+            }
+        }
+    }
+
+    /* Roots, only check the current parent of possible children */
+    for (uint32_t idx = 0U; idx < DEV_SM_ROOT_WORDS; idx++)
+    {
+        uint32_t pending = roots[idx];
+
+        while (pending != 0U)
+        {
+            uint32_t lsb = pending & (~pending + 1U);
+            uint32_t rootIdx = (idx * 32U) + (31U
+                - ((uint32_t) __CLZ(lsb)));
+            uint32_t parent = 0U;
+
+            /* Clear from pending */
+            pending &= ~lsb;
+
+            /* Inherit change from current parent */
+            if (CCM_RootGetParent(rootIdx, &parent)
+                && ((affected[parent / 32U] & BIT32(parent)) != 0U))
+            {
+                uint32_t clockId = rootIdx + CLOCK_NUM_SRC;
+
+                affected[clockId / 32U] |= BIT32(clockId);
+            }
+        }
+    }
+
+    /* GPR selects, parents are sources or roots */
+    for (uint32_t gprSelIdx = 0U; gprSelIdx < CLOCK_NUM_GPR_SEL;
+        gprSelIdx++)
+    {
+        uint32_t parent = 0U;
+
+        if (CCM_GprSelGetParent(gprSelIdx, &parent)
+            && (parent < DEV_SM_NUM_CLOCK)
+            && ((affected[parent / 32U] & BIT32(parent)) != 0U))
+        {
+            uint32_t clockId = gprSelIdx + CLOCK_NUM_SRC + CLOCK_NUM_ROOT;
+
+            affected[clockId / 32U] |= BIT32(clockId);
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Return the source at the top of a source tree (e.g. PLL VCO)             */
+/*--------------------------------------------------------------------------*/
+static uint32_t DEV_SM_ClockSrcTop(uint32_t sourceIdx)
+{
+    uint32_t id = sourceIdx;
+
+    while (s_clockSrcParent[id] != 0U)
+    {
+        id = s_clockSrcParent[id];
+    }
+
+    /* Return result */
+    return id;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Set root rate using the best parent and divider                          */
+/*--------------------------------------------------------------------------*/
+static int32_t DEV_SM_ClockRootSolve(uint32_t rootIdx, uint64_t rate,
+    uint32_t roundRule)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    uint32_t oldParent = 0U;
+    uint32_t oldDiv = 0U;
+    uint32_t newParent = 0U;
+    uint32_t newDiv = 0U;
+    uint64_t bestDelta = 0ULL;
+    bool found = false;
+
+    /* Build candidate tables */
+    if (!s_clockRootCandInit)
+    {
+        DEV_SM_ClockRootCandInit();
+    }
+
+    /* Get current config */
+    if ((rate == 0ULL) || (roundRule > DEV_SM_CLOCK_ROUND_AUTO)
+        || !CCM_RootGetParent(rootIdx, &oldParent)
+        || !CCM_RootGetDiv(rootIdx, &oldDiv))
+    {
+        status = SM_ERR_INVALID_PARAMETERS;
+    }
+
+    /* Loop over candidate parents */
+    for (uint32_t mux = 0U; (status == SM_ERR_SUCCESS)
+        && (mux < CLOCK_NUM_ROOT_MUX_SEL); mux++)
+    {
+        uint32_t parent = g_clockRootMux[rootIdx][mux];
+        uint64_t srcRate = 0ULL;
+        uint32_t div = 0U;
+
+        /* Skip if not a candidate or not running */
+        if (((s_clockRootCand[rootIdx] & BIT8(mux)) != 0U)
+            && CLOCK_SourceGetEnable(parent)
+            && (DEV_SM_ClockRateGet(parent, &srcRate) == SM_ERR_SUCCESS)
+            && DEV_SM_ClockRootDivGet(srcRate, rate, roundRule, &div))
+        {
+            uint64_t newRate = srcRate / ((uint64_t) div);
+            uint64_t delta = (newRate > rate) ? (newRate - rate)
+                : (rate - newRate);
+
+            /* Keep best, prefer current parent on a tie */
+            if (!found || (delta < bestDelta) || ((delta == bestDelta)
+                && (parent == oldParent)))
+            {
+                newParent = parent;
+                newDiv = div;
+                bestDelta = delta;
+                found = true;
+            }
+        }
+    }
+
+    if ((status == SM_ERR_SUCCESS) && !found)
+    {
+        status = SM_ERR_INVALID_PARAMETERS;
+    }
+
+    /* Switch without exceeding the higher of the old and new rates */
+    if (status == SM_ERR_SUCCESS)
+    {
+        /* If new divider is larger, apply first */
+        if ((newDiv > oldDiv) && !CCM_RootSetDiv(rootIdx, newDiv))
+        {
+            status = SM_ERR_HARDWARE_ERROR;
+        }
+
+        /* Glitch-free mux switch, both sources are running */
+        if ((status == SM_ERR_SUCCESS) && (newParent != oldParent)
+            && !CCM_RootSetParent(rootIdx, newParent))
+        {
+            status = SM_ERR_HARDWARE_ERROR;
+        }
+
+        if ((status == SM_ERR_SUCCESS) && (newDiv < oldDiv)
+            && !CCM_RootSetDiv(rootIdx, newDiv))
+        {
+            status = SM_ERR_HARDWARE_ERROR;
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get root divider for a rate using a rounding rule                        */
+/*--------------------------------------------------------------------------*/
+static bool DEV_SM_ClockRootDivGet(uint64_t srcRate, uint64_t rate,
+    uint32_t roundRule, uint32_t *divider)
+{
+    bool valid = false;
+    uint64_t div = 0ULL;
+
+    if (srcRate != 0ULL)
+    {
+        switch (roundRule)
+        {
+            case DEV_SM_CLOCK_ROUND_DOWN:
+                /* Smallest divider giving a rate <= requested */
+                div = (srcRate + rate - 1ULL) / rate;
+                valid = (div <= 256ULL);
+                break;
+
+            case DEV_SM_CLOCK_ROUND_UP:
+                /* Largest divider giving a rate >= requested */
+                div = MIN(srcRate / rate, 256ULL);
+                valid = (div >= 1ULL);
+                break;
+
+            default:
+                /* Closest of the two dividers around the rate */
+                div = srcRate / rate;
+                if (div == 0ULL)
+                {
+                    div = 1ULL;
+                }
+                else if (div >= 256ULL)
+                {
+                    div = 256ULL;
+                }
+                else
+                {
+                    if (((srcRate / div) - rate)
+                        > (rate - (srcRate / (div + 1ULL))))
+                    {
+                        div++;
+                    }
+                }
+                valid = true;
+                break;
+        }
+    }
+
+    /* Return divider */
+    *divider = (uint32_t) div;
+
+    /* Return result */
+    return valid;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Build root rate solver candidate tables                                  */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_ClockRootCandInit(void)
+{
+    /* Loop over roots */
+    for (uint32_t rootIdx = 0U; rootIdx < CLOCK_NUM_ROOT; rootIdx++)
+    {
+        uint8_t cand = 0U;
+
+        /* Loop over mux inputs */
+        for (uint32_t mux = 0U; mux < CLOCK_NUM_ROOT_MUX_SEL; mux++)
+        {
+            uint32_t parent = g_clockRootMux[rootIdx][mux];
+            uint32_t top = DEV_SM_ClockSrcTop(parent);
+            bool dup = false;
+
+            /* Skip duplicate inputs */
+            for (uint32_t prev = 0U; prev < mux; prev++)
+            {
+                if (g_clockRootMux[rootIdx][prev] == parent)
+                {
+                    dup = true;
+                }
+            }
+
+            /* ARM and DRAM PLLs are changed by their perf domains */
+            if (!dup && (top != CLOCK_SRC_ARMPLL_VCO)
+                && (top != CLOCK_SRC_DRAMPLL_VCO))
+            {
+                cand |= (uint8_t) BIT8(mux);
+            }
+        }
+
+        s_clockRootCand[rootIdx] = cand;
+    }
+
+    s_clockRootCandInit = true;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Build the list of roots that can select each source                      */
+/*--------------------------------------------------------------------------*/
+static void DEV_SM_ClockSrcRootsInit(void)
+{
+    /* Loop over roots */
+    for (uint32_t rootIdx = 0U; rootIdx < CLOCK_NUM_ROOT; rootIdx++)
+    {
+        /* Loop over mux inputs */
+        for (uint32_t mux = 0U; mux < CLOCK_NUM_ROOT_MUX_SEL; mux++)
+        {
+            uint32_t srcIdx = g_clockRootMux[rootIdx][mux];
+
+            s_clockSrcRoots[srcIdx][rootIdx / 32U] |= BIT32(rootIdx);
+        }
+    }
+
+    s_clockSrcRootsInit = true;
+}
+
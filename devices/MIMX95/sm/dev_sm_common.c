@@ -126,6 +126,15 @@ uint64_t DEV_SM_Usec64Get(void)
     return SYSCTR_GetUsec64();
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get time in nanoseconds                                                  */
+/*--------------------------------------------------------------------------*/
+uint64_t DEV_SM_Nsec64Get(void)
+{
+    /* 24MHz counter, 125/3 nS per tick */
+    return (SYSCTR_GetCounter64() * 125ULL) / 3ULL;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Get address of a fuse word                                               */
 /*--------------------------------------------------------------------------*/
@@ -150,6 +159,8 @@ int32_t DEV_SM_FuseInfoGet(uint32_t fuseWord, uint32_t *addr)
 /*--------------------------------------------------------------------------*/
 void DEV_SM_ErrorDump(void)
 {
+    /* Dump clock errors */
+    DEV_SM_ClockErrorDump();
 }
 
 /*--------------------------------------------------------------------------*/
@@ -145,6 +145,9 @@ void SysTick_Handler(void)
     /* Call board tick */
     BRD_SM_TimerTick(BOARD_TICK_PERIOD_MSEC);
 
+    /* Poll RPC FastChannels */
+    LMM_RpcPoll();
+
     s_smTimeMsec += BOARD_TICK_PERIOD_MSEC;
 }
 
@@ -247,6 +250,20 @@ void Reserved110_IRQHandler(void)
     LMM_Handler();
 }
 
+/*--------------------------------------------------------------------------*/
+/* Handler for PendSV                                                       */
+/*--------------------------------------------------------------------------*/
+void PendSV_Handler(void)
+{
+    LMM_RpcHandler();
+
+    /* Background board work only once no RPC requests are pending */
+    if (!LMM_RpcPending())
+    {
+        BRD_SM_DeferredHandler();
+    }
+}
+
 /*--------------------------------------------------------------------------*/
 /* ELE Group #1 IRQ exception handler                                       */
 /*--------------------------------------------------------------------------*/
@@ -462,6 +479,13 @@ void GPC_SM_REQ_IRQHandler(void)
         CPU_MixPowerDownNotify(lpHsMode.srcMixIdx);
     }
 
+    /* Report hardware-driven power transitions */
+    if (lpHsMode.req == PWR_GPC_REQ_STATE_POWER)
+    {
+        LMM_PowerEvent(lpHsMode.srcMixIdx, (lpHsMode.stat == 1U)
+            ? DEV_SM_POWER_STATE_ON : DEV_SM_POWER_STATE_OFF);
+    }
+
     PWR_LpHandshakeAck();
 }
 
@@ -474,6 +498,31 @@ void SWI_Trigger(void)
     NVIC_SetPendingIRQ(BOARD_SWI_IRQn);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Trigger PendSV exception                                                 */
+/*--------------------------------------------------------------------------*/
+void PENDSV_Trigger(void)
+{
+    /* Trigger PendSV handler */
+    SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Mask interrupts                                                          */
+/*--------------------------------------------------------------------------*/
+uint32_t IRQ_Lock(void)
+{
+    return DisableGlobalIRQ();
+}
+
+/*--------------------------------------------------------------------------*/
+/* Restore interrupt mask                                                   */
+/*--------------------------------------------------------------------------*/
+void IRQ_Unlock(uint32_t state)
+{
+    EnableGlobalIRQ(state);
+}
+
 /*--------------------------------------------------------------------------*/
 /* Get time elapsed in msec                                                 */
 /*--------------------------------------------------------------------------*/
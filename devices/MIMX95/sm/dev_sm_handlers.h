@@ -162,6 +162,11 @@ void TMPSNS_CORTEXA_2_IRQHandler(void);
  */
 void Reserved110_IRQHandler(void);
 
+/*!
+ * PendSV handler.
+ */
+void PendSV_Handler(void);
+
 /*!
  * ELE group 1 handler.
  *
@@ -280,6 +285,27 @@ void GPC_SM_REQ_IRQHandler(void);
  */
 void SWI_Trigger(void);
 
+/*!
+ * Trigger PendSV exception.
+ */
+void PENDSV_Trigger(void);
+
+/*!
+ * Mask interrupts.
+ *
+ * Used to guard state shared with handlers that can preempt the caller.
+ *
+ * @return Returns the prior mask state to pass to IRQ_Unlock().
+ */
+uint32_t IRQ_Lock(void);
+
+/*!
+ * Restore interrupt mask.
+ *
+ * @param[in]     state   Mask state returned by IRQ_Lock()
+ */
+void IRQ_Unlock(uint32_t state);
+
 /*!
  * Read timer.
  *
@@ -41,6 +41,7 @@
 #include "sm.h"
 #include "dev_sm.h"
 #include "brd_sm.h"
+#include "lmm.h"
 #include "fsl_fract_pll.h"
 
 /* Local defines */
@@ -141,6 +142,19 @@ static uint32_t s_perfLevelCurrent[DEV_SM_NUM_PERF] =
     [DEV_SM_PERF_A55C5] = DEV_SM_PERF_LVL_PRK
 };
 
+/* VCO clock of each PLL */
+static uint32_t const s_perfPllVco[CLOCK_NUM_PLL] =
+{
+    [CLOCK_PLL_SYS1] = DEV_SM_CLK_SYSPLL1_VCO,
+    [CLOCK_PLL_AUDIO1] = DEV_SM_CLK_AUDIOPLL1_VCO,
+    [CLOCK_PLL_AUDIO2] = DEV_SM_CLK_AUDIOPLL2_VCO,
+    [CLOCK_PLL_VIDEO1] = DEV_SM_CLK_VIDEOPLL1_VCO,
+    [CLOCK_PLL_ARM] = DEV_SM_CLK_ARMPLL_VCO,
+    [CLOCK_PLL_DRAM] = DEV_SM_CLK_DRAMPLL_VCO,
+    [CLOCK_PLL_HSIO] = DEV_SM_CLK_HSIOPLL_VCO,
+    [CLOCK_PLL_LDB] = DEV_SM_CLK_LDBPLL_VCO
+};
+
 /* Voltage setpoints for VDD_SOC */
 static uint32_t const s_perfDvsTableSoc[DEV_SM_NUM_PERF_LVL_SOC] =
 {
@@ -1745,6 +1759,10 @@ int32_t DEV_SM_PerfInit(uint32_t bootPerfLevel, uint32_t runPerfLevel)
     (void) CCM_RootSetDiv(CLOCK_ROOT_VPUAPB, 3U);
     (void) CCM_RootSetParent(CLOCK_ROOT_VPUAPB, CLOCK_SRC_SYSPLL1_PFD1_DIV2);
 
+    /* Check number of perf levels */
+    COMPILE_ASSERT((DEV_SM_NUM_PERF_LVL_SOC <= DEV_SM_NUM_PERF_LVL_MAX)
+        && (DEV_SM_NUM_PERF_LVL_ARM <= DEV_SM_NUM_PERF_LVL_MAX));
+
     /* Set number of perf levels */
     s_perfNumLevels[PS_VDD_SOC] = DEV_SM_NUM_PERF_LVL_SOC;
 
@@ -2223,6 +2241,12 @@ static int32_t DEV_SM_PerfRootFreqUpdate(uint32_t rootClk,
                 }
             }
         }
+
+        /* Record rate change */
+        if ((newDiv != oldDiv) || (newParent != oldParent))
+        {
+            DEV_SM_ClockRateChanged(rootClk + CLOCK_NUM_SRC);
+        }
     }
 
     /* Return status */
@@ -2245,6 +2269,9 @@ static int32_t DEV_SM_PerfPllFreqUpdate(uint32_t pllIdx,
         status = SM_ERR_HARDWARE_ERROR;
     }
 
+    /* Record rate change of all PLL outputs */
+    DEV_SM_ClockRateChanged(s_perfPllVco[pllIdx]);
+
     /* Return status */
     return status;
 }
@@ -2265,6 +2292,9 @@ static int32_t DEV_SM_PerfPfdFreqUpdate(uint32_t pllIdx, uint8_t pfdIdx,
         status = SM_ERR_HARDWARE_ERROR;
     }
 
+    /* Record rate change, PFD outputs are derived from the VCO */
+    DEV_SM_ClockRateChanged(s_perfPllVco[pllIdx]);
+
     /* Return status */
     return status;
 }
@@ -2587,6 +2617,9 @@ static int32_t DEV_SM_PerfA55SubDomFreqUpdate(uint32_t gprSelIdx,
                 }
             }
         }
+
+        /* Record rate change */
+        DEV_SM_ClockRateChanged(gprSelIdx + CLOCK_NUM_SRC + CLOCK_NUM_ROOT);
     }
 
     /* Return status */
@@ -2688,6 +2721,9 @@ static int32_t DEV_SM_PerfFreqUpdate(uint32_t domainId, uint32_t perfLevel)
         }
     }
 
+    /* Report clock rate changes */
+    DEV_SM_ClockRateReport();
+
     /* Return status */
     return status;
 }
@@ -2703,15 +2739,24 @@ static int32_t DEV_SM_PerfCurrentUpdate(uint32_t domainId, uint32_t perfLevel)
     {
         case DEV_SM_PERF_A55:
             {
-                s_perfLevelCurrent[DEV_SM_PERF_A55] = perfLevel;
-
                 dev_sm_perf_ps_cfg_t const *psCfg =
                     s_perfCfg[DEV_SM_PERF_A55].psCfg;
 
+                /* Report change */
+                if (s_perfLevelCurrent[DEV_SM_PERF_A55] != perfLevel)
+                {
+                    s_perfLevelCurrent[DEV_SM_PERF_A55] = perfLevel;
+                    LMM_PerfEvent(DEV_SM_PERF_A55, perfLevel);
+                }
+
                 /* Update all subdomains */
                 for (uint32_t id = psCfg->idStart; id <= psCfg->idEnd; id++)
                 {
-                    s_perfLevelCurrent[id] = perfLevel;
+                    if (s_perfLevelCurrent[id] != perfLevel)
+                    {
+                        s_perfLevelCurrent[id] = perfLevel;
+                        LMM_PerfEvent(id, perfLevel);
+                    }
                 }
             }
             break;
@@ -2720,9 +2765,14 @@ static int32_t DEV_SM_PerfCurrentUpdate(uint32_t domainId, uint32_t perfLevel)
             {
                 status = SM_ERR_NOT_FOUND;
             }
-            else
+            else if (s_perfLevelCurrent[domainId] != perfLevel)
             {
                 s_perfLevelCurrent[domainId] = perfLevel;
+                LMM_PerfEvent(domainId, perfLevel);
+            }
+            else
+            {
+                ; /* Intentional empty else */
             }
             break;
     }
@@ -95,6 +95,9 @@
 #define DEV_SM_PERF_LVL_SOD  4U  /*!< Super overdrive per datasheet */
 /** @} */
 
+/*! Max number of levels of any performance domain */
+#define DEV_SM_NUM_PERF_LVL_MAX  5U
+
 /* Types */
 
 /* Functions */
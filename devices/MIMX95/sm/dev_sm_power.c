@@ -40,6 +40,7 @@
 
 #include "sm.h"
 #include "dev_sm.h"
+#include "lmm.h"
 
 /* Local defines */
 
@@ -181,6 +182,9 @@ int32_t DEV_SM_PowerStateSet(uint32_t domainId, uint8_t powerState)
                     if (SRC_MixSoftPowerUp(domainId))
                     {
                         DEV_SM_PowerUpPost(domainId);
+
+                        /* Report change */
+                        LMM_PowerEvent(domainId, DEV_SM_POWER_STATE_ON);
                     }
                 }
                 else
@@ -191,8 +195,16 @@ int32_t DEV_SM_PowerStateSet(uint32_t domainId, uint8_t powerState)
             case DEV_SM_POWER_STATE_OFF:
                 if (!PWR_AnyChildPowered(domainId))
                 {
+                    bool wasOn = SRC_MixIsPwrSwitchOn(domainId);
+
                     DEV_SM_PowerDownPre(domainId);
                     SRC_MixSoftPowerDown(domainId);
+
+                    /* Report change */
+                    if (wasOn)
+                    {
+                        LMM_PowerEvent(domainId, DEV_SM_POWER_STATE_OFF);
+                    }
                 }
                 else
                 {
@@ -248,6 +248,7 @@ int32_t DEV_SM_SensorDescribe(uint32_t sensorId,
         desc->numTripPoints = s_tmpsns[sensorId].numThresholds;
         desc->timestampSupport = false;
         desc->timestampExponent = 0;
+        desc->asyncSupport = false;
     }
 
     /* Return status */
@@ -40,6 +40,7 @@
 
 #include "sm.h"
 #include "dev_sm.h"
+#include "lmm.h"
 
 /* Local defines */
 
@@ -159,9 +160,15 @@ int32_t DEV_SM_ClockRateSet(uint32_t clockId, uint64_t rate,
     /* Check clock */
     if(clockId < DEV_SM_NUM_CLOCK)
     {
-        if (roundSel <= 2U)
+        /* Simulated clocks have one parent, ignore parent search */
+        if ((roundSel & ~DEV_SM_CLOCK_ROUND_PARENT) <= 2U)
         {
-            s_clockFreq[clockId] = rate;
+            /* Report change, simulated clocks have no children */
+            if (s_clockFreq[clockId] != rate)
+            {
+                s_clockFreq[clockId] = rate;
+                LMM_ClockRateEvent(clockId, rate);
+            }
         }
         else
         {
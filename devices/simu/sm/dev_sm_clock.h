@@ -73,6 +73,7 @@
 #define DEV_SM_CLOCK_ROUND_DOWN        0x0U   /*!< Round rate down */
 #define DEV_SM_CLOCK_ROUND_UP          0x1U   /*!< Round rate up */
 #define DEV_SM_CLOCK_ROUND_AUTO        0x2U   /*!< Automatically select closest rate */
+#define DEV_SM_CLOCK_ROUND_PARENT      0x4U   /*!< Flag, also select best parent */
 /** @} */
 
 /* Types */
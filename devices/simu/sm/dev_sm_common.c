@@ -42,6 +42,7 @@
 #include "dev_sm.h"
 #include "lmm.h"
 #include <sys/time.h>
+#include <time.h>
 
 /* Local defines */
 
@@ -81,6 +82,18 @@ uint64_t DEV_SM_Usec64Get(void)
     return (tv.tv_sec * 1000000ULL) + tv.tv_usec;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get time in nanoseconds                                                  */
+/*--------------------------------------------------------------------------*/
+uint64_t DEV_SM_Nsec64Get(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (ts.tv_sec * 1000000000ULL) + ts.tv_nsec;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Get address of a fuse word                                               */
 /*--------------------------------------------------------------------------*/
@@ -129,6 +142,53 @@ void SWI_Trigger(void)
     LMM_Handler();
 }
 
+/*--------------------------------------------------------------------------*/
+/* Trigger PendSV exception                                                 */
+/*--------------------------------------------------------------------------*/
+void PENDSV_Trigger(void)
+{
+    static bool s_pendSvActive = false;
+    static bool s_pendSvPending = false;
+
+    /* Mark pending */
+    s_pendSvPending = true;
+
+    /* Run handler unless already active (emulate tail-chaining) */
+    if (!s_pendSvActive)
+    {
+        s_pendSvActive = true;
+        while (s_pendSvPending)
+        {
+            s_pendSvPending = false;
+            LMM_RpcHandler();
+
+            /* Background board work only once no RPC requests pending */
+            if (!LMM_RpcPending())
+            {
+                BRD_SM_DeferredHandler();
+            }
+        }
+        s_pendSvActive = false;
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Mask interrupts                                                          */
+/*--------------------------------------------------------------------------*/
+uint32_t IRQ_Lock(void)
+{
+    /* Handlers are called inline, nothing to mask */
+    return 0U;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Restore interrupt mask                                                   */
+/*--------------------------------------------------------------------------*/
+void IRQ_Unlock(uint32_t state)
+{
+    ; /* Intentional empty function */
+}
+
 /*--------------------------------------------------------------------------*/
 /* Get length of a string                                                   */
 /*--------------------------------------------------------------------------*/
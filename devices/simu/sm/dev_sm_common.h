@@ -85,6 +85,25 @@
  */
 void SWI_Trigger(void);
 
+/*!
+ * Trigger PendSV exception.
+ */
+void PENDSV_Trigger(void);
+
+/*!
+ * Mask interrupts.
+ *
+ * @return Returns the prior mask state to pass to IRQ_Unlock().
+ */
+uint32_t IRQ_Lock(void);
+
+/*!
+ * Restore interrupt mask.
+ *
+ * @param[in]     state   Mask state returned by IRQ_Lock()
+ */
+void IRQ_Unlock(uint32_t state);
+
 /** @} */
 
 /* Include SM device API */
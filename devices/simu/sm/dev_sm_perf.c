@@ -40,6 +40,7 @@
 
 #include "sm.h"
 #include "dev_sm.h"
+#include "lmm.h"
 
 /* Local defines */
 
@@ -129,6 +130,10 @@ int32_t DEV_SM_PerfNumLevelsGet(uint32_t domainId, uint32_t *numLevels)
 {
     int32_t status = SM_ERR_SUCCESS;
 
+    /* Check number of perf levels */
+    COMPILE_ASSERT((sizeof(s_perfLevels) / sizeof(dev_sm_perf_desc_t))
+        <= DEV_SM_NUM_PERF_LVL_MAX);
+
     *numLevels = sizeof(s_perfLevels) / sizeof(dev_sm_perf_desc_t);
 
     /* Return status */
@@ -170,9 +175,16 @@ int32_t DEV_SM_PerfLevelSet(uint32_t domainId, uint32_t perfLevel)
     {
         status = SM_ERR_NOT_FOUND;
     }
-    else
+    else if (s_perfLevel[domainId] != perfLevel)
     {
         s_perfLevel[domainId] = perfLevel;
+
+        /* Report change */
+        LMM_PerfEvent(domainId, perfLevel);
+    }
+    else
+    {
+        ; /* Intentional empty else */
     }
 
     /* Return status */
@@ -64,6 +64,9 @@
 #define DEV_SM_PERF_1  1U  /*!< Perf 0 */
 /** @} */
 
+/*! Max number of levels of any performance domain */
+#define DEV_SM_NUM_PERF_LVL_MAX  4U
+
 /* Types */
 
 /* Functions */
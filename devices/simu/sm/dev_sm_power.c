@@ -40,6 +40,7 @@
 
 #include "sm.h"
 #include "dev_sm.h"
+#include "lmm.h"
 
 /* Local defines */
 
@@ -150,7 +151,12 @@ int32_t DEV_SM_PowerStateSet(uint32_t domainId, uint8_t powerState)
             status = DEV_SM_PowerDownPre(domainId);
         }
 
-        s_powerState[domainId] = powerState;
+        /* Report change */
+        if (s_powerState[domainId] != powerState)
+        {
+            s_powerState[domainId] = powerState;
+            LMM_PowerEvent(domainId, powerState);
+        }
     }
 
     /* Return status */
@@ -94,6 +94,18 @@ void BRD_SM_Exit(int32_t status);
  */
 void BRD_SM_TimerTick(uint32_t msec);
 
+/*!
+ * Board deferred handler.
+ *
+ * This function is called from the low priority RPC handler (PendSV)
+ * after the RPC requests, and only once none are pending. Board work that
+ * blocks (e.g. PMIC I2C transfers) is done here rather than in the timer
+ * tick. Request a call with PENDSV_Trigger(). Do one blocking operation
+ * per call and trigger again for more so pending requests are served in
+ * between.
+ */
+void BRD_SM_DeferredHandler(void);
+
 /*!
  * Board custom function. Called from the debug monitor.
  *
@@ -77,6 +77,16 @@ int32_t DEV_SM_SiInfoGet(uint32_t *deviceId, uint32_t *siRev,
  */
 uint64_t DEV_SM_Usec64Get(void);
 
+/*!
+ * Get 64-bit timestamp in nanoseconds.
+ *
+ * Resolution is that of the underlying counter. Intended for profiling
+ * short intervals.
+ *
+ * @return Returns the time in nS.
+ */
+uint64_t DEV_SM_Nsec64Get(void);
+
 /*!
  * Get fuse info.
  *
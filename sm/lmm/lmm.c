@@ -303,6 +303,41 @@ void LMM_ErrorDump(void)
     SM_ERRORDUMP();
 }
 
+/*--------------------------------------------------------------------------*/
+/* Dump all RPC statistics                                                  */
+/*--------------------------------------------------------------------------*/
+int32_t LMM_StatsDump(bool reset)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Loop over LMs */
+    for (uint32_t lmId = 0U; lmId < SM_NUM_LM; lmId++)
+    {
+        /* Dump RPC statistics */
+        switch (g_lmmConfig[lmId].rpcType)
+        {
+            case SM_RPC_NONE:
+                break;
+            case SM_RPC_SCMI:
+                status = RPC_SCMI_StatsDump(g_lmmConfig[lmId].rpcInst,
+                    reset);
+                break;
+            default:
+                ; /* Intentional empty default */
+                break;
+        }
+
+        /* Exit on error */
+        if (status != SM_ERR_SUCCESS)
+        {
+            break;
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Common LMM handler                                                       */
 /*--------------------------------------------------------------------------*/
@@ -338,6 +373,32 @@ void LMM_Handler(void)
     }
 }
 
+/*--------------------------------------------------------------------------*/
+/* RPC handler                                                              */
+/*--------------------------------------------------------------------------*/
+void LMM_RpcHandler(void)
+{
+    /* Execute deferred SCMI requests */
+    RPC_SCMI_Handler();
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check for pending RPC requests                                           */
+/*--------------------------------------------------------------------------*/
+bool LMM_RpcPending(void)
+{
+    return RPC_SCMI_Pending();
+}
+
+/*--------------------------------------------------------------------------*/
+/* RPC poll                                                                 */
+/*--------------------------------------------------------------------------*/
+void LMM_RpcPoll(void)
+{
+    /* Poll SCMI FastChannels */
+    RPC_SCMI_Poll();
+}
+
 /*--------------------------------------------------------------------------*/
 /* Get LM boot time                                                         */
 /*--------------------------------------------------------------------------*/
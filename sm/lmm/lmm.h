@@ -53,6 +53,7 @@
 #include "sm.h"
 #include "config_lmm.h"
 #include "lmm_config.h"
+#include "lmm_vote.h"
 #include "lmm_power.h"
 #include "lmm_sys.h"
 #include "lmm_perf.h"
@@ -88,6 +89,9 @@
 #define LMM_TRIGGER_FUSA_SEENV  0x6U  /*!< FuSa S-EENV event */
 #define LMM_TRIGGER_FUSA_FAULT  0x7U  /*!< FuSa fault event */
 #define LMM_TRIGGER_CTRL        0x8U  /*!< Control event */
+#define LMM_TRIGGER_PERF        0x9U  /*!< Performance event */
+#define LMM_TRIGGER_POWER       0xAU  /*!< Power domain event */
+#define LMM_TRIGGER_CLOCK       0xBU  /*!< Clock rate event */
 /** @} */
 
 /* Types */
@@ -186,6 +190,17 @@ int32_t LMM_RpcNotificationTrigger(uint32_t lmId,
  */
 void LMM_ErrorDump(void);
 
+/*!
+ * Dump LMM RPC statistics.
+ *
+ * @param[in]     reset     True to reset the statistics after the dump
+ *
+ * Dump the RPC service time statistics of all LMs.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ */
+int32_t LMM_StatsDump(bool reset);
+
 /*!
  * LMM handler.
  *
@@ -193,6 +208,30 @@ void LMM_ErrorDump(void);
  */
 void LMM_Handler(void);
 
+/*!
+ * LMM RPC handler.
+ *
+ * Handler for PendSV to execute deferred RPC requests.
+ */
+void LMM_RpcHandler(void);
+
+/*!
+ * Check for pending RPC requests.
+ *
+ * Called from the PendSV handler to run background board work only once
+ * no RPC requests are pending.
+ *
+ * @return Returns true if a request is waiting for LMM_RpcHandler().
+ */
+bool LMM_RpcPending(void);
+
+/*!
+ * LMM RPC poll.
+ *
+ * Called from the periodic tick to poll RPC FastChannels.
+ */
+void LMM_RpcPoll(void);
+
 /*!
  * Get time LM was booted.
  *
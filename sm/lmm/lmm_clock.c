@@ -41,6 +41,7 @@
 
 #include "sm.h"
 #include "lmm.h"
+#include "rpc_scmi.h"
 #include "dev_sm_api.h"
 
 /* Local defines */
@@ -49,7 +50,8 @@
 
 /* Local variables */
 
-static bool s_clockState[SM_NUM_CLOCK][SM_NUM_LM];
+static uint32_t s_clockVote[SM_NUM_CLOCK];
+static uint32_t s_clockSync[LMM_VOTE_WORDS(SM_NUM_CLOCK)];
 static uint32_t s_clockParent[DEV_SM_NUM_CLOCK];
 static uint64_t s_clockFreq[DEV_SM_NUM_CLOCK];
 
@@ -63,7 +65,8 @@ int32_t LMM_ClockInit(uint32_t numClock, const uint32_t *clockList)
     /* Init LM0 clock state */
     for (uint32_t idx = 0U; idx < numClock; idx++)
     {
-        s_clockState[clockList[idx]][0U] = true;
+        (void) LMM_VoteBitSet(&s_clockVote[clockList[idx]], LMM_VOTE_ALL,
+            0U, true, LMM_VOTE_OR, NULL, NULL);
     }
 
     /* Loop over clocks */
@@ -185,22 +188,20 @@ int32_t LMM_ClockEnable(uint32_t lmId, uint32_t clockId, bool enable)
 
     if (status == SM_ERR_SUCCESS)
     {
-        bool newEnable = false;
+        uint32_t newEnable = 0U;
+        bool changed = false;
 
-        /* Record new state */
-        s_clockState[clockId][lmId] = enable;
+        /* Record new state and aggregate clock enable */
+        status = LMM_VoteBitSet(&s_clockVote[clockId], LMM_VOTE_ALL, lmId,
+            enable, LMM_VOTE_OR, &newEnable, &changed);
 
-        /* Aggregate clock enable */
-        for (uint32_t lm = 0U; lm < SM_NUM_LM; lm++)
+        /* Inform device of clock state if changed */
+        if ((status == SM_ERR_SUCCESS) && LMM_VoteWriteNeeded(
+            LMM_VOTE_TYPE_CLOCK, s_clockSync, clockId, changed))
         {
-            if (s_clockState[clockId][lm])
-            {
-                newEnable = true;
-            }
+            status = SM_CLOCKENABLE(clockId, newEnable != 0U);
+            LMM_VoteWriteDone(s_clockSync, clockId, status);
         }
-
-        /* Inform device of clock state, device will check if changed */
-        status = SM_CLOCKENABLE(clockId, newEnable);
     }
 
     /* Return status */
@@ -234,3 +235,31 @@ int32_t LMM_ClockParentGet(uint32_t lmId, uint32_t clockId, uint32_t *parent)
     return SM_CLOCKPARENTGET(clockId, parent);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Report clock rate change                                                 */
+/*--------------------------------------------------------------------------*/
+void LMM_ClockRateEvent(uint32_t clockId, uint64_t rate)
+{
+    /* Dispatch for all LM */
+    for (uint32_t dstLm = 0U; dstLm < SM_NUM_LM; dstLm++)
+    {
+        lmm_rpc_trigger_t trigger =
+        {
+            .event = LMM_TRIGGER_CLOCK,
+            .parm[0] = clockId,
+            .parm[1] = SM_UINT64_L(rate),
+            .parm[2] = SM_UINT64_H(rate)
+        };
+
+        (void) LMM_RpcNotificationTrigger(dstLm, &trigger);
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check for enabled clock rate notifications                               */
+/*--------------------------------------------------------------------------*/
+bool LMM_ClockRateNotifyEnabled(void)
+{
+    return RPC_SCMI_ClockRateNotifyEnabled();
+}
+
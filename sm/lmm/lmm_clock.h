@@ -269,6 +269,28 @@ int32_t LMM_ClockParentSet(uint32_t lmId, uint32_t clockId, uint32_t parent);
  */
 int32_t LMM_ClockParentGet(uint32_t lmId, uint32_t clockId, uint32_t *parent);
 
+/*!
+ * Report clock rate change.
+ *
+ * This function reports a rate change of a clock to the LMM. Called by
+ * the device for the changed clock and for each clock derived from it.
+ *
+ * @param[in]  clockId    Identifier for the clock device
+ * @param[in]  rate       New clock rate in Hz
+ */
+void LMM_ClockRateEvent(uint32_t clockId, uint64_t rate);
+
+/*!
+ * Check for enabled clock rate notifications.
+ *
+ * The device can skip finding the clocks derived from a changed clock and
+ * calling LMM_ClockRateEvent() if this returns false.
+ *
+ * @return Returns true if any agent of any LM is to be notified of clock
+ *         rate changes.
+ */
+bool LMM_ClockRateNotifyEnabled(void);
+
 #endif /* LMM_CLOCK_H */
 
 /** @} */
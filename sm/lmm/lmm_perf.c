@@ -49,6 +49,9 @@
 
 /* Local variables */
 
+static lmm_vote_level_t s_perfVote[SM_NUM_PERF];
+static uint32_t s_perfSync[LMM_VOTE_WORDS(SM_NUM_PERF)];
+
 /*--------------------------------------------------------------------------*/
 /* Return performance domain name                                           */
 /*--------------------------------------------------------------------------*/
@@ -127,21 +130,24 @@ int32_t LMM_PerfLevelSet(uint32_t lmId, uint32_t domainId,
 
     if (status == SM_ERR_SUCCESS)
     {
-        static uint32_t s_perfLevel[SM_NUM_PERF][SM_NUM_LM];
-        uint8_t newPerfLevel = 0U;
+        uint32_t newPerfLevel = 0U;
+        bool changed = false;
+
+        /* Check all device levels fit in the vote bit-planes */
+        COMPILE_ASSERT(DEV_SM_NUM_PERF_LVL_MAX
+            <= BIT32(LMM_VOTE_NUM_PLANE));
 
-        /* Record new level */
-        s_perfLevel[domainId][lmId] = performanceLevel;
+        /* Record new level and aggregate perf level */
+        status = LMM_VoteLevelSet(&s_perfVote[domainId], LMM_VOTE_ALL,
+            lmId, performanceLevel, LMM_VOTE_MAX, &newPerfLevel, &changed);
 
-        /* Aggregate perf level */
-        for (uint32_t lm = 0U; lm < SM_NUM_LM; lm++)
+        /* Inform device of perf level if changed */
+        if ((status == SM_ERR_SUCCESS) && LMM_VoteWriteNeeded(
+            LMM_VOTE_TYPE_PERF, s_perfSync, domainId, changed))
         {
-            newPerfLevel = (uint8_t) MAX(newPerfLevel,
-                s_perfLevel[domainId][lm]);
+            status = SM_PERFLEVELSET(domainId, newPerfLevel);
+            LMM_VoteWriteDone(s_perfSync, domainId, status);
         }
-
-        /* Inform device of power state, device will check if changed */
-        status = SM_PERFLEVELSET(domainId, newPerfLevel);
     }
 
     /* Return status */
@@ -158,3 +164,28 @@ int32_t LMM_PerfLevelGet(uint32_t lmId, uint32_t domainId,
     return SM_PERFLEVELGET(domainId, performanceLevel);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Report performance level change                                          */
+/*--------------------------------------------------------------------------*/
+void LMM_PerfEvent(uint32_t domainId, uint32_t performanceLevel)
+{
+    /* Votes no longer known to match the hardware */
+    if (domainId < SM_NUM_PERF)
+    {
+        LMM_VoteSyncClear(s_perfSync, domainId);
+    }
+
+    /* Dispatch for all LM */
+    for (uint32_t dstLm = 0U; dstLm < SM_NUM_LM; dstLm++)
+    {
+        lmm_rpc_trigger_t trigger =
+        {
+            .event = LMM_TRIGGER_PERF,
+            .parm[0] = domainId,
+            .parm[1] = performanceLevel
+        };
+
+        (void) LMM_RpcNotificationTrigger(dstLm, &trigger);
+    }
+}
+
@@ -179,6 +179,18 @@ int32_t LMM_PerfLevelSet(uint32_t lmId, uint32_t domainId,
 int32_t LMM_PerfLevelGet(uint32_t lmId, uint32_t domainId,
     uint32_t *performanceLevel);
 
+/*!
+ * Report performance level change.
+ *
+ * This function reports a change of the current level of a performance
+ * domain to the LMM. Called by the device once the new level has been
+ * applied.
+ *
+ * @param[in]  domainId          Identifier for the domain
+ * @param[in]  performanceLevel  New performance level
+ */
+void LMM_PerfEvent(uint32_t domainId, uint32_t performanceLevel);
+
 #endif /* LMM_PERF_H */
 
 /** @} */
@@ -49,6 +49,9 @@
 
 /* Local variables */
 
+static lmm_vote_level_t s_powerVote[SM_NUM_POWER];
+static uint32_t s_powerSync[LMM_VOTE_WORDS(SM_NUM_POWER)];
+
 /*--------------------------------------------------------------------------*/
 /* Return power domain name                                                 */
 /*--------------------------------------------------------------------------*/
@@ -91,20 +94,20 @@ int32_t LMM_PowerStateSet(uint32_t lmId, uint32_t domainId,
 
     if (status == SM_ERR_SUCCESS)
     {
-        static uint8_t s_powerState[SM_NUM_POWER][SM_NUM_LM];
-        uint8_t newPowerState = 0U;
+        uint32_t newPowerState = 0U;
+        bool changed = false;
 
-        /* Record new state */
-        s_powerState[domainId][lmId] = (uint8_t) (powerState & 0xFFU);
+        /* Record new state and aggregate power state */
+        status = LMM_VoteLevelSet(&s_powerVote[domainId], LMM_VOTE_ALL,
+            lmId, powerState, LMM_VOTE_MAX, &newPowerState, &changed);
 
-        /* Aggregate power state */
-        for (uint32_t lm = 0U; lm < SM_NUM_LM; lm++)
+        /* Inform device of power state if changed */
+        if ((status == SM_ERR_SUCCESS) && LMM_VoteWriteNeeded(
+            LMM_VOTE_TYPE_POWER, s_powerSync, domainId, changed))
         {
-            newPowerState = MAX(newPowerState, s_powerState[domainId][lm]);
+            status = SM_POWERSTATESET(domainId, (uint8_t) newPowerState);
+            LMM_VoteWriteDone(s_powerSync, domainId, status);
         }
-
-        /* Inform device of power state, device will check if changed */
-        status = SM_POWERSTATESET(domainId, newPowerState);
     }
 
     /* Return status */
@@ -121,3 +124,28 @@ int32_t LMM_PowerStateGet(uint32_t lmId, uint32_t domainId,
     return SM_POWERSTATEGET(domainId, powerState);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Report power domain state change                                         */
+/*--------------------------------------------------------------------------*/
+void LMM_PowerEvent(uint32_t domainId, uint8_t powerState)
+{
+    /* Votes no longer known to match the hardware */
+    if (domainId < SM_NUM_POWER)
+    {
+        LMM_VoteSyncClear(s_powerSync, domainId);
+    }
+
+    /* Dispatch for all LM */
+    for (uint32_t dstLm = 0U; dstLm < SM_NUM_LM; dstLm++)
+    {
+        lmm_rpc_trigger_t trigger =
+        {
+            .event = LMM_TRIGGER_POWER,
+            .parm[0] = domainId,
+            .parm[1] = (uint32_t) powerState
+        };
+
+        (void) LMM_RpcNotificationTrigger(dstLm, &trigger);
+    }
+}
+
@@ -144,6 +144,17 @@ int32_t LMM_PowerStateSet(uint32_t lmId, uint32_t domainId,
 int32_t LMM_PowerStateGet(uint32_t lmId, uint32_t domainId,
     uint8_t *powerState);
 
+/*!
+ * Report power domain state change.
+ *
+ * This function reports a power state change of a power domain to the
+ * LMM. Called by the device for software and hardware-driven transitions.
+ *
+ * @param[in]  domainId    Identifier for the power domain
+ * @param[in]  powerState  New power state
+ */
+void LMM_PowerEvent(uint32_t domainId, uint8_t powerState);
+
 #endif /* LMM_POWER_H */
 
 /** @} */
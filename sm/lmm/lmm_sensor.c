@@ -79,6 +79,28 @@ int32_t LMM_SensorReadingGet(uint32_t lmId, uint32_t sensorId,
     return SM_SENSORREADINGGET(sensorId, sensorValue, sensorTimestamp);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Take a fresh sensor sample                                               */
+/*--------------------------------------------------------------------------*/
+int32_t LMM_SensorSample(uint32_t lmId, uint32_t sensorId)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+#ifdef SM_SENSORSAMPLE
+    /* Passthru to board */
+    status = SM_SENSORSAMPLE(sensorId);
+#else
+    /* Check sensor, all reads are fresh */
+    if (sensorId >= SM_NUM_SENSOR)
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+#endif
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Set sensor trippoint                                                     */
 /*--------------------------------------------------------------------------*/
@@ -114,6 +114,26 @@ int32_t LMM_SensorDescribe(uint32_t lmId, uint32_t sensorId,
 int32_t LMM_SensorReadingGet(uint32_t lmId, uint32_t sensorId,
     int64_t *sensorValue, uint64_t *sensorTimestamp);
 
+/*!
+ * Take a fresh sensor sample.
+ *
+ * @param[in]     lmId             LM call is for
+ * @param[in]     sensorId         Sensor to sample
+ *
+ * This function allows the caller to force a new sample of a sensor
+ * that is normally sampled in the background. The next call to
+ * LMM_SensorReadingGet() will return the new value. This is a no-op
+ * for sensors read directly on every call.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_SUCCESS: if the sample was taken.
+ * - ::SM_ERR_NOT_FOUND: if \a sensorId is invalid.
+ * - others returned by ::SM_SENSORSAMPLE
+ */
+int32_t LMM_SensorSample(uint32_t lmId, uint32_t sensorId);
+
 /*!
  * Configure a trip point for a sensor.
  *
@@ -49,6 +49,9 @@
 
 /* Local variables */
 
+static lmm_vote_level_t s_voltVote[SM_NUM_VOLT];
+static uint32_t s_voltSync[LMM_VOTE_WORDS(SM_NUM_VOLT)];
+
 /*--------------------------------------------------------------------------*/
 /* Init LMM voltage management                                              */
 /*--------------------------------------------------------------------------*/
@@ -104,20 +107,20 @@ int32_t LMM_VoltageModeSet(uint32_t lmId, uint32_t domainId,
 
     if (status == SM_ERR_SUCCESS)
     {
-        static uint8_t s_voltMode[SM_NUM_VOLT][SM_NUM_LM];
-        uint8_t newVoltMode = DEV_SM_VOLT_MODE_OFF;
+        uint32_t newVoltMode = DEV_SM_VOLT_MODE_OFF;
+        bool changed = false;
 
-        /* Record new state */
-        s_voltMode[domainId][lmId] = voltMode;
+        /* Record new state and aggregate voltage mode */
+        status = LMM_VoteLevelSet(&s_voltVote[domainId], LMM_VOTE_ALL,
+            lmId, voltMode, LMM_VOTE_MAX, &newVoltMode, &changed);
 
-        /* Aggregate voltage mode */
-        for (uint32_t lm = 0U; lm < SM_NUM_LM; lm++)
+        /* Inform device of voltage mode if changed */
+        if ((status == SM_ERR_SUCCESS) && LMM_VoteWriteNeeded(
+            LMM_VOTE_TYPE_VOLT, s_voltSync, domainId, changed))
         {
-            newVoltMode = MAX(newVoltMode, s_voltMode[domainId][lm]);
+            status = SM_VOLTAGEMODESET(domainId, (uint8_t) newVoltMode);
+            LMM_VoteWriteDone(s_voltSync, domainId, status);
         }
-
-        /* Inform device of voltage mode, device will check if changed */
-        status = SM_VOLTAGEMODESET(domainId, newVoltMode);
     }
 
     /* Return status */
@@ -0,0 +1,340 @@
+/*
+** ###################################################################
+**
+** Copyright 2025 NXP
+**
+** Redistribution and use in source and binary forms, with or without modification,
+** are permitted provided that the following conditions are met:
+**
+** o Redistributions of source code must retain the above copyright notice, this list
+**   of conditions and the following disclaimer.
+**
+** o Redistributions in binary form must reproduce the above copyright notice, this
+**   list of conditions and the following disclaimer in the documentation and/or
+**   other materials provided with the distribution.
+**
+** o Neither the name of the copyright holder nor the names of its
+**   contributors may be used to endorse or promote products derived from this
+**   software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+** ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+** WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+** DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+** ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+** (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+** LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+** ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+** SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+**
+** ###################################################################
+*/
+
+/*==========================================================================*/
+/* File containing the implementation of the Logical Machine Manager vote   */
+/* aggregation.                                                             */
+/*==========================================================================*/
+
+/* Includes */
+
+#include "sm.h"
+#include "lmm.h"
+
+/* Local defines */
+
+/* Local types */
+
+/* Local variables */
+
+static lmm_vote_stats_t s_voteStats[LMM_VOTE_NUM_TYPE];
+
+/* Local functions */
+
+static uint32_t LMM_VoteLevelAgg(const lmm_vote_level_t *vote,
+    uint32_t mask, uint8_t policy);
+
+/*--------------------------------------------------------------------------*/
+/* Update a bitmap vote                                                     */
+/*--------------------------------------------------------------------------*/
+int32_t LMM_VoteBitSet(uint32_t *voters, uint32_t mask, uint32_t voter,
+    bool vote, uint8_t policy, uint32_t *value, bool *changed)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check parameters */
+    if ((voter >= LMM_VOTE_MAX_VOTER) || ((policy != LMM_VOTE_OR)
+        && (policy != LMM_VOTE_REF)))
+    {
+        status = SM_ERR_INVALID_PARAMETERS;
+    }
+    else
+    {
+        uint32_t irqState = IRQ_Lock();
+        uint32_t oldVoters = *voters & mask;
+        uint32_t newVoters;
+        uint32_t newValue;
+        bool newChanged;
+
+        /* Record vote */
+        if (vote)
+        {
+            *voters |= BIT32(voter);
+        }
+        else
+        {
+            *voters &= ~BIT32(voter);
+        }
+        newVoters = *voters & mask;
+
+        if (policy == LMM_VOTE_OR)
+        {
+            newValue = (newVoters != 0U) ? 1U : 0U;
+            newChanged = ((oldVoters != 0U) != (newVoters != 0U));
+        }
+        else
+        {
+            /* Count voters */
+            newValue = 0U;
+            while (newVoters != 0U)
+            {
+                newVoters &= (newVoters - 1U);
+                newValue++;
+            }
+            newChanged = (oldVoters != (*voters & mask));
+        }
+
+        IRQ_Unlock(irqState);
+
+        /* Return results */
+        if (value != NULL)
+        {
+            *value = newValue;
+        }
+        if (changed != NULL)
+        {
+            *changed = newChanged;
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Update a level vote                                                      */
+/*--------------------------------------------------------------------------*/
+int32_t LMM_VoteLevelSet(lmm_vote_level_t *vote, uint32_t mask,
+    uint32_t voter, uint32_t level, uint8_t policy, uint32_t *value,
+    bool *changed)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check parameters */
+    if ((voter >= LMM_VOTE_MAX_VOTER)
+        || (level >= BIT32(LMM_VOTE_NUM_PLANE))
+        || ((policy != LMM_VOTE_MAX) && (policy != LMM_VOTE_MIN)))
+    {
+        status = SM_ERR_INVALID_PARAMETERS;
+    }
+    else
+    {
+        uint32_t irqState = IRQ_Lock();
+        uint32_t oldValue = LMM_VoteLevelAgg(vote, mask, policy);
+        uint32_t newValue;
+
+        /* Record vote */
+        for (uint32_t b = 0U; b < LMM_VOTE_NUM_PLANE; b++)
+        {
+            if ((level & BIT32(b)) != 0U)
+            {
+                vote->plane[b] |= BIT32(voter);
+            }
+            else
+            {
+                vote->plane[b] &= ~BIT32(voter);
+            }
+        }
+        newValue = LMM_VoteLevelAgg(vote, mask, policy);
+
+        IRQ_Unlock(irqState);
+
+        /* Return results */
+        if (value != NULL)
+        {
+            *value = newValue;
+        }
+        if (changed != NULL)
+        {
+            *changed = (newValue != oldValue);
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get a level vote                                                         */
+/*--------------------------------------------------------------------------*/
+uint32_t LMM_VoteLevelGet(const lmm_vote_level_t *vote, uint32_t voter)
+{
+    uint32_t level = 0U;
+
+    /* Gather vote bits */
+    if (voter < LMM_VOTE_MAX_VOTER)
+    {
+        for (uint32_t b = 0U; b < LMM_VOTE_NUM_PLANE; b++)
+        {
+            if ((vote->plane[b] & BIT32(voter)) != 0U)
+            {
+                level |= BIT32(b);
+            }
+        }
+    }
+
+    /* Return vote */
+    return level;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check if a hardware write is needed                                      */
+/*--------------------------------------------------------------------------*/
+bool LMM_VoteWriteNeeded(uint32_t type, const uint32_t *sync, uint32_t id,
+    bool changed)
+{
+    bool needed = changed || ((sync[id / 32U] & BIT32(id)) == 0U);
+
+    /* Update statistics */
+    if (type < LMM_VOTE_NUM_TYPE)
+    {
+        s_voteStats[type].updates++;
+        if (needed)
+        {
+            s_voteStats[type].writes++;
+        }
+        else
+        {
+            s_voteStats[type].suppressed++;
+        }
+    }
+
+    /* Return result */
+    return needed;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Record the result of a hardware write                                    */
+/*--------------------------------------------------------------------------*/
+void LMM_VoteWriteDone(uint32_t *sync, uint32_t id, int32_t status)
+{
+    uint32_t irqState = IRQ_Lock();
+
+    if (status == SM_ERR_SUCCESS)
+    {
+        sync[id / 32U] |= BIT32(id);
+    }
+    else
+    {
+        sync[id / 32U] &= ~BIT32(id);
+    }
+
+    IRQ_Unlock(irqState);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Mark a resource out of sync                                              */
+/*--------------------------------------------------------------------------*/
+void LMM_VoteSyncClear(uint32_t *sync, uint32_t id)
+{
+    uint32_t irqState = IRQ_Lock();
+
+    sync[id / 32U] &= ~BIT32(id);
+    IRQ_Unlock(irqState);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get vote statistics                                                      */
+/*--------------------------------------------------------------------------*/
+int32_t LMM_VoteStatsGet(uint32_t type, lmm_vote_stats_t *stats,
+    bool reset)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check type */
+    if (type >= LMM_VOTE_NUM_TYPE)
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+    else
+    {
+        /* Return statistics */
+        *stats = s_voteStats[type];
+
+        /* Reset statistics */
+        if (reset)
+        {
+            const lmm_vote_stats_t zero = { 0 };
+
+            s_voteStats[type] = zero;
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Aggregate a level vote                                                   */
+/*--------------------------------------------------------------------------*/
+static uint32_t LMM_VoteLevelAgg(const lmm_vote_level_t *vote,
+    uint32_t mask, uint8_t policy)
+{
+    uint32_t value = 0U;
+    uint32_t cand = 0U;
+
+    /* Find voters with a non-zero vote */
+    for (uint32_t b = 0U; b < LMM_VOTE_NUM_PLANE; b++)
+    {
+        cand |= vote->plane[b];
+    }
+    cand &= mask;
+
+    /* Narrow candidates from the most significant plane down */
+    if (cand != 0U)
+    {
+        for (uint32_t b = LMM_VOTE_NUM_PLANE; b > 0U; b--)
+        {
+            uint32_t set = cand & vote->plane[b - 1U];
+
+            if (policy == LMM_VOTE_MAX)
+            {
+                /* Keep voters with this bit set if any */
+                if (set != 0U)
+                {
+                    value |= BIT32(b - 1U);
+                    cand = set;
+                }
+            }
+            else
+            {
+                /* Keep voters with this bit clear if any */
+                if (set != cand)
+                {
+                    cand &= ~set;
+                }
+                else
+                {
+                    value |= BIT32(b - 1U);
+                }
+            }
+        }
+    }
+
+    /* Return aggregate */
+    return value;
+}
+
@@ -0,0 +1,238 @@
+/*
+** ###################################################################
+**
+** Copyright 2025 NXP
+**
+** Redistribution and use in source and binary forms, with or without modification,
+** are permitted provided that the following conditions are met:
+**
+** o Redistributions of source code must retain the above copyright notice, this list
+**   of conditions and the following disclaimer.
+**
+** o Redistributions in binary form must reproduce the above copyright notice, this
+**   list of conditions and the following disclaimer in the documentation and/or
+**   other materials provided with the distribution.
+**
+** o Neither the name of the copyright holder nor the names of its
+**   contributors may be used to endorse or promote products derived from this
+**   software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+** ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+** WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+** DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+** ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+** (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+** LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+** ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+** SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+**
+** ###################################################################
+*/
+
+/*==========================================================================*/
+/*!
+ * @addtogroup LMM_VOTE
+ * @{
+ *
+ * @file
+ * @brief
+ *
+ * Header file containing the API for the Logical Machine Manager vote
+ * aggregation.
+ */
+/*==========================================================================*/
+
+#ifndef LMM_VOTE_H
+#define LMM_VOTE_H
+
+/* Includes */
+
+#include "sm.h"
+
+/* Defines */
+
+/*!
+ * @name LMM vote policies
+ */
+/** @{ */
+#define LMM_VOTE_OR   0U  /*!< 1 if any voter has voted, else 0 */
+#define LMM_VOTE_REF  1U  /*!< Number of voters that have voted */
+#define LMM_VOTE_MAX  2U  /*!< Highest vote */
+#define LMM_VOTE_MIN  3U  /*!< Lowest non-zero vote, 0 if none */
+/** @} */
+
+/*!
+ * @name LMM vote statistics types
+ */
+/** @{ */
+#define LMM_VOTE_TYPE_CLOCK  0U  /*!< Clock enable votes */
+#define LMM_VOTE_TYPE_POWER  1U  /*!< Power state votes */
+#define LMM_VOTE_TYPE_PERF   2U  /*!< Performance level votes */
+#define LMM_VOTE_TYPE_VOLT   3U  /*!< Voltage mode votes */
+#define LMM_VOTE_NUM_TYPE    4U  /*!< Number of vote types */
+/** @} */
+
+/*! Voter mask including all voters */
+#define LMM_VOTE_ALL  0xFFFFFFFFU
+
+/*! Max number of voters */
+#define LMM_VOTE_MAX_VOTER  32U
+
+/*!
+ * Number of vote bit-planes, level votes must be less than 2^planes.
+ * LMM_PerfLevelSet() checks the device level count against this at
+ * compile time.
+ */
+#ifndef LMM_VOTE_NUM_PLANE
+#define LMM_VOTE_NUM_PLANE  3U
+#endif
+
+/*! Number of words in a sync bitmap for \a N resources */
+#define LMM_VOTE_WORDS(N)  ((((N) - 1U) / 32U) + 1U)
+
+/* Types */
+
+/*!
+ * Level vote state.
+ *
+ * Votes are stored as bit-planes. Bit n of plane b is bit b of the vote
+ * of voter n. The aggregate is found with one pass over the planes, so
+ * the cost does not depend on the number of voters.
+ */
+typedef struct
+{
+    uint32_t plane[LMM_VOTE_NUM_PLANE];  /*!< Vote bit-planes */
+} lmm_vote_level_t;
+
+/*!
+ * Vote statistics
+ */
+typedef struct
+{
+    uint32_t updates;     /*!< Number of vote updates */
+    uint32_t writes;      /*!< Number of hardware writes */
+    uint32_t suppressed;  /*!< Number of skipped no-op hardware writes */
+} lmm_vote_stats_t;
+
+/* Functions */
+
+/*!
+ * Update a bitmap vote.
+ *
+ * @param[in,out] voters    Bitmap of voters, bit per voter
+ * @param[in]     mask      Mask of voters to aggregate
+ * @param[in]     voter     Voter to update
+ * @param[in]     vote      True to vote, false to withdraw
+ * @param[in]     policy    Aggregation policy (OR or REF)
+ * @param[out]    value     Return new aggregate (can be NULL)
+ * @param[out]    changed   Return true if the aggregate changed (can be
+ *                          NULL)
+ *
+ * Records the vote of \a voter and returns the aggregate over the voters
+ * in \a mask. The update is done with interrupts locked, so votes can be
+ * cast from any handler priority.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_INVALID_PARAMETERS: if \a voter or \a policy is invalid.
+ */
+int32_t LMM_VoteBitSet(uint32_t *voters, uint32_t mask, uint32_t voter,
+    bool vote, uint8_t policy, uint32_t *value, bool *changed);
+
+/*!
+ * Update a level vote.
+ *
+ * @param[in,out] vote      Level vote state
+ * @param[in]     mask      Mask of voters to aggregate
+ * @param[in]     voter     Voter to update
+ * @param[in]     level     New vote, 0 for no vote
+ * @param[in]     policy    Aggregation policy (MAX or MIN)
+ * @param[out]    value     Return new aggregate (can be NULL)
+ * @param[out]    changed   Return true if the aggregate changed (can be
+ *                          NULL)
+ *
+ * Records the vote of \a voter and returns the aggregate over the voters
+ * in \a mask. Atomic like LMM_VoteBitSet().
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_INVALID_PARAMETERS: if \a voter, \a level or \a policy is
+ *   invalid.
+ */
+int32_t LMM_VoteLevelSet(lmm_vote_level_t *vote, uint32_t mask,
+    uint32_t voter, uint32_t level, uint8_t policy, uint32_t *value,
+    bool *changed);
+
+/*!
+ * Get a level vote.
+ *
+ * @param[in]     vote      Level vote state
+ * @param[in]     voter     Voter
+ *
+ * @return Returns the current vote of \a voter.
+ */
+uint32_t LMM_VoteLevelGet(const lmm_vote_level_t *vote, uint32_t voter);
+
+/*!
+ * Check if a hardware write is needed.
+ *
+ * @param[in]     type      Vote type (LMM_VOTE_TYPE_*)
+ * @param[in]     sync      Sync bitmap, bit per resource
+ * @param[in]     id        Resource
+ * @param[in]     changed   True if the aggregate changed
+ *
+ * A write is needed if the aggregate changed or the hardware is not known
+ * to be in sync with it. Updates the statistics of \a type.
+ *
+ * @return Returns true if the write is needed.
+ */
+bool LMM_VoteWriteNeeded(uint32_t type, const uint32_t *sync, uint32_t id,
+    bool changed);
+
+/*!
+ * Record the result of a hardware write.
+ *
+ * @param[in,out] sync      Sync bitmap, bit per resource
+ * @param[in]     id        Resource
+ * @param[in]     status    Status returned by the write
+ *
+ * Marks the resource in sync if the write succeeded, else out of sync so
+ * the next vote is written even if the aggregate does not change.
+ */
+void LMM_VoteWriteDone(uint32_t *sync, uint32_t id, int32_t status);
+
+/*!
+ * Mark a resource out of sync.
+ *
+ * @param[in,out] sync      Sync bitmap, bit per resource
+ * @param[in]     id        Resource
+ *
+ * Used when the hardware state changes outside of the votes. The next
+ * vote for the resource is then written to the hardware.
+ */
+void LMM_VoteSyncClear(uint32_t *sync, uint32_t id);
+
+/*!
+ * Get vote statistics.
+ *
+ * @param[in]     type      Vote type (LMM_VOTE_TYPE_*)
+ * @param[out]    stats     Return statistics
+ * @param[in]     reset     True to reset the statistics
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_FOUND: if \a type is invalid.
+ */
+int32_t LMM_VoteStatsGet(uint32_t type, lmm_vote_stats_t *stats,
+    bool reset);
+
+#endif /* LMM_VOTE_H */
+
+/** @} */
+
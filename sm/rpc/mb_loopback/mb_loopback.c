@@ -45,6 +45,13 @@
 
 /* Local defines */
 
+/* Buffer stride, largest configured buffer size */
+#ifdef SM_MB_LOOPBACK_MAX_BUF_SIZE
+#define MB_LB_BUF_STRIDE  SM_MB_LOOPBACK_MAX_BUF_SIZE
+#else
+#define MB_LB_BUF_STRIDE  SM_MB_LB_BUF_SIZE
+#endif
+
 /* Local types */
 
 static bool s_abortState[SM_NUM_MB_LOOPBACK];
@@ -82,11 +89,37 @@ int32_t MB_LOOPBACK_Init(uint8_t inst, uint8_t db, bool noIrq,
 uint32_t *MB_LOOPBACK_SmaGet(uint8_t inst, uint8_t db)
 {
     static uint32_t s_smtBuffer[SM_NUM_MB_LOOPBACK][SM_NUM_MB_LB_DB]
-    [SM_MB_LB_BUF_SIZE/4];
+    [MB_LB_BUF_STRIDE/4];
 
     return s_smtBuffer[inst][db];
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get mailbox buffer address as seen by the agent                          */
+/*--------------------------------------------------------------------------*/
+uint64_t MB_LOOPBACK_SmaAgentGet(uint8_t inst, uint8_t db)
+{
+    const uint32_t *sma = MB_LOOPBACK_SmaGet(inst, db);
+
+    return (uint64_t) ((uintptr_t) sma);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get mailbox buffer size                                                  */
+/*--------------------------------------------------------------------------*/
+uint32_t MB_LOOPBACK_SmaSizeGet(uint8_t inst, uint8_t db)
+{
+    uint32_t size = s_mbLbConfig[inst].bufSize[db];
+
+    /* Use default if not configured */
+    if (size == 0U)
+    {
+        size = SM_MB_LB_BUF_SIZE;
+    }
+
+    return size;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Ring mailbox doorbell                                                    */
 /*--------------------------------------------------------------------------*/
@@ -82,10 +82,36 @@ int32_t MB_LOOPBACK_Init(uint8_t inst, uint8_t db, bool noIrq,
  * Returns the address for the MB instance shared memory. The address is
  * unique per MB instance and doorbell.
  *
- * @return Returns the status (::SM_ERR_SUCCESS = success).
+ * @return Returns the buffer address.
  */
 uint32_t *MB_LOOPBACK_SmaGet(uint8_t inst, uint8_t db);
 
+/*!
+ * Get MB shared memory address as seen by the agent.
+ *
+ * @param[in]     inst        Instance
+ * @param[in]     db          Doorbell
+ *
+ * The loopback agent shares the address space of the SM.
+ *
+ * @return Returns the agent buffer address.
+ */
+uint64_t MB_LOOPBACK_SmaAgentGet(uint8_t inst, uint8_t db);
+
+/*!
+ * Get MB shared memory size.
+ *
+ * @param[in]     inst        Instance
+ * @param[in]     db          Doorbell
+ *
+ * Returns the size of the shared memory buffer for the MB instance and
+ * doorbell. This is the configured size or ::SM_MB_LB_BUF_SIZE if not
+ * configured.
+ *
+ * @return Returns the buffer size in bytes.
+ */
+uint32_t MB_LOOPBACK_SmaSizeGet(uint8_t inst, uint8_t db);
+
 /*!
  * Ring MB doorbell.
  *
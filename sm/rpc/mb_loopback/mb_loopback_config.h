@@ -54,7 +54,7 @@
 
 /* Defines */
 
-/*! Size of transport shared memory per channel */
+/*! Default size of transport shared memory per channel */
 #define SM_MB_LB_BUF_SIZE  128U
 
 /*! Number of doorbells */
@@ -69,6 +69,7 @@ typedef struct
 {
     uint8_t xportType[SM_NUM_MB_LB_DB];     /*!< Linked transport type */
     uint8_t xportChannel[SM_NUM_MB_LB_DB];  /*!< Linked transport channel */
+    uint16_t bufSize[SM_NUM_MB_LB_DB];      /*!< Buffer sizes (0=default) */
 } mb_lb_config_t;
 
 #endif /* MB_LOOPBACK_CONFIG_H */
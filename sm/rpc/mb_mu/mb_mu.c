@@ -42,11 +42,16 @@
 #include "fsl_device_registers.h"
 #include "mb_mu.h"
 #include "config_mb_mu.h"
-#include "rpc_smt.h"
+#include "rpc_scmi.h"
 #include "fsl_mu.h"
 
 /* Local defines */
 
+/*! Mask of all doorbell (GI) status flags */
+#define MB_MU_DB_FLAGS  (((uint32_t) kMU_GenInt0Flag) \
+    | ((uint32_t) kMU_GenInt1Flag) | ((uint32_t) kMU_GenInt2Flag) \
+    | ((uint32_t) kMU_GenInt3Flag))
+
 /* Local types */
 
 /* Local variables */
@@ -58,6 +63,12 @@ static const mb_mu_config_t s_mbMuConfig[SM_NUM_MB_MU] =
 
 static MU_Type *const s_muBases[] = MU_BASE_PTRS;
 
+static const mb_mu_dispatch_t s_mbMuDispatch[ARRAY_SIZE(s_muBases)]
+    [SM_NUM_MB_MU_DB] =
+{
+    SM_MB_MU_DISPATCH_DATA
+};
+
 /* Local functions */
 
 /*--------------------------------------------------------------------------*/
@@ -82,6 +93,12 @@ int32_t MB_MU_Init(uint8_t inst, uint8_t db, bool noIrq, uint32_t initCount)
 
         /* Init MU */
         MU_Init(base);
+
+        /* Override board default priority */
+        if (s_mbMuConfig[inst].irqPrio != 0U)
+        {
+            NVIC_SetPriority(irq, s_mbMuConfig[inst].irqPrio);
+        }
         NVIC_EnableIRQ(irq);
     }
 
@@ -113,11 +130,58 @@ uint32_t *MB_MU_SmaGet(uint8_t inst, uint8_t db)
     }
 
     /* Apply channel spacing */
-    sma += ((uint32_t) db) * SM_MB_MU_BUF_SIZE;
+    for (uint8_t prev = 0U; prev < db; prev++)
+    {
+        sma += MB_MU_SmaSizeGet(inst, prev);
+    }
 
     return (uint32_t*) sma;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get mailbox buffer address as seen by the agent                          */
+/*--------------------------------------------------------------------------*/
+uint64_t MB_MU_SmaAgentGet(uint8_t inst, uint8_t db)
+{
+    uint64_t sma = s_mbMuConfig[inst].smaAgent;
+
+    /* Same view as the SM */
+    if (sma == 0U)
+    {
+        sma = s_mbMuConfig[inst].sma;
+    }
+
+    /* MU SRAM via the agent side of the MU */
+    if (sma == 0U)
+    {
+        sma = ((uint32_t) s_muBases[s_mbMuConfig[inst].muAgent]) + 0x1000U;
+    }
+
+    /* Apply channel spacing */
+    for (uint8_t prev = 0U; prev < db; prev++)
+    {
+        sma += MB_MU_SmaSizeGet(inst, prev);
+    }
+
+    return sma;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get mailbox buffer size                                                  */
+/*--------------------------------------------------------------------------*/
+uint32_t MB_MU_SmaSizeGet(uint8_t inst, uint8_t db)
+{
+    uint32_t size = s_mbMuConfig[inst].bufSize[db];
+
+    /* Use default if not configured */
+    if (size == 0U)
+    {
+        size = SM_MB_MU_BUF_SIZE;
+    }
+
+    return size;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Ring mailbox doorbell                                                    */
 /*--------------------------------------------------------------------------*/
@@ -216,7 +280,6 @@ void MB_MU_Handler(uint32_t mu)
 {
     MU_Type *base = s_muBases[mu];
     uint32_t flags;
-    uint32_t mb;
 
     /* Get interrupt status flags */
     flags = MU_GetStatusFlags(base);
@@ -224,32 +287,31 @@ void MB_MU_Handler(uint32_t mu)
     /* Clear interrupts */
     MU_ClearStatusFlags(base, flags);
 
-    /* Find mailbox */
-    for (mb = 0U; mb < SM_NUM_MB_MU; mb++)
+    /* Loop over pending GI, lowest doorbell first */
+    flags &= MB_MU_DB_FLAGS;
+    while (flags != 0U)
     {
-        /* MU found? */
-        if (s_mbMuConfig[mb].mu == mu)
-        {
-            /* Loop over pending GI */
-            for (uint32_t gi = 0U; gi < SM_NUM_MB_MU_DB; gi++)
-            {
-                uint32_t mask = ((uint32_t) kMU_GenInt0Flag) << gi;
+        uint32_t lsb = flags & (~flags + 1U);
+        uint32_t db = ((uint32_t) __CLZ((uint32_t) kMU_GenInt0Flag))
+            - ((uint32_t) __CLZ(lsb));
+        const mb_mu_dispatch_t *disp = &s_mbMuDispatch[mu][db];
 
-                if ((flags & mask) != 0U)
+        /* Clear from pending */
+        flags &= ~lsb;
+
+        /* Call transport */
+        switch (disp->xportType)
+        {
+            case SM_XPORT_SMT:
+                /* SMT binds straight through to the RPC channel */
+                if (disp->rpcType == SM_RPC_SCMI)
                 {
-                    /* Call transport */
-                    switch (s_mbMuConfig[mb].xportType[gi])
-                    {
-                        case SM_XPORT_SMT:
-                            RPC_SMT_Dispatch(
-                                s_mbMuConfig[mb].xportChannel[gi]);
-                            break;
-                        default:
-                            ; /* Intentional empty default */
-                            break;
-                    }
+                    RPC_SCMI_Dispatch(disp->rpcChannel);
                 }
-            }
+                break;
+            default:
+                ; /* Intentional empty default */
+                break;
         }
     }
 }
@@ -79,12 +79,41 @@ int32_t MB_MU_Init(uint8_t inst, uint8_t db, bool noIrq, uint32_t initCount);
  * @param[in]     db          Doorbell
  *
  * Returns the address for the MU instance shared memory. The address is
- * unique per MU instance and doorbell.
+ * unique per MU instance and doorbell. Buffers for the doorbells of an
+ * instance are packed back-to-back using the configured buffer sizes.
  *
- * @return Returns the status (::SM_ERR_SUCCESS = success).
+ * @return Returns the buffer address.
  */
 uint32_t *MB_MU_SmaGet(uint8_t inst, uint8_t db);
 
+/*!
+ * Get MU shared memory address as seen by the agent.
+ *
+ * @param[in]     inst        Instance
+ * @param[in]     db          Doorbell
+ *
+ * Returns the address of the same buffer as MB_MU_SmaGet() in the memory
+ * map of the agent. This is the configured agent view of the shared
+ * memory, or for the MU SRAM, the SRAM of the agent side of the MU.
+ *
+ * @return Returns the agent buffer address.
+ */
+uint64_t MB_MU_SmaAgentGet(uint8_t inst, uint8_t db);
+
+/*!
+ * Get MU shared memory size.
+ *
+ * @param[in]     inst        Instance
+ * @param[in]     db          Doorbell
+ *
+ * Returns the size of the shared memory buffer for the MU instance and
+ * doorbell. This is the configured size or ::SM_MB_MU_BUF_SIZE if not
+ * configured.
+ *
+ * @return Returns the buffer size in bytes.
+ */
+uint32_t MB_MU_SmaSizeGet(uint8_t inst, uint8_t db);
+
 /*!
  * Ring MU doorbell.
  *
@@ -54,7 +54,7 @@
 
 /* Defines */
 
-/*! Size of transport shared memory per channel */
+/*! Default size of transport shared memory per channel */
 #define SM_MB_MU_BUF_SIZE  128U
 
 /*! Number of general purpose interrupts for doorbells */
@@ -69,10 +69,29 @@ typedef struct
 {
     uint32_t mu;                            /*!< Index to MU SDK driver */
     uint32_t sma;                           /*!< Shared memory address */
+    uint32_t muAgent;                       /*!< MU SDK index, agent side */
+    uint32_t smaAgent;                      /*!< Agent view of sma (0=sma) */
     uint8_t xportType[SM_NUM_MB_MU_DB];     /*!< Linked transport types */
     uint8_t xportChannel[SM_NUM_MB_MU_DB];  /*!< Linked transport channels */
+    uint16_t bufSize[SM_NUM_MB_MU_DB];      /*!< Buffer sizes (0=default) */
+    uint8_t irqPrio;                        /*!< NVIC prio (1-7, 0=default) */
 } mb_mu_config_t;
 
+/*!
+ * Mailbox-MU dispatch structure
+ *
+ * Flattened (MU, doorbell) to transport and RPC channel lookup generated
+ * by the configtool so the MU IRQ handler can dispatch to the RPC channel
+ * without searching or going through the transport.
+ */
+typedef struct
+{
+    uint8_t xportType;                      /*!< Linked transport type */
+    uint8_t xportChannel;                   /*!< Linked transport channel */
+    uint8_t rpcType;                        /*!< Linked RPC type */
+    uint8_t rpcChannel;                     /*!< Linked RPC channel */
+} mb_mu_dispatch_t;
+
 #endif /* MB_MU_CONFIG_H */
 
 /** @} */
@@ -49,6 +49,32 @@
 
 #define SCMI_NUM_Q  2U
 
+/* Max length of a queued P2A message */
+#define SCMI_NOTIFY_MAX_LEN  32U
+
+/* SCMI message types */
+#define SCMI_TYPE_DELAYED  2U
+#define SCMI_TYPE_NOTIFY   3U
+
+/* Protocol dispatch table size, indexed by the low bits of the ID */
+#define SCMI_NUM_PROTO_IDX  32U
+
+#ifdef SCMI_STATS
+/* Number of message statistics entries (all instances) */
+#define SCMI_STATS_NUM_MSG  64U
+
+/* Message statistics entry in use */
+#define SCMI_STATS_VALID    0x80000000U
+#endif
+
+#ifdef SCMI_TRACE
+/* Version of the trace export format */
+#define SCMI_TRACE_VERSION  1U
+
+/* Number of words per exported trace entry */
+#define SCMI_TRACE_WORDS    6U
+#endif
+
 /* Local macros */
 
 /* SCMI header creation */
@@ -63,8 +89,20 @@
 #define SCMI_HEADER_PROTOCOL_EX(x)  (((x) & 0x3FC00U) >> 10U)
 #define SCMI_HEADER_TOKEN_EX(x)  (((x) & 0x0FFC0000U) >> 18U)
 
+/* Index of a protocol in the dispatch table */
+#define SCMI_PROTO_IDX(x)  ((x) & (SCMI_NUM_PROTO_IDX - 1U))
+
 /* Local types */
 
+typedef int32_t (*protocol_func_t)(scmi_caller_t *caller,
+    uint32_t messageId);
+
+typedef struct
+{
+    uint32_t protocolId;
+    protocol_func_t dispatch;
+} protocol_desc_t;
+
 typedef struct
 {
     uint32_t header;
@@ -73,10 +111,19 @@ typedef struct
 
 typedef struct
 {
+    uint32_t header;
+    uint32_t key;
+    uint32_t len;
+    uint32_t data[SCMI_NOTIFY_MAX_LEN / 4U];
+} notify_event_t;
+
+typedef struct
+{
+    notify_event_t *event;
+    uint32_t depth;
     uint32_t head;
     uint32_t tail;
     uint32_t count;
-    uint32_t data[SM_SCMI_MAX_NOTIFY];
 } notify_queue_t;
 
 /* Local variables */
@@ -99,27 +146,103 @@ static const uint8_t s_protocolList[] =
     (uint8_t) SCMI_PROTOCOL_MISC
 };
 
+/* Protocol dispatch table, indexed by SCMI_PROTO_IDX() */
+static const protocol_desc_t s_protocolDesc[SCMI_NUM_PROTO_IDX] =
+{
+    [SCMI_PROTO_IDX(SCMI_PROTOCOL_BASE)] =
+        {SCMI_PROTOCOL_BASE, RPC_SCMI_BaseDispatchCommand},
+    [SCMI_PROTO_IDX(SCMI_PROTOCOL_POWER)] =
+        {SCMI_PROTOCOL_POWER, RPC_SCMI_PowerDispatchCommand},
+    [SCMI_PROTO_IDX(SCMI_PROTOCOL_SYSTEM)] =
+        {SCMI_PROTOCOL_SYSTEM, RPC_SCMI_SysDispatchCommand},
+    [SCMI_PROTO_IDX(SCMI_PROTOCOL_PERF)] =
+        {SCMI_PROTOCOL_PERF, RPC_SCMI_PerfDispatchCommand},
+    [SCMI_PROTO_IDX(SCMI_PROTOCOL_CLOCK)] =
+        {SCMI_PROTOCOL_CLOCK, RPC_SCMI_ClockDispatchCommand},
+    [SCMI_PROTO_IDX(SCMI_PROTOCOL_SENSOR)] =
+        {SCMI_PROTOCOL_SENSOR, RPC_SCMI_SensorDispatchCommand},
+    [SCMI_PROTO_IDX(SCMI_PROTOCOL_RESET)] =
+        {SCMI_PROTOCOL_RESET, RPC_SCMI_ResetDispatchCommand},
+    [SCMI_PROTO_IDX(SCMI_PROTOCOL_VOLTAGE)] =
+        {SCMI_PROTOCOL_VOLTAGE, RPC_SCMI_VoltageDispatchCommand},
+    [SCMI_PROTO_IDX(SCMI_PROTOCOL_PINCTRL)] =
+        {SCMI_PROTOCOL_PINCTRL, RPC_SCMI_PinctrlDispatchCommand},
+    [SCMI_PROTO_IDX(SCMI_PROTOCOL_LMM)] =
+        {SCMI_PROTOCOL_LMM, RPC_SCMI_LmmDispatchCommand},
+    [SCMI_PROTO_IDX(SCMI_PROTOCOL_BBM)] =
+        {SCMI_PROTOCOL_BBM, RPC_SCMI_BbmDispatchCommand},
+    [SCMI_PROTO_IDX(SCMI_PROTOCOL_CPU)] =
+        {SCMI_PROTOCOL_CPU, RPC_SCMI_CpuDispatchCommand},
+    [SCMI_PROTO_IDX(SCMI_PROTOCOL_FUSA)] =
+        {SCMI_PROTOCOL_FUSA, RPC_SCMI_FusaDispatchCommand},
+    [SCMI_PROTO_IDX(SCMI_PROTOCOL_MISC)] =
+        {SCMI_PROTOCOL_MISC, RPC_SCMI_MiscDispatchCommand}
+};
+
 static uint32_t s_token[SM_SCMI_NUM_CHN];
 static uint32_t s_channel2queue[SM_SCMI_NUM_CHN];
 static uint32_t s_agent2channel[SM_SCMI_NUM_AGNT][SCMI_NUM_Q];
 static notify_queue_t s_queue[SM_SCMI_NUM_AGNT][SCMI_NUM_Q];
+static notify_event_t s_notifyEvent[SM_SCMI_NUM_NOTIFY];
+static scmi_notify_counters_t s_notifyCounters[SM_SCMI_NUM_AGNT];
+static bool s_notifyPack[SM_SCMI_NUM_AGNT];
+static volatile bool s_pending[SM_SCMI_NUM_CHN];
+static volatile bool s_p2aClaim[SM_SCMI_NUM_CHN];
+static uint32_t s_lastChannel;
 #ifdef MONITOR
 static channel_err_t s_channelErr[SM_SCMI_NUM_CHN];
 #endif
+#ifdef SCMI_STATS
+static uint64_t s_statsStart[SM_SCMI_NUM_CHN];
+static scmi_stats_t s_chnStats[SM_SCMI_NUM_CHN];
+static scmi_stats_t s_msgStats[SCMI_STATS_NUM_MSG];
+#endif
+#ifdef SCMI_TRACE
+static scmi_trace_t s_trace[SM_SCMI_TRACE_NUM];
+static uint32_t s_traceCount;
+static uint32_t s_traceBase;
+#endif
 
 /* Local functions */
 
 static void *RPC_SCMI_HdrAddrGet(uint32_t scmiChannel);
+static uint32_t RPC_SCMI_MaxLenGet(uint32_t scmiChannel);
 static bool RPC_SCMI_ChannelFree(uint32_t scmiChannel);
 static int32_t RPC_SCMI_IsAborted(uint32_t scmiChannel);
+static bool RPC_SCMI_PendingGet(uint32_t *scmiChannel);
 static void RPC_SCMI_A2pDispatch(uint32_t scmiChannel);
+static void RPC_SCMI_A2pFastDispatch(uint32_t scmiChannel);
 static int32_t RPC_SCMI_A2pSubDispatch(scmi_caller_t *caller,
     uint32_t protocolId, uint32_t messageId);
+static void RPC_SCMI_P2aQInit(uint32_t agentId, uint32_t queue,
+    uint32_t scmiChannel);
+static void RPC_SCMI_P2aEnqueue(uint32_t agentId, uint32_t queue,
+    uint32_t header, uint32_t key, const uint32_t *msg, uint32_t len);
 static void RPC_SCMI_P2aDispatch(uint32_t scmiChannel);
+static bool RPC_SCMI_P2aPackTx(uint32_t scmiChannel, uint32_t *msg);
+static int32_t RPC_SCMI_P2aXport(uint32_t scmiChannel, uint32_t len,
+    bool compInt);
 static int32_t RPC_SCMI_A2pRx(scmi_caller_t *caller, void* msgRx,
     uint32_t len);
 static int32_t RPC_SCMI_A2pTx(const scmi_caller_t *caller, uint32_t len,
     int32_t status);
+#ifdef SCMI_STATS
+static void RPC_SCMI_StatsRecord(const scmi_caller_t *caller,
+    int32_t status);
+static void RPC_SCMI_StatsUpdate(scmi_stats_t *stats, uint32_t nsec,
+    int32_t status);
+static scmi_stats_t *RPC_SCMI_StatsFind(uint32_t scmiInst, uint32_t type,
+    uint32_t index);
+#ifdef MONITOR
+static void RPC_SCMI_StatsPrint(const scmi_stats_t *stats);
+#endif
+#endif
+#ifdef SCMI_TRACE
+static void RPC_SCMI_TraceRecord(uint32_t type, uint32_t channel,
+    uint32_t header, const uint32_t *payload, int32_t status,
+    uint64_t start);
+static uint32_t RPC_SCMI_TraceNum(void);
+#endif
 
 /*--------------------------------------------------------------------------*/
 /* Init SCMI instance                                                       */
@@ -150,6 +273,9 @@ int32_t RPC_SCMI_Init(uint8_t scmiInst)
                 bool noIrq = (g_scmiChannelConfig[scmiChannel].type
                     == SM_SCMI_CHN_P2A);
 
+                /* Drop any deferred request */
+                s_pending[scmiChannel] = false;
+
                 /* Record P2A notification channel */
                 if (g_scmiChannelConfig[scmiChannel].type
                     == SM_SCMI_CHN_P2A_NOTIFY)
@@ -157,6 +283,7 @@ int32_t RPC_SCMI_Init(uint8_t scmiInst)
                     s_agent2channel[agentId][SCMI_NOTIFY_Q]
                         = scmiChannel;
                     s_channel2queue[scmiChannel] = SCMI_NOTIFY_Q;
+                    RPC_SCMI_P2aQInit(agentId, SCMI_NOTIFY_Q, scmiChannel);
                 }
 
                 /* Record P2A priority notification channel */
@@ -166,6 +293,8 @@ int32_t RPC_SCMI_Init(uint8_t scmiInst)
                     s_agent2channel[agentId][SCMI_PRIORITY_Q]
                         = scmiChannel;
                     s_channel2queue[scmiChannel] = SCMI_PRIORITY_Q;
+                    RPC_SCMI_P2aQInit(agentId, SCMI_PRIORITY_Q,
+                        scmiChannel);
                 }
 
                 /* First channel for this agent? */
@@ -184,6 +313,14 @@ int32_t RPC_SCMI_Init(uint8_t scmiInst)
                     s_queue[agentId][SCMI_PRIORITY_Q].head = 0U;
                     s_queue[agentId][SCMI_PRIORITY_Q].tail = 0U;
                     s_queue[agentId][SCMI_PRIORITY_Q].count = 0U;
+
+                    /* Reset P2A counters */
+                    s_notifyCounters[agentId].queued = 0U;
+                    s_notifyCounters[agentId].coalesced = 0U;
+                    s_notifyCounters[agentId].dropped = 0U;
+
+                    /* Reset P2A packing */
+                    s_notifyPack[agentId] = false;
                 }
 
                 /* Reset transport */
@@ -200,6 +337,15 @@ int32_t RPC_SCMI_Init(uint8_t scmiInst)
                         break;
                 }
 
+                /* Init FastChannels */
+                if ((status == SM_ERR_SUCCESS)
+                    && (g_scmiChannelConfig[scmiChannel].type
+                    == SM_SCMI_CHN_A2P_FAST))
+                {
+                    RPC_SCMI_PerfFastChannelInit(g_scmiConfig[scmiInst].lmId,
+                        agentId, (uint32_t*) RPC_SCMI_HdrAddrGet(scmiChannel));
+                }
+
                 /* Increment init count for an agent */
                 initCount[agentId]++;
             }
@@ -246,15 +392,29 @@ void RPC_SCMI_Dispatch(uint32_t scmiChannel)
         case SM_SCMI_CHN_A2P:
             if (!channelFree)
             {
-                RPC_SCMI_A2pDispatch(scmiChannel);
+#ifdef SCMI_STATS
+                /* Record doorbell time */
+                s_statsStart[scmiChannel] = DEV_SM_Nsec64Get();
+#endif
+
+                /* Defer execution to the RPC handler */
+                s_pending[scmiChannel] = true;
+                PENDSV_Trigger();
             }
             break;
+        case SM_SCMI_CHN_A2P_FAST:
+            /* Defer execution to the RPC handler */
+            s_pending[scmiChannel] = true;
+            PENDSV_Trigger();
+            break;
         case SM_SCMI_CHN_P2A:
         case SM_SCMI_CHN_P2A_NOTIFY:
         case SM_SCMI_CHN_P2A_PRIORITY:
             if (channelFree)
             {
-                RPC_SCMI_P2aDispatch(scmiChannel);
+                /* Defer next send to the RPC handler */
+                s_pending[scmiChannel] = true;
+                PENDSV_Trigger();
             }
             break;
         default:
@@ -263,6 +423,103 @@ void RPC_SCMI_Dispatch(uint32_t scmiChannel)
     }
 }
 
+/*--------------------------------------------------------------------------*/
+/* Execute deferred SCMI requests                                           */
+/*--------------------------------------------------------------------------*/
+void RPC_SCMI_Handler(void)
+{
+    uint32_t scmiChannel = 0U;
+
+    /* Get highest priority pending request */
+    if (RPC_SCMI_PendingGet(&scmiChannel))
+    {
+        /* Consume request */
+        s_pending[scmiChannel] = false;
+        s_lastChannel = scmiChannel;
+
+        /* Execute request */
+        switch (g_scmiChannelConfig[scmiChannel].type)
+        {
+            case SM_SCMI_CHN_A2P:
+                if (!RPC_SCMI_ChannelFree(scmiChannel))
+                {
+                    RPC_SCMI_A2pDispatch(scmiChannel);
+                }
+                break;
+            case SM_SCMI_CHN_A2P_FAST:
+                RPC_SCMI_A2pFastDispatch(scmiChannel);
+                break;
+            default:
+                /* Send next queued message */
+                RPC_SCMI_P2aDispatch(scmiChannel);
+                break;
+        }
+    }
+    else
+    {
+        /* Execute async work once no commands are pending */
+        RPC_SCMI_ClockAsyncDispatch();
+        RPC_SCMI_SensorAsyncDispatch();
+        RPC_SCMI_SensorUpdateDispatch();
+    }
+
+    /* Come back for any remaining requests */
+    if (RPC_SCMI_PendingGet(&scmiChannel) || RPC_SCMI_ClockAsyncPending()
+        || RPC_SCMI_SensorAsyncPending() || RPC_SCMI_SensorUpdatePending())
+    {
+        PENDSV_Trigger();
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check for pending SCMI requests                                          */
+/*--------------------------------------------------------------------------*/
+bool RPC_SCMI_Pending(void)
+{
+    uint32_t scmiChannel = 0U;
+
+    return RPC_SCMI_PendingGet(&scmiChannel);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check for enabled clock rate notifications                               */
+/*--------------------------------------------------------------------------*/
+bool RPC_SCMI_ClockRateNotifyEnabled(void)
+{
+    return RPC_SCMI_ClockNotifyEnabled();
+}
+
+/*--------------------------------------------------------------------------*/
+/* Poll SCMI FastChannels                                                   */
+/*--------------------------------------------------------------------------*/
+void RPC_SCMI_Poll(void)
+{
+    bool trigger = false;
+
+    /* Mark all FastChannels pending */
+    for (uint32_t scmiChannel = 0U; scmiChannel < SM_SCMI_NUM_CHN;
+        scmiChannel++)
+    {
+        if (g_scmiChannelConfig[scmiChannel].type == SM_SCMI_CHN_A2P_FAST)
+        {
+            s_pending[scmiChannel] = true;
+            trigger = true;
+        }
+    }
+
+    /* Sensor updates due? */
+    if (RPC_SCMI_SensorUpdatePending())
+    {
+        trigger = true;
+    }
+
+    /* Defer execution to the RPC handler */
+    if (trigger)
+    {
+        PENDSV_Trigger();
+    }
+}
+
 /*--------------------------------------------------------------------------*/
 /* Send P2A message                                                         */
 /*--------------------------------------------------------------------------*/
@@ -281,7 +538,7 @@ int32_t RPC_SCMI_P2aTx(uint32_t scmiChannel, uint32_t protocolId,
         | SCMI_HEADER_TOKEN(s_token[scmiChannel]);
     if (notify)
     {
-        *header |= SCMI_HEADER_TYPE(3UL);
+        *header |= SCMI_HEADER_TYPE(SCMI_TYPE_NOTIFY);
     }
     msg->header = *header;
 
@@ -289,17 +546,7 @@ int32_t RPC_SCMI_P2aTx(uint32_t scmiChannel, uint32_t protocolId,
     s_token[scmiChannel]++;
 
     /* Send message via transport */
-    switch (g_scmiChannelConfig[scmiChannel].xportType)
-    {
-        case SM_XPORT_SMT:
-            status = RPC_SMT_Tx(
-                g_scmiChannelConfig[scmiChannel].xportChannel, len,
-                false, notify);
-            break;
-        default:
-            status = SM_ERR_NOT_SUPPORTED;
-            break;
-    }
+    status = RPC_SCMI_P2aXport(scmiChannel, len, notify);
 
     /* Return status */
     return status;
@@ -315,14 +562,24 @@ int32_t RPC_SCMI_P2aRx(uint32_t scmiChannel, uint32_t minLen,
     return SM_ERR_SUCCESS;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Check queue exists                                                       */
+/*--------------------------------------------------------------------------*/
+bool RPC_SCMI_P2aTxQValid(uint32_t agentId, uint32_t queue)
+{
+    /* Agents without a P2A channel of this type have no queue */
+    return s_queue[agentId][queue].depth != 0U;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Check queue full status                                                  */
 /*--------------------------------------------------------------------------*/
 bool RPC_SCMI_P2aTxQFull(uint32_t agentId, uint32_t len, uint32_t queue)
 {
     bool rtn = false;
+    const notify_queue_t *q = &s_queue[agentId][queue];
 
-    if ((len / 4U) > (SM_SCMI_MAX_NOTIFY - s_queue[agentId][queue].count))
+    if ((len > SCMI_NOTIFY_MAX_LEN) || (q->count >= q->depth))
     {
         rtn = true;
     }
@@ -335,33 +592,75 @@ bool RPC_SCMI_P2aTxQFull(uint32_t agentId, uint32_t len, uint32_t queue)
 /* Queue message to send on P2A channel                                     */
 /*--------------------------------------------------------------------------*/
 void RPC_SCMI_P2aTxQ(uint32_t agentId, scmi_msg_id_t msgId, uint32_t *msg,
-    uint32_t len, uint32_t queue)
+    uint32_t len, uint32_t queue, uint32_t key)
 {
-    /* Check space in queue */
-    if (!RPC_SCMI_P2aTxQFull(agentId, len, queue))
-    {
-        /* Generate header */
-        uint32_t header = SCMI_HEADER_MSG(msgId.messageId)
-            | SCMI_HEADER_PROTOCOL(msgId.protocolId)
-            | SCMI_HEADER_TYPE(3UL)
-            | SCMI_HEADER_TOKEN(len);
-        msg[0] = header;
+    /* Generate header */
+    uint32_t header = SCMI_HEADER_MSG(msgId.messageId)
+        | SCMI_HEADER_PROTOCOL(msgId.protocolId)
+        | SCMI_HEADER_TYPE(SCMI_TYPE_NOTIFY);
 
-        /* Queue message data */
-        for (uint32_t idx = 0U; idx < (len / 4U); idx++)
-        {
-            s_queue[agentId][queue].data[s_queue[agentId][queue].head]
-                = msg[idx];
-            s_queue[agentId][queue].head = (s_queue[agentId][queue].head
-                + 1U) % SM_SCMI_MAX_NOTIFY;
-            s_queue[agentId][queue].count++;
-        }
+    /* Guard queue against the P2A doorbell handler */
+    uint32_t irqState = IRQ_Lock();
+
+    /* Queue message */
+    RPC_SCMI_P2aEnqueue(agentId, queue, header, key, msg, len);
+
+    IRQ_Unlock(irqState);
+
+    /* Trigger xmit */
+    RPC_SCMI_P2aDispatch(s_agent2channel[agentId][queue]);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Queue delayed response to send on P2A channel                            */
+/*--------------------------------------------------------------------------*/
+void RPC_SCMI_P2aRespTxQ(uint32_t agentId, uint32_t header, uint32_t *msg,
+    uint32_t len)
+{
+    /* Reply with the token of the command */
+    uint32_t respHeader = (header & ~SCMI_HEADER_TYPE(0x3UL))
+        | SCMI_HEADER_TYPE(SCMI_TYPE_DELAYED);
+
+    /* Guard queue against the P2A doorbell handler */
+    uint32_t irqState = IRQ_Lock();
+
+    /* Queue message */
+    RPC_SCMI_P2aEnqueue(agentId, SCMI_NOTIFY_Q, respHeader,
+        SCMI_NOTIFY_KEY_NONE, msg, len);
+
+    IRQ_Unlock(irqState);
+
+    /* Trigger xmit */
+    RPC_SCMI_P2aDispatch(s_agent2channel[agentId][SCMI_NOTIFY_Q]);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get P2A queue counters                                                   */
+/*--------------------------------------------------------------------------*/
+void RPC_SCMI_P2aCountersGet(uint32_t agentId,
+    scmi_notify_counters_t *counters, bool reset)
+{
+    /* Return counters */
+    *counters = s_notifyCounters[agentId];
+    counters->depth = s_queue[agentId][SCMI_NOTIFY_Q].depth;
 
-        /* Trigger xmit */
-        RPC_SCMI_P2aDispatch(s_agent2channel[agentId][queue]);
+    /* Reset counters */
+    if (reset)
+    {
+        s_notifyCounters[agentId].queued = 0U;
+        s_notifyCounters[agentId].coalesced = 0U;
+        s_notifyCounters[agentId].dropped = 0U;
     }
 }
 
+/*--------------------------------------------------------------------------*/
+/* Configure packed P2A notifications                                       */
+/*--------------------------------------------------------------------------*/
+void RPC_SCMI_P2aPackSet(uint32_t agentId, bool enable)
+{
+    s_notifyPack[agentId] = enable;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Bounded string copy                                                      */
 /*--------------------------------------------------------------------------*/
@@ -381,6 +680,43 @@ void RPC_SCMI_StrCpy(uint8_t *dst, const uint8_t *src, uint32_t maxLen)
     *pDst = 0U;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Find next resource in a dirty-resource bitmap                            */
+/*--------------------------------------------------------------------------*/
+bool RPC_SCMI_DirtyNext(const uint32_t *dirty, uint32_t numRsrc,
+    uint32_t *rsrc)
+{
+    bool rtn = false;
+    uint32_t idx = *rsrc;
+
+    /* Loop over remaining resources */
+    while (idx < numRsrc)
+    {
+        uint32_t word = dirty[idx / 32U] >> (idx % 32U);
+
+        if (word == 0U)
+        {
+            /* Skip to next word */
+            idx = (idx & ~31U) + 32U;
+        }
+        else if ((word & 1U) != 0U)
+        {
+            rtn = true;
+            break;
+        }
+        else
+        {
+            idx++;
+        }
+    }
+
+    /* Return resource */
+    *rsrc = idx;
+
+    /* Return result */
+    return rtn;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Get number of protocols                                                  */
 /*--------------------------------------------------------------------------*/
@@ -472,7 +808,10 @@ int32_t RPC_SCMI_Trigger(const lmm_rpc_trigger_t *trigger)
 {
     int32_t status;
 
-    scmi_msg_id_t msgId;
+    scmi_msg_id_t msgId = { 0 };
+#ifdef SCMI_TRACE
+    uint64_t start = DEV_SM_Nsec64Get();
+#endif
 
     /* Queue via protocol */
     switch (trigger->event)
@@ -522,121 +861,128 @@ int32_t RPC_SCMI_Trigger(const lmm_rpc_trigger_t *trigger)
             msgId.messageId = RPC_SCMI_NOTIFY_MISC_CONTROL_EVENT;
             status = RPC_SCMI_MiscDispatchNotification(msgId, trigger);
             break;
+        case LMM_TRIGGER_PERF:
+            msgId.protocolId = SCMI_PROTOCOL_PERF;
+            msgId.messageId = RPC_SCMI_NOTIFY_PERFORMANCE_LEVEL_CHANGED;
+            status = RPC_SCMI_PerfDispatchNotification(msgId, trigger);
+            break;
+        case LMM_TRIGGER_POWER:
+            msgId.protocolId = SCMI_PROTOCOL_POWER;
+            msgId.messageId = RPC_SCMI_NOTIFY_POWER_STATE_CHANGED;
+            status = RPC_SCMI_PowerDispatchNotification(msgId, trigger);
+            break;
+        case LMM_TRIGGER_CLOCK:
+            msgId.protocolId = SCMI_PROTOCOL_CLOCK;
+            msgId.messageId = RPC_SCMI_NOTIFY_CLOCK_RATE_CHANGED;
+            status = RPC_SCMI_ClockDispatchNotification(msgId, trigger);
+            break;
         default:
             status = SM_ERR_INVALID_PARAMETERS;
             break;
     }
 
+#ifdef SCMI_TRACE
+    /* Record trigger */
+    RPC_SCMI_TraceRecord(SCMI_TRACE_TRIGGER, trigger->rpcInst,
+        SCMI_HEADER_MSG(msgId.messageId)
+        | SCMI_HEADER_TYPE(SCMI_TYPE_NOTIFY)
+        | SCMI_HEADER_PROTOCOL(msgId.protocolId), trigger->parm, status,
+        start);
+#endif
+
     /* Return status */
     return status;
 }
 
 /*--------------------------------------------------------------------------*/
-/* Dump collected SCMI errors                                               */
+/* Get FastChannel region                                                   */
 /*--------------------------------------------------------------------------*/
-void RPC_SCMI_ErrorDump(uint8_t scmiInst)
+uint32_t *RPC_SCMI_FastChannelGet(uint32_t agentId)
 {
-#ifdef MONITOR
-    /* Loop over channels */
+    uint32_t *fc = NULL;
+
+    /* Find FastChannel of agent */
     for (uint32_t scmiChannel = 0U; scmiChannel < SM_SCMI_NUM_CHN;
         scmiChannel++)
     {
-        uint32_t agent = g_scmiChannelConfig[scmiChannel].agentId;
-
-        if (g_scmiAgentConfig[agent].scmiInst == scmiInst)
+        if ((g_scmiChannelConfig[scmiChannel].agentId == agentId)
+            && (g_scmiChannelConfig[scmiChannel].type
+            == SM_SCMI_CHN_A2P_FAST))
         {
-            channel_err_t *err = &s_channelErr[scmiChannel];
-
-            if (err->status != SM_ERR_SUCCESS)
-            {
-                uint32_t header = err->header;
-
-                printf("SCMI err (chn=%u): ", scmiChannel);
-                printf("protocolId=0x%X", SCMI_HEADER_PROTOCOL_EX(header));
-                printf(", messageId=0x%X", SCMI_HEADER_MSG_EX(header));
-                printf(", status=%d\n", err->status);
-
-                /* Clear log */
-                err->status = SM_ERR_SUCCESS;
-            }
+            fc = (uint32_t*) RPC_SCMI_HdrAddrGet(scmiChannel);
+            break;
         }
     }
-#endif
-}
 
-/*==========================================================================*/
+    /* Return address */
+    return fc;
+}
 
 /*--------------------------------------------------------------------------*/
-/* Get buffer address                                                       */
+/* Get agent address of FastChannel region                                  */
 /*--------------------------------------------------------------------------*/
-static void *RPC_SCMI_HdrAddrGet(uint32_t scmiChannel)
+uint64_t RPC_SCMI_FastChannelAgentAddrGet(uint32_t agentId)
 {
-    void *addr = NULL;
+    uint64_t addr = 0U;
 
-    /* Get message buffer address */
-    switch (g_scmiChannelConfig[scmiChannel].xportType)
+    /* Find FastChannel of agent */
+    for (uint32_t scmiChannel = 0U; scmiChannel < SM_SCMI_NUM_CHN;
+        scmiChannel++)
     {
-        case SM_XPORT_SMT:
-            addr = RPC_SMT_HdrAddrGet(
-                g_scmiChannelConfig[scmiChannel].xportChannel);
-            break;
-        default:
-            ; /* Intentional empty default */
+        if ((g_scmiChannelConfig[scmiChannel].agentId == agentId)
+            && (g_scmiChannelConfig[scmiChannel].type
+            == SM_SCMI_CHN_A2P_FAST))
+        {
+            switch (g_scmiChannelConfig[scmiChannel].xportType)
+            {
+                case SM_XPORT_SMT:
+                    addr = RPC_SMT_HdrAgentAddrGet(
+                        g_scmiChannelConfig[scmiChannel].xportChannel);
+                    break;
+                default:
+                    ; /* Intentional empty default */
+                    break;
+            }
             break;
+        }
     }
 
+    /* Return address */
     return addr;
 }
 
 /*--------------------------------------------------------------------------*/
-/* Get channel free status                                                  */
+/* Dispatch SCMI A2P message                                                */
 /*--------------------------------------------------------------------------*/
-static bool RPC_SCMI_ChannelFree(uint32_t scmiChannel)
+int32_t RPC_SCMI_A2pMsgDispatch(scmi_caller_t *caller)
 {
-    bool channelFree = false;
+    int32_t status = SM_ERR_SUCCESS;
 
-    switch (g_scmiChannelConfig[scmiChannel].xportType)
+    /* Check message type */
+    if (SCMI_HEADER_TYPE_EX(caller->header) != 0U)
     {
-        case SM_XPORT_SMT:
-            channelFree = RPC_SMT_ChannelFree(
-                g_scmiChannelConfig[scmiChannel].xportChannel);
-            break;
-        default:
-            ; /* Intentional empty default */
-            break;
+        status = SM_ERR_COMMS_ERROR;
     }
 
-    return channelFree;
-}
+    if (status == SM_ERR_SUCCESS)
+    {
+        uint32_t protocolId;
+        uint32_t messageId;
 
-/*--------------------------------------------------------------------------*/
-/* Get abort status                                                         */
-/*                                                                          */
-/* Parameters:                                                              */
-/* - scmiChannel: SCMI channel                                              */
-/*                                                                          */
-/* This function returns SM_ERR_ABORT_ERROR if the channel is aborted.      */
-/*                                                                          */
-/* Return errors:                                                           */
-/* - SM_ERR_INVALID_PARAMETERS: if the configured transport is not          */
-/*   supported                                                              */
-/* - others returned by the transport abort function (e.g.                  */
-/*   RPC_SMT_IsAborted())                                                   */
-/*--------------------------------------------------------------------------*/
-static int32_t RPC_SCMI_IsAborted(uint32_t scmiChannel)
-{
-    int32_t status;
+        /* Decompose header */
+        protocolId = SCMI_HEADER_PROTOCOL_EX(caller->header);
+        messageId = SCMI_HEADER_MSG_EX(caller->header);
 
-    /* Get abort status */
-    switch (g_scmiChannelConfig[scmiChannel].xportType)
-    {
-        case SM_XPORT_SMT:
-            status = RPC_SMT_IsAborted(
-                g_scmiChannelConfig[scmiChannel].xportChannel);
-            break;
-        default:
-            status = SM_ERR_NOT_SUPPORTED;
-            break;
+        /* Protocol extension? */
+        caller->extension = false;
+        if (protocolId >= 0x90U)
+        {
+            caller->extension = true;
+            protocolId -= 0x80U;
+        }
+
+        /* Dispatch subrequest */
+        status = RPC_SCMI_A2pSubDispatch(caller, protocolId, messageId);
     }
 
     /* Return status */
@@ -644,17 +990,486 @@ static int32_t RPC_SCMI_IsAborted(uint32_t scmiChannel)
 }
 
 /*--------------------------------------------------------------------------*/
-/* Dispatch SCMI A2P request                                                */
+/* Check SCMI A2P message                                                   */
 /*--------------------------------------------------------------------------*/
-static void RPC_SCMI_A2pDispatch(uint32_t scmiChannel)
+int32_t RPC_SCMI_A2pMsgCheck(const scmi_caller_t *caller,
+    const scmi_msg_desc_t *desc, uint32_t numDesc, uint32_t messageId,
+    uint32_t *lenOut)
 {
-    scmi_caller_t caller = { 0 };
+    int32_t status = SM_ERR_SUCCESS;
 
-    /* Record channel */
-    caller.scmiChannel = scmiChannel;
+    /* Default to status only response */
+    *lenOut = sizeof(scmi_msg_status_t);
 
-    /* Map channel to agent */
-    caller.agentId = g_scmiChannelConfig[scmiChannel].agentId;
+    /* Check message supported */
+    if (!RPC_SCMI_A2pMsgSupported(desc, numDesc, messageId))
+    {
+        status = SM_ERR_NOT_SUPPORTED;
+    }
+
+    /* Check request length */
+    if ((status == SM_ERR_SUCCESS)
+        && (caller->lenCopy < desc[messageId].lenIn))
+    {
+        status = SM_ERR_PROTOCOL_ERROR;
+    }
+
+    /* Return response length */
+    if (status == SM_ERR_SUCCESS)
+    {
+        *lenOut = desc[messageId].lenOut;
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check if SCMI A2P message supported                                      */
+/*--------------------------------------------------------------------------*/
+bool RPC_SCMI_A2pMsgSupported(const scmi_msg_desc_t *desc,
+    uint32_t numDesc, uint32_t messageId)
+{
+    return (messageId < numDesc) && (desc[messageId].lenIn != 0U);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Dump collected SCMI errors                                               */
+/*--------------------------------------------------------------------------*/
+void RPC_SCMI_ErrorDump(uint8_t scmiInst)
+{
+#ifdef MONITOR
+    /* Loop over channels */
+    for (uint32_t scmiChannel = 0U; scmiChannel < SM_SCMI_NUM_CHN;
+        scmiChannel++)
+    {
+        uint32_t agent = g_scmiChannelConfig[scmiChannel].agentId;
+
+        if (g_scmiAgentConfig[agent].scmiInst == scmiInst)
+        {
+            channel_err_t *err = &s_channelErr[scmiChannel];
+
+            if (err->status != SM_ERR_SUCCESS)
+            {
+                uint32_t header = err->header;
+
+                printf("SCMI err (chn=%u): ", scmiChannel);
+                printf("protocolId=0x%X", SCMI_HEADER_PROTOCOL_EX(header));
+                printf(", messageId=0x%X", SCMI_HEADER_MSG_EX(header));
+                printf(", status=%d\n", err->status);
+
+                /* Clear log */
+                err->status = SM_ERR_SUCCESS;
+            }
+        }
+    }
+
+    /* Loop over agents */
+    for (uint32_t agentId = 0U; agentId < SM_SCMI_NUM_AGNT; agentId++)
+    {
+        const scmi_notify_counters_t *cnt = &s_notifyCounters[agentId];
+
+        if ((g_scmiAgentConfig[agentId].scmiInst == scmiInst)
+            && ((cnt->dropped != 0U) || (cnt->coalesced != 0U)))
+        {
+            printf("SCMI notify (agent=%u): ", agentId);
+            printf("depth=%u", s_queue[agentId][SCMI_NOTIFY_Q].depth);
+            printf(", queued=%u", cnt->queued);
+            printf(", coalesced=%u", cnt->coalesced);
+            printf(", dropped=%u\n", cnt->dropped);
+        }
+    }
+#endif
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get SCMI statistics                                                      */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_StatsGet(uint32_t scmiInst, uint32_t type, uint32_t index,
+    scmi_stats_t *stats)
+{
+#ifdef SCMI_STATS
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check type */
+    if ((type != SCMI_STATS_TYPE_CHANNEL) && (type != SCMI_STATS_TYPE_MSG))
+    {
+        status = SM_ERR_INVALID_PARAMETERS;
+    }
+
+    if (status == SM_ERR_SUCCESS)
+    {
+        const scmi_stats_t *entry = RPC_SCMI_StatsFind(scmiInst, type,
+            index);
+
+        /* Return entry */
+        if (entry != NULL)
+        {
+            *stats = *entry;
+            stats->id &= 0xFFFFU;
+        }
+        else
+        {
+            status = SM_ERR_NOT_FOUND;
+        }
+    }
+
+    /* Return status */
+    return status;
+#else
+    return SM_ERR_NOT_SUPPORTED;
+#endif
+}
+
+/*--------------------------------------------------------------------------*/
+/* Dump SCMI statistics                                                     */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_StatsDump(uint8_t scmiInst, bool reset)
+{
+#if defined(SCMI_STATS) && defined(MONITOR)
+    const scmi_stats_t *stats;
+    uint32_t index;
+
+    /* Loop over channels */
+    index = 0U;
+    stats = RPC_SCMI_StatsFind(scmiInst, SCMI_STATS_TYPE_CHANNEL, index);
+    while (stats != NULL)
+    {
+        printf("SCMI stats (chn=%u): ", stats->id);
+        RPC_SCMI_StatsPrint(stats);
+
+        index++;
+        stats = RPC_SCMI_StatsFind(scmiInst, SCMI_STATS_TYPE_CHANNEL,
+            index);
+    }
+
+    /* Loop over messages */
+    index = 0U;
+    stats = RPC_SCMI_StatsFind(scmiInst, SCMI_STATS_TYPE_MSG, index);
+    while (stats != NULL)
+    {
+        printf("SCMI stats (protocolId=0x%X, messageId=0x%X): ",
+            (stats->id >> 8U) & 0xFFU, stats->id & 0xFFU);
+        RPC_SCMI_StatsPrint(stats);
+
+        index++;
+        stats = RPC_SCMI_StatsFind(scmiInst, SCMI_STATS_TYPE_MSG, index);
+    }
+
+    /* Reset statistics */
+    if (reset)
+    {
+        const scmi_stats_t zero = { 0 };
+
+        for (uint32_t scmiChannel = 0U; scmiChannel < SM_SCMI_NUM_CHN;
+            scmiChannel++)
+        {
+            uint32_t agent = g_scmiChannelConfig[scmiChannel].agentId;
+
+            if (g_scmiAgentConfig[agent].scmiInst == scmiInst)
+            {
+                s_chnStats[scmiChannel] = zero;
+            }
+        }
+
+        /* Keep id so probe chains stay intact */
+        for (uint32_t slot = 0U; slot < SCMI_STATS_NUM_MSG; slot++)
+        {
+            uint32_t id = s_msgStats[slot].id;
+
+            if (((id & SCMI_STATS_VALID) != 0U)
+                && (((id >> 16U) & 0xFFU) == scmiInst))
+            {
+                s_msgStats[slot] = zero;
+                s_msgStats[slot].id = id;
+            }
+        }
+    }
+
+    /* Return status */
+    return SM_ERR_SUCCESS;
+#else
+    return SM_ERR_NOT_SUPPORTED;
+#endif
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get SCMI trace entry                                                     */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_TraceGet(uint32_t index, scmi_trace_t *entry)
+{
+#ifdef SCMI_TRACE
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check index */
+    if (index >= RPC_SCMI_TraceNum())
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+    else
+    {
+        /* Return entry, most recent first */
+        *entry = s_trace[(s_traceCount - 1U - index) % SM_SCMI_TRACE_NUM];
+    }
+
+    /* Return status */
+    return status;
+#else
+    return SM_ERR_NOT_SUPPORTED;
+#endif
+}
+
+/*--------------------------------------------------------------------------*/
+/* Dump SCMI trace                                                          */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_TraceDump(uint32_t scmiChannel, uint32_t protocolId)
+{
+#if defined(SCMI_TRACE) && defined(MONITOR)
+    static string const s_traceTypes[] =
+    {
+        "a2p",
+        "p2a",
+        "trg"
+    };
+    uint32_t num = RPC_SCMI_TraceNum();
+
+    /* Loop over entries, oldest first */
+    for (uint32_t index = num; index > 0U; index--)
+    {
+        uint32_t seq = s_traceCount - index;
+        const scmi_trace_t *entry = &s_trace[seq % SM_SCMI_TRACE_NUM];
+        uint32_t header = entry->header;
+
+        /* Filter */
+        if (((scmiChannel == SCMI_TRACE_ANY)
+            || ((entry->type != SCMI_TRACE_TRIGGER)
+            && (entry->channel == scmiChannel)))
+            && ((protocolId == SCMI_TRACE_ANY)
+            || (SCMI_HEADER_PROTOCOL_EX(header) == protocolId)))
+        {
+            printf("%u: time=%u, dur=%u nS, %s", seq, entry->time,
+                entry->duration, s_traceTypes[entry->type]);
+            printf(" %s=%u", (entry->type == SCMI_TRACE_TRIGGER)
+                ? "inst" : "chn", entry->channel);
+            printf(", protocolId=0x%X, messageId=0x%X, token=%u",
+                SCMI_HEADER_PROTOCOL_EX(header),
+                SCMI_HEADER_MSG_EX(header), SCMI_HEADER_TOKEN_EX(header));
+            printf(", status=%d\n", entry->status);
+            printf("    payload: 0x%08X 0x%08X\n", entry->payload[0],
+                entry->payload[1]);
+        }
+    }
+
+    /* Return status */
+    return SM_ERR_SUCCESS;
+#else
+    return SM_ERR_NOT_SUPPORTED;
+#endif
+}
+
+/*--------------------------------------------------------------------------*/
+/* Export SCMI trace                                                        */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_TraceExport(void)
+{
+#if defined(SCMI_TRACE) && defined(MONITOR)
+    uint32_t num = RPC_SCMI_TraceNum();
+
+    /* Format header */
+    printf("SCMI_TRACE %u %u %u\n", SCMI_TRACE_VERSION, num,
+        SCMI_TRACE_WORDS);
+
+    /* Loop over entries, oldest first */
+    for (uint32_t index = num; index > 0U; index--)
+    {
+        uint32_t seq = s_traceCount - index;
+        const scmi_trace_t *entry = &s_trace[seq % SM_SCMI_TRACE_NUM];
+        uint32_t info = ((uint32_t) entry->type)
+            | (((uint32_t) entry->channel) << 8U)
+            | (((uint32_t) entry->status) << 16U);
+
+        printf("T %u %08X %08X %08X %08X %08X %08X\n", seq, entry->time,
+            entry->duration, entry->header, entry->payload[0],
+            entry->payload[1], info);
+    }
+
+    /* Return status */
+    return SM_ERR_SUCCESS;
+#else
+    return SM_ERR_NOT_SUPPORTED;
+#endif
+}
+
+/*--------------------------------------------------------------------------*/
+/* Clear SCMI trace                                                         */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_TraceClear(void)
+{
+#ifdef SCMI_TRACE
+    /* Sequence numbers continue from the clear point */
+    s_traceBase = s_traceCount;
+
+    /* Return status */
+    return SM_ERR_SUCCESS;
+#else
+    return SM_ERR_NOT_SUPPORTED;
+#endif
+}
+
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Get buffer address                                                       */
+/*--------------------------------------------------------------------------*/
+static void *RPC_SCMI_HdrAddrGet(uint32_t scmiChannel)
+{
+    void *addr = NULL;
+
+    /* Get message buffer address */
+    switch (g_scmiChannelConfig[scmiChannel].xportType)
+    {
+        case SM_XPORT_SMT:
+            addr = RPC_SMT_HdrAddrGet(
+                g_scmiChannelConfig[scmiChannel].xportChannel);
+            break;
+        default:
+            ; /* Intentional empty default */
+            break;
+    }
+
+    return addr;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get max message length                                                   */
+/*--------------------------------------------------------------------------*/
+static uint32_t RPC_SCMI_MaxLenGet(uint32_t scmiChannel)
+{
+    uint32_t len = 0U;
+
+    /* Get max message length */
+    switch (g_scmiChannelConfig[scmiChannel].xportType)
+    {
+        case SM_XPORT_SMT:
+            len = RPC_SMT_MaxLenGet(
+                g_scmiChannelConfig[scmiChannel].xportChannel);
+            break;
+        default:
+            ; /* Intentional empty default */
+            break;
+    }
+
+    return len;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get channel free status                                                  */
+/*--------------------------------------------------------------------------*/
+static bool RPC_SCMI_ChannelFree(uint32_t scmiChannel)
+{
+    bool channelFree = false;
+
+    switch (g_scmiChannelConfig[scmiChannel].xportType)
+    {
+        case SM_XPORT_SMT:
+            channelFree = RPC_SMT_ChannelFree(
+                g_scmiChannelConfig[scmiChannel].xportChannel);
+            break;
+        default:
+            ; /* Intentional empty default */
+            break;
+    }
+
+    return channelFree;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get abort status                                                         */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - scmiChannel: SCMI channel                                              */
+/*                                                                          */
+/* This function returns SM_ERR_ABORT_ERROR if the channel is aborted.      */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_INVALID_PARAMETERS: if the configured transport is not          */
+/*   supported                                                              */
+/* - others returned by the transport abort function (e.g.                  */
+/*   RPC_SMT_IsAborted())                                                   */
+/*--------------------------------------------------------------------------*/
+static int32_t RPC_SCMI_IsAborted(uint32_t scmiChannel)
+{
+    int32_t status;
+
+    /* Get abort status */
+    switch (g_scmiChannelConfig[scmiChannel].xportType)
+    {
+        case SM_XPORT_SMT:
+            status = RPC_SMT_IsAborted(
+                g_scmiChannelConfig[scmiChannel].xportChannel);
+            break;
+        default:
+            status = SM_ERR_NOT_SUPPORTED;
+            break;
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get next pending request                                                 */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - scmiChannel: Return pointer to the SCMI channel                        */
+/*                                                                          */
+/* This function finds the pending channel whose agent has the highest      */
+/* configured priority. Channels of equal priority are served round-robin,  */
+/* starting after the last channel served.                                  */
+/*                                                                          */
+/* Returns true if a request is pending.                                    */
+/*--------------------------------------------------------------------------*/
+static bool RPC_SCMI_PendingGet(uint32_t *scmiChannel)
+{
+    bool found = false;
+    uint32_t priority = 0U;
+
+    /* Loop over channels */
+    for (uint32_t idx = 1U; idx <= SM_SCMI_NUM_CHN; idx++)
+    {
+        uint32_t chn = (s_lastChannel + idx) % SM_SCMI_NUM_CHN;
+
+        if (s_pending[chn])
+        {
+            uint32_t agentId = g_scmiChannelConfig[chn].agentId;
+            uint32_t chnPriority = g_scmiAgentConfig[agentId].priority;
+
+            /* Higher priority than already found? */
+            if ((!found) || (chnPriority > priority))
+            {
+                *scmiChannel = chn;
+                priority = chnPriority;
+                found = true;
+            }
+        }
+    }
+
+    /* Return result */
+    return found;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Dispatch SCMI A2P request                                                */
+/*--------------------------------------------------------------------------*/
+static void RPC_SCMI_A2pDispatch(uint32_t scmiChannel)
+{
+    scmi_caller_t caller = { 0 };
+
+    /* Record channel */
+    caller.scmiChannel = scmiChannel;
+
+    /* Map channel to agent */
+    caller.agentId = g_scmiChannelConfig[scmiChannel].agentId;
 
     /* Map agent to instance */
     caller.scmiInst= g_scmiAgentConfig[caller.agentId].scmiInst;
@@ -665,194 +1480,483 @@ static void RPC_SCMI_A2pDispatch(uint32_t scmiChannel)
     /* Record safety type */
     caller.safeType= g_lmmConfig[caller.lmId].safeType;
 
-    /* Map agent to instance agent */
-    caller.instAgentId = caller.agentId + 1U
-        - g_scmiConfig[caller.scmiInst].firstAgent;
+    /* Map agent to instance agent */
+    caller.instAgentId = caller.agentId + 1U
+        - g_scmiConfig[caller.scmiInst].firstAgent;
+
+    /* Get the message buffer address */
+    caller.msg = (scmi_msg_status_t*) RPC_SCMI_HdrAddrGet(scmiChannel);
+    caller.lenMsg = sizeof(scmi_msg_status_t);
+    caller.lenMax = RPC_SCMI_MaxLenGet(scmiChannel);
+
+    /* Get the buffer? */
+    if (caller.msg != NULL)
+    {
+        int32_t status;
+        static scmi_msg_t s_msgCopy;
+#ifdef SCMI_TRACE
+        uint64_t start = DEV_SM_Nsec64Get();
+#endif
+
+        /* Check if aborted */
+        status = RPC_SCMI_IsAborted(scmiChannel);
+
+        /* Copy receive data and do CRC */
+        if (status == SM_ERR_SUCCESS)
+        {
+            caller.msgCopy = &s_msgCopy;
+            status = RPC_SCMI_A2pRx(&caller, (void*) &s_msgCopy,
+                sizeof(s_msgCopy));
+        }
+        else
+        {
+            /* Use caller header to return error status */
+            caller.header = caller.msg->header;
+        }
+
+        /* Get header */
+        if (status == SM_ERR_SUCCESS)
+        {
+            caller.header = s_msgCopy.header;
+        }
+
+        /* Dispatch message */
+        if (status == SM_ERR_SUCCESS)
+        {
+            status = RPC_SCMI_A2pMsgDispatch(&caller);
+        }
+
+        /* Send response */
+        if (caller.lenMsg > 0U)
+        {
+            RPC_SCMI_A2pTx(&caller, caller.lenMsg, status);
+        }
+
+#ifdef SCMI_STATS
+        /* Record service time */
+        RPC_SCMI_StatsRecord(&caller, status);
+#endif
+
+#ifdef SCMI_TRACE
+        /* Record command */
+        RPC_SCMI_TraceRecord(SCMI_TRACE_A2P, scmiChannel, caller.header,
+            s_msgCopy.payload, status, start);
+#endif
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Dispatch SCMI A2P FastChannels                                           */
+/*--------------------------------------------------------------------------*/
+static void RPC_SCMI_A2pFastDispatch(uint32_t scmiChannel)
+{
+    uint32_t agentId = g_scmiChannelConfig[scmiChannel].agentId;
+    uint32_t scmiInst = g_scmiAgentConfig[agentId].scmiInst;
+    uint32_t *fc = (uint32_t*) RPC_SCMI_HdrAddrGet(scmiChannel);
+
+    /* Service perf FastChannels */
+    if (fc != NULL)
+    {
+        RPC_SCMI_PerfDispatchFastChannel(g_scmiConfig[scmiInst].lmId,
+            agentId, fc);
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Dispatch SCMI A2P subrequest                                             */
+/*--------------------------------------------------------------------------*/
+static int32_t RPC_SCMI_A2pSubDispatch(scmi_caller_t *caller,
+    uint32_t protocolId, uint32_t messageId)
+{
+    int32_t status = SM_ERR_NOT_SUPPORTED;
+    const protocol_desc_t *proto;
+
+    /* Find protocol */
+    proto = &s_protocolDesc[SCMI_PROTO_IDX(protocolId)];
+
+    /* Dispatch to protocol */
+    if ((proto->dispatch != NULL) && (proto->protocolId == protocolId))
+    {
+        status = proto->dispatch(caller, messageId);
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Init P2A queue                                                           */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - agentId: Agent owning the queue                                        */
+/* - queue: Notify or priority queue                                        */
+/* - scmiChannel: P2A channel of the queue                                  */
+/*                                                                          */
+/* Assigns the queue its slice of the event pool. Slices are allocated in   */
+/* channel order using the configured depth of each channel.                */
+/*--------------------------------------------------------------------------*/
+static void RPC_SCMI_P2aQInit(uint32_t agentId, uint32_t queue,
+    uint32_t scmiChannel)
+{
+    uint32_t offset = 0U;
+
+    /* Sum depth of prior channels */
+    for (uint32_t chn = 0U; chn < scmiChannel; chn++)
+    {
+        offset += g_scmiChannelConfig[chn].depth;
+    }
+
+    /* Assign events */
+    s_queue[agentId][queue].event = &s_notifyEvent[offset];
+    s_queue[agentId][queue].depth = g_scmiChannelConfig[scmiChannel].depth;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Queue P2A message                                                        */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - agentId: Agent to send message                                         */
+/* - queue: Notify or priority queue                                        */
+/* - header: Header to send (protocol, message, type)                       */
+/* - key: Coalesce key, SCMI_NOTIFY_KEY_NONE to never coalesce              */
+/* - msg: Pointer to message                                                */
+/* - len: Length of message in bytes                                        */
+/*                                                                          */
+/* A message with the same header and key as a message still in the queue   */
+/* replaces the payload of that message. Otherwise the message is added to  */
+/* the queue or dropped if the queue is full. Counters are updated.         */
+/*--------------------------------------------------------------------------*/
+static void RPC_SCMI_P2aEnqueue(uint32_t agentId, uint32_t queue,
+    uint32_t header, uint32_t key, const uint32_t *msg, uint32_t len)
+{
+    notify_queue_t *q = &s_queue[agentId][queue];
+    scmi_notify_counters_t *cnt = &s_notifyCounters[agentId];
+    notify_event_t *event = NULL;
+
+    /* Look for a queued message to coalesce with */
+    if ((key != SCMI_NOTIFY_KEY_NONE) && (len <= SCMI_NOTIFY_MAX_LEN))
+    {
+        uint32_t idx = q->tail;
+
+        for (uint32_t num = 0U; num < q->count; num++)
+        {
+            if ((q->event[idx].header == header)
+                && (q->event[idx].key == key))
+            {
+                event = &q->event[idx];
+                cnt->coalesced++;
+                break;
+            }
+            idx = (idx + 1U) % q->depth;
+        }
+    }
+
+    /* Allocate a new message */
+    if (event == NULL)
+    {
+        if (RPC_SCMI_P2aTxQFull(agentId, len, queue))
+        {
+            cnt->dropped++;
+        }
+        else
+        {
+            event = &q->event[q->head];
+            q->head = (q->head + 1U) % q->depth;
+            q->count++;
+            cnt->queued++;
+        }
+    }
+
+    /* Fill in message */
+    if (event != NULL)
+    {
+        event->header = header;
+        event->key = key;
+        event->len = len;
+        for (uint32_t idx = 0U; idx < (len / 4U); idx++)
+        {
+            event->data[idx] = msg[idx];
+        }
+    }
+}
 
-    /* Get the message buffer address */
-    caller.msg = (scmi_msg_status_t*) RPC_SCMI_HdrAddrGet(scmiChannel);
-    caller.lenMsg = sizeof(scmi_msg_status_t);
+/*--------------------------------------------------------------------------*/
+/* Dispatch SCMI P2A request                                                */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - scmiChannel: P2A channel for comms                                     */
+/*                                                                          */
+/* Can be called from any handler priority. Only the channel claim and the  */
+/* queue updates are done with interrupts locked, the send is not. A caller */
+/* finding the channel claimed gives up, so the claimer checks again once   */
+/* it has sent.                                                             */
+/*--------------------------------------------------------------------------*/
+static void RPC_SCMI_P2aDispatch(uint32_t scmiChannel)
+{
+    uint32_t agentId = g_scmiChannelConfig[scmiChannel].agentId;
+    notify_queue_t *q = &s_queue[agentId][s_channel2queue[scmiChannel]];
+    bool sent = true;
 
-    /* Get the buffer? */
-    if (caller.msg != NULL)
+    /* Send until queue empty or channel busy */
+    while (sent)
     {
-        int32_t status;
-        static scmi_msg_t s_msgCopy;
+        int32_t status = SM_ERR_SUCCESS;
+        uint32_t *msg = NULL;
+        bool packed = false;
+        uint32_t irqState;
 
-        /* Check if aborted */
-        status = RPC_SCMI_IsAborted(scmiChannel);
+        sent = false;
 
-        /* Copy receive data and do CRC */
-        if (status == SM_ERR_SUCCESS)
+        irqState = IRQ_Lock();
+
+        /* Check if a message to send */
+        if (q->count == 0U)
         {
-            caller.msgCopy = &s_msgCopy;
-            status = RPC_SCMI_A2pRx(&caller, (void*) &s_msgCopy,
-                sizeof(s_msgCopy));
+            status = SM_ERR_NOT_FOUND;
         }
-        else
+
+        /* Check if xport free to send a message */
+        if ((status == SM_ERR_SUCCESS) && (s_p2aClaim[scmiChannel]
+            || !RPC_SCMI_ChannelFree(scmiChannel)))
         {
-            /* Use caller header to return error status */
-            caller.header = caller.msg->header;
+            status = SM_ERR_BUSY;
         }
 
-        /* Get header */
+        /* Claim channel */
         if (status == SM_ERR_SUCCESS)
         {
-            caller.header = s_msgCopy.header;
+            s_p2aClaim[scmiChannel] = true;
+        }
 
-            /* Check message type */
-            if (SCMI_HEADER_TYPE_EX(caller.header) != 0U)
+        IRQ_Unlock(irqState);
+
+        /* Get message buffer address */
+        if (status == SM_ERR_SUCCESS)
+        {
+            msg = (uint32_t*) RPC_SCMI_HdrAddrGet(scmiChannel);
+            if (msg == NULL)
             {
-                status = SM_ERR_COMMS_ERROR;
+                s_p2aClaim[scmiChannel] = false;
+                status = SM_ERR_GENERIC_ERROR;
             }
         }
 
-        if (status == SM_ERR_SUCCESS)
+        /* Send several messages packed into one? */
+        if ((status == SM_ERR_SUCCESS) && s_notifyPack[agentId]
+            && (q->count > 1U))
         {
-            uint32_t protocolId;
-            uint32_t messageId;
+            packed = RPC_SCMI_P2aPackTx(scmiChannel, msg);
+            sent = packed;
+        }
+
+        /* All clear to send a message */
+        if ((status == SM_ERR_SUCCESS) && !packed)
+        {
+            const notify_event_t *event;
+            uint32_t header;
+            uint32_t len;
+#ifdef SCMI_TRACE
+            uint64_t start = DEV_SM_Nsec64Get();
+            uint32_t payload[SCMI_TRACE_NUM_PAYLOAD];
+#endif
 
-            /* Decompose header */
-            protocolId = SCMI_HEADER_PROTOCOL_EX(caller.header);
-            messageId = SCMI_HEADER_MSG_EX(caller.header);
+            irqState = IRQ_Lock();
 
-            /* Protocol extension? */
-            if (protocolId >= 0x90U)
+            /* Copy out message data */
+            event = &q->event[q->tail];
+            header = event->header;
+            len = event->len;
+            for (uint32_t idx = 0U; idx < (len / 4U); idx++)
+            {
+                msg[idx] = event->data[idx];
+            }
+
+            /* Consume message */
+            q->tail = (q->tail + 1U) % q->depth;
+            q->count--;
+
+            IRQ_Unlock(irqState);
+
+#ifdef SCMI_TRACE
+            payload[0] = msg[1];
+            payload[1] = msg[2];
+#endif
+
+            /* Send message */
+            if (SCMI_HEADER_TYPE_EX(header) == SCMI_TYPE_DELAYED)
+            {
+                msg[0] = header;
+                status = RPC_SCMI_P2aXport(scmiChannel, len, true);
+            }
+            else
             {
-                caller.extension = true;
-                protocolId -= 0x80U;
+                status = RPC_SCMI_P2aTx(scmiChannel,
+                    SCMI_HEADER_PROTOCOL_EX(header),
+                    SCMI_HEADER_MSG_EX(header), len, &header, true);
             }
 
-            /* Dispatch subrequest */
-            status = RPC_SCMI_A2pSubDispatch(&caller, protocolId,
-                messageId);
+#ifdef SCMI_TRACE
+            /* Record message */
+            RPC_SCMI_TraceRecord(SCMI_TRACE_P2A, scmiChannel, header,
+                payload, status, start);
+#endif
+            sent = true;
         }
 
-        /* Send response */
-        if (caller.lenMsg > 0U)
+        /* Release channel and check again */
+        if (sent)
         {
-            RPC_SCMI_A2pTx(&caller, caller.lenMsg, status);
+            s_p2aClaim[scmiChannel] = false;
         }
     }
 }
 
 /*--------------------------------------------------------------------------*/
-/* Dispatch SCMI A2P subrequest                                             */
-/*--------------------------------------------------------------------------*/
-static int32_t RPC_SCMI_A2pSubDispatch(scmi_caller_t *caller,
-    uint32_t protocolId, uint32_t messageId)
-{
-    int32_t status = SM_ERR_SUCCESS;
-
-    switch(protocolId)
-    {
-        case SCMI_PROTOCOL_BASE:
-            status = RPC_SCMI_BaseDispatchCommand(caller, messageId);
-            break;
-        case SCMI_PROTOCOL_POWER:
-            status = RPC_SCMI_PowerDispatchCommand(caller, messageId);
-            break;
-        case SCMI_PROTOCOL_SYSTEM:
-            status = RPC_SCMI_SysDispatchCommand(caller, messageId);
-            break;
-        case SCMI_PROTOCOL_PERF:
-            status = RPC_SCMI_PerfDispatchCommand(caller, messageId);
-            break;
-        case SCMI_PROTOCOL_CLOCK:
-            status = RPC_SCMI_ClockDispatchCommand(caller, messageId);
-            break;
-        case SCMI_PROTOCOL_SENSOR:
-            status = RPC_SCMI_SensorDispatchCommand(caller, messageId);
-            break;
-        case SCMI_PROTOCOL_RESET:
-            status = RPC_SCMI_ResetDispatchCommand(caller, messageId);
-            break;
-        case SCMI_PROTOCOL_VOLTAGE:
-            status = RPC_SCMI_VoltageDispatchCommand(caller, messageId);
-            break;
-        case SCMI_PROTOCOL_PINCTRL:
-            status = RPC_SCMI_PinctrlDispatchCommand(caller, messageId);
-            break;
-        case SCMI_PROTOCOL_LMM:
-            status = RPC_SCMI_LmmDispatchCommand(caller, messageId);
-            break;
-        case SCMI_PROTOCOL_BBM:
-            status = RPC_SCMI_BbmDispatchCommand(caller, messageId);
-            break;
-        case SCMI_PROTOCOL_CPU:
-            status = RPC_SCMI_CpuDispatchCommand(caller, messageId);
-            break;
-        case SCMI_PROTOCOL_FUSA:
-            status = RPC_SCMI_FusaDispatchCommand(caller, messageId);
-            break;
-        case SCMI_PROTOCOL_MISC:
-            status = RPC_SCMI_MiscDispatchCommand(caller, messageId);
-            break;
-        default:
-            status = SM_ERR_NOT_SUPPORTED;
-            break;
-    }
-
-    /* Return status */
-    return status;
-}
-
-/*--------------------------------------------------------------------------*/
-/* Dispatch SCMI P2A request                                                */
+/* Send packed P2A notification                                             */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - scmiChannel: P2A channel for comms                                     */
+/* - msg: Pointer to the transport buffer                                   */
+/*                                                                          */
+/* Packs as many queued messages as fit in the transport buffer into one    */
+/* MISC_PACKED_EVENT notification. The payload is the number of events and  */
+/* the number of words that follow. Each event is its header (no token),    */
+/* its payload length in bytes, and its payload. Packing stops at a delayed */
+/* response as that must carry the token of the command.                    */
+/*                                                                          */
+/* Returns true if a packed notification was sent. Nothing is consumed and  */
+/* false returned if fewer than two messages can be packed.                 */
 /*--------------------------------------------------------------------------*/
-static void RPC_SCMI_P2aDispatch(uint32_t scmiChannel)
+static bool RPC_SCMI_P2aPackTx(uint32_t scmiChannel, uint32_t *msg)
 {
-    int32_t status = SM_ERR_SUCCESS;
     uint32_t agentId = g_scmiChannelConfig[scmiChannel].agentId;
-    uint32_t queue = s_channel2queue[scmiChannel];
-    uint32_t *msg = NULL;
+    notify_queue_t *q = &s_queue[agentId][s_channel2queue[scmiChannel]];
+    uint32_t maxWords = RPC_SCMI_MaxLenGet(scmiChannel) / 4U;
+    uint32_t numEvents = 0U;
+    uint32_t numWords = 0U;
+    uint32_t idx = q->tail;
+    uint32_t irqState;
 
-    /* Check if a message to send */
-    if (s_queue[agentId][queue].count == 0U)
-    {
-        status = SM_ERR_NOT_FOUND;
-    }
+    irqState = IRQ_Lock();
 
-    /* Check if xport free to send a message */
-    if (status == SM_ERR_SUCCESS)
+    /* Count messages that fit */
+    while (numEvents < q->count)
     {
-        if (!RPC_SCMI_ChannelFree(scmiChannel))
+        const notify_event_t *event = &q->event[idx];
+        uint32_t words = (event->len / 4U) + 1U;
+
+        if ((SCMI_HEADER_TYPE_EX(event->header) == SCMI_TYPE_DELAYED)
+            || ((3U + numWords + words) > maxWords))
         {
-            status = SM_ERR_BUSY;
+            break;
         }
+
+        numWords += words;
+        numEvents++;
+        idx = (idx + 1U) % q->depth;
     }
 
-    /* Get message buffer address */
-    if (status == SM_ERR_SUCCESS)
+    IRQ_Unlock(irqState);
+
+    /* Pack and send */
+    if (numEvents > 1U)
     {
-        msg = (uint32_t*) RPC_SCMI_HdrAddrGet(scmiChannel);
-        if (msg == NULL)
+        uint32_t header;
+        uint32_t word = 3U;
+        int32_t status;
+#ifdef SCMI_TRACE
+        uint64_t start = DEV_SM_Nsec64Get();
+        uint32_t payload[SCMI_TRACE_NUM_PAYLOAD] =
         {
-            status = SM_ERR_GENERIC_ERROR;
-        }
-    }
+            numEvents, numWords
+        };
+#endif
 
-    /* All clear to send a message */
-    if (status == SM_ERR_SUCCESS)
-    {
-        uint32_t header = s_queue[agentId][queue].data[
-            s_queue[agentId][queue].tail];
-        uint32_t len = SCMI_HEADER_TOKEN_EX(header);
+        msg[1] = numEvents;
+        msg[2] = numWords;
 
-        /* Copy out message data */
-        for (uint32_t idx = 0U; idx < (len / 4U); idx++)
+        /* Copy out and consume messages, one at a time */
+        for (uint32_t num = 0U; num < numEvents; num++)
         {
-            msg[idx] = s_queue[agentId][queue].data[
-                s_queue[agentId][queue].tail];
-            s_queue[agentId][queue].tail = (s_queue[agentId][queue].tail
-                + 1U) % SM_SCMI_MAX_NOTIFY;
-            s_queue[agentId][queue].count--;
+            const notify_event_t *event;
+
+            irqState = IRQ_Lock();
+            event = &q->event[q->tail];
+
+            /* Coalesced since counted, the rest go in the next message */
+            if (((word + (event->len / 4U) + 1U) - 3U) > numWords)
+            {
+                IRQ_Unlock(irqState);
+                msg[1] = num;
+                msg[2] = word - 3U;
+                break;
+            }
+
+            msg[word] = event->header;
+            word++;
+            msg[word] = event->len - 4U;
+            word++;
+            for (uint32_t data = 1U; data < (event->len / 4U); data++)
+            {
+                msg[word] = event->data[data];
+                word++;
+            }
+
+            q->tail = (q->tail + 1U) % q->depth;
+            q->count--;
+
+            IRQ_Unlock(irqState);
         }
 
         /* Send message */
-        (void) RPC_SCMI_P2aTx(scmiChannel, SCMI_HEADER_PROTOCOL_EX(header),
-            SCMI_HEADER_MSG_EX(header), len, &header, true);
+        status = RPC_SCMI_P2aTx(scmiChannel, SCMI_PROTOCOL_MISC,
+            RPC_SCMI_NOTIFY_MISC_PACKED_EVENT, word * 4U, &header, true);
+
+#ifdef SCMI_TRACE
+        /* Record message */
+        RPC_SCMI_TraceRecord(SCMI_TRACE_P2A, scmiChannel, header, payload,
+            status, start);
+#else
+        (void) status;
+#endif
+    }
+
+    /* Return result */
+    return (numEvents > 1U);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Send P2A buffer via transport                                            */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - scmiChannel: P2A channel for comms                                     */
+/* - len: Length of buffer to send                                          */
+/* - compInt: True to request a completion interrupt                        */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_NOT_SUPPORTED: if the configured transport is not supported     */
+/* - others returned by the transport send function (e.g. RPC_SMT_Tx())     */
+/*--------------------------------------------------------------------------*/
+static int32_t RPC_SCMI_P2aXport(uint32_t scmiChannel, uint32_t len,
+    bool compInt)
+{
+    int32_t status;
+
+    /* Send message via transport */
+    switch (g_scmiChannelConfig[scmiChannel].xportType)
+    {
+        case SM_XPORT_SMT:
+            status = RPC_SMT_Tx(
+                g_scmiChannelConfig[scmiChannel].xportChannel, len,
+                false, compInt);
+            break;
+        default:
+            status = SM_ERR_NOT_SUPPORTED;
+            break;
     }
+
+    /* Return status */
+    return status;
 }
 
 /*--------------------------------------------------------------------------*/
@@ -971,3 +2075,216 @@ static int32_t RPC_SCMI_A2pTx(const scmi_caller_t *caller, uint32_t len,
     return rtn;
 }
 
+#ifdef SCMI_STATS
+/*--------------------------------------------------------------------------*/
+/* Record service time of an A2P request                                    */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - status: Status returned to the caller                                  */
+/*                                                                          */
+/* Updates the channel statistics and, if the header is known, the          */
+/* statistics of the message. Message entries are kept in a small hash      */
+/* table. Messages are not tracked once the table is full.                  */
+/*--------------------------------------------------------------------------*/
+static void RPC_SCMI_StatsRecord(const scmi_caller_t *caller,
+    int32_t status)
+{
+    uint32_t scmiChannel = caller->scmiChannel;
+    uint64_t delta = DEV_SM_Nsec64Get() - s_statsStart[scmiChannel];
+    uint32_t nsec = UINT32_MAX;
+
+    /* Saturate */
+    if (delta < UINT32_MAX)
+    {
+        nsec = (uint32_t) delta;
+    }
+
+    /* Update channel */
+    s_chnStats[scmiChannel].id = scmiChannel;
+    RPC_SCMI_StatsUpdate(&s_chnStats[scmiChannel], nsec, status);
+
+    /* Header known? */
+    if (SCMI_HEADER_PROTOCOL_EX(caller->header) != 0U)
+    {
+        uint32_t id = SCMI_STATS_VALID | (caller->scmiInst << 16U)
+            | (SCMI_HEADER_PROTOCOL_EX(caller->header) << 8U)
+            | SCMI_HEADER_MSG_EX(caller->header);
+        uint32_t slot = (((id >> 8U) * 31U) + id) % SCMI_STATS_NUM_MSG;
+
+        /* Probe for the entry or a free one */
+        for (uint32_t probe = 0U; probe < SCMI_STATS_NUM_MSG; probe++)
+        {
+            scmi_stats_t *stats = &s_msgStats[slot];
+
+            if ((stats->id == id) || (stats->id == 0U))
+            {
+                stats->id = id;
+                RPC_SCMI_StatsUpdate(stats, nsec, status);
+                break;
+            }
+            slot = (slot + 1U) % SCMI_STATS_NUM_MSG;
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Update a statistics entry                                                */
+/*--------------------------------------------------------------------------*/
+static void RPC_SCMI_StatsUpdate(scmi_stats_t *stats, uint32_t nsec,
+    int32_t status)
+{
+    uint32_t usec = nsec / 1000U;
+    uint32_t bucket = 0U;
+
+    /* Update min/max */
+    if ((stats->count == 0U) || (nsec < stats->minTime))
+    {
+        stats->minTime = nsec;
+    }
+    if (nsec > stats->maxTime)
+    {
+        stats->maxTime = nsec;
+    }
+
+    /* Update totals */
+    stats->totalTime += nsec;
+    stats->count++;
+    if (status != SM_ERR_SUCCESS)
+    {
+        stats->errors++;
+    }
+
+    /* Bucket n counts times less than 2^n uS */
+    while ((usec != 0U) && (bucket < (SCMI_STATS_NUM_HIST - 1U)))
+    {
+        usec >>= 1U;
+        bucket++;
+    }
+    stats->hist[bucket]++;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Find the nth used statistics entry of an instance                        */
+/*--------------------------------------------------------------------------*/
+static scmi_stats_t *RPC_SCMI_StatsFind(uint32_t scmiInst, uint32_t type,
+    uint32_t index)
+{
+    scmi_stats_t *stats = NULL;
+    uint32_t found = 0U;
+
+    if (type == SCMI_STATS_TYPE_CHANNEL)
+    {
+        /* Loop over channels */
+        for (uint32_t scmiChannel = 0U; scmiChannel < SM_SCMI_NUM_CHN;
+            scmiChannel++)
+        {
+            uint32_t agent = g_scmiChannelConfig[scmiChannel].agentId;
+
+            if ((g_scmiAgentConfig[agent].scmiInst == scmiInst)
+                && (s_chnStats[scmiChannel].count != 0U))
+            {
+                if (found == index)
+                {
+                    stats = &s_chnStats[scmiChannel];
+                    break;
+                }
+                found++;
+            }
+        }
+    }
+    else
+    {
+        /* Loop over messages */
+        for (uint32_t slot = 0U; slot < SCMI_STATS_NUM_MSG; slot++)
+        {
+            uint32_t id = s_msgStats[slot].id;
+
+            if (((id & SCMI_STATS_VALID) != 0U)
+                && (((id >> 16U) & 0xFFU) == scmiInst)
+                && (s_msgStats[slot].count != 0U))
+            {
+                if (found == index)
+                {
+                    stats = &s_msgStats[slot];
+                    break;
+                }
+                found++;
+            }
+        }
+    }
+
+    /* Return entry */
+    return stats;
+}
+
+#ifdef MONITOR
+/*--------------------------------------------------------------------------*/
+/* Print a statistics entry                                                 */
+/*--------------------------------------------------------------------------*/
+static void RPC_SCMI_StatsPrint(const scmi_stats_t *stats)
+{
+    printf("count=%u, errors=%u", stats->count, stats->errors);
+    printf(", min=%u, avg=%u, max=%u nS\n", stats->minTime,
+        (uint32_t) (stats->totalTime / stats->count), stats->maxTime);
+    printf("    hist (<1/2/4/8/16/32/64/64+ uS):");
+    for (uint32_t bucket = 0U; bucket < SCMI_STATS_NUM_HIST; bucket++)
+    {
+        printf(" %u", stats->hist[bucket]);
+    }
+    printf("\n");
+}
+#endif
+#endif
+
+#ifdef SCMI_TRACE
+/*--------------------------------------------------------------------------*/
+/* Record a trace entry                                                     */
+/*                                                                          */
+/* Fixed cost: one time read and a 24 byte store into the next ring slot,   */
+/* overwriting the oldest entry.                                            */
+/*--------------------------------------------------------------------------*/
+static void RPC_SCMI_TraceRecord(uint32_t type, uint32_t channel,
+    uint32_t header, const uint32_t *payload, int32_t status,
+    uint64_t start)
+{
+    uint64_t delta = DEV_SM_Nsec64Get() - start;
+    uint32_t irqState;
+    uint32_t seq;
+    scmi_trace_t *entry;
+
+    /* Claim slot, P2A records can come from a preempting handler */
+    irqState = IRQ_Lock();
+    seq = s_traceCount;
+    s_traceCount++;
+    IRQ_Unlock(irqState);
+    entry = &s_trace[seq % SM_SCMI_TRACE_NUM];
+
+    /* Fill in entry */
+    entry->time = (uint32_t) (start / 1000ULL);
+    entry->duration = (delta < UINT32_MAX) ? (uint32_t) delta : UINT32_MAX;
+    entry->header = header;
+    entry->payload[0] = payload[0];
+    entry->payload[1] = payload[1];
+    entry->type = (uint8_t) type;
+    entry->channel = (uint8_t) channel;
+    entry->status = (int16_t) status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get number of valid trace entries                                        */
+/*--------------------------------------------------------------------------*/
+static uint32_t RPC_SCMI_TraceNum(void)
+{
+    uint32_t num = s_traceCount - s_traceBase;
+
+    /* Limit to the ring size */
+    if (num > SM_SCMI_TRACE_NUM)
+    {
+        num = SM_SCMI_TRACE_NUM;
+    }
+
+    /* Return number */
+    return num;
+}
+#endif
@@ -110,6 +110,32 @@
 #define SCMI_PRIORITY_Q             1U
 /** @} */
 
+/*!
+ * @name Trace config
+ */
+/** @{ */
+#ifndef SM_SCMI_TRACE_NUM
+/*! Number of entries in the trace ring */
+#define SM_SCMI_TRACE_NUM           64U
+#endif
+/*! Number of payload words recorded per trace entry */
+#define SCMI_TRACE_NUM_PAYLOAD      2U
+/*! Trace filter matching any channel or protocol */
+#define SCMI_TRACE_ANY              0xFFFFFFFFU
+/** @} */
+
+/*!
+ * @name Trace entry types
+ */
+/** @{ */
+/*! A2P command */
+#define SCMI_TRACE_A2P              0U
+/*! P2A notification or delayed response */
+#define SCMI_TRACE_P2A              1U
+/*! Notification trigger from the LMM */
+#define SCMI_TRACE_TRIGGER          2U
+/** @} */
+
 /* Types */
 
 /*! SCMI full message structure */
@@ -133,6 +159,24 @@ typedef struct
     uint32_t messageId;   /*!< Message ID */
 } scmi_msg_id_t;
 
+/*!
+ * SCMI trace entry
+ *
+ * For triggers \a header is that of the resulting notification,
+ * \a payload holds the first trigger parameters and \a channel is the
+ * SCMI instance.
+ */
+typedef struct
+{
+    uint32_t time;                             /*!< Start time (uS) */
+    uint32_t duration;                         /*!< Duration (nS) */
+    uint32_t header;                           /*!< SCMI header */
+    uint32_t payload[SCMI_TRACE_NUM_PAYLOAD];  /*!< First payload words */
+    uint8_t type;                              /*!< Entry type */
+    uint8_t channel;                           /*!< SCMI channel */
+    int16_t status;                            /*!< Status */
+} scmi_trace_t;
+
 /*!
  * SCMI caller structure
  *
@@ -146,6 +190,7 @@ typedef struct
     scmi_msg_status_t *msg;  /*!< Pointer to message buffer */
     uint32_t lenCopy;        /*!< Length of rx message */
     uint32_t lenMsg;         /*!< Length of tx message */
+    uint32_t lenMax;         /*!< Max length of tx message */
     uint32_t lmId;           /*!< Caller logical machine */
     uint32_t scmiInst;       /*!< Caller SCMI instance */
     uint32_t agentId;        /*!< Caller SCMI agent */
@@ -197,11 +242,58 @@ int32_t RPC_SCMI_BufInit(uint32_t scmiChannel, void **msg);
  *
  * This function dispatches an SCMI doorbell interrupt. The \a scmiChannel
  * parameter is used to index into the global const SCMI channel config
- * structure to find the channel type (A2P or P2A). The specific directional
- * SCMI dispatch function is then called.
+ * structure to find the channel type (A2P or P2A). Both are only marked
+ * pending. A2P requests are executed and the next queued P2A message is
+ * sent later by RPC_SCMI_Handler().
+ *
+ * Safe to call from a handler that preempts the RPC handler (e.g. an MU
+ * with a preemptive \a irqprio), it only sets pending flags, so the time
+ * spent in the doorbell handler does not depend on the message size.
  */
 void RPC_SCMI_Dispatch(uint32_t scmiChannel);
 
+/*!
+ * Execute deferred SCMI requests.
+ *
+ * This function is called from the low priority RPC handler (PendSV). It
+ * executes the pending A2P request (or sends the next queued P2A message)
+ * of the agent with the highest configured priority. Once no requests are
+ * pending, queued async work (e.g. CLOCK_RATE_SET) is executed one item at
+ * a time. If more work is pending then the handler is triggered again so
+ * other interrupts are serviced in between.
+ */
+void RPC_SCMI_Handler(void);
+
+/*!
+ * Check for pending SCMI requests.
+ *
+ * Used to hold back background work until RPC_SCMI_Handler() has served
+ * all doorbells.
+ *
+ * @return Returns true if a channel is waiting for RPC_SCMI_Handler().
+ */
+bool RPC_SCMI_Pending(void);
+
+/*!
+ * Check for enabled clock rate notifications.
+ *
+ * Used by the device to skip finding and reporting derived clock rate
+ * changes nobody is notified of.
+ *
+ * @return Returns true if any agent enabled a clock rate notification.
+ */
+bool RPC_SCMI_ClockRateNotifyEnabled(void);
+
+/*!
+ * Poll SCMI FastChannels.
+ *
+ * This function marks all FastChannels (::SM_SCMI_CHN_A2P_FAST) pending
+ * and triggers the RPC handler to service them. Called periodically so
+ * agents do not need to ring a doorbell. The handler is also triggered
+ * when sensor update notifications are due.
+ */
+void RPC_SCMI_Poll(void);
+
 /*!
  * Send P2A message.
  *
@@ -288,6 +380,85 @@ int32_t RPC_SCMI_Trigger(const lmm_rpc_trigger_t *trigger);
  */
 void RPC_SCMI_ErrorDump(uint8_t scmiInst);
 
+/*!
+ * Dump SCMI service time statistics.
+ *
+ * @param[in]     scmiInst  SCMI instance
+ * @param[in]     reset     True to reset the statistics after the dump
+ *
+ * Dump the channel and message statistics for the specified SCMI
+ * instance.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_SUPPORTED: if statistics are not built in.
+ */
+int32_t RPC_SCMI_StatsDump(uint8_t scmiInst, bool reset);
+
+/*!
+ * Get an SCMI trace entry.
+ *
+ * @param[in]     index     Index of the entry, 0 is the most recent
+ * @param[out]    entry     Pointer to return the entry
+ *
+ * The trace is a ring of the last ::SM_SCMI_TRACE_NUM A2P commands, P2A
+ * messages and notification triggers, in order of completion. Only
+ * available if the SM is built with SCMI_TRACE defined.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_FOUND: if \a index is beyond the oldest entry.
+ * - ::SM_ERR_NOT_SUPPORTED: if the trace is not built in.
+ */
+int32_t RPC_SCMI_TraceGet(uint32_t index, scmi_trace_t *entry);
+
+/*!
+ * Dump the SCMI trace.
+ *
+ * @param[in]     scmiChannel  Channel to dump (::SCMI_TRACE_ANY for all)
+ * @param[in]     protocolId   Protocol to dump (::SCMI_TRACE_ANY for all)
+ *
+ * Decode and print the trace from the oldest to the most recent entry.
+ * Triggers are only filtered by protocol.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_SUPPORTED: if the trace is not built in.
+ */
+int32_t RPC_SCMI_TraceDump(uint32_t scmiChannel, uint32_t protocolId);
+
+/*!
+ * Export the SCMI trace.
+ *
+ * Print the raw trace for decode by host tools. The first line is
+ * "SCMI_TRACE <version> <entries> <words per entry>", followed by one
+ * line per entry, oldest first:
+ *
+ * "T <seq> <time> <duration> <header> <payload0> <payload1> <info>"
+ *
+ * The sequence number is decimal, the ::scmi_trace_t words are hex and
+ * \a info packs type[7:0], channel[15:8] and status[31:16].
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_SUPPORTED: if the trace is not built in.
+ */
+int32_t RPC_SCMI_TraceExport(void);
+
+/*!
+ * Clear the SCMI trace.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_SUPPORTED: if the trace is not built in.
+ */
+int32_t RPC_SCMI_TraceClear(void);
+
 /** @} */
 
 #endif /* RPC_SCMI_H */
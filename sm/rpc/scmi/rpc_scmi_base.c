@@ -47,7 +47,7 @@
 /* Protocol version */
 #define PROTOCOL_VERSION  0x20001U
 
-/* SCMI base protocol message IDs and masks */
+/* SCMI base protocol message IDs */
 #define COMMAND_PROTOCOL_VERSION                      0x0U
 #define COMMAND_PROTOCOL_ATTRIBUTES                   0x1U
 #define COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES           0x2U
@@ -59,12 +59,12 @@
 #define COMMAND_BASE_SET_DEVICE_PERMISSIONS           0x9U
 #define COMMAND_BASE_RESET_AGENT_CONFIGURATION        0xBU
 #define COMMAND_NEGOTIATE_PROTOCOL_VERSION            0x10U
-#define COMMAND_SUPPORTED_MASK                        0x10AFFUL
 
 /* SCMI max base argument lengths */
 #define BASE_MAX_NAME              16U
 #define BASE_MAX_VENDORIDENTIFIER  16U
 #define BASE_MAX_PROTOCOLS         SCMI_ARRAY(8U, uint32_t)
+#define BASE_NUM_PROTOCOLS(C)      SCMI_ARRAY_CALLER(C, 8U, uint32_t)
 
 /* SCMI agent ID */
 #define BASE_ID_DISCOVER  0xFFFFFFFFU
@@ -235,6 +235,33 @@ typedef struct
     uint32_t version;
 } msg_rbase16_t;
 
+/* Local variables */
+
+/* Message descriptors, indexed by message ID */
+static const scmi_msg_desc_t s_baseMsgDesc[] =
+{
+    [COMMAND_PROTOCOL_VERSION] = SCMI_MSG_DESC(scmi_msg_header_t, msg_tbase0_t),
+    [COMMAND_PROTOCOL_ATTRIBUTES] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tbase1_t),
+    [COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES] =
+        SCMI_MSG_DESC(msg_rbase2_t, msg_tbase2_t),
+    [COMMAND_BASE_DISCOVER_VENDOR] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tbase3_t),
+    [COMMAND_BASE_DISCOVER_SUB_VENDOR] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tbase4_t),
+    [COMMAND_BASE_DISCOVER_IMPLEMENTATION_VERSION] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tbase5_t),
+    [COMMAND_BASE_DISCOVER_LIST_PROTOCOLS] =
+        SCMI_MSG_DESC(msg_rbase6_t, msg_tbase6_t),
+    [COMMAND_BASE_DISCOVER_AGENT] = SCMI_MSG_DESC(msg_rbase7_t, msg_tbase7_t),
+    [COMMAND_BASE_SET_DEVICE_PERMISSIONS] =
+        SCMI_MSG_DESC(msg_rbase9_t, scmi_msg_status_t),
+    [COMMAND_BASE_RESET_AGENT_CONFIGURATION] =
+        SCMI_MSG_DESC(msg_rbase11_t, scmi_msg_status_t),
+    [COMMAND_NEGOTIATE_PROTOCOL_VERSION] =
+        SCMI_MSG_DESC(msg_rbase16_t, scmi_msg_status_t)
+};
+
 /* Local functions */
 
 static int32_t BaseProtocolVersion(const scmi_caller_t *caller,
@@ -272,72 +299,68 @@ static int32_t BaseResetAgentConfig(uint32_t lmId, uint32_t agentId,
 int32_t RPC_SCMI_BaseDispatchCommand(scmi_caller_t *caller,
     uint32_t messageId)
 {
-    int32_t status = SM_ERR_SUCCESS;
+    int32_t status;
     const scmi_msg_t *in = caller->msgCopy;
     scmi_msg_status_t *out = caller->msg;
-    uint32_t lenOut = sizeof(scmi_msg_status_t);
+    uint32_t lenOut;
+
+    /* Check message */
+    status = RPC_SCMI_A2pMsgCheck(caller, s_baseMsgDesc,
+        ARRAY_SIZE(s_baseMsgDesc), messageId, &lenOut);
 
     /* Handle standard messages */
-    switch(messageId)
+    if (status == SM_ERR_SUCCESS)
     {
-        case COMMAND_PROTOCOL_VERSION:
-            lenOut = sizeof(msg_tbase0_t);
-            status = BaseProtocolVersion(caller,
-                (const scmi_msg_header_t*) in, (msg_tbase0_t*) out);
-            break;
-        case COMMAND_PROTOCOL_ATTRIBUTES:
-            lenOut = sizeof(msg_tbase1_t);
-            status = BaseProtocolAttributes(caller,
-                (const scmi_msg_header_t*) in, (msg_tbase1_t*) out);
-            break;
-        case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
-            lenOut = sizeof(msg_tbase2_t);
-            status = BaseProtocolMessageAttributes(caller,
-                (const msg_rbase2_t*) in, (msg_tbase2_t*) out);
-            break;
-        case COMMAND_BASE_DISCOVER_VENDOR:
-            lenOut = sizeof(msg_tbase3_t);
-            status = BaseDiscoverVendor(caller, (const scmi_msg_header_t*) in,
-                (msg_tbase3_t*) out);
-            break;
-        case COMMAND_BASE_DISCOVER_SUB_VENDOR:
-            lenOut = sizeof(msg_tbase4_t);
-            status = BaseDiscoverSubVendor(caller,
-                (const scmi_msg_header_t*) in, (msg_tbase4_t*) out);
-            break;
-        case COMMAND_BASE_DISCOVER_IMPLEMENTATION_VERSION:
-            lenOut = sizeof(msg_tbase5_t);
-            status = BaseDiscoverImplementationVersion(caller,
-                (const scmi_msg_header_t*) in, (msg_tbase5_t*) out);
-            break;
-        case COMMAND_BASE_DISCOVER_LIST_PROTOCOLS:
-            lenOut = sizeof(msg_tbase6_t);
-            status = BaseDiscoverListProtocols(caller,
-                (const msg_rbase6_t*) in, (msg_tbase6_t*) out, &lenOut);
-            break;
-        case COMMAND_BASE_DISCOVER_AGENT:
-            lenOut = sizeof(msg_tbase7_t);
-            status = BaseDiscoverAgent(caller, (const msg_rbase7_t*) in,
-                (msg_tbase7_t*) out);
-            break;
-        case COMMAND_BASE_SET_DEVICE_PERMISSIONS:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = BaseSetDevicePermissions(caller,
-                (const msg_rbase9_t*) in, (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_BASE_RESET_AGENT_CONFIGURATION:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = BaseResetAgentConfiguration(caller,
-                (const msg_rbase11_t*) in, (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = BaseNegotiateProtocolVersion(caller,
-                (const msg_rbase16_t*) in, (const scmi_msg_status_t*) out);
-            break;
-        default:
-            status = SM_ERR_NOT_SUPPORTED;
-            break;
+        switch(messageId)
+        {
+            case COMMAND_PROTOCOL_VERSION:
+                status = BaseProtocolVersion(caller,
+                    (const scmi_msg_header_t*) in, (msg_tbase0_t*) out);
+                break;
+            case COMMAND_PROTOCOL_ATTRIBUTES:
+                status = BaseProtocolAttributes(caller,
+                    (const scmi_msg_header_t*) in, (msg_tbase1_t*) out);
+                break;
+            case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
+                status = BaseProtocolMessageAttributes(caller,
+                    (const msg_rbase2_t*) in, (msg_tbase2_t*) out);
+                break;
+            case COMMAND_BASE_DISCOVER_VENDOR:
+                status = BaseDiscoverVendor(caller,
+                    (const scmi_msg_header_t*) in, (msg_tbase3_t*) out);
+                break;
+            case COMMAND_BASE_DISCOVER_SUB_VENDOR:
+                status = BaseDiscoverSubVendor(caller,
+                    (const scmi_msg_header_t*) in, (msg_tbase4_t*) out);
+                break;
+            case COMMAND_BASE_DISCOVER_IMPLEMENTATION_VERSION:
+                status = BaseDiscoverImplementationVersion(caller,
+                    (const scmi_msg_header_t*) in, (msg_tbase5_t*) out);
+                break;
+            case COMMAND_BASE_DISCOVER_LIST_PROTOCOLS:
+                status = BaseDiscoverListProtocols(caller,
+                    (const msg_rbase6_t*) in, (msg_tbase6_t*) out, &lenOut);
+                break;
+            case COMMAND_BASE_DISCOVER_AGENT:
+                status = BaseDiscoverAgent(caller, (const msg_rbase7_t*) in,
+                    (msg_tbase7_t*) out);
+                break;
+            case COMMAND_BASE_SET_DEVICE_PERMISSIONS:
+                status = BaseSetDevicePermissions(caller,
+                    (const msg_rbase9_t*) in, (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_BASE_RESET_AGENT_CONFIGURATION:
+                status = BaseResetAgentConfiguration(caller,
+                    (const msg_rbase11_t*) in, (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
+                status = BaseNegotiateProtocolVersion(caller,
+                    (const msg_rbase16_t*) in, (const scmi_msg_status_t*) out);
+                break;
+            default:
+                status = SM_ERR_NOT_SUPPORTED;
+                break;
+        }
     }
 
     /* Update length */
@@ -377,25 +400,14 @@ int32_t RPC_SCMI_BaseDispatchReset(uint32_t lmId, uint32_t agentId,
 /* SCMI_BaseProtocolVersion(). See section 4.2.2.1 in the SCMI spec.        */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BaseProtocolVersion(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tbase0_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return version */
-        out->version = PROTOCOL_VERSION;
-    }
+    /* Return version */
+    out->version = PROTOCOL_VERSION;
 
     /* Return status */
     return status;
@@ -421,29 +433,18 @@ static int32_t BaseProtocolVersion(const scmi_caller_t *caller,
 /*   implemented, excluding the Base protocol                               */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BaseProtocolAttributes(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tbase1_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return attributes */
-        out->attributes
-            = BASE_PROTO_ATTR_NUM_AGENTS(((uint32_t) g_scmiConfig[
-                caller->scmiInst].numAgents))
-            | BASE_PROTO_ATTR_NUM_PROTOCOLS(RPC_SCMI_NumProtocolsGet()
-                - 1U);
-    }
+    /* Return attributes */
+    out->attributes
+        = BASE_PROTO_ATTR_NUM_AGENTS(((uint32_t) g_scmiConfig[
+            caller->scmiInst].numAgents))
+        | BASE_PROTO_ATTR_NUM_PROTOCOLS(RPC_SCMI_NumProtocolsGet()
+            - 1U);
 
     /* Return status */
     return status;
@@ -468,33 +469,20 @@ static int32_t BaseProtocolAttributes(const scmi_caller_t *caller,
 /*   use.                                                                   */
 /* - SM_ERR_NOT_FOUND: if the message identified by messageId is not        */
 /*   provided by this platform implementation.                              */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BaseProtocolMessageAttributes(const scmi_caller_t *caller,
     const msg_rbase2_t *in, msg_tbase2_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
+    /* Always zero */
+    out->attributes = 0U;
 
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
+    /* Is message supported ? */
+    if (!RPC_SCMI_A2pMsgSupported(s_baseMsgDesc,
+        ARRAY_SIZE(s_baseMsgDesc), in->messageId))
     {
-        uint32_t mask = COMMAND_SUPPORTED_MASK;
-
-        /* Always zero */
-        out->attributes = 0U;
-
-        /* Is message supported ? */
-        if ((in->messageId >= 32U) || (((mask >> in->messageId)
-            & 0x1U) == 0U))
-        {
-            status = SM_ERR_NOT_FOUND;
-        }
+        status = SM_ERR_NOT_FOUND;
     }
 
     /* Return status */
@@ -513,26 +501,15 @@ static int32_t BaseProtocolMessageAttributes(const scmi_caller_t *caller,
 /* SCMI_BaseDiscoverVendor(). See section 4.2.2.5 in the SCMI spec.         */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BaseDiscoverVendor(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tbase3_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Copy out vendor identifier */
-        RPC_SCMI_StrCpy(out->vendorIdentifier, (const uint8_t *)
-            SCMI_VENDOR, BASE_MAX_VENDORIDENTIFIER);
-    }
+    /* Copy out vendor identifier */
+    RPC_SCMI_StrCpy(out->vendorIdentifier, (const uint8_t *)
+        SCMI_VENDOR, BASE_MAX_VENDORIDENTIFIER);
 
     /* Return status */
     return status;
@@ -550,26 +527,15 @@ static int32_t BaseDiscoverVendor(const scmi_caller_t *caller,
 /* SCMI_BaseDiscoverSubVendor(). See section 4.2.2.6 in the SCMI spec.      */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BaseDiscoverSubVendor(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tbase4_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Copy out sub vendor identifier */
-        RPC_SCMI_StrCpy(out->vendorIdentifier,
-            (const uint8_t *) SCMI_SUB_VENDOR, BASE_MAX_VENDORIDENTIFIER);
-    }
+    /* Copy out sub vendor identifier */
+    RPC_SCMI_StrCpy(out->vendorIdentifier,
+        (const uint8_t *) SCMI_SUB_VENDOR, BASE_MAX_VENDORIDENTIFIER);
 
     /* Return status */
     return status;
@@ -587,24 +553,14 @@ static int32_t BaseDiscoverSubVendor(const scmi_caller_t *caller,
 /* 4.2.2.7 in the SCMI spec.                                                */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BaseDiscoverImplementationVersion(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tbase5_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        out->implementationVersion = SM_BUILD;
-    }
+    out->implementationVersion = SM_BUILD;
 
     /* Return status */
     return status;
@@ -628,26 +584,16 @@ static int32_t BaseDiscoverImplementationVersion(const scmi_caller_t *caller,
 /* Return errors:                                                           */
 /* - SM_ERR_SUCCESS: if a valid list of protocols is found.                 */
 /* - SM_ERR_INVALID_PARAMETERS: if skip field is invalid.                   */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BaseDiscoverListProtocols(const scmi_caller_t *caller,
     const msg_rbase6_t *in, msg_tbase6_t *out, uint32_t *len)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Get compressed list of protocols excluding base */
-        status = RPC_SCMI_ProtocolListGet(in->skip + 1U,
-            BASE_MAX_PROTOCOLS, &(out->numProtocols), out->protocols);
-    }
+    /* Get compressed list of protocols excluding base */
+    status = RPC_SCMI_ProtocolListGet(in->skip + 1U,
+        BASE_NUM_PROTOCOLS(caller), &(out->numProtocols),
+        out->protocols);
 
     /* Update length */
     if (status == SM_ERR_SUCCESS)
@@ -688,38 +634,27 @@ static int32_t BaseDiscoverListProtocols(const scmi_caller_t *caller,
 /* Return errors:                                                           */
 /* - SM_ERR_SUCCESS: If a valid agent identifier is found.                  */
 /* - SM_ERR_NOT_FOUND: if agentId does not point to a valid agent.          */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BaseDiscoverAgent(const scmi_caller_t *caller,
     const msg_rbase7_t *in, msg_tbase7_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
+    /* Self discovery */
+    if (in->agentId != BASE_ID_DISCOVER)
     {
-        status = SM_ERR_PROTOCOL_ERROR;
+        out->agentId = in->agentId;
     }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
+    else
     {
-        /* Self discovery */
-        if (in->agentId != BASE_ID_DISCOVER)
-        {
-            out->agentId = in->agentId;
-        }
-        else
-        {
-            out->agentId = caller->instAgentId;
-        }
+        out->agentId = caller->instAgentId;
+    }
 
-        /* Check agent */
-        if ((out->agentId > SM_SCMI_NUM_AGNT)
-            || (out->agentId > g_scmiConfig[caller->scmiInst].numAgents))
-        {
-            status = SM_ERR_NOT_FOUND;
-        }
+    /* Check agent */
+    if ((out->agentId > SM_SCMI_NUM_AGNT)
+        || (out->agentId > g_scmiConfig[caller->scmiInst].numAgents))
+    {
+        status = SM_ERR_NOT_FOUND;
     }
 
     /* Copy out agent name */
@@ -774,7 +709,6 @@ static int32_t BaseDiscoverAgent(const scmi_caller_t *caller,
 /* - SM_ERR_NOT_SUPPORTED: if the function is not supported.                */
 /* - SM_ERR_DENIED: if the calling agent is not allowed to set the          */
 /*   permissions of the agent specified by agentId.                         */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BaseSetDevicePermissions(const scmi_caller_t *caller,
     const msg_rbase9_t *in, const scmi_msg_status_t *out)
@@ -782,52 +716,43 @@ static int32_t BaseSetDevicePermissions(const scmi_caller_t *caller,
 #if SM_NUM_DEVICE > 0
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
+    /* Return data */
+    bool allow = BASE_PERM_FLAGS_ACCESS_TYPE(in->flags) != 0U;
+
+    /* Check agent */
+    if ((in->agentId == 0U)
+        || (in->agentId > SM_SCMI_NUM_AGNT)
+        || (in->agentId > g_scmiConfig[caller->scmiInst].numAgents))
     {
-        status = SM_ERR_PROTOCOL_ERROR;
+        status = SM_ERR_NOT_FOUND;
     }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
+    else
     {
-        bool allow = BASE_PERM_FLAGS_ACCESS_TYPE(in->flags) != 0U;
+        uint32_t agent = in->agentId - 1U
+            + g_scmiConfig[caller->scmiInst].firstAgent;
+        uint8_t domId = g_scmiAgentConfig[agent].domId;
+        bool secure = (g_scmiAgentConfig[agent].secure != 0U);
 
-        /* Check agent */
-        if ((in->agentId == 0U)
-            || (in->agentId > SM_SCMI_NUM_AGNT)
-            || (in->agentId > g_scmiConfig[caller->scmiInst].numAgents))
+        /* Check device */
+        if (in->deviceId >= SM_NUM_DEVICE)
         {
             status = SM_ERR_NOT_FOUND;
         }
         else
         {
-            uint32_t agent = in->agentId - 1U
-                + g_scmiConfig[caller->scmiInst].firstAgent;
-            uint8_t domId = g_scmiAgentConfig[agent].domId;
-            bool secure = (g_scmiAgentConfig[agent].secure != 0U);
-
-            /* Check device */
-            if (in->deviceId >= SM_NUM_DEVICE)
-            {
-                status = SM_ERR_NOT_FOUND;
-            }
-            else
+            /* Check permissions */
+            if (SM_SCMI_PERM(g_scmiBasePerms, caller->agentId,
+                in->deviceId + SM_NUM_AGENT) < SM_SCMI_PERM_PRIV)
             {
-                /* Check permissions */
-                if (g_scmiAgentConfig[caller->agentId].basePerms[
-                        in->deviceId + SM_NUM_AGENT] < SM_SCMI_PERM_PRIV)
-                {
-                    status = SM_ERR_DENIED;
-                }
+                status = SM_ERR_DENIED;
             }
+        }
 
-            /* Call device permission function */
-            if (status == SM_ERR_SUCCESS)
-            {
-                status = SM_RDCACCESSSET(in->deviceId, allow, domId,
-                    secure);
-            }
+        /* Call device permission function */
+        if (status == SM_ERR_SUCCESS)
+        {
+            status = SM_RDCACCESSSET(in->deviceId, allow, domId,
+                secure);
         }
     }
 #else
@@ -867,49 +792,39 @@ static int32_t BaseSetDevicePermissions(const scmi_caller_t *caller,
 /* - SM_ERR_NOT_FOUND: if agentId does not point to a valid agent.          */
 /* - SM_ERR_DENIED: if the calling agent is not allowed to set the reset    */
 /*   the agent specified by agentId.                                        */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BaseResetAgentConfiguration(const scmi_caller_t *caller,
     const msg_rbase11_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
+    /* Return data */
+    bool permissionsReset = BASE_FLAGS_PERMISSIONS(in->flags) != 0U;
+
+    /* Check agent */
+    if ((in->agentId == 0U)
+        || (in->agentId > SM_SCMI_NUM_AGNT)
+        || (in->agentId > g_scmiConfig[caller->scmiInst].numAgents))
     {
-        status = SM_ERR_PROTOCOL_ERROR;
+        status = SM_ERR_NOT_FOUND;
     }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
+    else
     {
-        bool permissionsReset = BASE_FLAGS_PERMISSIONS(in->flags) != 0U;
+        uint32_t agent = in->agentId - 1U
+            + g_scmiConfig[caller->scmiInst].firstAgent;
 
-        /* Check agent */
-        if ((in->agentId == 0U)
-            || (in->agentId > SM_SCMI_NUM_AGNT)
-            || (in->agentId > g_scmiConfig[caller->scmiInst].numAgents))
+        /* Check permissions */
+        if (SM_SCMI_PERM(g_scmiBasePerms, caller->agentId, agent)
+            < SM_SCMI_PERM_PRIV)
         {
-            status = SM_ERR_NOT_FOUND;
+            status = SM_ERR_DENIED;
         }
-        else
-        {
-            uint32_t agent = in->agentId - 1U
-                + g_scmiConfig[caller->scmiInst].firstAgent;
-
-            /* Check permissions */
-            if (g_scmiAgentConfig[caller->agentId].basePerms[agent]
-                < SM_SCMI_PERM_PRIV)
-            {
-                status = SM_ERR_DENIED;
-            }
 
-            /* Call base reset function */
-            if (status == SM_ERR_SUCCESS)
-            {
-                status = BaseResetAgentConfig(caller->lmId, agent,
-                    permissionsReset);
-            }
+        /* Call base reset function */
+        if (status == SM_ERR_SUCCESS)
+        {
+            status = BaseResetAgentConfig(caller->lmId, agent,
+                permissionsReset);
         }
     }
 
@@ -934,19 +849,12 @@ static int32_t BaseResetAgentConfiguration(const scmi_caller_t *caller,
 /*   successful return of this command must comply with the negotiated      */
 /*   version.                                                               */
 /* - SM_ERR_NOT_SUPPORTED: if the protocol version is not supported.        */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BaseNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rbase16_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check major version */
     if ((status == SM_ERR_SUCCESS) && (SCMI_VER_MAJOR(in->version)
         == SCMI_VER_MAJOR(PROTOCOL_VERSION)))
@@ -986,8 +894,8 @@ static int32_t BaseResetAgentConfig(uint32_t lmId, uint32_t agentId,
         /* Loop over devices */
         for (uint32_t deviceId = 0U; deviceId < SM_NUM_DEVICE; deviceId++)
         {
-            if (g_scmiAgentConfig[agentId].basePerms[deviceId
-                + SM_NUM_AGENT] >= SM_SCMI_PERM_PRIV)
+            if (SM_SCMI_PERM(g_scmiBasePerms, agentId,
+                deviceId + SM_NUM_AGENT) >= SM_SCMI_PERM_PRIV)
             {
                 uint8_t domId = g_scmiAgentConfig[agentId].domId;
                 bool secure = (g_scmiAgentConfig[agentId].secure != 0U);
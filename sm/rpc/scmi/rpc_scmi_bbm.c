@@ -47,7 +47,7 @@
 /* Protocol version */
 #define PROTOCOL_VERSION  0x10000U
 
-/* SCMI bbm protocol message IDs and masks */
+/* SCMI bbm protocol message IDs */
 #define COMMAND_PROTOCOL_VERSION             0x0U
 #define COMMAND_PROTOCOL_ATTRIBUTES          0x1U
 #define COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES  0x2U
@@ -61,7 +61,6 @@
 #define COMMAND_BBM_RTC_NOTIFY               0xAU
 #define COMMAND_BBM_BUTTON_NOTIFY            0xBU
 #define COMMAND_NEGOTIATE_PROTOCOL_VERSION   0x10U
-#define COMMAND_SUPPORTED_MASK               0x10FFFUL
 
 /* SCMI BBM max argument lengths */
 #define BBM_MAX_NAME  16U
@@ -312,6 +311,30 @@ typedef struct
     uint32_t flags;
 } msg_rbbm33_t;
 
+/* Local variables */
+
+/* Message descriptors, indexed by message ID */
+static const scmi_msg_desc_t s_bbmMsgDesc[] =
+{
+    [COMMAND_PROTOCOL_VERSION] = SCMI_MSG_DESC(scmi_msg_header_t, msg_tbbm0_t),
+    [COMMAND_PROTOCOL_ATTRIBUTES] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tbbm1_t),
+    [COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES] =
+        SCMI_MSG_DESC(msg_rbbm2_t, msg_tbbm2_t),
+    [COMMAND_BBM_GPR_SET] = SCMI_MSG_DESC(msg_rbbm3_t, scmi_msg_status_t),
+    [COMMAND_BBM_GPR_GET] = SCMI_MSG_DESC(msg_rbbm4_t, msg_tbbm4_t),
+    [COMMAND_BBM_RTC_ATTRIBUTES] = SCMI_MSG_DESC(msg_rbbm5_t, msg_tbbm5_t),
+    [COMMAND_BBM_RTC_TIME_SET] = SCMI_MSG_DESC(msg_rbbm6_t, scmi_msg_status_t),
+    [COMMAND_BBM_RTC_TIME_GET] = SCMI_MSG_DESC(msg_rbbm7_t, msg_tbbm7_t),
+    [COMMAND_BBM_RTC_ALARM_SET] = SCMI_MSG_DESC(msg_rbbm8_t, scmi_msg_status_t),
+    [COMMAND_BBM_BUTTON_GET] = SCMI_MSG_DESC(scmi_msg_header_t, msg_tbbm9_t),
+    [COMMAND_BBM_RTC_NOTIFY] = SCMI_MSG_DESC(msg_rbbm10_t, scmi_msg_status_t),
+    [COMMAND_BBM_BUTTON_NOTIFY] =
+        SCMI_MSG_DESC(msg_rbbm11_t, scmi_msg_status_t),
+    [COMMAND_NEGOTIATE_PROTOCOL_VERSION] =
+        SCMI_MSG_DESC(msg_rbbm16_t, scmi_msg_status_t)
+};
+
 /* Local functions */
 
 static int32_t BbmProtocolVersion(const scmi_caller_t *caller,
@@ -357,82 +380,76 @@ static int32_t BbmResetAgentConfig(uint32_t lmId, uint32_t agentId,
 int32_t RPC_SCMI_BbmDispatchCommand(scmi_caller_t *caller,
     uint32_t messageId)
 {
-    int32_t status = SM_ERR_SUCCESS;
+    int32_t status;
     const scmi_msg_t *in = caller->msgCopy;
     scmi_msg_status_t *out = caller->msg;
-    uint32_t lenOut = sizeof(scmi_msg_status_t);
+    uint32_t lenOut;
+
+    /* Check message */
+    status = RPC_SCMI_A2pMsgCheck(caller, s_bbmMsgDesc,
+        ARRAY_SIZE(s_bbmMsgDesc), messageId, &lenOut);
 
     /* Handle standard messages */
-    switch(messageId)
+    if (status == SM_ERR_SUCCESS)
     {
-        case COMMAND_PROTOCOL_VERSION:
-            lenOut = sizeof(msg_tbbm0_t);
-            status = BbmProtocolVersion(caller, (const scmi_msg_header_t*) in,
-                (msg_tbbm0_t*) out);
-            break;
-        case COMMAND_PROTOCOL_ATTRIBUTES:
-            lenOut = sizeof(msg_tbbm1_t);
-            status = BbmProtocolAttributes(caller,
-                (const scmi_msg_header_t*) in, (msg_tbbm1_t*) out);
-            break;
-        case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
-            lenOut = sizeof(msg_tbbm2_t);
-            status = BbmProtocolMessageAttributes(caller,
-                (const msg_rbbm2_t*) in, (msg_tbbm2_t*) out);
-            break;
-        case COMMAND_BBM_GPR_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = BbmGprSet(caller, (const msg_rbbm3_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_BBM_GPR_GET:
-            lenOut = sizeof(msg_tbbm4_t);
-            status = BbmGprGet(caller, (const msg_rbbm4_t*) in,
-                (msg_tbbm4_t*) out);
-            break;
-        case COMMAND_BBM_RTC_ATTRIBUTES:
-            lenOut = sizeof(msg_tbbm5_t);
-            status = BbmRtcAttributes(caller, (const msg_rbbm5_t*) in,
-                (msg_tbbm5_t*) out);
-            break;
-        case COMMAND_BBM_RTC_TIME_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = BbmRtcTimeSet(caller, (const msg_rbbm6_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_BBM_RTC_TIME_GET:
-            lenOut = sizeof(msg_tbbm7_t);
-            status = BbmRtcTimeGet(caller, (const msg_rbbm7_t*) in,
-                (msg_tbbm7_t*) out);
-            break;
-        case COMMAND_BBM_RTC_ALARM_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = BbmRtcAlarmSet(caller, (const msg_rbbm8_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_BBM_BUTTON_GET:
-            lenOut = sizeof(msg_tbbm9_t);
-            status = BbmButtonGet(caller, (const scmi_msg_header_t*) in,
-                (msg_tbbm9_t*) out);
-            break;
-        case COMMAND_BBM_RTC_NOTIFY:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = BbmRtcNotify(caller, (const msg_rbbm10_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_BBM_BUTTON_NOTIFY:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = BbmButtonNotify(caller, (const msg_rbbm11_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = BbmNegotiateProtocolVersion(caller,
-                (const msg_rbbm16_t*) in, (const scmi_msg_status_t*) out);
-            break;
-        default:
-            status = SM_ERR_NOT_SUPPORTED;
-            break;
+        switch(messageId)
+        {
+            case COMMAND_PROTOCOL_VERSION:
+                status = BbmProtocolVersion(caller,
+                    (const scmi_msg_header_t*) in, (msg_tbbm0_t*) out);
+                break;
+            case COMMAND_PROTOCOL_ATTRIBUTES:
+                status = BbmProtocolAttributes(caller,
+                    (const scmi_msg_header_t*) in, (msg_tbbm1_t*) out);
+                break;
+            case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
+                status = BbmProtocolMessageAttributes(caller,
+                    (const msg_rbbm2_t*) in, (msg_tbbm2_t*) out);
+                break;
+            case COMMAND_BBM_GPR_SET:
+                status = BbmGprSet(caller, (const msg_rbbm3_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_BBM_GPR_GET:
+                status = BbmGprGet(caller, (const msg_rbbm4_t*) in,
+                    (msg_tbbm4_t*) out);
+                break;
+            case COMMAND_BBM_RTC_ATTRIBUTES:
+                status = BbmRtcAttributes(caller, (const msg_rbbm5_t*) in,
+                    (msg_tbbm5_t*) out);
+                break;
+            case COMMAND_BBM_RTC_TIME_SET:
+                status = BbmRtcTimeSet(caller, (const msg_rbbm6_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_BBM_RTC_TIME_GET:
+                status = BbmRtcTimeGet(caller, (const msg_rbbm7_t*) in,
+                    (msg_tbbm7_t*) out);
+                break;
+            case COMMAND_BBM_RTC_ALARM_SET:
+                status = BbmRtcAlarmSet(caller, (const msg_rbbm8_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_BBM_BUTTON_GET:
+                status = BbmButtonGet(caller, (const scmi_msg_header_t*) in,
+                    (msg_tbbm9_t*) out);
+                break;
+            case COMMAND_BBM_RTC_NOTIFY:
+                status = BbmRtcNotify(caller, (const msg_rbbm10_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_BBM_BUTTON_NOTIFY:
+                status = BbmButtonNotify(caller, (const msg_rbbm11_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
+                status = BbmNegotiateProtocolVersion(caller,
+                    (const msg_rbbm16_t*) in, (const scmi_msg_status_t*) out);
+                break;
+            default:
+                status = SM_ERR_NOT_SUPPORTED;
+                break;
+        }
     }
 
     /* Update length */
@@ -517,25 +534,14 @@ static bool s_buttonNotify[SM_SCMI_NUM_AGNT];
 /* SCMI_BbmProtocolVersion().                                               */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BbmProtocolVersion(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tbbm0_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return version */
-        out->version = PROTOCOL_VERSION;
-    }
+    /* Return version */
+    out->version = PROTOCOL_VERSION;
 
     /* Return status */
     return status;
@@ -558,26 +564,15 @@ static int32_t BbmProtocolVersion(const scmi_caller_t *caller,
 /* - BBM_PROTO_ATTR_NUM_GPR() - Number of persistent storage (GPR) words    */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BbmProtocolAttributes(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tbbm1_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return attributes */
-        out->attributes = BBM_PROTO_ATTR_NUM_RTC(SM_NUM_RTC)
-            | BBM_PROTO_ATTR_NUM_GPR(SM_NUM_GPR);
-    }
+    /* Return attributes */
+    out->attributes = BBM_PROTO_ATTR_NUM_RTC(SM_NUM_RTC)
+        | BBM_PROTO_ATTR_NUM_GPR(SM_NUM_GPR);
 
     /* Return status */
     return status;
@@ -601,31 +596,20 @@ static int32_t BbmProtocolAttributes(const scmi_caller_t *caller,
 /*   use.                                                                   */
 /* - SM_ERR_NOT_FOUND: if the message identified by messageId is invalid    */
 /*   or not provided by this platform implementation.                       */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BbmProtocolMessageAttributes(const scmi_caller_t *caller,
     const msg_rbbm2_t *in, msg_tbbm2_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
+    /* Always zero */
+    out->attributes = 0U;
 
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
+    /* Is message supported ? */
+    if (!RPC_SCMI_A2pMsgSupported(s_bbmMsgDesc,
+        ARRAY_SIZE(s_bbmMsgDesc), in->messageId))
     {
-        /* Always zero */
-        out->attributes = 0U;
-
-        /* Is message supported ? */
-        if ((in->messageId >= 32U)
-            || (((COMMAND_SUPPORTED_MASK >> in->messageId) & 0x1U) == 0U))
-        {
-            status = SM_ERR_NOT_FOUND;
-        }
+        status = SM_ERR_NOT_FOUND;
     }
 
     /* Return status */
@@ -648,19 +632,12 @@ static int32_t BbmProtocolMessageAttributes(const scmi_caller_t *caller,
 /* - SM_ERR_NOT_FOUND: if the index is not valid.                           */
 /* - SM_ERR_DENIED: if the agent does not have permission to write the      */
 /*   specified GPR.                                                         */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BbmGprSet(const scmi_caller_t *caller, const msg_rbbm3_t *in,
     const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check GPR */
     if ((status == SM_ERR_SUCCESS) && (in->index >= SM_NUM_GPR))
     {
@@ -669,7 +646,7 @@ static int32_t BbmGprSet(const scmi_caller_t *caller, const msg_rbbm3_t *in,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].gprPerms[in->index]
+        && (SM_SCMI_PERM(g_scmiGprPerms, caller->agentId, in->index)
         < SM_SCMI_PERM_EXCLUSIVE))
     {
         status = SM_ERR_DENIED;
@@ -701,19 +678,12 @@ static int32_t BbmGprSet(const scmi_caller_t *caller, const msg_rbbm3_t *in,
 /* - SM_ERR_NOT_FOUND: if the index is not valid.                           */
 /* - SM_ERR_DENIED: if the agent does not have permission to read the       */
 /*   specified GPR.                                                         */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BbmGprGet(const scmi_caller_t *caller, const msg_rbbm4_t *in,
     msg_tbbm4_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check GPR */
     if ((status == SM_ERR_SUCCESS) && (in->index >= SM_NUM_GPR))
     {
@@ -722,7 +692,7 @@ static int32_t BbmGprGet(const scmi_caller_t *caller, const msg_rbbm4_t *in,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].gprPerms[in->index]
+        && (SM_SCMI_PERM(g_scmiGprPerms, caller->agentId, in->index)
         < SM_SCMI_PERM_GET))
     {
         status = SM_ERR_DENIED;
@@ -763,7 +733,6 @@ static int32_t BbmGprGet(const scmi_caller_t *caller, const msg_rbbm4_t *in,
 /* Return errors:                                                           */
 /* - SM_ERR_SUCCESS: if valid power domain attributes are returned.         */
 /* - SM_ERR_NOT_FOUND: if rtcId pertains to a non-existent RTC.             */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BbmRtcAttributes(const scmi_caller_t *caller,
     const msg_rbbm5_t *in, msg_tbbm5_t *out)
@@ -774,12 +743,6 @@ static int32_t BbmRtcAttributes(const scmi_caller_t *caller,
     uint32_t tickWidth;
     uint32_t ticksPerSec;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check RTC */
     if ((status == SM_ERR_SUCCESS) && (in->rtcId >= SM_NUM_RTC))
     {
@@ -843,19 +806,12 @@ static int32_t BbmRtcAttributes(const scmi_caller_t *caller,
 /*   range of the RTC).                                                     */
 /* - SM_ERR_DENIED: if the agent does not have permission to set the        */
 /*   RTC.                                                                   */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BbmRtcTimeSet(const scmi_caller_t *caller,
     const msg_rbbm6_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check RTC */
     if ((status == SM_ERR_SUCCESS) && (in->rtcId >= SM_NUM_RTC))
     {
@@ -864,7 +820,7 @@ static int32_t BbmRtcTimeSet(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].rtcPerms[in->rtcId]
+        && (SM_SCMI_PERM(g_scmiRtcPerms, caller->agentId, in->rtcId)
         < SM_SCMI_PERM_EXCLUSIVE))
     {
         status = SM_ERR_DENIED;
@@ -908,7 +864,6 @@ static int32_t BbmRtcTimeSet(const scmi_caller_t *caller,
 /* Return errors:                                                           */
 /* - SM_ERR_SUCCESS: if the RTC time was successfully read.                 */
 /* - SM_ERR_NOT_FOUND: if rtcId pertains to a non-existent RTC.             */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BbmRtcTimeGet(const scmi_caller_t *caller,
     const msg_rbbm7_t *in, msg_tbbm7_t *out)
@@ -917,12 +872,6 @@ static int32_t BbmRtcTimeGet(const scmi_caller_t *caller,
     bool ticks = BBM_RTC_FLAGS_TICKS(in->flags) != 0U;
     uint64_t lmTime;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check RTC */
     if ((status == SM_ERR_SUCCESS) && (in->rtcId >= SM_NUM_RTC))
     {
@@ -973,19 +922,12 @@ static int32_t BbmRtcTimeGet(const scmi_caller_t *caller,
 /*   range of the RTC alarm).                                               */
 /* - SM_ERR_DENIED: if the agent does not have permission to set the RTC    */
 /*   alarm.                                                                 */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BbmRtcAlarmSet(const scmi_caller_t *caller,
     const msg_rbbm8_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check RTC */
     if ((status == SM_ERR_SUCCESS) && (in->rtcId >= SM_NUM_RTC))
     {
@@ -994,7 +936,7 @@ static int32_t BbmRtcAlarmSet(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].rtcPerms[in->rtcId]
+        && (SM_SCMI_PERM(g_scmiRtcPerms, caller->agentId, in->rtcId)
         < SM_SCMI_PERM_PRIV))
     {
         status = SM_ERR_DENIED;
@@ -1029,7 +971,6 @@ static int32_t BbmRtcAlarmSet(const scmi_caller_t *caller,
 /*                                                                          */
 /* Return errors:                                                           */
 /* - SM_ERR_SUCCESS: if the button status was read.                         */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BbmButtonGet(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tbbm9_t *out)
@@ -1037,17 +978,8 @@ static int32_t BbmButtonGet(const scmi_caller_t *caller,
     int32_t status = SM_ERR_SUCCESS;
     bool buttonAsserted;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Get button state */
-    if (status == SM_ERR_SUCCESS)
-    {
-        status = LMM_BbmButtonGet(caller->lmId, &buttonAsserted);
-    }
+    status = LMM_BbmButtonGet(caller->lmId, &buttonAsserted);
 
     /* Covert to return format */
     if (status == SM_ERR_SUCCESS)
@@ -1091,19 +1023,12 @@ static int32_t BbmButtonGet(const scmi_caller_t *caller,
 /* - SM_ERR_NOT_FOUND: if rtcId pertains to a non-existent RTC.             */
 /* - SM_ERR_DENIED: if the agent does not have permission to request RTC    */
 /*   notifications.                                                         */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BbmRtcNotify(const scmi_caller_t *caller,
     const msg_rbbm10_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check RTC */
     if ((status == SM_ERR_SUCCESS) && (in->rtcId >= SM_NUM_RTC))
     {
@@ -1112,7 +1037,7 @@ static int32_t BbmRtcNotify(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].rtcPerms[in->rtcId]
+        && (SM_SCMI_PERM(g_scmiRtcPerms, caller->agentId, in->rtcId)
         < SM_SCMI_PERM_NOTIFY))
     {
         status = SM_ERR_DENIED;
@@ -1167,22 +1092,15 @@ static int32_t BbmRtcNotify(const scmi_caller_t *caller,
 /*   updated.                                                               */
 /* - SM_ERR_DENIED: if the agent does not have permission to request        */
 /*   button notifications.                                                  */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BbmButtonNotify(const scmi_caller_t *caller,
     const msg_rbbm11_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].buttonPerms[0U]
+        && (SM_SCMI_PERM(g_scmiButtonPerms, caller->agentId, 0U)
         < SM_SCMI_PERM_NOTIFY))
     {
         status = SM_ERR_DENIED;
@@ -1215,19 +1133,12 @@ static int32_t BbmButtonNotify(const scmi_caller_t *caller,
 /*   successful return of this command must comply with the negotiated      */
 /*   version.                                                               */
 /* - SM_ERR_NOT_SUPPORTED: if the protocol version is not supported.        */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t BbmNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rbbm16_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check major version */
     if ((status == SM_ERR_SUCCESS) && (SCMI_VER_MAJOR(in->version)
         == SCMI_VER_MAJOR(PROTOCOL_VERSION)))
@@ -1277,9 +1188,10 @@ static int32_t BbmRtcEvent(scmi_msg_id_t msgId,
                     = BBM_EVENT_RTC_ALARM(1U)
                     | BBM_EVENT_RTC_ID(rtcId);
 
-                /* Queue notification */
+                /* Queue notification (coalesced per event) */
                 RPC_SCMI_P2aTxQ(dstAgent, msgId, (uint32_t*) &out,
-                    sizeof(out), SCMI_NOTIFY_Q);
+                    sizeof(out), SCMI_NOTIFY_Q,
+                    out.flags);
             }
             if ((event == LMM_TRIGGER_PARM_RTC_ROLLOVER)
                 && (s_rtcInfo[rtcId].rolloverNotify[dstAgent]))
@@ -1289,9 +1201,10 @@ static int32_t BbmRtcEvent(scmi_msg_id_t msgId,
                     = BBM_EVENT_RTC_ROLLOVER(1U)
                     | BBM_EVENT_RTC_ID(rtcId);
 
-                /* Queue notification */
+                /* Queue notification (coalesced per event) */
                 RPC_SCMI_P2aTxQ(dstAgent, msgId, (uint32_t*) &out,
-                    sizeof(out), SCMI_NOTIFY_Q);
+                    sizeof(out), SCMI_NOTIFY_Q,
+                    out.flags);
             }
             if ((event == LMM_TRIGGER_PARM_RTC_UPDATE)
                 && (s_rtcInfo[rtcId].updateNotify[dstAgent]))
@@ -1301,9 +1214,10 @@ static int32_t BbmRtcEvent(scmi_msg_id_t msgId,
                     = BBM_EVENT_RTC_UPDATED(1U)
                     | BBM_EVENT_RTC_ID(rtcId);
 
-                /* Queue notification */
+                /* Queue notification (coalesced per event) */
                 RPC_SCMI_P2aTxQ(dstAgent, msgId, (uint32_t*) &out,
-                    sizeof(out), SCMI_NOTIFY_Q);
+                    sizeof(out), SCMI_NOTIFY_Q,
+                    out.flags);
             }
         }
     }
@@ -1336,9 +1250,9 @@ static int32_t BbmButtonEvent(scmi_msg_id_t msgId,
             /* Fill in data */
             out.flags = BBM_EVENT_BUTTON_DETECTED(1U);
 
-            /* Queue notification */
+            /* Queue notification (coalesced per event) */
             RPC_SCMI_P2aTxQ(dstAgent, msgId, (uint32_t*) &out,
-                sizeof(out), SCMI_NOTIFY_Q);
+                sizeof(out), SCMI_NOTIFY_Q, out.flags);
         }
     }
 
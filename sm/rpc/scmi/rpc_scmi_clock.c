@@ -47,7 +47,7 @@
 /* Protocol version */
 #define PROTOCOL_VERSION  0x30000U
 
-/* SCMI clock protocol message IDs and masks */
+/* SCMI clock protocol message IDs */
 #define COMMAND_PROTOCOL_VERSION             0x0U
 #define COMMAND_PROTOCOL_ATTRIBUTES          0x1U
 #define COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES  0x2U
@@ -56,24 +56,29 @@
 #define COMMAND_CLOCK_RATE_SET               0x5U
 #define COMMAND_CLOCK_RATE_GET               0x6U
 #define COMMAND_CLOCK_CONFIG_SET             0x7U
+#define COMMAND_CLOCK_RATE_NOTIFY            0x9U
+#define COMMAND_CLOCK_RATE_CHANGE_REQUESTED_NOTIFY  0xAU
 #define COMMAND_CLOCK_CONFIG_GET             0xBU
 #define COMMAND_CLOCK_POSSIBLE_PARENTS_GET   0xCU
 #define COMMAND_CLOCK_PARENT_SET             0xDU
 #define COMMAND_CLOCK_PARENT_GET             0xEU
 #define COMMAND_CLOCK_GET_PERMISSIONS        0xFU
 #define COMMAND_NEGOTIATE_PROTOCOL_VERSION   0x10U
-#define COMMAND_SUPPORTED_MASK               0x1F8FFUL
 
 /* SCMI max clock argument lengths */
 #define CLOCK_MAX_NAME     16U
 #define CLOCK_MAX_RATES    SCMI_ARRAY(8U, clock_rate_t)
 #define CLOCK_MAX_PARENTS  SCMI_ARRAY(8U, uint32_t)
+#define CLOCK_NUM_PARENTS(C)  SCMI_ARRAY_CALLER(C, 8U, uint32_t)
 
 /* SCMI clock round options */
 #define CLOCK_ROUND_DOWN  0U
 #define CLOCK_ROUND_UP    1U
 #define CLOCK_ROUND_AUTO  2U
 
+/* Max pending async rate changes per agent */
+#define CLOCK_MAX_PENDING  2U
+
 /* Local macros */
 
 /* SCMI clock protocol attributes */
@@ -103,6 +108,10 @@
 #define CLOCK_CONFIG_SET_EXT_CONFIG(x)  (((x) & 0xFF0000U) >> 16U)
 #define CLOCK_CONFIG_SET_ENABLE(x)      (((x) & 0x3U) >> 0U)
 
+/* SCMI clock extended config types */
+#define CLOCK_EXT_CONFIG_NONE        0x00U
+#define CLOCK_EXT_CONFIG_PARENT_SEL  0x80U
+
 /* SCMI clock config get flags */
 #define CLOCK_CONFIG_FLAGS_EXT_CONFIG(x)  (((x) & 0xFFU) >> 0U)
 
@@ -113,6 +122,9 @@
 #define CLOCK_NUM_PARENT_FLAGS_REMAING_PARENTS(x)  (((x) & 0xFFU) << 24U)
 #define CLOCK_NUM_PARENT_FLAGS_NUM_PARENTS(x)      (((x) & 0xFFU) << 0U)
 
+/* SCMI clock notification enable */
+#define CLOCK_NOTIFY_ENABLE(x)  (((x) & 0x1U) >> 0U)
+
 /* SCMI clock permissions */
 #define CLOCK_PERM_STATE(x)   (((x) & 0x1U) << 31U)
 #define CLOCK_PERM_PARENT(x)  (((x) & 0x1U) << 30U)
@@ -373,6 +385,127 @@ typedef struct
     uint32_t version;
 } msg_rclock16_t;
 
+/* Request type for ClockRateNotify() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Identifier for the clock device */
+    uint32_t clockId;
+    /* Notification flags */
+    uint32_t notifyEnable;
+} msg_rclock9_t;
+
+/* Request type for ClockRateChangeRequestedNotify() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Identifier for the clock device */
+    uint32_t clockId;
+    /* Notification flags */
+    uint32_t notifyEnable;
+} msg_rclock10_t;
+
+/* Request type for ClockRateChanged() and ClockRateChangeRequested() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Refers to the agent that caused this event */
+    uint32_t agentId;
+    /* Identifier for the clock device */
+    uint32_t clockId;
+    /* Clock rate */
+    clock_rate_t rate;
+} msg_rclock32_t;
+
+/* Delayed response type for ClockRateSet() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Return status */
+    int32_t status;
+    /* Identifier for the clock device */
+    uint32_t clockId;
+    /* Clock rate that was set */
+    clock_rate_t rate;
+} msg_dclock5_t;
+
+/* Pending async rate change */
+typedef struct
+{
+    /* Header of the CLOCK_RATE_SET message */
+    uint32_t header;
+    /* LM of the agent */
+    uint32_t lmId;
+    /* Identifier for the clock device */
+    uint32_t clockId;
+    /* Rounding */
+    uint32_t roundSel;
+    /* Requested rate */
+    uint64_t rate;
+    /* Send delayed response */
+    bool resp;
+} clock_async_t;
+
+/* Async rate change queue */
+typedef struct
+{
+    uint32_t tail;
+    uint32_t count;
+    clock_async_t req[CLOCK_MAX_PENDING];
+} clock_async_queue_t;
+
+/* Local variables */
+
+/* Message descriptors, indexed by message ID */
+static const scmi_msg_desc_t s_clockMsgDesc[] =
+{
+    [COMMAND_PROTOCOL_VERSION] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tclock0_t),
+    [COMMAND_PROTOCOL_ATTRIBUTES] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tclock1_t),
+    [COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES] =
+        SCMI_MSG_DESC(msg_rclock2_t, msg_tclock2_t),
+    [COMMAND_CLOCK_ATTRIBUTES] = SCMI_MSG_DESC(msg_rclock3_t, msg_tclock3_t),
+    [COMMAND_CLOCK_DESCRIBE_RATES] =
+        SCMI_MSG_DESC(msg_rclock4_t, msg_tclock4_t),
+    [COMMAND_CLOCK_RATE_SET] = SCMI_MSG_DESC(msg_rclock5_t, scmi_msg_status_t),
+    [COMMAND_CLOCK_RATE_GET] = SCMI_MSG_DESC(msg_rclock6_t, msg_tclock6_t),
+    [COMMAND_CLOCK_CONFIG_SET] = SCMI_MSG_DESC_VAR(3U, scmi_msg_status_t),
+    [COMMAND_CLOCK_RATE_NOTIFY] =
+        SCMI_MSG_DESC(msg_rclock9_t, scmi_msg_status_t),
+    [COMMAND_CLOCK_RATE_CHANGE_REQUESTED_NOTIFY] =
+        SCMI_MSG_DESC(msg_rclock10_t, scmi_msg_status_t),
+    [COMMAND_CLOCK_CONFIG_GET] = SCMI_MSG_DESC(msg_rclock11_t, msg_tclock11_t),
+    [COMMAND_CLOCK_POSSIBLE_PARENTS_GET] =
+        SCMI_MSG_DESC(msg_rclock12_t, msg_tclock12_t),
+    [COMMAND_CLOCK_PARENT_SET] =
+        SCMI_MSG_DESC(msg_rclock13_t, scmi_msg_status_t),
+    [COMMAND_CLOCK_PARENT_GET] = SCMI_MSG_DESC(msg_rclock14_t, msg_tclock14_t),
+    [COMMAND_CLOCK_GET_PERMISSIONS] =
+        SCMI_MSG_DESC(msg_rclock15_t, msg_tclock15_t),
+    [COMMAND_NEGOTIATE_PROTOCOL_VERSION] =
+        SCMI_MSG_DESC(msg_rclock16_t, scmi_msg_status_t)
+};
+
+static clock_async_queue_t s_asyncQueue[SM_SCMI_NUM_AGNT];
+static uint32_t s_asyncLastAgent;
+
+/* Rate change notification enables, bitmap per agent */
+static uint32_t s_clockNotify[SM_SCMI_NUM_AGNT]
+    [SCMI_DIRTY_WORDS(SM_NUM_CLOCK)];
+
+/* Change requested notification enables, bitmap per agent */
+static uint32_t s_clockReqNotify[SM_SCMI_NUM_AGNT]
+    [SCMI_DIRTY_WORDS(SM_NUM_CLOCK)];
+
+/* Rate set selects best parent, bitmap per agent */
+static uint32_t s_clockParentSel[SM_SCMI_NUM_AGNT]
+    [SCMI_DIRTY_WORDS(SM_NUM_CLOCK)];
+
 /* Local functions */
 
 static int32_t ClockProtocolVersion(const scmi_caller_t *caller,
@@ -391,6 +524,10 @@ static int32_t ClockRateGet(const scmi_caller_t *caller,
     const msg_rclock6_t *in, msg_tclock6_t *out);
 static int32_t ClockConfigSet(const scmi_caller_t *caller,
     const msg_rclock7_t *in, const scmi_msg_status_t *out);
+static int32_t ClockRateNotify(const scmi_caller_t *caller,
+    const msg_rclock9_t *in, const scmi_msg_status_t *out);
+static int32_t ClockRateChangeRequestedNotify(const scmi_caller_t *caller,
+    const msg_rclock10_t *in, const scmi_msg_status_t *out);
 static int32_t ClockConfigGet(const scmi_caller_t *caller,
     const msg_rclock11_t *in, msg_tclock11_t *out);
 static int32_t ClockPossibleParentsGet(const scmi_caller_t *caller,
@@ -403,8 +540,13 @@ static int32_t ClockGetPermissions(const scmi_caller_t *caller,
     const msg_rclock15_t *in, msg_tclock15_t *out);
 static int32_t ClockNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rclock16_t *in, const scmi_msg_status_t *out);
+static int32_t ClockRateChanged(scmi_msg_id_t msgId,
+    const lmm_rpc_trigger_t *trigger);
+static void ClockRateChangeRequested(const scmi_caller_t *caller,
+    uint32_t clockId, const clock_rate_t *rate);
 static int32_t ClockResetAgentConfig(uint32_t lmId, uint32_t agentId,
     bool permissionsReset);
+static bool ClockAsyncGet(uint32_t *agentId);
 
 /*--------------------------------------------------------------------------*/
 /* Dispatch SCMI command                                                    */
@@ -416,92 +558,120 @@ static int32_t ClockResetAgentConfig(uint32_t lmId, uint32_t agentId,
 int32_t RPC_SCMI_ClockDispatchCommand(scmi_caller_t *caller,
     uint32_t messageId)
 {
-    int32_t status = SM_ERR_SUCCESS;
+    int32_t status;
     const scmi_msg_t *in = caller->msgCopy;
     scmi_msg_status_t *out = caller->msg;
-    uint32_t lenOut = sizeof(scmi_msg_status_t);
+    uint32_t lenOut;
+
+    /* Check message */
+    status = RPC_SCMI_A2pMsgCheck(caller, s_clockMsgDesc,
+        ARRAY_SIZE(s_clockMsgDesc), messageId, &lenOut);
 
     /* Handle standard messages */
-    switch(messageId)
+    if (status == SM_ERR_SUCCESS)
     {
-        case COMMAND_PROTOCOL_VERSION:
-            lenOut = sizeof(msg_tclock0_t);
-            status = ClockProtocolVersion(caller,
-                (const scmi_msg_header_t*) in, (msg_tclock0_t*) out);
-            break;
-        case COMMAND_PROTOCOL_ATTRIBUTES:
-            lenOut = sizeof(msg_tclock1_t);
-            status = ClockProtocolAttributes(caller,
-                (const scmi_msg_header_t*) in, (msg_tclock1_t*) out);
-            break;
-        case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
-            lenOut = sizeof(msg_tclock2_t);
-            status = ClockProtocolMessageAttributes(caller,
-                (const msg_rclock2_t*) in, (msg_tclock2_t*) out);
-            break;
-        case COMMAND_CLOCK_ATTRIBUTES:
-            lenOut = sizeof(msg_tclock3_t);
-            status = ClockAttributes(caller, (const msg_rclock3_t*) in,
-                (msg_tclock3_t*) out);
-            break;
-        case COMMAND_CLOCK_DESCRIBE_RATES:
-            lenOut = sizeof(msg_tclock4_t);
-            status = ClockDescribeRates(caller, (const msg_rclock4_t*) in,
-                (msg_tclock4_t*) out, &lenOut);
-            break;
-        case COMMAND_CLOCK_RATE_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = ClockRateSet(caller, (const msg_rclock5_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_CLOCK_RATE_GET:
-            lenOut = sizeof(msg_tclock6_t);
-            status = ClockRateGet(caller, (const msg_rclock6_t*) in,
-                (msg_tclock6_t*) out);
-            break;
-        case COMMAND_CLOCK_CONFIG_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = ClockConfigSet(caller, (const msg_rclock7_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_CLOCK_CONFIG_GET:
-            lenOut = sizeof(msg_tclock11_t);
-            status = ClockConfigGet(caller, (const msg_rclock11_t*) in,
-                (msg_tclock11_t*) out);
-            break;
-        case COMMAND_CLOCK_POSSIBLE_PARENTS_GET:
-            lenOut = sizeof(msg_tclock12_t);
-            status = ClockPossibleParentsGet(caller,
-                (const msg_rclock12_t*) in, (msg_tclock12_t*) out, &lenOut);
-            break;
-        case COMMAND_CLOCK_PARENT_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = ClockParentSet(caller, (const msg_rclock13_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_CLOCK_PARENT_GET:
-            lenOut = sizeof(msg_tclock14_t);
-            status = ClockParentGet(caller, (const msg_rclock14_t*) in,
-                (msg_tclock14_t*) out);
-            break;
-        case COMMAND_CLOCK_GET_PERMISSIONS:
-            lenOut = sizeof(msg_tclock15_t);
-            status = ClockGetPermissions(caller, (const msg_rclock15_t*) in,
-                (msg_tclock15_t*) out);
-            break;
-        case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = ClockNegotiateProtocolVersion(caller,
-                (const msg_rclock16_t*) in, (const scmi_msg_status_t*) out);
+        switch(messageId)
+        {
+            case COMMAND_PROTOCOL_VERSION:
+                status = ClockProtocolVersion(caller,
+                    (const scmi_msg_header_t*) in, (msg_tclock0_t*) out);
+                break;
+            case COMMAND_PROTOCOL_ATTRIBUTES:
+                status = ClockProtocolAttributes(caller,
+                    (const scmi_msg_header_t*) in, (msg_tclock1_t*) out);
+                break;
+            case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
+                status = ClockProtocolMessageAttributes(caller,
+                    (const msg_rclock2_t*) in, (msg_tclock2_t*) out);
+                break;
+            case COMMAND_CLOCK_ATTRIBUTES:
+                status = ClockAttributes(caller, (const msg_rclock3_t*) in,
+                    (msg_tclock3_t*) out);
+                break;
+            case COMMAND_CLOCK_DESCRIBE_RATES:
+                status = ClockDescribeRates(caller, (const msg_rclock4_t*) in,
+                    (msg_tclock4_t*) out, &lenOut);
+                break;
+            case COMMAND_CLOCK_RATE_SET:
+                status = ClockRateSet(caller, (const msg_rclock5_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_CLOCK_RATE_GET:
+                status = ClockRateGet(caller, (const msg_rclock6_t*) in,
+                    (msg_tclock6_t*) out);
+                break;
+            case COMMAND_CLOCK_CONFIG_SET:
+                status = ClockConfigSet(caller, (const msg_rclock7_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_CLOCK_RATE_NOTIFY:
+                status = ClockRateNotify(caller, (const msg_rclock9_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_CLOCK_RATE_CHANGE_REQUESTED_NOTIFY:
+                status = ClockRateChangeRequestedNotify(caller,
+                    (const msg_rclock10_t*) in, (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_CLOCK_CONFIG_GET:
+                status = ClockConfigGet(caller, (const msg_rclock11_t*) in,
+                    (msg_tclock11_t*) out);
+                break;
+            case COMMAND_CLOCK_POSSIBLE_PARENTS_GET:
+                status = ClockPossibleParentsGet(caller,
+                    (const msg_rclock12_t*) in, (msg_tclock12_t*) out, &lenOut);
+                break;
+            case COMMAND_CLOCK_PARENT_SET:
+                status = ClockParentSet(caller, (const msg_rclock13_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_CLOCK_PARENT_GET:
+                status = ClockParentGet(caller, (const msg_rclock14_t*) in,
+                    (msg_tclock14_t*) out);
+                break;
+            case COMMAND_CLOCK_GET_PERMISSIONS:
+                status = ClockGetPermissions(caller, (const msg_rclock15_t*) in,
+                    (msg_tclock15_t*) out);
+                break;
+            case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
+                status = ClockNegotiateProtocolVersion(caller,
+                    (const msg_rclock16_t*) in, (const scmi_msg_status_t*) out);
+                break;
+            default:
+                status = SM_ERR_NOT_SUPPORTED;
+                break;
+        }
+    }
+
+    /* Update length */
+    caller->lenMsg = lenOut;
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Dispatch SCMI notifications                                              */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - msgId: Message ID to dispatch                                          */
+/* - trigger: Trigger data                                                  */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_ClockDispatchNotification(scmi_msg_id_t msgId,
+    const lmm_rpc_trigger_t *trigger)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Handle notifications */
+    switch(msgId.messageId)
+    {
+        case RPC_SCMI_NOTIFY_CLOCK_RATE_CHANGED:
+            status = ClockRateChanged(msgId, trigger);
             break;
         default:
             status = SM_ERR_NOT_SUPPORTED;
             break;
     }
 
-    /* Update length */
-    caller->lenMsg = lenOut;
-
     /* Return status */
     return status;
 }
@@ -520,6 +690,81 @@ int32_t RPC_SCMI_ClockDispatchReset(uint32_t lmId, uint32_t agentId,
     return ClockResetAgentConfig(lmId, agentId, permissionsReset);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Check if any clock rate change notification is enabled                   */
+/*--------------------------------------------------------------------------*/
+bool RPC_SCMI_ClockNotifyEnabled(void)
+{
+    uint32_t enabled = 0U;
+
+    /* Loop over agents */
+    for (uint32_t agentId = 0U; agentId < SM_SCMI_NUM_AGNT; agentId++)
+    {
+        for (uint32_t word = 0U; word < SCMI_DIRTY_WORDS(SM_NUM_CLOCK);
+            word++)
+        {
+            enabled |= s_clockNotify[agentId][word];
+        }
+    }
+
+    /* Return result */
+    return (enabled != 0U);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check for pending async clock rate changes                               */
+/*--------------------------------------------------------------------------*/
+bool RPC_SCMI_ClockAsyncPending(void)
+{
+    uint32_t agentId;
+
+    /* Return result */
+    return ClockAsyncGet(&agentId);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Execute a pending async clock rate change                                */
+/*--------------------------------------------------------------------------*/
+void RPC_SCMI_ClockAsyncDispatch(void)
+{
+    uint32_t agentId;
+
+    /* Get next request ready to execute */
+    if (ClockAsyncGet(&agentId))
+    {
+        clock_async_queue_t *queue = &s_asyncQueue[agentId];
+        const clock_async_t *req = &queue->req[queue->tail];
+        uint64_t lmRate = req->rate;
+        msg_dclock5_t out;
+
+        /* Set clock rate */
+        out.status = LMM_ClockRateSet(req->lmId, req->clockId, req->rate,
+            req->roundSel);
+
+        /* Get rate that was set */
+        if (out.status == SM_ERR_SUCCESS)
+        {
+            (void) LMM_ClockRateGet(req->lmId, req->clockId, &lmRate);
+        }
+
+        /* Queue delayed response */
+        if (req->resp)
+        {
+            out.clockId = req->clockId;
+            out.rate.upper = SM_UINT64_H(lmRate);
+            out.rate.lower = SM_UINT64_L(lmRate);
+
+            RPC_SCMI_P2aRespTxQ(agentId, req->header, (uint32_t*) &out,
+                sizeof(out));
+        }
+
+        /* Consume request */
+        queue->tail = (queue->tail + 1U) % CLOCK_MAX_PENDING;
+        queue->count--;
+        s_asyncLastAgent = agentId;
+    }
+}
+
 /*==========================================================================*/
 /* Custom Protocol Implementation                                           */
 /*==========================================================================*/
@@ -527,6 +772,7 @@ int32_t RPC_SCMI_ClockDispatchReset(uint32_t lmId, uint32_t agentId,
 /* Local variables */
 
 static uint32_t s_clockState[SM_NUM_CLOCK];
+static uint32_t s_clockDirty[SM_SCMI_NUM_AGNT][SCMI_DIRTY_WORDS(SM_NUM_CLOCK)];
 
 /* Local functions */
 
@@ -545,25 +791,14 @@ static int32_t ClockConfigUpdate(uint32_t lmId, uint32_t agentId,
 /* SCMI_ClockProtocolVersion(). See section 4.6.2.1 in the SCMI spec.       */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t ClockProtocolVersion(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tclock0_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return version */
-        out->version = PROTOCOL_VERSION;
-    }
+    /* Return version */
+    out->version = PROTOCOL_VERSION;
 
     /* Return status */
     return status;
@@ -589,27 +824,16 @@ static int32_t ClockProtocolVersion(const scmi_caller_t *caller,
 /* - CLOCK_PROTO_ATTR_NUM_CLOCKS() - Number of clocks                       */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t ClockProtocolAttributes(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tclock1_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return number of clocks, no async calls */
-        out->attributes
-            = CLOCK_PROTO_ATTR_MAX_PENDING(0UL)
-            | CLOCK_PROTO_ATTR_NUM_CLOCKS(SM_NUM_CLOCK);
-    }
+    /* Return number of clocks and async calls */
+    out->attributes
+        = CLOCK_PROTO_ATTR_MAX_PENDING(CLOCK_MAX_PENDING)
+        | CLOCK_PROTO_ATTR_NUM_CLOCKS(SM_NUM_CLOCK);
 
     /* Return status */
     return status;
@@ -634,33 +858,20 @@ static int32_t ClockProtocolAttributes(const scmi_caller_t *caller,
 /*   use.                                                                   */
 /* - SM_ERR_NOT_FOUND: if the message identified by messageId is invalid    */
 /*   or not provided by this platform implementation.                       */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t ClockProtocolMessageAttributes(const scmi_caller_t *caller,
     const msg_rclock2_t *in, msg_tclock2_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
+    /* Always zero */
+    out->attributes = 0U;
 
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
+    /* Is message supported ? */
+    if (!RPC_SCMI_A2pMsgSupported(s_clockMsgDesc,
+        ARRAY_SIZE(s_clockMsgDesc), in->messageId))
     {
-        uint32_t mask = COMMAND_SUPPORTED_MASK;
-
-        /* Always zero */
-        out->attributes = 0U;
-
-        /* Is message supported ? */
-        if ((in->messageId >= 32U) || (((mask >> in->messageId)
-            & 0x1U) == 0U))
-        {
-            status = SM_ERR_NOT_FOUND;
-        }
+        status = SM_ERR_NOT_FOUND;
     }
 
     /* Return status */
@@ -731,7 +942,6 @@ static int32_t ClockProtocolMessageAttributes(const scmi_caller_t *caller,
 /* - SM_ERR_SUCCESS: if valid clock attributes are returned.                */
 /* - SM_ERR_NOT_FOUND: if clockId does not point to a valid clock           */
 /*   device.                                                                */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t ClockAttributes(const scmi_caller_t *caller,
     const msg_rclock3_t *in, msg_tclock3_t *out)
@@ -740,12 +950,6 @@ static int32_t ClockAttributes(const scmi_caller_t *caller,
     const uint8_t *nameAddr = (const uint8_t*) "";
     bool enabled;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check clock */
     if ((status == SM_ERR_SUCCESS) && (in->clockId >= SM_NUM_CLOCK))
     {
@@ -771,10 +975,10 @@ static int32_t ClockAttributes(const scmi_caller_t *caller,
         uint32_t mux;
         uint32_t numMuxes;
 
-        /* No notifications */
+        /* Rate change notifications */
         out->attributes
-            = CLOCK_ATTR_CHANGE(0UL)
-            | CLOCK_ATTR_CHANGE_REQ(0UL)
+            = CLOCK_ATTR_CHANGE(1UL)
+            | CLOCK_ATTR_CHANGE_REQ(1UL)
             | CLOCK_ATTR_EXT_NAME(0UL)
             | CLOCK_ATTR_EXT_CONFIG(0UL);
 
@@ -782,11 +986,12 @@ static int32_t ClockAttributes(const scmi_caller_t *caller,
         if (LMM_ClockMuxGet(caller->lmId, in->clockId, 0U, &mux,
             &numMuxes) == SM_ERR_SUCCESS)
         {
-            out->attributes |= CLOCK_ATTR_PARENT(1UL);
+            out->attributes |= CLOCK_ATTR_PARENT(1UL)
+                | CLOCK_ATTR_EXT_CONFIG(1UL);
         }
 
         /* Restricted? */
-        if ((g_scmiAgentConfig[caller->agentId].clkPerms[in->clockId]
+        if ((SM_SCMI_PERM(g_scmiClkPerms, caller->agentId, in->clockId)
             < SM_SCMI_PERM_EXCLUSIVE))
         {
             out->attributes |= CLOCK_ATTR_RESTRICTED(1UL);
@@ -856,7 +1061,6 @@ static int32_t ClockAttributes(const scmi_caller_t *caller,
 /* - SM_ERR_NOT_FOUND: if the clock identified by clockId does not          */
 /*   exist.                                                                 */
 /* - SM_ERR_OUT_OF_RANGE: if the rate_index is outside of valid range.      */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t ClockDescribeRates(const scmi_caller_t *caller,
     const msg_rclock4_t *in, msg_tclock4_t *out, uint32_t *len)
@@ -864,12 +1068,6 @@ static int32_t ClockDescribeRates(const scmi_caller_t *caller,
     int32_t status = SM_ERR_SUCCESS;
     dev_sm_clock_range_t range = {0ULL, 0ULL, 0ULL};
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check clock */
     if ((status == SM_ERR_SUCCESS) && (in->clockId >= SM_NUM_CLOCK))
     {
@@ -949,6 +1147,13 @@ static int32_t ClockDescribeRates(const scmi_caller_t *caller,
 /* SCMI_ClockRateSet(). Requires access greater than or equal to            */
 /* EXCLUSIVE. See section 4.6.2.7 in the SCMI spec.                         */
 /*                                                                          */
+/* Async requests are queued per agent and executed by the RPC handler      */
+/* after the response is sent. Completion is reported with the              */
+/* CLOCK_RATE_SET_COMPLETE delayed response on the agent's P2A channel.     */
+/*                                                                          */
+/* If enabled with CLOCK_CONFIG_SET, the rate is set using the parent and   */
+/* divider giving the best rate under the rounding rule.                    */
+/*                                                                          */
 /*  Access macros:                                                          */
 /* - CLOCK_RATE_FLAGS_ROUND() - Round up/down                               */
 /* - CLOCK_RATE_FLAGS_NO_RESP() - Ignore delayed response                   */
@@ -969,7 +1174,8 @@ static int32_t ClockDescribeRates(const scmi_caller_t *caller,
 /*   of pending asynchronous clock rate changes supported by the platform.  */
 /* - SM_ERR_DENIED: if the clock rate cannot be set because of              */
 /*   dependencies, e.g. if there are other users of the clock.              */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
+/* - SM_ERR_NOT_SUPPORTED: if an async request needs a delayed response     */
+/*   and the agent has no notification channel to send it on.               */
 /*--------------------------------------------------------------------------*/
 static int32_t ClockRateSet(const scmi_caller_t *caller,
     const msg_rclock5_t *in, const scmi_msg_status_t *out)
@@ -978,12 +1184,6 @@ static int32_t ClockRateSet(const scmi_caller_t *caller,
     bool async = CLOCK_RATE_FLAGS_ASYNC(in->flags) != 0U;
     uint32_t roundSel = CLOCK_RATE_FLAGS_ROUND(in->flags);
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check clock */
     if ((status == SM_ERR_SUCCESS) && (in->clockId >= SM_NUM_CLOCK))
     {
@@ -996,19 +1196,28 @@ static int32_t ClockRateSet(const scmi_caller_t *caller,
         roundSel = CLOCK_ROUND_AUTO;
     }
 
+    /* Select best parent if enabled by the agent */
+    if ((status == SM_ERR_SUCCESS)
+        && ((s_clockParentSel[caller->agentId][in->clockId / 32U]
+        & BIT32(in->clockId)) != 0U))
+    {
+        roundSel |= DEV_SM_CLOCK_ROUND_PARENT;
+    }
+
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].clkPerms[in->clockId]
+        && (SM_SCMI_PERM(g_scmiClkPerms, caller->agentId, in->clockId)
         < SM_SCMI_PERM_EXCLUSIVE))
     {
         status = SM_ERR_DENIED;
     }
 
-    /* Check for async request */
-    if ((status == SM_ERR_SUCCESS) && async)
+    /* Check delayed response can be sent */
+    if ((status == SM_ERR_SUCCESS) && async
+        && (CLOCK_RATE_FLAGS_NO_RESP(in->flags) == 0U)
+        && !RPC_SCMI_P2aTxQValid(caller->agentId, SCMI_NOTIFY_Q))
     {
-        /* Support sync only */
-        status = SM_ERR_INVALID_PARAMETERS;
+        status = SM_ERR_NOT_SUPPORTED;
     }
 
     /* Set clock rate */
@@ -1017,8 +1226,44 @@ static int32_t ClockRateSet(const scmi_caller_t *caller,
         uint64_t lmRate = (((uint64_t) in->rate.upper) << 32U)
             | (uint64_t) in->rate.lower;
 
-        status = LMM_ClockRateSet(caller->lmId, in->clockId, lmRate,
-            roundSel);
+        /* Revert on agent reset */
+        SCMI_DIRTY_SET(s_clockDirty[caller->agentId], in->clockId);
+
+        if (async)
+        {
+            clock_async_queue_t *queue = &s_asyncQueue[caller->agentId];
+
+            /* Check queue space */
+            if (queue->count >= CLOCK_MAX_PENDING)
+            {
+                status = SM_ERR_BUSY;
+            }
+            else
+            {
+                clock_async_t *req = &queue->req[(queue->tail
+                    + queue->count) % CLOCK_MAX_PENDING];
+
+                /* Queue request, executed after the response is sent */
+                req->header = caller->header;
+                req->lmId = caller->lmId;
+                req->clockId = in->clockId;
+                req->roundSel = roundSel;
+                req->rate = lmRate;
+                req->resp = CLOCK_RATE_FLAGS_NO_RESP(in->flags) == 0U;
+                queue->count++;
+
+                /* Inform other agents of the request */
+                ClockRateChangeRequested(caller, in->clockId, &in->rate);
+            }
+        }
+        else
+        {
+            /* Inform other agents of the request */
+            ClockRateChangeRequested(caller, in->clockId, &in->rate);
+
+            status = LMM_ClockRateSet(caller->lmId, in->clockId, lmRate,
+                roundSel);
+        }
     }
 
     /* Return status */
@@ -1044,19 +1289,12 @@ static int32_t ClockRateSet(const scmi_caller_t *caller,
 /*   exist.                                                                 */
 /* - SM_ERR_INVALID_PARAMETERS: if power/clock conditions not met to        */
 /*   allow getting the rate.                                                */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t ClockRateGet(const scmi_caller_t *caller,
     const msg_rclock6_t *in, msg_tclock6_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check clock */
     if ((status == SM_ERR_SUCCESS) && (in->clockId >= SM_NUM_CLOCK))
     {
@@ -1106,6 +1344,9 @@ static int32_t ClockRateGet(const scmi_caller_t *caller,
 /* SCMI_ClockConfigSet(). Requires access greater than or equal to SET.     */
 /* See section 4.6.2.9 in the SCMI spec.                                    */
 /*                                                                          */
+/* Vendor extended config type 0x80 enables (1) or disables (0) best        */
+/* parent selection by CLOCK_RATE_SET for this agent and clock.             */
+/*                                                                          */
 /*  Access macros:                                                          */
 /* - CLOCK_CONFIG_SET_EXT_CONFIG() - Extended config type                   */
 /* - CLOCK_CONFIG_SET_ENABLE() - Enable/Disable                             */
@@ -1129,40 +1370,65 @@ static int32_t ClockConfigSet(const scmi_caller_t *caller,
     uint32_t ext = CLOCK_CONFIG_SET_EXT_CONFIG(in->attributes);
     uint32_t enable = CLOCK_CONFIG_SET_ENABLE(in->attributes);
 
-    /* Check request length */
-    if (caller->lenCopy < (sizeof(*in) - sizeof(uint32_t)))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check clock */
     if ((status == SM_ERR_SUCCESS) && (in->clockId >= SM_NUM_CLOCK))
     {
         status = SM_ERR_NOT_FOUND;
     }
 
+    /* Extended config value is optional in the message */
+    if ((status == SM_ERR_SUCCESS) && (ext != CLOCK_EXT_CONFIG_NONE)
+        && (caller->lenCopy < sizeof(*in)))
+    {
+        status = SM_ERR_PROTOCOL_ERROR;
+    }
+
     /* Check extended config */
-    if ((status == SM_ERR_SUCCESS) && (ext != 0U))
+    if ((status == SM_ERR_SUCCESS) && (ext != CLOCK_EXT_CONFIG_NONE))
     {
-        status = SM_ERR_INVALID_PARAMETERS;
+        uint32_t mux;
+        uint32_t numMuxes;
+
+        /* Parent selection requires parents */
+        if ((ext != CLOCK_EXT_CONFIG_PARENT_SEL)
+            || (in->extendedConfigVal > 1U)
+            || (LMM_ClockMuxGet(caller->lmId, in->clockId, 0U, &mux,
+            &numMuxes) != SM_ERR_SUCCESS))
+        {
+            status = SM_ERR_INVALID_PARAMETERS;
+        }
     }
 
-    /* Check extended update */
-    if ((status == SM_ERR_SUCCESS) && (enable > 1U))
+    /* Check extended update, 3 leaves enable unchanged */
+    if ((status == SM_ERR_SUCCESS) && (enable > 1U)
+        && ((enable != 3U) || (ext == CLOCK_EXT_CONFIG_NONE)))
     {
         status = SM_ERR_INVALID_PARAMETERS;
     }
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].clkPerms[in->clockId]
+        && (SM_SCMI_PERM(g_scmiClkPerms, caller->agentId, in->clockId)
         < SM_SCMI_PERM_SET))
     {
         status = SM_ERR_DENIED;
     }
 
+    /* Update parent selection */
+    if ((status == SM_ERR_SUCCESS) && (ext == CLOCK_EXT_CONFIG_PARENT_SEL))
+    {
+        if (in->extendedConfigVal != 0U)
+        {
+            SCMI_DIRTY_SET(s_clockParentSel[agentId], in->clockId);
+        }
+        else
+        {
+            SCMI_DIRTY_CLR(s_clockParentSel[agentId], in->clockId);
+        }
+    }
+
     /* Update tracking */
-    if (status == SM_ERR_SUCCESS)
+    if ((status == SM_ERR_SUCCESS) && (enable <= 1U))
     {
         status = ClockConfigUpdate(caller->lmId, agentId, in->clockId,
             enable == 1U);
@@ -1172,6 +1438,144 @@ static int32_t ClockConfigSet(const scmi_caller_t *caller,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Configure clock rate change notification                                 */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - in->clockId: Identifier for the clock device                           */
+/* - in->notifyEnable: Notification flags:                                  */
+/*   Bits[31:1] Reserved, must be zero.                                     */
+/*   Bit[0] Notify enable. This bit must be set to 1 if an agent wants to   */
+/*   receive CLOCK_RATE_CHANGED                                             */
+/*   notifications, and set to 0 otherwise.                                 */
+/*                                                                          */
+/* Process the CLOCK_RATE_NOTIFY message. Platform handler for              */
+/* SCMI_ClockRateNotify(). Requires access greater than or equal to         */
+/* NOTIFY. See section 4.6.2.12 in the SCMI spec.                           */
+/*                                                                          */
+/*  Access macros:                                                          */
+/* - CLOCK_NOTIFY_ENABLE() - Notify enable                                  */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_SUCCESS: if the notification state was successfully updated.    */
+/* - SM_ERR_NOT_FOUND: if clockId does not point to a valid clock device.   */
+/* - SM_ERR_DENIED: if the calling agent is not permitted to request the    */
+/*   notification.                                                          */
+/* - SM_ERR_INVALID_PARAMETERS: if notifyEnable specifies values that are   */
+/*   either illegal or incorrect.                                           */
+/*--------------------------------------------------------------------------*/
+static int32_t ClockRateNotify(const scmi_caller_t *caller,
+    const msg_rclock9_t *in, const scmi_msg_status_t *out)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check clock */
+    if ((status == SM_ERR_SUCCESS) && (in->clockId >= SM_NUM_CLOCK))
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Check permissions */
+    if ((status == SM_ERR_SUCCESS)
+        && (SM_SCMI_PERM(g_scmiClkPerms, caller->agentId, in->clockId)
+        < SM_SCMI_PERM_NOTIFY))
+    {
+        status = SM_ERR_DENIED;
+    }
+
+    /* Check flags */
+    if ((status == SM_ERR_SUCCESS) && ((in->notifyEnable & ~1U) != 0U))
+    {
+        status = SM_ERR_INVALID_PARAMETERS;
+    }
+
+    /* Record notification enable */
+    if (status == SM_ERR_SUCCESS)
+    {
+        if (CLOCK_NOTIFY_ENABLE(in->notifyEnable) != 0U)
+        {
+            SCMI_DIRTY_SET(s_clockNotify[caller->agentId], in->clockId);
+        }
+        else
+        {
+            SCMI_DIRTY_CLR(s_clockNotify[caller->agentId], in->clockId);
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Configure clock rate change requested notification                       */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - in->clockId: Identifier for the clock device                           */
+/* - in->notifyEnable: Notification flags:                                  */
+/*   Bits[31:1] Reserved, must be zero.                                     */
+/*   Bit[0] Notify enable. This bit must be set to 1 if an agent wants to   */
+/*   receive CLOCK_RATE_CHANGE_REQUESTED                                    */
+/*   notifications, and set to 0 otherwise.                                 */
+/*                                                                          */
+/* Process the CLOCK_RATE_CHANGE_REQUESTED_NOTIFY message. Platform         */
+/* handler for SCMI_ClockRateChangeRequestedNotify(). Requires access       */
+/* greater than or equal to NOTIFY. See section 4.6.2.13 in the SCMI spec.  */
+/*                                                                          */
+/*  Access macros:                                                          */
+/* - CLOCK_NOTIFY_ENABLE() - Notify enable                                  */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_SUCCESS: if the notification state was successfully updated.    */
+/* - SM_ERR_NOT_FOUND: if clockId does not point to a valid clock device.   */
+/* - SM_ERR_DENIED: if the calling agent is not permitted to request the    */
+/*   notification.                                                          */
+/* - SM_ERR_INVALID_PARAMETERS: if notifyEnable specifies values that are   */
+/*   either illegal or incorrect.                                           */
+/*--------------------------------------------------------------------------*/
+static int32_t ClockRateChangeRequestedNotify(const scmi_caller_t *caller,
+    const msg_rclock10_t *in, const scmi_msg_status_t *out)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check clock */
+    if ((status == SM_ERR_SUCCESS) && (in->clockId >= SM_NUM_CLOCK))
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Check permissions */
+    if ((status == SM_ERR_SUCCESS)
+        && (SM_SCMI_PERM(g_scmiClkPerms, caller->agentId, in->clockId)
+        < SM_SCMI_PERM_NOTIFY))
+    {
+        status = SM_ERR_DENIED;
+    }
+
+    /* Check flags */
+    if ((status == SM_ERR_SUCCESS) && ((in->notifyEnable & ~1U) != 0U))
+    {
+        status = SM_ERR_INVALID_PARAMETERS;
+    }
+
+    /* Record notification enable */
+    if (status == SM_ERR_SUCCESS)
+    {
+        if (CLOCK_NOTIFY_ENABLE(in->notifyEnable) != 0U)
+        {
+            SCMI_DIRTY_SET(s_clockReqNotify[caller->agentId], in->clockId);
+        }
+        else
+        {
+            SCMI_DIRTY_CLR(s_clockReqNotify[caller->agentId], in->clockId);
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Get clock configuration                                                  */
 /*                                                                          */
@@ -1208,7 +1612,6 @@ static int32_t ClockConfigSet(const scmi_caller_t *caller,
 /* - SM_ERR_INVALID_PARAMETERS, if the input attributes flag specifies      */
 /*   unsupported or invalid configurations. Might also be returned if       */
 /*   power/clock conditions not met to allow getting the configuration.     */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t ClockConfigGet(const scmi_caller_t *caller,
     const msg_rclock11_t *in, msg_tclock11_t *out)
@@ -1217,12 +1620,6 @@ static int32_t ClockConfigGet(const scmi_caller_t *caller,
     uint32_t ext = CLOCK_CONFIG_FLAGS_EXT_CONFIG(in->flags);
     bool enabled;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check clock */
     if ((status == SM_ERR_SUCCESS) && (in->clockId >= SM_NUM_CLOCK))
     {
@@ -1230,7 +1627,8 @@ static int32_t ClockConfigGet(const scmi_caller_t *caller,
     }
 
     /* Check extended config */
-    if ((status == SM_ERR_SUCCESS) && (ext != 0U))
+    if ((status == SM_ERR_SUCCESS) && (ext != CLOCK_EXT_CONFIG_NONE)
+        && (ext != CLOCK_EXT_CONFIG_PARENT_SEL))
     {
         status = SM_ERR_INVALID_PARAMETERS;
     }
@@ -1249,6 +1647,14 @@ static int32_t ClockConfigGet(const scmi_caller_t *caller,
         out->attributes = 0U;
         out->config = CLOCK_CONFIG_GET_ENABLE(getEnabled);
         out->extendedConfigVal = 0U;
+
+        /* Return parent selection */
+        if ((ext == CLOCK_EXT_CONFIG_PARENT_SEL)
+            && ((s_clockParentSel[caller->agentId][in->clockId / 32U]
+            & BIT32(in->clockId)) != 0U))
+        {
+            out->extendedConfigVal = 1U;
+        }
     }
 
     /* Return status */
@@ -1290,7 +1696,6 @@ static int32_t ClockConfigGet(const scmi_caller_t *caller,
 /* - SM_ERR_DENIED: if the calling agent is not allowed to get the          */
 /*   possible parents.                                                      */
 /*                                                                          */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t ClockPossibleParentsGet(const scmi_caller_t *caller,
     const msg_rclock12_t *in, msg_tclock12_t *out, uint32_t *len)
@@ -1298,12 +1703,6 @@ static int32_t ClockPossibleParentsGet(const scmi_caller_t *caller,
     int32_t status = SM_ERR_SUCCESS;
     uint32_t numMuxes = 0U;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check clock */
     if ((status == SM_ERR_SUCCESS) && (in->clockId >= SM_NUM_CLOCK))
     {
@@ -1331,7 +1730,7 @@ static int32_t ClockPossibleParentsGet(const scmi_caller_t *caller,
         uint32_t index;
 
         out->numParentsFlags = 0U;
-        for (index = 0U; index < CLOCK_MAX_PARENTS; index++)
+        for (index = 0U; index < CLOCK_NUM_PARENTS(caller); index++)
         {
             uint32_t mux;
             uint32_t temp;
@@ -1394,19 +1793,12 @@ static int32_t ClockPossibleParentsGet(const scmi_caller_t *caller,
 /* - SM_ERR_NOT_SUPPORTED: if the request is not supported.                 */
 /* - SM_ERR_DENIED: if the calling agent is not allowed to set the          */
 /*   parent.                                                                */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t ClockParentSet(const scmi_caller_t *caller,
     const msg_rclock13_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check clock */
     if ((status == SM_ERR_SUCCESS) && (in->clockId >= SM_NUM_CLOCK))
     {
@@ -1415,7 +1807,7 @@ static int32_t ClockParentSet(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].clkPerms[in->clockId]
+        && (SM_SCMI_PERM(g_scmiClkPerms, caller->agentId, in->clockId)
         < SM_SCMI_PERM_EXCLUSIVE))
     {
         status = SM_ERR_DENIED;
@@ -1424,6 +1816,9 @@ static int32_t ClockParentSet(const scmi_caller_t *caller,
     /* Set clock parent */
     if (status == SM_ERR_SUCCESS)
     {
+        /* Revert on agent reset */
+        SCMI_DIRTY_SET(s_clockDirty[caller->agentId], in->clockId);
+
         status = LMM_ClockParentSet(caller->lmId, in->clockId,
             in->parentId);
     }
@@ -1451,19 +1846,12 @@ static int32_t ClockParentSet(const scmi_caller_t *caller,
 /* - SM_ERR_NOT_SUPPORTED: if the request is not supported.                 */
 /* - SM_ERR_DENIED: f the calling agent is not allowed to get the           */
 /*   parent.                                                                */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t ClockParentGet(const scmi_caller_t *caller,
     const msg_rclock14_t *in, msg_tclock14_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check clock */
     if ((status == SM_ERR_SUCCESS) && (in->clockId >= SM_NUM_CLOCK))
     {
@@ -1516,19 +1904,12 @@ static int32_t ClockParentGet(const scmi_caller_t *caller,
 /* - SM_ERR_NOT_FOUND: if the clock identified by clockId does not          */
 /*   exist.                                                                 */
 /* - SM_ERR_NOT_SUPPORTED: if the request is not supported.                 */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t ClockGetPermissions(const scmi_caller_t *caller,
     const msg_rclock15_t *in, msg_tclock15_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check clock */
     if ((status == SM_ERR_SUCCESS) && (in->clockId >= SM_NUM_CLOCK))
     {
@@ -1542,14 +1923,14 @@ static int32_t ClockGetPermissions(const scmi_caller_t *caller,
         out->permissions = 0U;
 
         /* Enable? */
-        if ((g_scmiAgentConfig[caller->agentId].clkPerms[in->clockId]
+        if ((SM_SCMI_PERM(g_scmiClkPerms, caller->agentId, in->clockId)
             >= SM_SCMI_PERM_SET))
         {
             out->permissions |= CLOCK_PERM_STATE(1UL);
         }
 
         /* Set parent/rate? */
-        if ((g_scmiAgentConfig[caller->agentId].clkPerms[in->clockId]
+        if ((SM_SCMI_PERM(g_scmiClkPerms, caller->agentId, in->clockId)
             >= SM_SCMI_PERM_EXCLUSIVE))
         {
             out->permissions |= CLOCK_PERM_RATE(1UL)
@@ -1578,19 +1959,12 @@ static int32_t ClockGetPermissions(const scmi_caller_t *caller,
 /*   successful return of this command must comply with the negotiated      */
 /*   version.                                                               */
 /* - SM_ERR_NOT_SUPPORTED: if the protocol version is not supported.        */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t ClockNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rclock16_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check major version */
     if ((status == SM_ERR_SUCCESS) && (SCMI_VER_MAJOR(in->version)
         == SCMI_VER_MAJOR(PROTOCOL_VERSION)))
@@ -1610,6 +1984,100 @@ static int32_t ClockNegotiateProtocolVersion(const scmi_caller_t *caller,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Send clock rate changed event                                            */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - msgId: Message ID to dispatch                                          */
+/* - trigger: Trigger data                                                  */
+/*--------------------------------------------------------------------------*/
+static int32_t ClockRateChanged(scmi_msg_id_t msgId,
+    const lmm_rpc_trigger_t *trigger)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    uint32_t clockId = trigger->parm[0];
+
+    /* Check clock */
+    if (clockId >= SM_NUM_CLOCK)
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+    else
+    {
+        /* Loop over all agents */
+        for (uint32_t dstAgent = 0U; dstAgent < SM_SCMI_NUM_AGNT;
+            dstAgent++)
+        {
+            bool enable = (s_clockNotify[dstAgent][clockId / 32U]
+                & BIT32(clockId)) != 0U;
+
+            /* Agent belong to instance? */
+            if ((g_scmiAgentConfig[dstAgent].scmiInst == trigger->rpcInst)
+                && enable)
+            {
+                msg_rclock32_t out;
+
+                /* Fill in data */
+                out.agentId = 0U;
+                out.clockId = clockId;
+                out.rate.lower = trigger->parm[1];
+                out.rate.upper = trigger->parm[2];
+
+                /* Queue notification (coalesced per clock) */
+                RPC_SCMI_P2aTxQ(dstAgent, msgId, (uint32_t*) &out,
+                    sizeof(out), SCMI_NOTIFY_Q, clockId);
+            }
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Send clock rate change requested event                                   */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info of the requesting agent                            */
+/* - clockId: Identifier for the clock device                               */
+/* - rate: Requested clock rate                                             */
+/*                                                                          */
+/* Rates are set per SCMI instance, so only the other agents of the         */
+/* caller's instance are informed.                                          */
+/*--------------------------------------------------------------------------*/
+static void ClockRateChangeRequested(const scmi_caller_t *caller,
+    uint32_t clockId, const clock_rate_t *rate)
+{
+    scmi_msg_id_t msgId =
+    {
+        .protocolId = SCMI_PROTOCOL_CLOCK,
+        .messageId = RPC_SCMI_NOTIFY_CLOCK_RATE_CHANGE_REQUESTED
+    };
+
+    /* Loop over all agents */
+    for (uint32_t dstAgent = 0U; dstAgent < SM_SCMI_NUM_AGNT; dstAgent++)
+    {
+        bool enable = (s_clockReqNotify[dstAgent][clockId / 32U]
+            & BIT32(clockId)) != 0U;
+
+        /* Other agent of the same instance? */
+        if ((g_scmiAgentConfig[dstAgent].scmiInst == caller->scmiInst)
+            && (dstAgent != caller->agentId) && enable)
+        {
+            msg_rclock32_t out;
+
+            /* Fill in data */
+            out.agentId = caller->instAgentId;
+            out.clockId = clockId;
+            out.rate = *rate;
+
+            /* Queue notification (coalesced per clock) */
+            RPC_SCMI_P2aTxQ(dstAgent, msgId, (uint32_t*) &out,
+                sizeof(out), SCMI_NOTIFY_Q, clockId);
+        }
+    }
+}
+
 /*--------------------------------------------------------------------------*/
 /* Reset agent configuration                                                */
 /*                                                                          */
@@ -1617,15 +2085,36 @@ static int32_t ClockNegotiateProtocolVersion(const scmi_caller_t *caller,
 /* - lmId: LM to reset                                                      */
 /* - agentId: Message ID to dispatch                                        */
 /* - permissionsReset: True to reset permissions                            */
+/*                                                                          */
+/* Only clocks the agent enabled or set the rate/parent of (dirty) are      */
+/* disabled and reverted to boot defaults. Clocks changed by other means    */
+/* keep their current state. Notifications and parent selection are         */
+/* cleared for all clocks.                                                  */
 /*--------------------------------------------------------------------------*/
 static int32_t ClockResetAgentConfig(uint32_t lmId, uint32_t agentId,
     bool permissionsReset)
 {
     int32_t status = SM_ERR_SUCCESS;
+    uint32_t clockId = 0U;
 
-    /* Loop over all clocks */
-    for (uint32_t clockId = 0U; clockId < SM_NUM_CLOCK; clockId++)
+    /* Disable notifications and parent selection */
+    for (uint32_t word = 0U; word < SCMI_DIRTY_WORDS(SM_NUM_CLOCK); word++)
     {
+        s_clockNotify[agentId][word] = 0U;
+        s_clockReqNotify[agentId][word] = 0U;
+        s_clockParentSel[agentId][word] = 0U;
+    }
+
+    /* Drop pending async rate changes */
+    s_asyncQueue[agentId].tail = 0U;
+    s_asyncQueue[agentId].count = 0U;
+
+    /* Loop over clocks changed by the agent */
+    while (RPC_SCMI_DirtyNext(s_clockDirty[agentId], SM_NUM_CLOCK,
+        &clockId))
+    {
+        bool reverted = true;
+
         /* Disable clock */
         if ((s_clockState[clockId] & (1UL << agentId)) != 0U)
         {
@@ -1633,18 +2122,63 @@ static int32_t ClockResetAgentConfig(uint32_t lmId, uint32_t agentId,
                 false);
         }
 
-        /* Reset rate */
-        if (g_scmiAgentConfig[agentId].clkPerms[clockId]
+        /* Reset rate, retry on next reset if still enabled by others */
+        if (SM_SCMI_PERM(g_scmiClkPerms, agentId, clockId)
             >= SM_SCMI_PERM_EXCLUSIVE)
         {
-            (void) LMM_ClockReset(lmId, clockId);
+            reverted = (LMM_ClockReset(lmId, clockId) != SM_ERR_BUSY);
         }
+
+        if (reverted)
+        {
+            SCMI_DIRTY_CLR(s_clockDirty[agentId], clockId);
+        }
+        clockId++;
     }
 
     /* Return status */
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get next agent with an async rate change ready to execute                */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - agentId: Pointer to return the agent                                   */
+/*                                                                          */
+/* Agents are served round-robin. A request needing a delayed response is   */
+/* held back until the agent's P2A queue has space for it.                  */
+/*                                                                          */
+/* Returns true if a request is ready.                                      */
+/*--------------------------------------------------------------------------*/
+static bool ClockAsyncGet(uint32_t *agentId)
+{
+    bool rtn = false;
+
+    /* Loop over agents starting after the last one served */
+    for (uint32_t idx = 1U; idx <= SM_SCMI_NUM_AGNT; idx++)
+    {
+        uint32_t agent = (s_asyncLastAgent + idx) % SM_SCMI_NUM_AGNT;
+        const clock_async_queue_t *queue = &s_asyncQueue[agent];
+
+        if (queue->count != 0U)
+        {
+            /* Delayed responses need space in the notify queue */
+            if ((!queue->req[queue->tail].resp)
+                || (!RPC_SCMI_P2aTxQFull(agent, sizeof(msg_dclock5_t),
+                SCMI_NOTIFY_Q)))
+            {
+                *agentId = agent;
+                rtn = true;
+                break;
+            }
+        }
+    }
+
+    /* Return result */
+    return rtn;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Aggregate and update the clock enable                                    */
 /*                                                                          */
@@ -1660,28 +2194,27 @@ static int32_t ClockConfigUpdate(uint32_t lmId, uint32_t agentId,
     uint32_t scmiInst = g_scmiAgentConfig[agentId].scmiInst;
     uint32_t firstAgent = g_scmiConfig[scmiInst].firstAgent;
     uint32_t numAgents = g_scmiConfig[scmiInst].numAgents;
-    uint32_t mask;
-    uint32_t clockState;
-    bool clockEnable;
+    uint32_t mask = ((1UL << numAgents) - 1UL) << firstAgent;
+    uint32_t clockEnable = 0U;
+    int32_t status;
 
-    /* Record state of clock by agent */
+    /* Revert on agent reset */
     if (enable)
     {
-        /* Mark as enabled */
-        s_clockState[clockId] |= (1UL << agentId);
-    }
-    else
-    {
-        /* Mark as disabled */
-        s_clockState[clockId] &= ~(1UL << agentId);
+        SCMI_DIRTY_SET(s_clockDirty[agentId], clockId);
     }
 
-    /* Extract enable */
-    mask = ((1UL << numAgents) - 1UL) << firstAgent;
-    clockState = s_clockState[clockId] & mask;
-    clockEnable = (clockState != 0U);
+    /* Record state of clock by agent and aggregate over the instance */
+    status = LMM_VoteBitSet(&s_clockState[clockId], mask, agentId, enable,
+        LMM_VOTE_OR, &clockEnable, NULL);
 
     /* Inform LMM of clock state, LMM will check if changed */
-    return LMM_ClockEnable(lmId, clockId, clockEnable);
+    if (status == SM_ERR_SUCCESS)
+    {
+        status = LMM_ClockEnable(lmId, clockId, clockEnable != 0U);
+    }
+
+    /* Return status */
+    return status;
 }
 
@@ -52,6 +52,18 @@
 
 #include "rpc_scmi.h"
 
+/* Defines */
+
+/*!
+ * @name SCMI clock notification message IDs
+ */
+/** @{ */
+/*! Clock rate changed */
+#define RPC_SCMI_NOTIFY_CLOCK_RATE_CHANGED            0x0U
+/*! Clock rate change requested */
+#define RPC_SCMI_NOTIFY_CLOCK_RATE_CHANGE_REQUESTED  0x1U
+/** @} */
+
 /* Functions */
 
 /*!
@@ -78,6 +90,24 @@
 int32_t RPC_SCMI_ClockDispatchCommand(scmi_caller_t *caller,
     uint32_t messageId);
 
+/*!
+ * Dispatch clock protocol notification.
+ *
+ * @param[in]     msgId       Message to send
+ * @param[in]     trigger     Data associated with message
+ *
+ * This function requests the clock protocol send the requested notification
+ * to agents that requested it.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_INVALID_PARAMETERS if \a messageId isn't supported
+ * - others returned by queuing functions
+ */
+int32_t RPC_SCMI_ClockDispatchNotification(scmi_msg_id_t msgId,
+    const lmm_rpc_trigger_t *trigger);
+
 /*!
  * Dispatch SCMI clock protocol reset.
  *
@@ -96,6 +126,34 @@ int32_t RPC_SCMI_ClockDispatchCommand(scmi_caller_t *caller,
 int32_t RPC_SCMI_ClockDispatchReset(uint32_t lmId, uint32_t agentId,
     bool permissionsReset);
 
+/*!
+ * Check if any clock rate change notification is enabled.
+ *
+ * @return Returns true if any agent enabled a CLOCK_RATE_CHANGED
+ *         notification.
+ */
+bool RPC_SCMI_ClockNotifyEnabled(void);
+
+/*!
+ * Check for pending async clock rate changes.
+ *
+ * A request needing a delayed response is only reported once there is
+ * space in the agent's P2A queue for the response.
+ *
+ * @return Returns true if a rate change is ready to execute.
+ */
+bool RPC_SCMI_ClockAsyncPending(void);
+
+/*!
+ * Execute a pending async clock rate change.
+ *
+ * This function executes one async CLOCK_RATE_SET request queued by an
+ * agent and queues the CLOCK_RATE_SET_COMPLETE delayed response unless the
+ * agent asked for none. Agents are served round-robin. Called from the
+ * SCMI RPC handler once no commands are pending.
+ */
+void RPC_SCMI_ClockAsyncDispatch(void);
+
 /** @} */
 
 #endif /* RPC_SCMI_CLOCK_H */
@@ -60,3 +60,93 @@ const scmi_config_t g_scmiConfig[SM_NUM_SCMI] =
     SM_SCMI_CONFIG_DATA
 };
 
+const scmi_perm_t g_scmiBasePerms[SM_NUM_BASE] =
+{
+    SM_SCMI_BASE_PERMS_DATA
+};
+
+const scmi_perm_t g_scmiPdPerms[SM_NUM_POWER] =
+{
+    SM_SCMI_PD_PERMS_DATA
+};
+
+const scmi_perm_t g_scmiPerfPerms[SM_NUM_PERF] =
+{
+    SM_SCMI_PERF_PERMS_DATA
+};
+
+const scmi_perm_t g_scmiClkPerms[SM_NUM_CLOCK] =
+{
+    SM_SCMI_CLK_PERMS_DATA
+};
+
+const scmi_perm_t g_scmiSensorPerms[SM_NUM_SENSOR] =
+{
+    SM_SCMI_SENSOR_PERMS_DATA
+};
+
+const scmi_perm_t g_scmiRstPerms[SM_NUM_RESET] =
+{
+    SM_SCMI_RST_PERMS_DATA
+};
+
+const scmi_perm_t g_scmiVoltPerms[SM_NUM_VOLT] =
+{
+    SM_SCMI_VOLT_PERMS_DATA
+};
+
+const scmi_perm_t g_scmiLmmPerms[SM_NUM_LM] =
+{
+    SM_SCMI_LMM_PERMS_DATA
+};
+
+const scmi_perm_t g_scmiGprPerms[SM_NUM_GPR] =
+{
+    SM_SCMI_GPR_PERMS_DATA
+};
+
+const scmi_perm_t g_scmiRtcPerms[SM_NUM_RTC] =
+{
+    SM_SCMI_RTC_PERMS_DATA
+};
+
+const scmi_perm_t g_scmiButtonPerms[SM_NUM_BUTTON] =
+{
+    SM_SCMI_BUTTON_PERMS_DATA
+};
+
+const scmi_perm_t g_scmiCpuPerms[SM_NUM_CPU] =
+{
+    SM_SCMI_CPU_PERMS_DATA
+};
+
+const scmi_perm_t g_scmiPerlpiPerms[SM_NUM_PERLPI] =
+{
+    SM_SCMI_PERLPI_PERMS_DATA
+};
+
+const scmi_perm_t g_scmiPinPerms[SM_NUM_PIN] =
+{
+    SM_SCMI_PIN_PERMS_DATA
+};
+
+const scmi_perm_t g_scmiDaisyPerms[SM_NUM_DAISY] =
+{
+    SM_SCMI_DAISY_PERMS_DATA
+};
+
+const scmi_perm_t g_scmiCtrlPerms[SM_NUM_CTRL] =
+{
+    SM_SCMI_CTRL_PERMS_DATA
+};
+
+const scmi_perm_t g_scmiFaultPerms[SM_NUM_FAULT] =
+{
+    SM_SCMI_FAULT_PERMS_DATA
+};
+
+const scmi_perm_t g_scmiCrcPerms[SM_NUM_CRC] =
+{
+    SM_SCMI_CRC_PERMS_DATA
+};
+
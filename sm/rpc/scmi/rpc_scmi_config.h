@@ -52,6 +52,7 @@
 
 #include "sm.h"
 #include "config_lmm.h"
+#include "config_scmi.h"
 #include "dev_sm_api.h"
 
 /* Defines */
@@ -61,7 +62,7 @@
  */
 /** @{ */
 #define SM_SCMI_CHN_A2P           0U  /*!< A2P channel */
-#define SM_SCMI_CHN_A2P_FAST      1U  /*!< A2P fast channel */
+#define SM_SCMI_CHN_A2P_FAST      1U  /*!< A2P FastChannel region */
 #define SM_SCMI_CHN_P2A           2U  /*!< P2A channel */
 #define SM_SCMI_CHN_P2A_NOTIFY    3U  /*!< P2A channel for notifications */
 #define SM_SCMI_CHN_P2A_PRIORITY  4U  /*!< P2A channel for priotiy
@@ -81,8 +82,56 @@
 #define SM_SCMI_PERM_ALL        255U  /*!< Full access */
 /** @} */
 
+/*! Bits per agent in a packed permission word */
+#define SM_SCMI_PERM_BITS  4U
+
+/*! Max agents supported by the packed permission word */
+#define SM_SCMI_PERM_MAX_AGNT  16U
+
+/*! Pack permission \a P of agent \a A into a permission word */
+#define SM_SCMI_PERM_PACK(A, P)  ((scmi_perm_t) (((scmi_perm_t) (P) \
+    & 0xFU) << ((A) * SM_SCMI_PERM_BITS)))
+
+/*! Extract the permission bits of agent \a A for resource \a R */
+#define SM_SCMI_PERM_BITS_GET(T, A, R)  ((uint8_t) (((T)[(R)] \
+    >> ((A) * SM_SCMI_PERM_BITS)) & 0xFU))
+
+/*!
+ * Get the permission (SM_SCMI_PERM_*) of agent \a A for resource \a R
+ * from permission table \a T
+ */
+#define SM_SCMI_PERM(T, A, R)  \
+    ((SM_SCMI_PERM_BITS_GET(T, A, R) == 0xFU) ? (uint8_t) SM_SCMI_PERM_ALL \
+    : SM_SCMI_PERM_BITS_GET(T, A, R))
+
+/*! Number of resources with packed permissions */
+#define SM_SCMI_PERM_NUM_RSRC  (SM_NUM_BASE + SM_NUM_POWER + SM_NUM_PERF \
+    + SM_NUM_CLOCK + SM_NUM_SENSOR + SM_NUM_RESET + SM_NUM_VOLT \
+    + SM_NUM_LM + SM_NUM_GPR + SM_NUM_RTC + SM_NUM_BUTTON + SM_NUM_CPU \
+    + SM_NUM_PERLPI + SM_NUM_PIN + SM_NUM_DAISY + SM_NUM_CTRL \
+    + SM_NUM_FAULT + SM_NUM_CRC)
+
 /* Types */
 
+/*!
+ * SCMI packed permission word
+ *
+ * Holds the permissions of all agents for one resource,
+ * ::SM_SCMI_PERM_BITS per agent with agent 0 in the low bits. A value of
+ * 0xF is ::SM_SCMI_PERM_ALL. Sized for the configured number of agents.
+ */
+#if (SM_SCMI_NUM_AGNT <= 2U)
+typedef uint8_t scmi_perm_t;
+#elif (SM_SCMI_NUM_AGNT <= 4U)
+typedef uint16_t scmi_perm_t;
+#elif (SM_SCMI_NUM_AGNT <= 8U)
+typedef uint32_t scmi_perm_t;
+#elif (SM_SCMI_NUM_AGNT <= SM_SCMI_PERM_MAX_AGNT)
+typedef uint64_t scmi_perm_t;
+#else
+#error "Too many SCMI agents for packed permissions"
+#endif
+
 /*!
  * SCMI channel config structure
  *
@@ -94,6 +143,7 @@ typedef struct
     uint8_t type;         /*!< Type, A2P, P2A, P2A_NOTIFY */
     uint8_t xportType;    /*!< Transport type */
     uint8_t xportChannel; /*!< Transport channel */
+    uint8_t depth;        /*!< P2A notification queue depth (messages) */
 } scmi_chn_config_t;
 
 /*!
@@ -103,30 +153,13 @@ typedef struct
  */
 typedef struct
 {
-    string name;                         /*!< Agent name */
-    uint8_t domId;                       /*!< Domain ID */
-    uint8_t secure;                      /*!< Security state */
-    uint8_t scmiInst;                    /*!< SCMI instance */
-    uint8_t basePerms[SM_NUM_BASE];      /*!< Base protocol permissions */
-    uint8_t pdPerms[SM_NUM_POWER];       /*!< Power protocol permissions */
-    uint8_t sysPerms;                    /*!< System protocol permission */
-    uint8_t perfPerms[SM_NUM_PERF];      /*!< Perf protocol permissions */
-    uint8_t clkPerms[SM_NUM_CLOCK];      /*!< Clock protocol permissions */
-    uint8_t sensorPerms[SM_NUM_SENSOR];  /*!< Sensor protocol permissions */
-    uint8_t rstPerms[SM_NUM_RESET];      /*!< Reset protocol permissions */
-    uint8_t voltPerms[SM_NUM_VOLT];      /*!< Voltage protocol permissions */
-    uint8_t lmmPerms[SM_NUM_LM];         /*!< LMM protocol permissions */
-    uint8_t gprPerms[SM_NUM_GPR];        /*!< BBM protocol GPR permissions */
-    uint8_t rtcPerms[SM_NUM_RTC];        /*!< BBM protocol RTC permissions */
-    uint8_t buttonPerms[SM_NUM_BUTTON];  /*!< BBM protocol button permissions */
-    uint8_t cpuPerms[SM_NUM_CPU];        /*!< CPU protocol permissions */
-    uint8_t perlpiPerms[SM_NUM_PERLPI];  /*!< CPU protocol peripheral permissions */
-    uint8_t pinPerms[SM_NUM_PIN];        /*!< Pin control protocol permissions */
-    uint8_t daisyPerms[SM_NUM_DAISY];    /*!< Pin control protocol daisy permissions */
-    uint8_t ctrlPerms[SM_NUM_CTRL];      /*!< Control protocol permissions */
-    uint8_t faultPerms[SM_NUM_FAULT];    /*!< FuSa protocol fault permissions */
-    uint8_t crcPerms[SM_NUM_CRC];        /*!< FuSa protocol CRC permissions */
-    uint8_t fusaPerms;                   /*!< FuSa protocol permission */
+    string name;        /*!< Agent name */
+    uint8_t domId;      /*!< Domain ID */
+    uint8_t secure;     /*!< Security state */
+    uint8_t scmiInst;   /*!< SCMI instance */
+    uint8_t priority;   /*!< Deferred dispatch priority */
+    uint8_t sysPerms;   /*!< System protocol permission */
+    uint8_t fusaPerms;  /*!< FuSa protocol permission */
 } scmi_agnt_config_t;
 
 /*!
@@ -152,6 +185,31 @@ extern const scmi_agnt_config_t g_scmiAgentConfig[];
 /*! SCMI instance config */
 extern const scmi_config_t g_scmiConfig[];
 
+/*!
+ * @name SCMI resource permissions
+ * Packed permission words of all agents, indexed by resource
+ */
+/** @{ */
+extern const scmi_perm_t g_scmiBasePerms[];    /*!< Base protocol */
+extern const scmi_perm_t g_scmiPdPerms[];      /*!< Power protocol */
+extern const scmi_perm_t g_scmiPerfPerms[];    /*!< Perf protocol */
+extern const scmi_perm_t g_scmiClkPerms[];     /*!< Clock protocol */
+extern const scmi_perm_t g_scmiSensorPerms[];  /*!< Sensor protocol */
+extern const scmi_perm_t g_scmiRstPerms[];     /*!< Reset protocol */
+extern const scmi_perm_t g_scmiVoltPerms[];    /*!< Voltage protocol */
+extern const scmi_perm_t g_scmiLmmPerms[];     /*!< LMM protocol */
+extern const scmi_perm_t g_scmiGprPerms[];     /*!< BBM protocol GPR */
+extern const scmi_perm_t g_scmiRtcPerms[];     /*!< BBM protocol RTC */
+extern const scmi_perm_t g_scmiButtonPerms[];  /*!< BBM protocol button */
+extern const scmi_perm_t g_scmiCpuPerms[];     /*!< CPU protocol */
+extern const scmi_perm_t g_scmiPerlpiPerms[];  /*!< CPU protocol peripheral */
+extern const scmi_perm_t g_scmiPinPerms[];     /*!< Pin control protocol */
+extern const scmi_perm_t g_scmiDaisyPerms[];   /*!< Pin control daisy */
+extern const scmi_perm_t g_scmiCtrlPerms[];    /*!< Control protocol */
+extern const scmi_perm_t g_scmiFaultPerms[];   /*!< FuSa protocol fault */
+extern const scmi_perm_t g_scmiCrcPerms[];     /*!< FuSa protocol CRC */
+/** @} */
+
 #endif /* RPC_SCMI_CONFIG_H */
 
 /** @} */
@@ -47,7 +47,7 @@
 /* Protocol version */
 #define PROTOCOL_VERSION  0x10000U
 
-/* SCMI cpu protocol message IDs and masks */
+/* SCMI cpu protocol message IDs */
 #define COMMAND_PROTOCOL_VERSION             0x0U
 #define COMMAND_PROTOCOL_ATTRIBUTES          0x1U
 #define COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES  0x2U
@@ -61,7 +61,6 @@
 #define COMMAND_CPU_PD_LPM_CONFIG_SET        0xAU
 #define COMMAND_CPU_PER_LPM_CONFIG_SET       0xBU
 #define COMMAND_NEGOTIATE_PROTOCOL_VERSION   0x10U
-#define COMMAND_SUPPORTED_MASK               0x10FFFUL
 
 /* SCMI max cpu argument lengths */
 #define CPU_MAX_NAME          16U
@@ -294,6 +293,31 @@ typedef struct
     uint32_t version;
 } msg_rcpu16_t;
 
+/* Local variables */
+
+/* Message descriptors, indexed by message ID */
+static const scmi_msg_desc_t s_cpuMsgDesc[] =
+{
+    [COMMAND_PROTOCOL_VERSION] = SCMI_MSG_DESC(scmi_msg_header_t, msg_tcpu0_t),
+    [COMMAND_PROTOCOL_ATTRIBUTES] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tcpu1_t),
+    [COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES] =
+        SCMI_MSG_DESC(msg_rcpu2_t, msg_tcpu2_t),
+    [COMMAND_CPU_ATTRIBUTES] = SCMI_MSG_DESC(msg_rcpu3_t, msg_tcpu3_t),
+    [COMMAND_CPU_START] = SCMI_MSG_DESC(msg_rcpu4_t, scmi_msg_status_t),
+    [COMMAND_CPU_STOP] = SCMI_MSG_DESC(msg_rcpu5_t, scmi_msg_status_t),
+    [COMMAND_CPU_RESET_VECTOR_SET] =
+        SCMI_MSG_DESC(msg_rcpu6_t, scmi_msg_status_t),
+    [COMMAND_CPU_SLEEP_MODE_SET] =
+        SCMI_MSG_DESC(msg_rcpu7_t, scmi_msg_status_t),
+    [COMMAND_CPU_IRQ_WAKE_SET] = SCMI_MSG_DESC_VAR(4U, scmi_msg_status_t),
+    [COMMAND_CPU_NON_IRQ_WAKE_SET] = SCMI_MSG_DESC_VAR(4U, scmi_msg_status_t),
+    [COMMAND_CPU_PD_LPM_CONFIG_SET] = SCMI_MSG_DESC_VAR(3U, scmi_msg_status_t),
+    [COMMAND_CPU_PER_LPM_CONFIG_SET] = SCMI_MSG_DESC_VAR(3U, scmi_msg_status_t),
+    [COMMAND_NEGOTIATE_PROTOCOL_VERSION] =
+        SCMI_MSG_DESC(msg_rcpu16_t, scmi_msg_status_t)
+};
+
 /* Local functions */
 
 static int32_t CpuProtocolVersion(const scmi_caller_t *caller,
@@ -335,82 +359,76 @@ static int32_t CpuResetAgentConfig(uint32_t lmId, uint32_t agentId,
 int32_t RPC_SCMI_CpuDispatchCommand(scmi_caller_t *caller,
     uint32_t messageId)
 {
-    int32_t status = SM_ERR_SUCCESS;
+    int32_t status;
     const scmi_msg_t *in = caller->msgCopy;
     scmi_msg_status_t *out = caller->msg;
-    uint32_t lenOut = sizeof(scmi_msg_status_t);
+    uint32_t lenOut;
+
+    /* Check message */
+    status = RPC_SCMI_A2pMsgCheck(caller, s_cpuMsgDesc,
+        ARRAY_SIZE(s_cpuMsgDesc), messageId, &lenOut);
 
     /* Handle standard messages */
-    switch(messageId)
+    if (status == SM_ERR_SUCCESS)
     {
-        case COMMAND_PROTOCOL_VERSION:
-            lenOut = sizeof(msg_tcpu0_t);
-            status = CpuProtocolVersion(caller, (const scmi_msg_header_t*) in,
-                (msg_tcpu0_t*) out);
-            break;
-        case COMMAND_PROTOCOL_ATTRIBUTES:
-            lenOut = sizeof(msg_tcpu1_t);
-            status = CpuProtocolAttributes(caller,
-                (const scmi_msg_header_t*) in, (msg_tcpu1_t*) out);
-            break;
-        case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
-            lenOut = sizeof(msg_tcpu2_t);
-            status = CpuProtocolMessageAttributes(caller,
-                (const msg_rcpu2_t*) in, (msg_tcpu2_t*) out);
-            break;
-        case COMMAND_CPU_ATTRIBUTES:
-            lenOut = sizeof(msg_tcpu3_t);
-            status = CpuAttributes(caller, (const msg_rcpu3_t*) in,
-                (msg_tcpu3_t*) out);
-            break;
-        case COMMAND_CPU_START:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = CpuStart(caller, (const msg_rcpu4_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_CPU_STOP:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = CpuStop(caller, (const msg_rcpu5_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_CPU_RESET_VECTOR_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = CpuResetVectorSet(caller, (const msg_rcpu6_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_CPU_SLEEP_MODE_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = CpuSleepModeSet(caller, (const msg_rcpu7_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_CPU_IRQ_WAKE_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = CpuIrqWakeSet(caller, (const msg_rcpu8_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_CPU_NON_IRQ_WAKE_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = CpuNonIrqWakeSet(caller, (const msg_rcpu9_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_CPU_PD_LPM_CONFIG_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = CpuPdLpmConfigSet(caller, (const msg_rcpu10_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_CPU_PER_LPM_CONFIG_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = CpuPerLpmConfigSet(caller, (const msg_rcpu11_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = CpuNegotiateProtocolVersion(caller,
-                (const msg_rcpu16_t*) in, (const scmi_msg_status_t*) out);
-            break;
-        default:
-            status = SM_ERR_NOT_SUPPORTED;
-            break;
+        switch(messageId)
+        {
+            case COMMAND_PROTOCOL_VERSION:
+                status = CpuProtocolVersion(caller,
+                    (const scmi_msg_header_t*) in, (msg_tcpu0_t*) out);
+                break;
+            case COMMAND_PROTOCOL_ATTRIBUTES:
+                status = CpuProtocolAttributes(caller,
+                    (const scmi_msg_header_t*) in, (msg_tcpu1_t*) out);
+                break;
+            case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
+                status = CpuProtocolMessageAttributes(caller,
+                    (const msg_rcpu2_t*) in, (msg_tcpu2_t*) out);
+                break;
+            case COMMAND_CPU_ATTRIBUTES:
+                status = CpuAttributes(caller, (const msg_rcpu3_t*) in,
+                    (msg_tcpu3_t*) out);
+                break;
+            case COMMAND_CPU_START:
+                status = CpuStart(caller, (const msg_rcpu4_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_CPU_STOP:
+                status = CpuStop(caller, (const msg_rcpu5_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_CPU_RESET_VECTOR_SET:
+                status = CpuResetVectorSet(caller, (const msg_rcpu6_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_CPU_SLEEP_MODE_SET:
+                status = CpuSleepModeSet(caller, (const msg_rcpu7_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_CPU_IRQ_WAKE_SET:
+                status = CpuIrqWakeSet(caller, (const msg_rcpu8_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_CPU_NON_IRQ_WAKE_SET:
+                status = CpuNonIrqWakeSet(caller, (const msg_rcpu9_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_CPU_PD_LPM_CONFIG_SET:
+                status = CpuPdLpmConfigSet(caller, (const msg_rcpu10_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_CPU_PER_LPM_CONFIG_SET:
+                status = CpuPerLpmConfigSet(caller, (const msg_rcpu11_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
+                status = CpuNegotiateProtocolVersion(caller,
+                    (const msg_rcpu16_t*) in, (const scmi_msg_status_t*) out);
+                break;
+            default:
+                status = SM_ERR_NOT_SUPPORTED;
+                break;
+        }
     }
 
     /* Update length */
@@ -450,25 +468,14 @@ int32_t RPC_SCMI_CpuDispatchReset(uint32_t lmId, uint32_t agentId,
 /* SCMI_CpuProtocolVersion().                                               */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t CpuProtocolVersion(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tcpu0_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return version */
-        out->version = PROTOCOL_VERSION;
-    }
+    /* Return version */
+    out->version = PROTOCOL_VERSION;
 
     /* Return status */
     return status;
@@ -490,25 +497,14 @@ static int32_t CpuProtocolVersion(const scmi_caller_t *caller,
 /* - CPU_PROTO_ATTR_NUM_CPUS() - Number of CPUs                             */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t CpuProtocolAttributes(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tcpu1_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return number of CPUs */
-        out->attributes = CPU_PROTO_ATTR_NUM_CPUS((uint32_t) SM_NUM_CPU);
-    }
+    /* Return number of CPUs */
+    out->attributes = CPU_PROTO_ATTR_NUM_CPUS((uint32_t) SM_NUM_CPU);
 
     /* Return status */
     return status;
@@ -532,33 +528,20 @@ static int32_t CpuProtocolAttributes(const scmi_caller_t *caller,
 /*   use.                                                                   */
 /* - SM_ERR_NOT_FOUND: if the message identified by messageId is invalid    */
 /*   or not implemented.                                                    */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t CpuProtocolMessageAttributes(const scmi_caller_t *caller,
     const msg_rcpu2_t *in, msg_tcpu2_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
+    /* Always zero */
+    out->attributes = 0U;
 
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
+    /* Is message supported ? */
+    if (!RPC_SCMI_A2pMsgSupported(s_cpuMsgDesc,
+        ARRAY_SIZE(s_cpuMsgDesc), in->messageId))
     {
-        uint32_t mask = COMMAND_SUPPORTED_MASK;
-
-        /* Always zero */
-        out->attributes = 0U;
-
-        /* Is message supported ? */
-        if ((in->messageId >= 32U) || (((mask >> in->messageId)
-            & 0x1U) == 0U))
-        {
-            status = SM_ERR_NOT_FOUND;
-        }
+        status = SM_ERR_NOT_FOUND;
     }
 
     /* Return status */
@@ -582,7 +565,6 @@ static int32_t CpuProtocolMessageAttributes(const scmi_caller_t *caller,
 /* Return errors:                                                           */
 /* - SM_ERR_SUCCESS: if valid attributes are returned.                      */
 /* - SM_ERR_NOT_FOUND: if cpuId does not point to a valid CPU.              */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t CpuAttributes(const scmi_caller_t *caller,
     const msg_rcpu3_t *in, msg_tcpu3_t *out)
@@ -590,12 +572,6 @@ static int32_t CpuAttributes(const scmi_caller_t *caller,
     int32_t status = SM_ERR_SUCCESS;
     const uint8_t *nameAddr = (const uint8_t*) "";
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check CPU */
     if ((status == SM_ERR_SUCCESS) && (in->cpuId >= SM_NUM_CPU))
     {
@@ -638,19 +614,12 @@ static int32_t CpuAttributes(const scmi_caller_t *caller,
 /* - SM_ERR_NOT_FOUND: if cpuId does not point to a valid CPU.              */
 /* - SM_ERR_DENIED: if the calling agent is not allowed to start this       */
 /*   CPU.                                                                   */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t CpuStart(const scmi_caller_t *caller, const msg_rcpu4_t *in,
     const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check CPU */
     if ((status == SM_ERR_SUCCESS) && (in->cpuId >= SM_NUM_CPU))
     {
@@ -659,7 +628,7 @@ static int32_t CpuStart(const scmi_caller_t *caller, const msg_rcpu4_t *in,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].cpuPerms[in->cpuId]
+        && (SM_SCMI_PERM(g_scmiCpuPerms, caller->agentId, in->cpuId)
         < SM_SCMI_PERM_EXCLUSIVE))
     {
         status = SM_ERR_DENIED;
@@ -690,19 +659,12 @@ static int32_t CpuStart(const scmi_caller_t *caller, const msg_rcpu4_t *in,
 /* - SM_ERR_NOT_FOUND: if cpuId does not point to a valid CPU.              */
 /* - SM_ERR_DENIED: if the calling agent is not allowed to stop this        */
 /*   CPU.                                                                   */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t CpuStop(const scmi_caller_t *caller, const msg_rcpu5_t *in,
     const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check CPU */
     if ((status == SM_ERR_SUCCESS) && (in->cpuId >= SM_NUM_CPU))
     {
@@ -711,7 +673,7 @@ static int32_t CpuStop(const scmi_caller_t *caller, const msg_rcpu5_t *in,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].cpuPerms[in->cpuId]
+        && (SM_SCMI_PERM(g_scmiCpuPerms, caller->agentId, in->cpuId)
         < SM_SCMI_PERM_EXCLUSIVE))
     {
         status = SM_ERR_DENIED;
@@ -769,7 +731,6 @@ static int32_t CpuStop(const scmi_caller_t *caller, const msg_rcpu5_t *in,
 /*   supported by this CPU.                                                 */
 /* - SM_ERR_DENIED: if the calling agent is not allowed to set the reset    */
 /*   vector of this CPU.                                                    */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t CpuResetVectorSet(const scmi_caller_t *caller,
     const msg_rcpu6_t *in, const scmi_msg_status_t *out)
@@ -780,12 +741,6 @@ static int32_t CpuResetVectorSet(const scmi_caller_t *caller,
     bool resume = CPU_VEC_FLAGS_RESUME(in->flags) != 0U;
     bool table = CPU_VEC_FLAGS_TABLE(in->flags) != 0U;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check CPU */
     if ((status == SM_ERR_SUCCESS) && (in->cpuId >= SM_NUM_CPU))
     {
@@ -794,7 +749,7 @@ static int32_t CpuResetVectorSet(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].cpuPerms[in->cpuId]
+        && (SM_SCMI_PERM(g_scmiCpuPerms, caller->agentId, in->cpuId)
         < SM_SCMI_PERM_EXCLUSIVE))
     {
         status = SM_ERR_DENIED;
@@ -847,7 +802,6 @@ static int32_t CpuResetVectorSet(const scmi_caller_t *caller,
 /* - SM_ERR_INVALID_PARAMETERS: if sleepMode or flags is invalid.           */
 /* - SM_ERR_DENIED: if the calling agent is not allowed to configure        */
 /*   this CPU.                                                              */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t CpuSleepModeSet(const scmi_caller_t *caller,
     const msg_rcpu7_t *in, const scmi_msg_status_t *out)
@@ -855,12 +809,6 @@ static int32_t CpuSleepModeSet(const scmi_caller_t *caller,
     int32_t status = SM_ERR_SUCCESS;
     uint32_t sleepMode = in->sleepMode;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check CPU */
     if ((status == SM_ERR_SUCCESS) && (in->cpuId >= SM_NUM_CPU))
     {
@@ -869,7 +817,7 @@ static int32_t CpuSleepModeSet(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].cpuPerms[in->cpuId]
+        && (SM_SCMI_PERM(g_scmiCpuPerms, caller->agentId, in->cpuId)
         < SM_SCMI_PERM_EXCLUSIVE))
     {
         status = SM_ERR_DENIED;
@@ -951,7 +899,7 @@ static int32_t CpuIrqWakeSet(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].cpuPerms[in->cpuId]
+        && (SM_SCMI_PERM(g_scmiCpuPerms, caller->agentId, in->cpuId)
         < SM_SCMI_PERM_EXCLUSIVE))
     {
         status = SM_ERR_DENIED;
@@ -1016,7 +964,7 @@ static int32_t CpuNonIrqWakeSet(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].cpuPerms[in->cpuId]
+        && (SM_SCMI_PERM(g_scmiCpuPerms, caller->agentId, in->cpuId)
         < SM_SCMI_PERM_EXCLUSIVE))
     {
         status = SM_ERR_DENIED;
@@ -1083,7 +1031,7 @@ static int32_t CpuPdLpmConfigSet(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].cpuPerms[in->cpuId]
+        && (SM_SCMI_PERM(g_scmiCpuPerms, caller->agentId, in->cpuId)
         < SM_SCMI_PERM_EXCLUSIVE))
     {
         status = SM_ERR_DENIED;
@@ -1152,7 +1100,7 @@ static int32_t CpuPerLpmConfigSet(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].cpuPerms[in->cpuId]
+        && (SM_SCMI_PERM(g_scmiCpuPerms, caller->agentId, in->cpuId)
         < SM_SCMI_PERM_EXCLUSIVE))
     {
         status = SM_ERR_DENIED;
@@ -1177,8 +1125,8 @@ static int32_t CpuPerLpmConfigSet(const scmi_caller_t *caller,
 
         /* Check permissions */
         if ((status == SM_ERR_SUCCESS)
-            && (g_scmiAgentConfig[caller->agentId].perlpiPerms[config->perId]
-            < SM_SCMI_PERM_EXCLUSIVE))
+            && (SM_SCMI_PERM(g_scmiPerlpiPerms, caller->agentId,
+            config->perId) < SM_SCMI_PERM_EXCLUSIVE))
         {
             status = SM_ERR_DENIED;
         }
@@ -1211,19 +1159,12 @@ static int32_t CpuPerLpmConfigSet(const scmi_caller_t *caller,
 /*   successful return of this command must comply with the negotiated      */
 /*   version.                                                               */
 /* - SM_ERR_NOT_SUPPORTED: if the protocol version is not supported.        */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t CpuNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rcpu16_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check major version */
     if ((status == SM_ERR_SUCCESS) && (SCMI_VER_MAJOR(in->version)
         == SCMI_VER_MAJOR(PROTOCOL_VERSION)))
@@ -1260,7 +1201,7 @@ static int32_t CpuResetAgentConfig(uint32_t lmId, uint32_t agentId,
     for (uint32_t cpuId = 0U; cpuId < SM_NUM_CPU; cpuId++)
     {
         /* Reset rate */
-        if (g_scmiAgentConfig[agentId].cpuPerms[cpuId]
+        if (SM_SCMI_PERM(g_scmiCpuPerms, agentId, cpuId)
             >= SM_SCMI_PERM_EXCLUSIVE)
         {
             (void) LMM_CpuResetVectorReset(lmId, cpuId);
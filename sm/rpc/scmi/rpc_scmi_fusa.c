@@ -47,7 +47,7 @@
 /* Protocol version */
 #define PROTOCOL_VERSION  0x10000U
 
-/* SCMI fusa protocol message IDs and masks */
+/* SCMI fusa protocol message IDs */
 #define COMMAND_PROTOCOL_VERSION             0x0U
 #define COMMAND_PROTOCOL_ATTRIBUTES          0x1U
 #define COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES  0x2U
@@ -63,7 +63,6 @@
 #define COMMAND_FUSA_CRC_CALCULATE           0xCU
 #define COMMAND_FUSA_CRC_RESULT_GET          0xDU
 #define COMMAND_NEGOTIATE_PROTOCOL_VERSION   0x10U
-#define COMMAND_SUPPORTED_MASK               0x13FFFUL
 
 /* SCMI FuSa F-EENV states */
 #define FUSA_FEENV_STATE_INIT            0U
@@ -344,6 +343,39 @@ typedef struct
     uint32_t flags;
 } msg_rfusa34_t;
 
+/* Local variables */
+
+/* Message descriptors, indexed by message ID */
+static const scmi_msg_desc_t s_fusaMsgDesc[] =
+{
+    [COMMAND_PROTOCOL_VERSION] = SCMI_MSG_DESC(scmi_msg_header_t, msg_tfusa0_t),
+    [COMMAND_PROTOCOL_ATTRIBUTES] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tfusa1_t),
+    [COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES] =
+        SCMI_MSG_DESC(msg_rfusa2_t, msg_tfusa2_t),
+    [COMMAND_FUSA_FEENV_STATE_GET] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tfusa3_t),
+    [COMMAND_FUSA_FEENV_STATE_SET] =
+        SCMI_MSG_DESC(msg_rfusa4_t, scmi_msg_status_t),
+    [COMMAND_FUSA_FEENV_STATE_NOTIFY] =
+        SCMI_MSG_DESC(msg_rfusa5_t, scmi_msg_status_t),
+    [COMMAND_FUSA_SEENV_STATE_GET] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tfusa6_t),
+    [COMMAND_FUSA_SEENV_STATE_SET] =
+        SCMI_MSG_DESC(msg_rfusa7_t, scmi_msg_status_t),
+    [COMMAND_FUSA_FAULT_GET] = SCMI_MSG_DESC(msg_rfusa8_t, msg_tfusa8_t),
+    [COMMAND_FUSA_FAULT_SET] = SCMI_MSG_DESC(msg_rfusa9_t, scmi_msg_status_t),
+    [COMMAND_FUSA_FAULT_GROUP_NOTIFY] =
+        SCMI_MSG_DESC(msg_rfusa10_t, msg_tfusa10_t),
+    [COMMAND_FUSA_SCHECK_EVNTRIG] =
+        SCMI_MSG_DESC(scmi_msg_header_t, scmi_msg_status_t),
+    [COMMAND_FUSA_CRC_CALCULATE] =
+        SCMI_MSG_DESC(msg_rfusa12_t, scmi_msg_status_t),
+    [COMMAND_FUSA_CRC_RESULT_GET] = SCMI_MSG_DESC(msg_rfusa13_t, msg_tfusa13_t),
+    [COMMAND_NEGOTIATE_PROTOCOL_VERSION] =
+        SCMI_MSG_DESC(msg_rfusa16_t, scmi_msg_status_t)
+};
+
 /* Local functions */
 
 static int32_t FusaProtocolVersion(const scmi_caller_t *caller,
@@ -395,92 +427,85 @@ static int32_t FusaResetAgentConfig(uint32_t lmId, uint32_t agentId,
 int32_t RPC_SCMI_FusaDispatchCommand(scmi_caller_t *caller,
     uint32_t messageId)
 {
-    int32_t status = SM_ERR_SUCCESS;
+    int32_t status;
     const scmi_msg_t *in = caller->msgCopy;
     scmi_msg_status_t *out = caller->msg;
-    uint32_t lenOut = sizeof(scmi_msg_status_t);
+    uint32_t lenOut;
+
+    /* Check message */
+    status = RPC_SCMI_A2pMsgCheck(caller, s_fusaMsgDesc,
+        ARRAY_SIZE(s_fusaMsgDesc), messageId, &lenOut);
 
     /* Handle standard messages */
-    switch(messageId)
+    if (status == SM_ERR_SUCCESS)
     {
-        case COMMAND_PROTOCOL_VERSION:
-            lenOut = sizeof(msg_tfusa0_t);
-            status = FusaProtocolVersion(caller,
-                (const scmi_msg_header_t*) in, (msg_tfusa0_t*) out);
-            break;
-        case COMMAND_PROTOCOL_ATTRIBUTES:
-            lenOut = sizeof(msg_tfusa1_t);
-            status = FusaProtocolAttributes(caller,
-                (const scmi_msg_header_t*) in, (msg_tfusa1_t*) out);
-            break;
-        case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
-            lenOut = sizeof(msg_tfusa2_t);
-            status = FusaProtocolMessageAttributes(caller,
-                (const msg_rfusa2_t*) in, (msg_tfusa2_t*) out);
-            break;
-        case COMMAND_FUSA_FEENV_STATE_GET:
-            lenOut = sizeof(msg_tfusa3_t);
-            status = FusaFeenvStateGet(caller, (const scmi_msg_header_t*) in,
-                (msg_tfusa3_t*) out);
-            break;
-        case COMMAND_FUSA_FEENV_STATE_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = FusaFeenvStateSet(caller, (const msg_rfusa4_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_FUSA_FEENV_STATE_NOTIFY:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = FusaFeenvStateNotify(caller, (const msg_rfusa5_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_FUSA_SEENV_STATE_GET:
-            lenOut = sizeof(msg_tfusa6_t);
-            status = FusaSeenvStateGet(caller, (const scmi_msg_header_t*) in,
-                (msg_tfusa6_t*) out);
-            break;
-        case COMMAND_FUSA_SEENV_STATE_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = FusaSeenvStateSet(caller, (const msg_rfusa7_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_FUSA_FAULT_GET:
-            lenOut = sizeof(msg_tfusa8_t);
-            status = FusaFaultGet(caller, (const msg_rfusa8_t*) in,
-                (msg_tfusa8_t*) out);
-            break;
-        case COMMAND_FUSA_FAULT_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = FusaFaultSet(caller, (const msg_rfusa9_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_FUSA_FAULT_GROUP_NOTIFY:
-            lenOut = sizeof(msg_tfusa10_t);
-            status = FusaFaultGroupNotify(caller, (const msg_rfusa10_t*) in,
-                (msg_tfusa10_t*) out);
-            break;
-        case COMMAND_FUSA_SCHECK_EVNTRIG:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = FusaScheckEvntrig(caller, (const scmi_msg_header_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_FUSA_CRC_CALCULATE:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = FusaCrcCalculate(caller, (const msg_rfusa12_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_FUSA_CRC_RESULT_GET:
-            lenOut = sizeof(msg_tfusa13_t);
-            status = FusaCrcResultGet(caller, (const msg_rfusa13_t*) in,
-                (msg_tfusa13_t*) out);
-            break;
-        case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = FusaNegotiateProtocolVersion(caller,
-                (const msg_rfusa16_t*) in, (const scmi_msg_status_t*) out);
-            break;
-        default:
-            status = SM_ERR_NOT_SUPPORTED;
-            break;
+        switch(messageId)
+        {
+            case COMMAND_PROTOCOL_VERSION:
+                status = FusaProtocolVersion(caller,
+                    (const scmi_msg_header_t*) in, (msg_tfusa0_t*) out);
+                break;
+            case COMMAND_PROTOCOL_ATTRIBUTES:
+                status = FusaProtocolAttributes(caller,
+                    (const scmi_msg_header_t*) in, (msg_tfusa1_t*) out);
+                break;
+            case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
+                status = FusaProtocolMessageAttributes(caller,
+                    (const msg_rfusa2_t*) in, (msg_tfusa2_t*) out);
+                break;
+            case COMMAND_FUSA_FEENV_STATE_GET:
+                status = FusaFeenvStateGet(caller,
+                    (const scmi_msg_header_t*) in, (msg_tfusa3_t*) out);
+                break;
+            case COMMAND_FUSA_FEENV_STATE_SET:
+                status = FusaFeenvStateSet(caller, (const msg_rfusa4_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_FUSA_FEENV_STATE_NOTIFY:
+                status = FusaFeenvStateNotify(caller, (const msg_rfusa5_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_FUSA_SEENV_STATE_GET:
+                status = FusaSeenvStateGet(caller,
+                    (const scmi_msg_header_t*) in, (msg_tfusa6_t*) out);
+                break;
+            case COMMAND_FUSA_SEENV_STATE_SET:
+                status = FusaSeenvStateSet(caller, (const msg_rfusa7_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_FUSA_FAULT_GET:
+                status = FusaFaultGet(caller, (const msg_rfusa8_t*) in,
+                    (msg_tfusa8_t*) out);
+                break;
+            case COMMAND_FUSA_FAULT_SET:
+                status = FusaFaultSet(caller, (const msg_rfusa9_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_FUSA_FAULT_GROUP_NOTIFY:
+                status = FusaFaultGroupNotify(caller, (const msg_rfusa10_t*) in,
+                    (msg_tfusa10_t*) out);
+                break;
+            case COMMAND_FUSA_SCHECK_EVNTRIG:
+                status = FusaScheckEvntrig(caller,
+                    (const scmi_msg_header_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_FUSA_CRC_CALCULATE:
+                status = FusaCrcCalculate(caller, (const msg_rfusa12_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_FUSA_CRC_RESULT_GET:
+                status = FusaCrcResultGet(caller, (const msg_rfusa13_t*) in,
+                    (msg_tfusa13_t*) out);
+                break;
+            case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
+                status = FusaNegotiateProtocolVersion(caller,
+                    (const msg_rfusa16_t*) in, (const scmi_msg_status_t*) out);
+                break;
+            default:
+                status = SM_ERR_NOT_SUPPORTED;
+                break;
+        }
     }
 
     /* Update length */
@@ -565,25 +590,14 @@ static BITARRAY_DEC(stateNotify, SM_NUM_AGENT);
 /* SCMI_FusaProtocolVersion().                                              */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t FusaProtocolVersion(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tfusa0_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return version */
-        out->version = PROTOCOL_VERSION;
-    }
+    /* Return version */
+    out->version = PROTOCOL_VERSION;
 
     /* Return status */
     return status;
@@ -612,36 +626,26 @@ static int32_t FusaProtocolVersion(const scmi_caller_t *caller,
 /* - FUSA_PROTO_ATTR1_NUM_SEENV() - Number of S-EENV LM in the system       */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t FusaProtocolAttributes(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tfusa1_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        uint32_t numSeenv = 0U;
+    uint32_t numSeenv = 0U;
 
-        /* Get number of S-EENV */
-        LMM_SsenvNumGet(&numSeenv);
+    /* Get number of S-EENV */
+    LMM_SsenvNumGet(&numSeenv);
 
-        /* Set attributes 1 */
-        out->attributes1
-            = FUSA_PROTO_ATTR1_NUM_FAULT((uint32_t) SM_NUM_FAULT)
-            | FUSA_PROTO_ATTR1_NUM_CRC((uint32_t) SM_NUM_CRC)
-            | FUSA_PROTO_ATTR1_NUM_SEENV(numSeenv);
+    /* Set attributes 1 */
+    out->attributes1
+        = FUSA_PROTO_ATTR1_NUM_FAULT((uint32_t) SM_NUM_FAULT)
+        | FUSA_PROTO_ATTR1_NUM_CRC((uint32_t) SM_NUM_CRC)
+        | FUSA_PROTO_ATTR1_NUM_SEENV(numSeenv);
 
-        /* Attributes 2 always 0 */
-        out->attributes2 = 0U;
-    }
+    /* Attributes 2 always 0 */
+    out->attributes2 = 0U;
 
     /* Return status */
     return status;
@@ -666,33 +670,20 @@ static int32_t FusaProtocolAttributes(const scmi_caller_t *caller,
 /* - SM_ERR_NOT_SUPPORTED: if FuSa not an enabled feature.                  */
 /* - SM_ERR_NOT_FOUND: if the message identified by messageId is invalid    */
 /*   or not implemented.                                                    */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t FusaProtocolMessageAttributes(const scmi_caller_t *caller,
     const msg_rfusa2_t *in, msg_tfusa2_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
+    /* Always zero */
+    out->attributes = 0U;
 
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
+    /* Is message supported ? */
+    if (!RPC_SCMI_A2pMsgSupported(s_fusaMsgDesc,
+        ARRAY_SIZE(s_fusaMsgDesc), in->messageId))
     {
-        uint32_t mask = COMMAND_SUPPORTED_MASK;
-
-        /* Always zero */
-        out->attributes = 0U;
-
-        /* Is message supported ? */
-        if ((in->messageId >= 32U) || (((mask >> in->messageId)
-            & 0x1U) == 0U))
-        {
-            status = SM_ERR_NOT_FOUND;
-        }
+        status = SM_ERR_NOT_FOUND;
     }
 
     /* Return status */
@@ -716,19 +707,12 @@ static int32_t FusaProtocolMessageAttributes(const scmi_caller_t *caller,
 /*   is not an S-EENV.                                                      */
 /* - SM_ERR_DENIED: if the calling agent is not allowed to get the          */
 /*   F-EENV state.                                                          */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t FusaFeenvStateGet(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tfusa3_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check call from S-EENV */
     if ((status == SM_ERR_SUCCESS)
         && (caller->safeType != LMM_SAFE_TYPE_SEENV))
@@ -785,7 +769,6 @@ static int32_t FusaFeenvStateGet(const scmi_caller_t *caller,
 /*   invalid.                                                               */
 /* - SM_ERR_DENIED: if the calling agent is not allowed to set the          */
 /*   F-EENV state.                                                          */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t FusaFeenvStateSet(const scmi_caller_t *caller,
     const msg_rfusa4_t *in, const scmi_msg_status_t *out)
@@ -793,12 +776,6 @@ static int32_t FusaFeenvStateSet(const scmi_caller_t *caller,
     int32_t status = SM_ERR_SUCCESS;
     bool graceful = FUSA_FLAGS_GRACEFUL(in->flags) != 0U;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check call from S-EENV */
     if ((status == SM_ERR_SUCCESS)
         && (caller->safeType != LMM_SAFE_TYPE_SEENV))
@@ -850,19 +827,12 @@ static int32_t FusaFeenvStateSet(const scmi_caller_t *caller,
 /*   is not an S-EENV.                                                      */
 /* - SM_ERR_DENIED: if the calling agent is not permitted to request the    */
 /*   notification.                                                          */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t FusaFeenvStateNotify(const scmi_caller_t *caller,
     const msg_rfusa5_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check call from S-EENV */
     if ((status == SM_ERR_SUCCESS)
         && (caller->safeType != LMM_SAFE_TYPE_SEENV))
@@ -909,19 +879,12 @@ static int32_t FusaFeenvStateNotify(const scmi_caller_t *caller,
 /* - SM_ERR_SUCCESS: if the S-EENV state is returned successfully.          */
 /* - SM_ERR_NOT_SUPPORTED: if FuSa not an enabled feature or the caller     */
 /*   is not an S-EENV.                                                      */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t FusaSeenvStateGet(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tfusa6_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check call from S-EENV */
     if ((status == SM_ERR_SUCCESS)
         && (caller->safeType != LMM_SAFE_TYPE_SEENV))
@@ -957,19 +920,12 @@ static int32_t FusaSeenvStateGet(const scmi_caller_t *caller,
 /* - SM_ERR_NOT_SUPPORTED: if FuSa not an enabled feature or the caller     */
 /*   is not an S-EENV.                                                      */
 /* - SM_ERR_INVALID_PARAMETERS: if the requested state is invalid.          */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t FusaSeenvStateSet(const scmi_caller_t *caller,
     const msg_rfusa7_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check call from S-EENV */
     if ((status == SM_ERR_SUCCESS)
         && (caller->safeType != LMM_SAFE_TYPE_SEENV))
@@ -1013,7 +969,6 @@ static int32_t FusaSeenvStateSet(const scmi_caller_t *caller,
 /* - SM_ERR_NOT_FOUND: if faultId is invalid.                               */
 /* - SM_ERR_DENIED: if the calling agent is not permitted to get the        */
 /*   state.                                                                 */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t FusaFaultGet(const scmi_caller_t *caller,
     const msg_rfusa8_t *in, msg_tfusa8_t *out)
@@ -1021,12 +976,6 @@ static int32_t FusaFaultGet(const scmi_caller_t *caller,
     int32_t status = SM_ERR_SUCCESS;
     bool state = false;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check call from S-EENV */
     if ((status == SM_ERR_SUCCESS)
         && (caller->safeType != LMM_SAFE_TYPE_SEENV))
@@ -1043,7 +992,7 @@ static int32_t FusaFaultGet(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].faultPerms[in->faultId]
+        && (SM_SCMI_PERM(g_scmiFaultPerms, caller->agentId, in->faultId)
         < SM_SCMI_PERM_GET))
     {
         status = SM_ERR_DENIED;
@@ -1091,19 +1040,12 @@ static int32_t FusaFaultGet(const scmi_caller_t *caller,
 /* - SM_ERR_NOT_FOUND: if faultId is invalid.                               */
 /* - SM_ERR_DENIED: if the calling agent is not permitted to set the        */
 /*   state.                                                                 */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t FusaFaultSet(const scmi_caller_t *caller,
     const msg_rfusa9_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check call from S-EENV */
     if ((status == SM_ERR_SUCCESS)
         && (caller->safeType != LMM_SAFE_TYPE_SEENV))
@@ -1120,7 +1062,7 @@ static int32_t FusaFaultSet(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].faultPerms[in->faultId]
+        && (SM_SCMI_PERM(g_scmiFaultPerms, caller->agentId, in->faultId)
         < SM_SCMI_PERM_SET))
     {
         status = SM_ERR_DENIED;
@@ -1169,19 +1111,12 @@ static int32_t FusaFaultSet(const scmi_caller_t *caller,
 /* - SM_ERR_NOT_FOUND: if faultIdFirst is invalid.                          */
 /* - SM_ERR_DENIED: if the calling agent is not permitted to modify any     */
 /*   of the requested notifications.                                        */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t FusaFaultGroupNotify(const scmi_caller_t *caller,
     const msg_rfusa10_t *in, msg_tfusa10_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check call from S-EENV */
     if ((status == SM_ERR_SUCCESS)
         && (caller->safeType != LMM_SAFE_TYPE_SEENV))
@@ -1220,7 +1155,7 @@ static int32_t FusaFaultGroupNotify(const scmi_caller_t *caller,
             if ((in->faultMask & BIT32(idx)) != 0U)
             {
                 /* Check permissions */
-                if (g_scmiAgentConfig[caller->agentId].faultPerms[faultId]
+                if (SM_SCMI_PERM(g_scmiFaultPerms, caller->agentId, faultId)
                     < SM_SCMI_PERM_NOTIFY)
                 {
                     status = SM_ERR_DENIED;
@@ -1276,19 +1211,12 @@ static int32_t FusaFaultGroupNotify(const scmi_caller_t *caller,
 /* - SM_ERR_SUCCESS: if fault handling disabled for the caller.             */
 /* - SM_ERR_NOT_SUPPORTED: if FuSa not an enabled feature or the caller     */
 /*   is not an S-EENV.                                                      */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t FusaScheckEvntrig(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check call from S-EENV */
     if ((status == SM_ERR_SUCCESS)
         && (caller->safeType != LMM_SAFE_TYPE_SEENV))
@@ -1330,19 +1258,12 @@ static int32_t FusaScheckEvntrig(const scmi_caller_t *caller,
 /*   calculation.                                                           */
 /* - SM_ERR_DENIED: if the calling agent is not permitted to use this       */
 /*   CRC channel.                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t FusaCrcCalculate(const scmi_caller_t *caller,
     const msg_rfusa12_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check call from S-EENV */
     if ((status == SM_ERR_SUCCESS)
         && (caller->safeType != LMM_SAFE_TYPE_SEENV))
@@ -1359,7 +1280,7 @@ static int32_t FusaCrcCalculate(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].crcPerms[in->crcChannel]
+        && (SM_SCMI_PERM(g_scmiCrcPerms, caller->agentId, in->crcChannel)
         < SM_SCMI_PERM_SET))
     {
         status = SM_ERR_DENIED;
@@ -1402,7 +1323,6 @@ static int32_t FusaCrcCalculate(const scmi_caller_t *caller,
 /*   calculation.                                                           */
 /* - SM_ERR_DENIED: if the calling agent is not permitted to use this       */
 /*   CRC channel.                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t FusaCrcResultGet(const scmi_caller_t *caller,
     const msg_rfusa13_t *in, msg_tfusa13_t *out)
@@ -1410,12 +1330,6 @@ static int32_t FusaCrcResultGet(const scmi_caller_t *caller,
     int32_t status = SM_ERR_SUCCESS;
     uint64_t memStart = 0ULL;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check call from S-EENV */
     if ((status == SM_ERR_SUCCESS)
         && (caller->safeType != LMM_SAFE_TYPE_SEENV))
@@ -1432,7 +1346,7 @@ static int32_t FusaCrcResultGet(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].crcPerms[in->crcChannel]
+        && (SM_SCMI_PERM(g_scmiCrcPerms, caller->agentId, in->crcChannel)
         < SM_SCMI_PERM_SET))
     {
         status = SM_ERR_DENIED;
@@ -1471,19 +1385,12 @@ static int32_t FusaCrcResultGet(const scmi_caller_t *caller,
 /*   successful return of this command must comply with the negotiated      */
 /*   version.                                                               */
 /* - SM_ERR_NOT_SUPPORTED: if the protocol version is not supported.        */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t FusaNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rfusa16_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check major version */
     if ((status == SM_ERR_SUCCESS) && (SCMI_VER_MAJOR(in->version)
         == SCMI_VER_MAJOR(PROTOCOL_VERSION)))
@@ -1534,7 +1441,8 @@ static int32_t FusaFeenvStateEvent(scmi_msg_id_t msgId,
             {
                 /* Queue notification */
                 RPC_SCMI_P2aTxQ(dstAgent, msgId, (uint32_t*) &out,
-                    sizeof(out), SCMI_PRIORITY_Q);
+                    sizeof(out), SCMI_PRIORITY_Q,
+                    SCMI_NOTIFY_KEY_NONE);
             }
             else
             {
@@ -1577,7 +1485,8 @@ static int32_t FusaSeenvStateReqEvent(scmi_msg_id_t msgId,
             {
                 /* Queue notification */
                 RPC_SCMI_P2aTxQ(dstAgent, msgId, (uint32_t*) &out,
-                    sizeof(out), SCMI_PRIORITY_Q);
+                    sizeof(out), SCMI_PRIORITY_Q,
+                    SCMI_NOTIFY_KEY_NONE);
             }
             else
             {
@@ -1624,7 +1533,8 @@ static int32_t FusaFaultEvent(scmi_msg_id_t msgId,
             {
                 /* Queue notification */
                 RPC_SCMI_P2aTxQ(dstAgent, msgId, (uint32_t*) &out,
-                    sizeof(out), SCMI_PRIORITY_Q);
+                    sizeof(out), SCMI_PRIORITY_Q,
+                    SCMI_NOTIFY_KEY_NONE);
             }
             else
             {
@@ -74,12 +74,45 @@
 /*! Vendor string returned by BASE_DISCOVER_VENDOR */
 #define SCMI_VENDOR         "NXP"
 
-/*! Payload buffer size */
-#define SCMI_PAYLOAD_LEN    100U
+/*! Payload buffer size (largest configured) */
+#define SCMI_PAYLOAD_LEN    SMT_BUFFER_PAYLOAD
 
 /*! Macro to determine max elements in the payload */
 #define SCMI_ARRAY(X, Y)    ((SCMI_PAYLOAD_LEN - (X)) / sizeof(Y))
 
+/*! Macro to determine max elements in the payload of a caller's channel */
+#define SCMI_ARRAY_CALLER(C, X, Y)  ((((C)->lenMax) - 4U - (X)) / sizeof(Y))
+
+/*! P2A coalesce key to never coalesce a message */
+#define SCMI_NOTIFY_KEY_NONE  0xFFFFFFFFU
+
+/*! Number of service time histogram buckets */
+#define SCMI_STATS_NUM_HIST  8U
+
+/*! Statistics for a channel */
+#define SCMI_STATS_TYPE_CHANNEL  0U
+/*! Statistics for a protocol message */
+#define SCMI_STATS_TYPE_MSG      1U
+
+/*! Number of words in a dirty-resource bitmap for \a N resources */
+#define SCMI_DIRTY_WORDS(N)  ((((N) - 1U) / 32U) + 1U)
+
+/*! Mark resource \a R as changed in dirty-resource bitmap \a D */
+#define SCMI_DIRTY_SET(D, R)  ((D)[(R) / 32U] |= BIT32(R))
+
+/*! Mark resource \a R as reverted in dirty-resource bitmap \a D */
+#define SCMI_DIRTY_CLR(D, R)  ((D)[(R) / 32U] &= ~BIT32(R))
+
+/*! Message descriptor for a fixed length request of type \a I */
+#define SCMI_MSG_DESC(I, O)  {(uint16_t) sizeof(I), (uint16_t) sizeof(O)}
+
+/*!
+ * Message descriptor for a variable length request with \a N fixed
+ * words (including the header), the handler checks the rest
+ */
+#define SCMI_MSG_DESC_VAR(N, O)  \
+    {(uint16_t) ((N) * sizeof(uint32_t)), (uint16_t) sizeof(O)}
+
 /* Types */
 
 /*! SCMI message structure (header only) */
@@ -88,6 +121,45 @@ typedef struct
     uint32_t header;  /*!< header (protocol, message, token*/
 } scmi_msg_header_t;
 
+/*!
+ * SCMI message descriptor
+ *
+ * Protocols define a table of these indexed by message ID. A \a lenIn
+ * of 0 marks an unsupported message.
+ */
+typedef struct
+{
+    uint16_t lenIn;   /*!< Min request length (bytes) */
+    uint16_t lenOut;  /*!< Response length (bytes) */
+} scmi_msg_desc_t;
+
+/*! SCMI P2A queue counters for an agent */
+typedef struct
+{
+    uint32_t depth;      /*!< Depth of the notification queue */
+    uint32_t queued;     /*!< Messages added to a queue */
+    uint32_t coalesced;  /*!< Messages merged into a queued message */
+    uint32_t dropped;    /*!< Messages dropped as a queue was full */
+} scmi_notify_counters_t;
+
+/*!
+ * SCMI service time statistics
+ *
+ * Service time is measured from the doorbell to the response. Histogram
+ * bucket n counts messages taking less than 2^n uS (bucket 0 less than
+ * 1uS), the last bucket counts all longer messages.
+ */
+typedef struct
+{
+    uint32_t id;                         /*!< Channel or protocol/message */
+    uint32_t count;                      /*!< Number of messages */
+    uint32_t errors;                     /*!< Number of error responses */
+    uint32_t minTime;                    /*!< Min service time (nS) */
+    uint32_t maxTime;                    /*!< Max service time (nS) */
+    uint64_t totalTime;                  /*!< Total service time (nS) */
+    uint32_t hist[SCMI_STATS_NUM_HIST];  /*!< Service time histogram */
+} scmi_stats_t;
+
 /* Functions */
 
 /*!
@@ -95,6 +167,19 @@ typedef struct
  * @{
  */
 
+/*!
+ * Check queue exists (P2A).
+ *
+ * @param[in]     agentId     Agent to send message
+ * @param[in]     queue       Notify or priority queue
+ *
+ * An agent without a P2A channel of the matching type has no queue and
+ * can never be sent a message on it.
+ *
+ * @return Returns true if the agent has the queue.
+ */
+bool RPC_SCMI_P2aTxQValid(uint32_t agentId, uint32_t queue);
+
 /*!
  * Check queue space (P2A).
  *
@@ -102,7 +187,9 @@ typedef struct
  * @param[in]     len         Length of message in bytes
  * @param[in]     queue       Notify or priority queue
  *
- * Check if sufficient space for a desired notification.
+ * Check if sufficient space for a desired notification. The queue is
+ * full if there is no free message entry or \a len is too large to
+ * queue.
  *
  * @return Returns true if insufficient space.
  */
@@ -116,15 +203,146 @@ bool RPC_SCMI_P2aTxQFull(uint32_t agentId, uint32_t len, uint32_t queue);
  * @param[in]     msg         Pointer to message to send
  * @param[in]     len         Length of message in bytes
  * @param[in]     queue       Notify or priority queue
+ * @param[in]     key         Coalesce key (resource)
  *
  * This function transmits an SCMI payload using the P2A protocol.
  * The \a agentId parameter identifies the queue to use. The channel
  * used is the SCMI channel of the ::SM_SCMI_CHN_P2A_NOTIFY type found for
  * the agent. The \a len parameter is the size in bytes of the source
  * payload.
+ *
+ * If a message with the same \a msgId and \a key is still in the queue
+ * then its payload is replaced with the new one rather than queuing a
+ * second message. Pass ::SCMI_NOTIFY_KEY_NONE for messages that must
+ * never be merged. If the queue is full the message is dropped. Both
+ * cases are counted (see RPC_SCMI_P2aCountersGet()).
  */
 void RPC_SCMI_P2aTxQ(uint32_t agentId, scmi_msg_id_t msgId, uint32_t *msg,
-    uint32_t len, uint32_t queue);
+    uint32_t len, uint32_t queue, uint32_t key);
+
+/*!
+ * Get P2A queue counters.
+ *
+ * @param[in]     agentId     Agent to get counters for
+ * @param[out]    counters    Pointer to return counters
+ * @param[in]     reset       True to reset the counters after reading
+ *
+ * This function returns the notification queue depth and the
+ * queued, coalesced and dropped message counters of an agent.
+ */
+void RPC_SCMI_P2aCountersGet(uint32_t agentId,
+    scmi_notify_counters_t *counters, bool reset);
+
+/*!
+ * Configure packed P2A notifications.
+ *
+ * @param[in]     agentId     Agent to configure
+ * @param[in]     enable      True to pack queued notifications
+ *
+ * When enabled, notifications queued for \a agentId are sent several
+ * at a time in one MISC_PACKED_EVENT notification.
+ */
+void RPC_SCMI_P2aPackSet(uint32_t agentId, bool enable);
+
+/*!
+ * Get SCMI service time statistics.
+ *
+ * @param[in]     scmiInst    SCMI instance
+ * @param[in]     type        Statistics type (channel or message)
+ * @param[in]     index       Index of the entry within the instance
+ * @param[out]    stats       Pointer to return statistics
+ *
+ * This function returns the \a index entry of the channel
+ * (::SCMI_STATS_TYPE_CHANNEL) or protocol message
+ * (::SCMI_STATS_TYPE_MSG) statistics of an SCMI instance. Only entries
+ * with recorded messages are counted. For channels the \a id field is
+ * the SCMI channel, for messages it is the protocol ID in bits [15:8]
+ * and the message ID in bits [7:0]. Only available if the SM is built
+ * with SCMI_STATS defined.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_FOUND: if \a index is beyond the last entry.
+ * - ::SM_ERR_INVALID_PARAMETERS: if \a type is not valid.
+ * - ::SM_ERR_NOT_SUPPORTED: if statistics are not built in.
+ */
+int32_t RPC_SCMI_StatsGet(uint32_t scmiInst, uint32_t type, uint32_t index,
+    scmi_stats_t *stats);
+
+/*!
+ * Dispatch an SCMI A2P message.
+ *
+ * @param[in]     caller      Caller info
+ *
+ * This function dispatches the message identified by the header in
+ * \a caller to the protocol handler. The input message, output buffer,
+ * and lengths must already be set in \a caller. It is used to dispatch
+ * the commands of a batch message (see MISC_BATCH).
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_COMMS_ERROR: if the message is not a command.
+ * - others returned by the protocol handler.
+ */
+int32_t RPC_SCMI_A2pMsgDispatch(scmi_caller_t *caller);
+
+/*!
+ * Check an SCMI A2P message against a descriptor table.
+ *
+ * @param[in]     caller      Caller info
+ * @param[in]     desc        Protocol message descriptor table
+ * @param[in]     numDesc     Number of entries in \a desc
+ * @param[in]     messageId   Message ID to check
+ * @param[out]    lenOut      Pointer to return the response length
+ *
+ * This function does the message checks common to all protocols before
+ * a protocol handles a message. It looks up \a messageId in \a desc,
+ * checks the request length, and returns the response length from the
+ * table. On error the response length is that of a status only
+ * response.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_NOT_SUPPORTED: if the message is not supported.
+ * - ::SM_ERR_PROTOCOL_ERROR: if the request is too short.
+ */
+int32_t RPC_SCMI_A2pMsgCheck(const scmi_caller_t *caller,
+    const scmi_msg_desc_t *desc, uint32_t numDesc, uint32_t messageId,
+    uint32_t *lenOut);
+
+/*!
+ * Check if an SCMI A2P message is supported.
+ *
+ * @param[in]     desc        Protocol message descriptor table
+ * @param[in]     numDesc     Number of entries in \a desc
+ * @param[in]     messageId   Message ID to check
+ *
+ * Used by the PROTOCOL_MESSAGE_ATTRIBUTES handlers so the supported
+ * messages are only listed once, in the descriptor table.
+ *
+ * @return Returns true if \a messageId has an entry in \a desc.
+ */
+bool RPC_SCMI_A2pMsgSupported(const scmi_msg_desc_t *desc,
+    uint32_t numDesc, uint32_t messageId);
+
+/*!
+ * Transmit SCMI delayed response (P2A).
+ *
+ * @param[in]     agentId     Agent to send message
+ * @param[in]     header      Header of the originating command
+ * @param[in]     msg         Pointer to message to send
+ * @param[in]     len         Length of message in bytes
+ *
+ * This function queues a delayed response on the notification queue of
+ * the agent. The response is sent with the protocol, message and token of
+ * the originating command \a header. Delayed responses are never
+ * coalesced. Use RPC_SCMI_P2aTxQFull() to check for space.
+ */
+void RPC_SCMI_P2aRespTxQ(uint32_t agentId, uint32_t header, uint32_t *msg,
+    uint32_t len);
 
 /*!
  * Bounded string copy.
@@ -138,6 +356,21 @@ void RPC_SCMI_P2aTxQ(uint32_t agentId, scmi_msg_id_t msgId, uint32_t *msg,
  */
 void RPC_SCMI_StrCpy(uint8_t *dst, const uint8_t *src, uint32_t maxLen);
 
+/*!
+ * Find the next resource in a dirty-resource bitmap.
+ *
+ * @param[in]     dirty    Dirty-resource bitmap
+ * @param[in]     numRsrc  Number of resources in the bitmap
+ * @param[in,out] rsrc     Resource to start from, returns the resource found
+ *
+ * Protocols mark the resources an agent changed so an agent reset only
+ * reverts those. Clean words are skipped 32 resources at a time.
+ *
+ * @return Returns true if a dirty resource was found.
+ */
+bool RPC_SCMI_DirtyNext(const uint32_t *dirty, uint32_t numRsrc,
+    uint32_t *rsrc);
+
 /*!
  * Get number of protocols.
  *
@@ -164,6 +397,31 @@ uint32_t RPC_SCMI_NumProtocolsGet(void);
 int32_t RPC_SCMI_ProtocolListGet(uint32_t skip, uint32_t numWords,
     uint32_t *numProtocols, uint32_t *protocolListDst);
 
+/*!
+ * Get FastChannel region of an agent.
+ *
+ * @param[in]   agentId          Agent to query
+ *
+ * The FastChannel region is the buffer of the ::SM_SCMI_CHN_A2P_FAST
+ * channel configured for the agent.
+ *
+ * @return Returns the region address or NULL if the agent has none.
+ */
+uint32_t *RPC_SCMI_FastChannelGet(uint32_t agentId);
+
+/*!
+ * Get FastChannel region of an agent as seen by the agent.
+ *
+ * @param[in]   agentId          Agent to query
+ *
+ * Returns the address of the region returned by RPC_SCMI_FastChannelGet()
+ * in the memory map of the agent. Addresses reported to the agent must be
+ * translated with this base.
+ *
+ * @return Returns the agent region address or 0 if the agent has none.
+ */
+uint64_t RPC_SCMI_FastChannelAgentAddrGet(uint32_t agentId);
+
 /** @} */
 
 #endif /* RPC_SCMI_INTERNAL_H */
@@ -47,7 +47,7 @@
 /* Protocol version */
 #define PROTOCOL_VERSION  0x10000U
 
-/* SCMI lmm protocol message IDs and masks */
+/* SCMI lmm protocol message IDs */
 #define COMMAND_PROTOCOL_VERSION             0x0U
 #define COMMAND_PROTOCOL_ATTRIBUTES          0x1U
 #define COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES  0x2U
@@ -60,7 +60,6 @@
 #define COMMAND_LMM_NOTIFY                   0x9U
 #define COMMAND_LMM_RESET_REASON             0xAU
 #define COMMAND_NEGOTIATE_PROTOCOL_VERSION   0x10U
-#define COMMAND_SUPPORTED_MASK               0x107FFUL
 
 /* SCMI LMM max argument lengths */
 #define LMM_MAX_NAME     16U
@@ -289,6 +288,28 @@ typedef struct
     uint32_t flags;
 } msg_rlmm32_t;
 
+/* Local variables */
+
+/* Message descriptors, indexed by message ID */
+static const scmi_msg_desc_t s_lmmMsgDesc[] =
+{
+    [COMMAND_PROTOCOL_VERSION] = SCMI_MSG_DESC(scmi_msg_header_t, msg_tlmm0_t),
+    [COMMAND_PROTOCOL_ATTRIBUTES] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tlmm1_t),
+    [COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES] =
+        SCMI_MSG_DESC(msg_rlmm2_t, msg_tlmm2_t),
+    [COMMAND_LMM_ATTRIBUTES] = SCMI_MSG_DESC(msg_rlmm3_t, msg_tlmm3_t),
+    [COMMAND_LMM_BOOT] = SCMI_MSG_DESC(msg_rlmm4_t, scmi_msg_status_t),
+    [COMMAND_LMM_RESET] = SCMI_MSG_DESC(msg_rlmm5_t, scmi_msg_status_t),
+    [COMMAND_LMM_SHUTDOWN] = SCMI_MSG_DESC(msg_rlmm6_t, scmi_msg_status_t),
+    [COMMAND_LMM_WAKE] = SCMI_MSG_DESC(msg_rlmm7_t, scmi_msg_status_t),
+    [COMMAND_LMM_SUSPEND] = SCMI_MSG_DESC(msg_rlmm8_t, scmi_msg_status_t),
+    [COMMAND_LMM_NOTIFY] = SCMI_MSG_DESC(msg_rlmm9_t, scmi_msg_status_t),
+    [COMMAND_LMM_RESET_REASON] = SCMI_MSG_DESC(msg_rlmm10_t, msg_tlmm10_t),
+    [COMMAND_NEGOTIATE_PROTOCOL_VERSION] =
+        SCMI_MSG_DESC(msg_rlmm16_t, scmi_msg_status_t)
+};
+
 /* Local functions */
 
 static int32_t LmmProtocolVersion(const scmi_caller_t *caller,
@@ -330,77 +351,72 @@ static int32_t LmmResetAgentConfig(uint32_t lmId, uint32_t agentId,
 int32_t RPC_SCMI_LmmDispatchCommand(scmi_caller_t *caller,
     uint32_t messageId)
 {
-    int32_t status = SM_ERR_SUCCESS;
+    int32_t status;
     const scmi_msg_t *in = caller->msgCopy;
     scmi_msg_status_t *out = caller->msg;
-    uint32_t lenOut = sizeof(scmi_msg_status_t);
+    uint32_t lenOut;
+
+    /* Check message */
+    status = RPC_SCMI_A2pMsgCheck(caller, s_lmmMsgDesc,
+        ARRAY_SIZE(s_lmmMsgDesc), messageId, &lenOut);
 
     /* Handle standard messages */
-    switch(messageId)
+    if (status == SM_ERR_SUCCESS)
     {
-        case COMMAND_PROTOCOL_VERSION:
-            lenOut = sizeof(msg_tlmm0_t);
-            status = LmmProtocolVersion(caller, (const scmi_msg_header_t*) in,
-                (msg_tlmm0_t*) out);
-            break;
-        case COMMAND_PROTOCOL_ATTRIBUTES:
-            lenOut = sizeof(msg_tlmm1_t);
-            status = LmmProtocolAttributes(caller,
-                (const scmi_msg_header_t*) in, (msg_tlmm1_t*) out);
-            break;
-        case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
-            lenOut = sizeof(msg_tlmm2_t);
-            status = LmmProtocolMessageAttributes(caller,
-                (const msg_rlmm2_t*) in, (msg_tlmm2_t*) out);
-            break;
-        case COMMAND_LMM_ATTRIBUTES:
-            lenOut = sizeof(msg_tlmm3_t);
-            status = LmmAttributes(caller, (const msg_rlmm3_t*) in,
-                (msg_tlmm3_t*) out);
-            break;
-        case COMMAND_LMM_BOOT:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = LmmBoot(caller, (const msg_rlmm4_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_LMM_RESET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = LmmReset(caller, (const msg_rlmm5_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_LMM_SHUTDOWN:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = LmmShutdown(caller, (const msg_rlmm6_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_LMM_WAKE:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = LmmWake(caller, (const msg_rlmm7_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_LMM_SUSPEND:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = LmmSuspend(caller, (const msg_rlmm8_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_LMM_NOTIFY:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = LmmNotify(caller, (const msg_rlmm9_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_LMM_RESET_REASON:
-            lenOut = sizeof(msg_tlmm10_t);
-            status = LmmResetReason(caller, (const msg_rlmm10_t*) in,
-                (msg_tlmm10_t*) out, &lenOut);
-            break;
-        case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = LmmNegotiateProtocolVersion(caller,
-                (const msg_rlmm16_t*) in, (const scmi_msg_status_t*) out);
-            break;
-        default:
-            status = SM_ERR_NOT_SUPPORTED;
-            break;
+        switch(messageId)
+        {
+            case COMMAND_PROTOCOL_VERSION:
+                status = LmmProtocolVersion(caller,
+                    (const scmi_msg_header_t*) in, (msg_tlmm0_t*) out);
+                break;
+            case COMMAND_PROTOCOL_ATTRIBUTES:
+                status = LmmProtocolAttributes(caller,
+                    (const scmi_msg_header_t*) in, (msg_tlmm1_t*) out);
+                break;
+            case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
+                status = LmmProtocolMessageAttributes(caller,
+                    (const msg_rlmm2_t*) in, (msg_tlmm2_t*) out);
+                break;
+            case COMMAND_LMM_ATTRIBUTES:
+                status = LmmAttributes(caller, (const msg_rlmm3_t*) in,
+                    (msg_tlmm3_t*) out);
+                break;
+            case COMMAND_LMM_BOOT:
+                status = LmmBoot(caller, (const msg_rlmm4_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_LMM_RESET:
+                status = LmmReset(caller, (const msg_rlmm5_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_LMM_SHUTDOWN:
+                status = LmmShutdown(caller, (const msg_rlmm6_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_LMM_WAKE:
+                status = LmmWake(caller, (const msg_rlmm7_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_LMM_SUSPEND:
+                status = LmmSuspend(caller, (const msg_rlmm8_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_LMM_NOTIFY:
+                status = LmmNotify(caller, (const msg_rlmm9_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_LMM_RESET_REASON:
+                status = LmmResetReason(caller, (const msg_rlmm10_t*) in,
+                    (msg_tlmm10_t*) out, &lenOut);
+                break;
+            case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
+                status = LmmNegotiateProtocolVersion(caller,
+                    (const msg_rlmm16_t*) in, (const scmi_msg_status_t*) out);
+                break;
+            default:
+                status = SM_ERR_NOT_SUPPORTED;
+                break;
+        }
     }
 
     /* Update length */
@@ -471,25 +487,14 @@ static uint8_t s_lmmNotify[SM_NUM_LM][SM_SCMI_NUM_AGNT];
 /* SCMI_LmmProtocolVersion().                                               */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t LmmProtocolVersion(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tlmm0_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return version */
-        out->version = PROTOCOL_VERSION;
-    }
+    /* Return version */
+    out->version = PROTOCOL_VERSION;
 
     /* Return status */
     return status;
@@ -511,25 +516,14 @@ static int32_t LmmProtocolVersion(const scmi_caller_t *caller,
 /* - LMM_PROTO_ATTR_NUM_LM() - Number of logical machines                   */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t LmmProtocolAttributes(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tlmm1_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return number of LMs */
-        out->attributes = LMM_PROTO_ATTR_NUM_LM(SM_NUM_LM);
-    }
+    /* Return number of LMs */
+    out->attributes = LMM_PROTO_ATTR_NUM_LM(SM_NUM_LM);
 
     /* Return status */
     return status;
@@ -553,31 +547,20 @@ static int32_t LmmProtocolAttributes(const scmi_caller_t *caller,
 /*   use.                                                                   */
 /* - SM_ERR_NOT_FOUND: if the message identified by messageId is invalid    */
 /*   or not provided by this platform implementation.                       */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t LmmProtocolMessageAttributes(const scmi_caller_t *caller,
     const msg_rlmm2_t *in, msg_tlmm2_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
+    /* Always zero */
+    out->attributes = 0U;
 
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
+    /* Is message supported ? */
+    if (!RPC_SCMI_A2pMsgSupported(s_lmmMsgDesc,
+        ARRAY_SIZE(s_lmmMsgDesc), in->messageId))
     {
-        /* Always zero */
-        out->attributes = 0U;
-
-        /* Is message supported ? */
-        if ((in->messageId >= 32U)
-            || (((COMMAND_SUPPORTED_MASK >> in->messageId) & 0x1U) == 0U))
-        {
-            status = SM_ERR_NOT_FOUND;
-        }
+        status = SM_ERR_NOT_FOUND;
     }
 
     /* Return status */
@@ -614,7 +597,6 @@ static int32_t LmmProtocolMessageAttributes(const scmi_caller_t *caller,
 /*   machine.                                                               */
 /* - SM_ERR_DENIED: if the calling agent is not allowed to get info for     */
 /*   the LM specified by lmId.                                              */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t LmmAttributes(const scmi_caller_t *caller,
     const msg_rlmm3_t *in, msg_tlmm3_t *out)
@@ -622,23 +604,14 @@ static int32_t LmmAttributes(const scmi_caller_t *caller,
     int32_t status = SM_ERR_SUCCESS;
     const uint8_t *nameAddr = (const uint8_t*) "";
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
+    /* Self discovery */
+    if (in->lmId != LMM_ID_DISCOVER)
     {
-        status = SM_ERR_PROTOCOL_ERROR;
+        out->lmId = in->lmId;
     }
-
-    /* Self discovery */
-    if (status == SM_ERR_SUCCESS)
+    else
     {
-        if (in->lmId != LMM_ID_DISCOVER)
-        {
-            out->lmId = in->lmId;
-        }
-        else
-        {
-            out->lmId = caller->lmId;
-        }
+        out->lmId = caller->lmId;
     }
 
     /* Check LM */
@@ -649,7 +622,7 @@ static int32_t LmmAttributes(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS) && (caller->lmId != out->lmId)
-        && (g_scmiAgentConfig[caller->agentId].lmmPerms[in->lmId]
+        && (SM_SCMI_PERM(g_scmiLmmPerms, caller->agentId, in->lmId)
         < SM_SCMI_PERM_GET))
     {
         status = SM_ERR_DENIED;
@@ -699,19 +672,12 @@ static int32_t LmmAttributes(const scmi_caller_t *caller,
 /* - SM_ERR_INVALID_PARAMETERS, if lmId is the same as the caller.          */
 /* - SM_ERR_DENIED: if the calling agent is not allowed to manage the LM    */
 /*   specified by lmId.                                                     */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t LmmBoot(const scmi_caller_t *caller, const msg_rlmm4_t *in,
     const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check LM */
     if ((status == SM_ERR_SUCCESS) && (in->lmId >= SM_NUM_LM))
     {
@@ -720,7 +686,7 @@ static int32_t LmmBoot(const scmi_caller_t *caller, const msg_rlmm4_t *in,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].lmmPerms[in->lmId]
+        && (SM_SCMI_PERM(g_scmiLmmPerms, caller->agentId, in->lmId)
         < SM_SCMI_PERM_PRIV))
     {
         status = SM_ERR_DENIED;
@@ -767,7 +733,6 @@ static int32_t LmmBoot(const scmi_caller_t *caller, const msg_rlmm4_t *in,
 /* - SM_ERR_INVALID_PARAMETERS, if lmId is the same as the caller.          */
 /* - SM_ERR_DENIED: if the calling agent is not allowed to manage the LM    */
 /*   specified by lmId.                                                     */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t LmmReset(const scmi_caller_t *caller, const msg_rlmm5_t *in,
     const scmi_msg_status_t *out)
@@ -775,12 +740,6 @@ static int32_t LmmReset(const scmi_caller_t *caller, const msg_rlmm5_t *in,
     int32_t status = SM_ERR_SUCCESS;
     bool graceful = LMM_FLAGS_GRACEFUL(in->flags) != 0U;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check LM */
     if ((status == SM_ERR_SUCCESS) && (in->lmId >= SM_NUM_LM))
     {
@@ -789,7 +748,7 @@ static int32_t LmmReset(const scmi_caller_t *caller, const msg_rlmm5_t *in,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].lmmPerms[in->lmId]
+        && (SM_SCMI_PERM(g_scmiLmmPerms, caller->agentId, in->lmId)
         < SM_SCMI_PERM_PRIV))
     {
         status = SM_ERR_DENIED;
@@ -836,7 +795,6 @@ static int32_t LmmReset(const scmi_caller_t *caller, const msg_rlmm5_t *in,
 /* - SM_ERR_INVALID_PARAMETERS, if lmId is the same as the caller.          */
 /* - SM_ERR_DENIED: if the calling agent is not allowed to manage the LM    */
 /*   specified by lmId.                                                     */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t LmmShutdown(const scmi_caller_t *caller, const msg_rlmm6_t *in,
     const scmi_msg_status_t *out)
@@ -844,12 +802,6 @@ static int32_t LmmShutdown(const scmi_caller_t *caller, const msg_rlmm6_t *in,
     int32_t status = SM_ERR_SUCCESS;
     bool graceful = LMM_FLAGS_GRACEFUL(in->flags) != 0U;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check LM */
     if ((status == SM_ERR_SUCCESS) && (in->lmId >= SM_NUM_LM))
     {
@@ -858,7 +810,7 @@ static int32_t LmmShutdown(const scmi_caller_t *caller, const msg_rlmm6_t *in,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].lmmPerms[in->lmId]
+        && (SM_SCMI_PERM(g_scmiLmmPerms, caller->agentId, in->lmId)
         < SM_SCMI_PERM_PRIV))
     {
         status = SM_ERR_DENIED;
@@ -897,19 +849,12 @@ static int32_t LmmShutdown(const scmi_caller_t *caller, const msg_rlmm6_t *in,
 /* - SM_ERR_INVALID_PARAMETERS, if lmId is the same as the caller.          */
 /* - SM_ERR_DENIED: if the calling agent is not allowed to manage the LM    */
 /*   specified by lmId.                                                     */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t LmmWake(const scmi_caller_t *caller, const msg_rlmm7_t *in,
     const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check LM */
     if ((status == SM_ERR_SUCCESS) && (in->lmId >= SM_NUM_LM))
     {
@@ -918,7 +863,7 @@ static int32_t LmmWake(const scmi_caller_t *caller, const msg_rlmm7_t *in,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].lmmPerms[in->lmId]
+        && (SM_SCMI_PERM(g_scmiLmmPerms, caller->agentId, in->lmId)
         < SM_SCMI_PERM_SET))
     {
         status = SM_ERR_DENIED;
@@ -957,19 +902,12 @@ static int32_t LmmWake(const scmi_caller_t *caller, const msg_rlmm7_t *in,
 /* - SM_ERR_INVALID_PARAMETERS, if lmId is the same as the caller.          */
 /* - SM_ERR_DENIED: if the calling agent is not allowed to manage the LM    */
 /*   specified by lmId.                                                     */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t LmmSuspend(const scmi_caller_t *caller, const msg_rlmm8_t *in,
     const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check LM */
     if ((status == SM_ERR_SUCCESS) && (in->lmId >= SM_NUM_LM))
     {
@@ -978,7 +916,7 @@ static int32_t LmmSuspend(const scmi_caller_t *caller, const msg_rlmm8_t *in,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].lmmPerms[in->lmId]
+        && (SM_SCMI_PERM(g_scmiLmmPerms, caller->agentId, in->lmId)
         < SM_SCMI_PERM_PRIV))
     {
         status = SM_ERR_DENIED;
@@ -1038,19 +976,12 @@ static int32_t LmmSuspend(const scmi_caller_t *caller, const msg_rlmm8_t *in,
 /*   unsupported or invalid configurations.                                 */
 /* - SM_ERR_DENIED: if the calling agent is not permitted to request the    */
 /*   notification.                                                          */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t LmmNotify(const scmi_caller_t *caller, const msg_rlmm9_t *in,
     const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check LM */
     if ((status == SM_ERR_SUCCESS) && (in->lmId >= SM_NUM_LM))
     {
@@ -1060,7 +991,7 @@ static int32_t LmmNotify(const scmi_caller_t *caller, const msg_rlmm9_t *in,
     /* Check permissions */
     if (status == SM_ERR_SUCCESS)
     {
-        if (g_scmiAgentConfig[caller->agentId].lmmPerms[in->lmId]
+        if (SM_SCMI_PERM(g_scmiLmmPerms, caller->agentId, in->lmId)
             < SM_SCMI_PERM_NOTIFY)
         {
             status = SM_ERR_DENIED;
@@ -1138,7 +1069,6 @@ static int32_t LmmNotify(const scmi_caller_t *caller, const msg_rlmm9_t *in,
 /* - SM_ERR_NOT_FOUND: if the LM identified by lmid does not exist.         */
 /* - SM_ERR_DENIED: if the calling agent is not permitted to request the    */
 /*   reset reason.                                                          */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t LmmResetReason(const scmi_caller_t *caller,
     const msg_rlmm10_t *in, msg_tlmm10_t *out, uint32_t *len)
@@ -1147,12 +1077,6 @@ static int32_t LmmResetReason(const scmi_caller_t *caller,
     lmm_rst_rec_t bootRec;
     lmm_rst_rec_t shutdownRec;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check LM */
     if ((status == SM_ERR_SUCCESS) && (in->lmId >= SM_NUM_LM))
     {
@@ -1161,7 +1085,7 @@ static int32_t LmmResetReason(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].lmmPerms[in->lmId]
+        && (SM_SCMI_PERM(g_scmiLmmPerms, caller->agentId, in->lmId)
         < SM_SCMI_PERM_GET))
     {
         status = SM_ERR_DENIED;
@@ -1231,19 +1155,12 @@ static int32_t LmmResetReason(const scmi_caller_t *caller,
 /*   successful return of this command must comply with the negotiated      */
 /*   version.                                                               */
 /* - SM_ERR_NOT_SUPPORTED: if the protocol version is not supported.        */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t LmmNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rlmm16_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check major version */
     if ((status == SM_ERR_SUCCESS) && (SCMI_VER_MAJOR(in->version)
         == SCMI_VER_MAJOR(PROTOCOL_VERSION)))
@@ -1296,7 +1213,8 @@ static int32_t LmmEvent(scmi_msg_id_t msgId,
 
                 /* Queue notification */
                 RPC_SCMI_P2aTxQ(dstAgent, msgId, (uint32_t*) &out,
-                    sizeof(out), SCMI_NOTIFY_Q);
+                    sizeof(out), SCMI_NOTIFY_Q,
+                    SCMI_NOTIFY_KEY_NONE);
             }
             if ((event == LMM_TRIGGER_PARM_LM_SHUTDOWN)
                 && (LMM_NOTIFY_SHUTDOWN(s_lmmNotify[eventLm][dstAgent]) != 0U))
@@ -1308,7 +1226,8 @@ static int32_t LmmEvent(scmi_msg_id_t msgId,
 
                 /* Queue notification */
                 RPC_SCMI_P2aTxQ(dstAgent, msgId, (uint32_t*) &out,
-                    sizeof(out), SCMI_NOTIFY_Q);
+                    sizeof(out), SCMI_NOTIFY_Q,
+                    SCMI_NOTIFY_KEY_NONE);
             }
         }
     }
@@ -47,7 +47,7 @@
 /* Protocol version */
 #define PROTOCOL_VERSION  0x10000U
 
-/* SCMI misc protocol message IDs and masks */
+/* SCMI misc protocol message IDs */
 #define COMMAND_PROTOCOL_VERSION             0x0U
 #define COMMAND_PROTOCOL_ATTRIBUTES          0x1U
 #define COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES  0x2U
@@ -60,8 +60,11 @@
 #define COMMAND_MISC_REASON_ATTRIBUTES       0x9U
 #define COMMAND_MISC_RESET_REASON            0xAU
 #define COMMAND_MISC_SI_INFO                 0xBU
+#define COMMAND_MISC_BATCH                   0xCU
+#define COMMAND_MISC_NOTIFY_COUNTERS         0xDU
+#define COMMAND_MISC_SCMI_STATS              0xEU
+#define COMMAND_MISC_NOTIFY_PACK             0xFU
 #define COMMAND_NEGOTIATE_PROTOCOL_VERSION   0x10U
-#define COMMAND_SUPPORTED_MASK               0x10FFFUL
 
 /* SCMI max misc argument lengths */
 #define MISC_MAX_BUILDDATE  16U
@@ -74,16 +77,29 @@
 #define MISC_MAX_RTN        SCMI_ARRAY(8U, uint32_t)
 #define MISC_MAX_PASSOVER   SCMI_ARRAY(8U, uint32_t)
 #define MISC_MAX_EXTINFO    SCMI_ARRAY(16U, uint32_t)
+#define MISC_MAX_CMDS_T     SCMI_ARRAY(8U, uint32_t)
+#define MISC_MAX_STATUS     SCMI_ARRAY(8U, int32_t)
+#define MISC_NUM_STATUS(C)  SCMI_ARRAY_CALLER(C, 8U, int32_t)
 
 /* Local macros */
 
 /* SCMI misc protocol attributes */
-#define MISC_PROTO_ATTR_NUM_REASON(x)  (((x) & 0xFFU) << 16U)
-#define MISC_PROTO_ATTR_NUM_CTRL(x)    (((x) & 0xFFFFU) << 0U)
+#define MISC_PROTO_ATTR_NOTIFY_PACK(x)  (((x) & 0x1U) << 24U)
+#define MISC_PROTO_ATTR_NUM_REASON(x)   (((x) & 0xFFU) << 16U)
+#define MISC_PROTO_ATTR_NUM_CTRL(x)     (((x) & 0xFFFFU) << 0U)
 
 /* SCMI reason flags */
 #define MISC_REASON_FLAG_SYSTEM(x)  (((x) & 0x1U) >> 0U)
 
+/* SCMI batch flags */
+#define MISC_BATCH_FLAG_STOP(x)  (((x) & 0x1U) >> 0U)
+
+/* SCMI notify counter flags */
+#define MISC_NOTIFY_FLAG_RESET(x)  (((x) & 0x1U) >> 0U)
+
+/* SCMI notify pack flags */
+#define MISC_NOTIFY_PACK_ENABLE(x)  (((x) & 0x1U) >> 0U)
+
 /* SCMI boot reason flags */
 #define MISC_BOOT_FLAG_VLD(x)      (((x) & 0x1U) << 31U)
 #define MISC_BOOT_FLAG_ORG_VLD(x)  (((x) & 0x1U) << 28U)
@@ -312,6 +328,101 @@ typedef struct
     uint8_t siName[MISC_MAX_SINAME];
 } msg_tmisc11_t;
 
+/* Request type for MiscBatch() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Batch flags */
+    uint32_t flags;
+    /* Number of commands */
+    uint32_t numCmds;
+    /* Packed command list */
+    uint32_t cmds[MISC_MAX_CMDS_T];
+} msg_rmisc12_t;
+
+/* Response type for MiscBatch() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Return status */
+    int32_t status;
+    /* Number of commands executed */
+    uint32_t numStatus;
+    /* Array of command status */
+    int32_t cmdStatus[MISC_MAX_STATUS];
+} msg_tmisc12_t;
+
+/* Request type for MiscNotifyCounters() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Counter flags */
+    uint32_t flags;
+} msg_rmisc13_t;
+
+/* Response type for MiscNotifyCounters() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Return status */
+    int32_t status;
+    /* Depth of the notification queue */
+    uint32_t depth;
+    /* Number of notifications queued */
+    uint32_t queued;
+    /* Number of notifications coalesced */
+    uint32_t coalesced;
+    /* Number of notifications dropped */
+    uint32_t dropped;
+} msg_tmisc13_t;
+
+/* Request type for MiscScmiStats() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Statistics type */
+    uint32_t type;
+    /* Index of the entry */
+    uint32_t index;
+} msg_rmisc14_t;
+
+/* Response type for MiscScmiStats() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Return status */
+    int32_t status;
+    /* Channel or protocol/message ID */
+    uint32_t id;
+    /* Number of messages */
+    uint32_t count;
+    /* Number of error responses */
+    uint32_t errors;
+    /* Minimum service time in nS */
+    uint32_t minTime;
+    /* Average service time in nS */
+    uint32_t avgTime;
+    /* Maximum service time in nS */
+    uint32_t maxTime;
+    /* Service time histogram */
+    uint32_t hist[SCMI_STATS_NUM_HIST];
+} msg_tmisc14_t;
+
+/* Request type for MiscNotifyPack() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Pack flags */
+    uint32_t flags;
+} msg_rmisc15_t;
+
 /* Request type for NegotiateProtocolVersion() */
 typedef struct
 {
@@ -332,6 +443,39 @@ typedef struct
     uint32_t flags;
 } msg_rmisc32_t;
 
+/* Local variables */
+
+/* Message descriptors, indexed by message ID */
+static const scmi_msg_desc_t s_miscMsgDesc[] =
+{
+    [COMMAND_PROTOCOL_VERSION] = SCMI_MSG_DESC(scmi_msg_header_t, msg_tmisc0_t),
+    [COMMAND_PROTOCOL_ATTRIBUTES] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tmisc1_t),
+    [COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES] =
+        SCMI_MSG_DESC(msg_rmisc2_t, msg_tmisc2_t),
+    [COMMAND_MISC_CONTROL_SET] = SCMI_MSG_DESC_VAR(3U, scmi_msg_status_t),
+    [COMMAND_MISC_CONTROL_GET] = SCMI_MSG_DESC(msg_rmisc4_t, msg_tmisc4_t),
+    [COMMAND_MISC_CONTROL_ACTION] = SCMI_MSG_DESC_VAR(4U, msg_tmisc5_t),
+    [COMMAND_MISC_DISCOVER_BUILD_INFO] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tmisc6_t),
+    [COMMAND_MISC_ROM_PASSOVER_GET] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tmisc7_t),
+    [COMMAND_MISC_CONTROL_NOTIFY] =
+        SCMI_MSG_DESC(msg_rmisc8_t, scmi_msg_status_t),
+    [COMMAND_MISC_REASON_ATTRIBUTES] =
+        SCMI_MSG_DESC(msg_rmisc9_t, msg_tmisc9_t),
+    [COMMAND_MISC_RESET_REASON] = SCMI_MSG_DESC(msg_rmisc10_t, msg_tmisc10_t),
+    [COMMAND_MISC_SI_INFO] = SCMI_MSG_DESC(scmi_msg_header_t, msg_tmisc11_t),
+    [COMMAND_MISC_BATCH] = SCMI_MSG_DESC_VAR(3U, msg_tmisc12_t),
+    [COMMAND_MISC_NOTIFY_COUNTERS] =
+        SCMI_MSG_DESC(msg_rmisc13_t, msg_tmisc13_t),
+    [COMMAND_MISC_SCMI_STATS] = SCMI_MSG_DESC(msg_rmisc14_t, msg_tmisc14_t),
+    [COMMAND_MISC_NOTIFY_PACK] =
+        SCMI_MSG_DESC(msg_rmisc15_t, scmi_msg_status_t),
+    [COMMAND_NEGOTIATE_PROTOCOL_VERSION] =
+        SCMI_MSG_DESC(msg_rmisc16_t, scmi_msg_status_t)
+};
+
 /* Local functions */
 
 static int32_t MiscProtocolVersion(const scmi_caller_t *caller,
@@ -358,6 +502,14 @@ static int32_t MiscResetReason(const scmi_caller_t *caller,
     const msg_rmisc10_t *in, msg_tmisc10_t *out, uint32_t *len);
 static int32_t MiscSiInfo(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tmisc11_t *out);
+static int32_t MiscBatch(const scmi_caller_t *caller,
+    const msg_rmisc12_t *in, msg_tmisc12_t *out, uint32_t *len);
+static int32_t MiscNotifyCounters(const scmi_caller_t *caller,
+    const msg_rmisc13_t *in, msg_tmisc13_t *out);
+static int32_t MiscScmiStats(const scmi_caller_t *caller,
+    const msg_rmisc14_t *in, msg_tmisc14_t *out);
+static int32_t MiscNotifyPack(const scmi_caller_t *caller,
+    const msg_rmisc15_t *in, const scmi_msg_status_t *out);
 static int32_t MiscNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rmisc16_t *in, const scmi_msg_status_t *out);
 static int32_t MiscControlEvent(scmi_msg_id_t msgId,
@@ -375,82 +527,93 @@ static int32_t MiscResetAgentConfig(uint32_t lmId, uint32_t agentId,
 int32_t RPC_SCMI_MiscDispatchCommand(scmi_caller_t *caller,
     uint32_t messageId)
 {
-    int32_t status = SM_ERR_SUCCESS;
+    int32_t status;
     const scmi_msg_t *in = caller->msgCopy;
     scmi_msg_status_t *out = caller->msg;
-    uint32_t lenOut = sizeof(scmi_msg_status_t);
+    uint32_t lenOut;
+
+    /* Check message */
+    status = RPC_SCMI_A2pMsgCheck(caller, s_miscMsgDesc,
+        ARRAY_SIZE(s_miscMsgDesc), messageId, &lenOut);
 
     /* Handle standard messages */
-    switch(messageId)
+    if (status == SM_ERR_SUCCESS)
     {
-        case COMMAND_PROTOCOL_VERSION:
-            lenOut = sizeof(msg_tmisc0_t);
-            status = MiscProtocolVersion(caller,
-                (const scmi_msg_header_t*) in, (msg_tmisc0_t*) out);
-            break;
-        case COMMAND_PROTOCOL_ATTRIBUTES:
-            lenOut = sizeof(msg_tmisc1_t);
-            status = MiscProtocolAttributes(caller,
-                (const scmi_msg_header_t*) in, (msg_tmisc1_t*) out);
-            break;
-        case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
-            lenOut = sizeof(msg_tmisc2_t);
-            status = MiscProtocolMessageAttributes(caller,
-                (const msg_rmisc2_t*) in, (msg_tmisc2_t*) out);
-            break;
-        case COMMAND_MISC_CONTROL_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = MiscControlSet(caller, (const msg_rmisc3_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_MISC_CONTROL_GET:
-            lenOut = sizeof(msg_tmisc4_t);
-            status = MiscControlGet(caller, (const msg_rmisc4_t*) in,
-                (msg_tmisc4_t*) out, &lenOut);
-            break;
-        case COMMAND_MISC_CONTROL_ACTION:
-            lenOut = sizeof(msg_tmisc5_t);
-            status = MiscControlAction(caller, (const msg_rmisc5_t*) in,
-                (msg_tmisc5_t*) out, &lenOut);
-            break;
-        case COMMAND_MISC_DISCOVER_BUILD_INFO:
-            lenOut = sizeof(msg_tmisc6_t);
-            status = MiscDiscoverBuildInfo(caller,
-                (const scmi_msg_header_t*) in, (msg_tmisc6_t*) out);
-            break;
-        case COMMAND_MISC_ROM_PASSOVER_GET:
-            lenOut = sizeof(msg_tmisc7_t);
-            status = MiscRomPassoverGet(caller, (const scmi_msg_header_t*) in,
-                (msg_tmisc7_t*) out, &lenOut);
-            break;
-        case COMMAND_MISC_CONTROL_NOTIFY:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = MiscControlNotify(caller, (const msg_rmisc8_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_MISC_REASON_ATTRIBUTES:
-            lenOut = sizeof(msg_tmisc9_t);
-            status = MiscReasonAttributes(caller, (const msg_rmisc9_t*) in,
-                (msg_tmisc9_t*) out);
-            break;
-        case COMMAND_MISC_RESET_REASON:
-            lenOut = sizeof(msg_tmisc10_t);
-            status = MiscResetReason(caller, (const msg_rmisc10_t*) in,
-                (msg_tmisc10_t*) out, &lenOut);
-            break;
-        case COMMAND_MISC_SI_INFO:
-            lenOut = sizeof(msg_tmisc11_t);
-            status = MiscSiInfo(caller, (const scmi_msg_header_t*) in,
-                (msg_tmisc11_t*) out);
-            break;
-        case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = MiscNegotiateProtocolVersion(caller,
-                (const msg_rmisc16_t*) in, (const scmi_msg_status_t*) out);
-            break;
-        default:
-            status = SM_ERR_NOT_SUPPORTED;
-            break;
+        switch(messageId)
+        {
+            case COMMAND_PROTOCOL_VERSION:
+                status = MiscProtocolVersion(caller,
+                    (const scmi_msg_header_t*) in, (msg_tmisc0_t*) out);
+                break;
+            case COMMAND_PROTOCOL_ATTRIBUTES:
+                status = MiscProtocolAttributes(caller,
+                    (const scmi_msg_header_t*) in, (msg_tmisc1_t*) out);
+                break;
+            case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
+                status = MiscProtocolMessageAttributes(caller,
+                    (const msg_rmisc2_t*) in, (msg_tmisc2_t*) out);
+                break;
+            case COMMAND_MISC_CONTROL_SET:
+                status = MiscControlSet(caller, (const msg_rmisc3_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_MISC_CONTROL_GET:
+                status = MiscControlGet(caller, (const msg_rmisc4_t*) in,
+                    (msg_tmisc4_t*) out, &lenOut);
+                break;
+            case COMMAND_MISC_CONTROL_ACTION:
+                status = MiscControlAction(caller, (const msg_rmisc5_t*) in,
+                    (msg_tmisc5_t*) out, &lenOut);
+                break;
+            case COMMAND_MISC_DISCOVER_BUILD_INFO:
+                status = MiscDiscoverBuildInfo(caller,
+                    (const scmi_msg_header_t*) in, (msg_tmisc6_t*) out);
+                break;
+            case COMMAND_MISC_ROM_PASSOVER_GET:
+                status = MiscRomPassoverGet(caller,
+                    (const scmi_msg_header_t*) in, (msg_tmisc7_t*) out,
+                    &lenOut);
+                break;
+            case COMMAND_MISC_CONTROL_NOTIFY:
+                status = MiscControlNotify(caller, (const msg_rmisc8_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_MISC_REASON_ATTRIBUTES:
+                status = MiscReasonAttributes(caller, (const msg_rmisc9_t*) in,
+                    (msg_tmisc9_t*) out);
+                break;
+            case COMMAND_MISC_RESET_REASON:
+                status = MiscResetReason(caller, (const msg_rmisc10_t*) in,
+                    (msg_tmisc10_t*) out, &lenOut);
+                break;
+            case COMMAND_MISC_SI_INFO:
+                status = MiscSiInfo(caller, (const scmi_msg_header_t*) in,
+                    (msg_tmisc11_t*) out);
+                break;
+            case COMMAND_MISC_BATCH:
+                status = MiscBatch(caller, (const msg_rmisc12_t*) in,
+                    (msg_tmisc12_t*) out, &lenOut);
+                break;
+            case COMMAND_MISC_NOTIFY_COUNTERS:
+                status = MiscNotifyCounters(caller, (const msg_rmisc13_t*) in,
+                    (msg_tmisc13_t*) out);
+                break;
+            case COMMAND_MISC_SCMI_STATS:
+                status = MiscScmiStats(caller, (const msg_rmisc14_t*) in,
+                    (msg_tmisc14_t*) out);
+                break;
+            case COMMAND_MISC_NOTIFY_PACK:
+                status = MiscNotifyPack(caller, (const msg_rmisc15_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
+                status = MiscNegotiateProtocolVersion(caller,
+                    (const msg_rmisc16_t*) in, (const scmi_msg_status_t*) out);
+                break;
+            default:
+                status = SM_ERR_NOT_SUPPORTED;
+                break;
+        }
     }
 
     /* Update length */
@@ -526,25 +689,14 @@ static int32_t MiscControlUpdate(uint32_t lmId, uint32_t agentId,
 /* SCMI_MiscProtocolVersion().                                              */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t MiscProtocolVersion(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tmisc0_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return version */
-        out->version = PROTOCOL_VERSION;
-    }
+    /* Return version */
+    out->version = PROTOCOL_VERSION;
 
     /* Return status */
     return status;
@@ -568,27 +720,17 @@ static int32_t MiscProtocolVersion(const scmi_caller_t *caller,
 /* - MISC_PROTO_ATTR_NUM_CTRL() - Number of controls                        */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t MiscProtocolAttributes(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tmisc1_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return number of controls */
-        out->attributes
-            = MISC_PROTO_ATTR_NUM_REASON(SM_NUM_REASON)
-            | MISC_PROTO_ATTR_NUM_CTRL(SM_NUM_CTRL);
-    }
+    /* Return number of controls */
+    out->attributes
+        = MISC_PROTO_ATTR_NOTIFY_PACK(1U)
+        | MISC_PROTO_ATTR_NUM_REASON(SM_NUM_REASON)
+        | MISC_PROTO_ATTR_NUM_CTRL(SM_NUM_CTRL);
 
     /* Return status */
     return status;
@@ -612,31 +754,20 @@ static int32_t MiscProtocolAttributes(const scmi_caller_t *caller,
 /*   use.                                                                   */
 /* - SM_ERR_NOT_FOUND: if the message identified by messageId is invalid    */
 /*   or not implemented.                                                    */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t MiscProtocolMessageAttributes(const scmi_caller_t *caller,
     const msg_rmisc2_t *in, msg_tmisc2_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
+    /* Always zero */
+    out->attributes = 0U;
 
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
+    /* Is message supported ? */
+    if (!RPC_SCMI_A2pMsgSupported(s_miscMsgDesc,
+        ARRAY_SIZE(s_miscMsgDesc), in->messageId))
     {
-        /* Always zero */
-        out->attributes = 0U;
-
-        /* Is message supported ? */
-        if ((in->messageId >= 32U)
-            || (((COMMAND_SUPPORTED_MASK >> in->messageId) & 0x1U) == 0U))
-        {
-            status = SM_ERR_NOT_FOUND;
-        }
+        status = SM_ERR_NOT_FOUND;
     }
 
     /* Return status */
@@ -682,7 +813,7 @@ static int32_t MiscControlSet(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].ctrlPerms[in->ctrlId]
+        && (SM_SCMI_PERM(g_scmiCtrlPerms, caller->agentId, in->ctrlId)
         < SM_SCMI_PERM_EXCLUSIVE))
     {
         status = SM_ERR_DENIED;
@@ -717,19 +848,12 @@ static int32_t MiscControlSet(const scmi_caller_t *caller,
 /* - SM_ERR_NOT_FOUND: if ctrlId does not point to a valid control.         */
 /* - SM_ERR_DENIED: if the calling agent is not allowed to get this         */
 /*   control.                                                               */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t MiscControlGet(const scmi_caller_t *caller,
     const msg_rmisc4_t *in, msg_tmisc4_t *out, uint32_t *len)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check control */
     if ((status == SM_ERR_SUCCESS) && (in->ctrlId >= SM_NUM_CTRL))
     {
@@ -738,7 +862,7 @@ static int32_t MiscControlGet(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].ctrlPerms[in->ctrlId]
+        && (SM_SCMI_PERM(g_scmiCtrlPerms, caller->agentId, in->ctrlId)
         < SM_SCMI_PERM_GET))
     {
         status = SM_ERR_DENIED;
@@ -804,7 +928,7 @@ static int32_t MiscControlAction(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].ctrlPerms[in->ctrlId]
+        && (SM_SCMI_PERM(g_scmiCtrlPerms, caller->agentId, in->ctrlId)
         < SM_SCMI_PERM_EXCLUSIVE))
     {
         status = SM_ERR_DENIED;
@@ -845,34 +969,23 @@ static int32_t MiscControlAction(const scmi_caller_t *caller,
 /* Return errors:                                                           */
 /* - SM_ERR_SUCCESS: in case the build info is returned.                    */
 /* - SM_ERR_NOT_SUPPORTED: if the data is not available.                    */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t MiscDiscoverBuildInfo(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tmisc6_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Copy out build number and commit */
-        out->buildNum = SM_BUILD;
-        out->buildCommit = SM_COMMIT;
+    /* Copy out build number and commit */
+    out->buildNum = SM_BUILD;
+    out->buildCommit = SM_COMMIT;
 
-        /* Copy out build date */
-        RPC_SCMI_StrCpy(out->buildDate, ((uint8_t const *) SM_DATE),
-            MISC_MAX_BUILDDATE);
+    /* Copy out build date */
+    RPC_SCMI_StrCpy(out->buildDate, ((uint8_t const *) SM_DATE),
+        MISC_MAX_BUILDDATE);
 
-        /* Copy out build time */
-        RPC_SCMI_StrCpy(out->buildTime, ((uint8_t const *) SM_TIME),
-            MISC_MAX_BUILDTIME);
-    }
+    /* Copy out build time */
+    RPC_SCMI_StrCpy(out->buildTime, ((uint8_t const *) SM_TIME),
+        MISC_MAX_BUILDTIME);
 
     /* Return status */
     return status;
@@ -893,7 +1006,6 @@ static int32_t MiscDiscoverBuildInfo(const scmi_caller_t *caller,
 /* Return errors:                                                           */
 /* - SM_ERR_SUCCESS: in case the ROM passover data is returned.             */
 /* - SM_ERR_NOT_SUPPORTED: if the data is not available.                    */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t MiscRomPassoverGet(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tmisc7_t *out, uint32_t *len)
@@ -906,17 +1018,8 @@ static int32_t MiscRomPassoverGet(const scmi_caller_t *caller,
     COMPILE_ASSERT((sizeof(rom_passover_t) / sizeof(uint32_t))
         <= MISC_MAX_PASSOVER);
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Get info */
-    if (status == SM_ERR_SUCCESS)
-    {
-        status = LMM_MiscRomPassoverGet(caller->lmId, &passover);
-    }
+    status = LMM_MiscRomPassoverGet(caller->lmId, &passover);
 
     /* Return data */
     if (status == SM_ERR_SUCCESS)
@@ -955,19 +1058,12 @@ static int32_t MiscRomPassoverGet(const scmi_caller_t *caller,
 /*   unsupported or invalid configurations.                                 */
 /* - SM_ERR_DENIED: if the calling agent is not permitted to request the    */
 /*   notification.                                                          */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t MiscControlNotify(const scmi_caller_t *caller,
     const msg_rmisc8_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check control */
     if ((status == SM_ERR_SUCCESS) && (in->ctrlId >= SM_NUM_CTRL))
     {
@@ -976,7 +1072,7 @@ static int32_t MiscControlNotify(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].ctrlPerms[in->ctrlId]
+        && (SM_SCMI_PERM(g_scmiCtrlPerms, caller->agentId, in->ctrlId)
         < SM_SCMI_PERM_NOTIFY))
     {
         status = SM_ERR_DENIED;
@@ -1011,7 +1107,6 @@ static int32_t MiscControlNotify(const scmi_caller_t *caller,
 /* Return errors:                                                           */
 /* - SM_ERR_SUCCESS: if valid reason attributes are returned.               */
 /* - SM_ERR_NOT_FOUND: if reasonId pertains to a non-existent reason.       */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t MiscReasonAttributes(const scmi_caller_t *caller,
     const msg_rmisc9_t *in, msg_tmisc9_t *out)
@@ -1019,12 +1114,6 @@ static int32_t MiscReasonAttributes(const scmi_caller_t *caller,
     int32_t status = SM_ERR_SUCCESS;
     const uint8_t *nameAddr = (const uint8_t*) "";
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check reason */
     if ((status == SM_ERR_SUCCESS) && (in->reasonId >= SM_NUM_REASON))
     {
@@ -1115,7 +1204,6 @@ static int32_t MiscReasonAttributes(const scmi_caller_t *caller,
 /* - MISC_SHUTDOWN_FLAG_REASON() - Reason                                   */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t MiscResetReason(const scmi_caller_t *caller,
     const msg_rmisc10_t *in, msg_tmisc10_t *out, uint32_t *len)
@@ -1125,27 +1213,18 @@ static int32_t MiscResetReason(const scmi_caller_t *caller,
     lmm_rst_rec_t shutdownRec;
     bool sys = MISC_REASON_FLAG_SYSTEM(in->flags) != 0U;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
+    /* Get reset reason */
+    if (sys)
     {
-        status = SM_ERR_PROTOCOL_ERROR;
+        /* Get reset info */
+        LM_SystemReason(caller->lmId, &bootRec,
+            &shutdownRec);
     }
-
-    /* Get reset reason */
-    if (status == SM_ERR_SUCCESS)
+    else
     {
-        if (sys)
-        {
-            /* Get reset info */
-            LM_SystemReason(caller->lmId, &bootRec,
-                &shutdownRec);
-        }
-        else
-        {
-            /* Get LM reset info */
-            status = LM_SystemLmReason(caller->lmId, caller->lmId,
-                &bootRec, &shutdownRec);
-        }
+        /* Get LM reset info */
+        status = LM_SystemLmReason(caller->lmId, caller->lmId,
+            &bootRec, &shutdownRec);
     }
 
     /* Fill in return data */
@@ -1203,7 +1282,6 @@ static int32_t MiscResetReason(const scmi_caller_t *caller,
 /* SCMI_MiscSiInfo().                                                       */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t MiscSiInfo(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tmisc11_t *out)
@@ -1214,18 +1292,9 @@ static int32_t MiscSiInfo(const scmi_caller_t *caller,
     uint32_t siRev;
     uint32_t partNum;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Get the silicon info */
-    if (status == SM_ERR_SUCCESS)
-    {
-        status = SM_SIINFOGET(&deviceId, &siRev, &partNum,
-            (string*) &nameAddr);
-    }
+    status = SM_SIINFOGET(&deviceId, &siRev, &partNum,
+        (string*) &nameAddr);
 
     /* Return results */
     if (status == SM_ERR_SUCCESS)
@@ -1243,6 +1312,290 @@ static int32_t MiscSiInfo(const scmi_caller_t *caller,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Execute a batch of commands                                              */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - in->flags: Batch flags:                                                */
+/*   Bits[31:1] Reserved, must be zero.                                     */
+/*   Bit[0] Stop on error. Set to 1 to stop executing commands after the    */
+/*   first command that fails                                               */
+/* - in->numCmds: Number of commands                                        */
+/* - in->cmds: Packed command list. Each command is a length word           */
+/*   followed by the command message. The length is the size of the         */
+/*   message in bytes, including the message header, and must be a          */
+/*   multiple of 4                                                          */
+/* - out->numStatus: Number of commands executed                            */
+/* - out->cmdStatus: Array of command status                                */
+/* - len: Pointer to length (can modify)                                    */
+/*                                                                          */
+/* Process the MISC_BATCH message. Platform handler for SCMI_MiscBatch().   */
+/* Commands are executed in order with the permissions of the calling       */
+/* agent. Only the status of each command is returned. Any other response   */
+/* data is discarded. Batches cannot be nested.                             */
+/*                                                                          */
+/*  Access macros:                                                          */
+/* - MISC_BATCH_FLAG_STOP() - Stop on error                                 */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_SUCCESS: if the commands were executed. The status of each      */
+/*   command is returned in cmdStatus.                                      */
+/* - SM_ERR_INVALID_PARAMETERS: if numCmds is larger than the status array  */
+/*   that fits in the channel.                                              */
+/* - SM_ERR_NOT_SUPPORTED: if called from within a batch.                   */
+/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small or the     */
+/*   command list is malformed.                                             */
+/*--------------------------------------------------------------------------*/
+static int32_t MiscBatch(const scmi_caller_t *caller,
+    const msg_rmisc12_t *in, msg_tmisc12_t *out, uint32_t *len)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    static bool s_batchActive = false;
+    uint32_t numWords = 0U;
+
+    /* Check request length */
+    if (caller->lenCopy < (3U * sizeof(uint32_t)))
+    {
+        status = SM_ERR_PROTOCOL_ERROR;
+    }
+    else
+    {
+        numWords = (caller->lenCopy / sizeof(uint32_t)) - 3U;
+    }
+
+    /* Check for nesting */
+    if ((status == SM_ERR_SUCCESS) && s_batchActive)
+    {
+        status = SM_ERR_NOT_SUPPORTED;
+    }
+
+    /* Check number of commands */
+    if ((status == SM_ERR_SUCCESS)
+        && (in->numCmds > MISC_NUM_STATUS(caller)))
+    {
+        status = SM_ERR_INVALID_PARAMETERS;
+    }
+
+    /* Check command list */
+    if (status == SM_ERR_SUCCESS)
+    {
+        uint32_t idx = 0U;
+
+        for (uint32_t cmd = 0U; cmd < in->numCmds; cmd++)
+        {
+            uint32_t cmdLen = 0U;
+
+            /* Get command length */
+            if (idx < numWords)
+            {
+                cmdLen = in->cmds[idx];
+            }
+
+            /* Check command fits */
+            if ((cmdLen < sizeof(uint32_t)) || ((cmdLen % 4U) != 0U)
+                || ((cmdLen / 4U) > (numWords - idx - 1U)))
+            {
+                status = SM_ERR_PROTOCOL_ERROR;
+                break;
+            }
+
+            /* Next command */
+            idx += 1U + (cmdLen / 4U);
+        }
+    }
+
+    /* Execute commands */
+    if (status == SM_ERR_SUCCESS)
+    {
+        static scmi_msg_t s_batchRsp;
+        uint32_t idx = 0U;
+
+        s_batchActive = true;
+        out->numStatus = 0U;
+        for (uint32_t cmd = 0U; cmd < in->numCmds; cmd++)
+        {
+            scmi_caller_t sub = *caller;
+
+            /* Point at command message, discard response data */
+            sub.msgCopy = (scmi_msg_t*) &caller->msgCopy->payload[3U + idx];
+            sub.msg = (scmi_msg_status_t*) &s_batchRsp;
+            sub.lenCopy = in->cmds[idx];
+            sub.lenMsg = sizeof(scmi_msg_status_t);
+            sub.lenMax = sizeof(s_batchRsp);
+            sub.header = in->cmds[idx + 1U];
+
+            /* Dispatch command */
+            out->cmdStatus[cmd] = RPC_SCMI_A2pMsgDispatch(&sub);
+            out->numStatus++;
+
+            /* Stop on error? */
+            if ((out->cmdStatus[cmd] != SM_ERR_SUCCESS)
+                && (MISC_BATCH_FLAG_STOP(in->flags) != 0U))
+            {
+                break;
+            }
+
+            /* Next command */
+            idx += 1U + (in->cmds[idx] / 4U);
+        }
+        s_batchActive = false;
+
+        /* Update length */
+        *len = (3U + out->numStatus) * sizeof(uint32_t);
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get notification counters                                                */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - in->flags: Counter flags:                                              */
+/*   Bits[31:1] Reserved, must be zero.                                     */
+/*   Bit[0] Reset. Set to 1 to reset the counters after reading them        */
+/* - out->depth: Depth of the notification queue in messages                */
+/* - out->queued: Number of notifications queued                            */
+/* - out->coalesced: Number of notifications merged into a queued           */
+/*   notification for the same resource                                     */
+/* - out->dropped: Number of notifications dropped as the queue was full    */
+/*                                                                          */
+/* Process the MISC_NOTIFY_COUNTERS message. Platform handler for           */
+/* SCMI_MiscNotifyCounters(). Returns the P2A queue counters of the calling */
+/* agent. Counters include notifications on the priority channel and        */
+/* delayed responses.                                                       */
+/*                                                                          */
+/*  Access macros:                                                          */
+/* - MISC_NOTIFY_FLAG_RESET() - Reset counters                              */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_SUCCESS: if the counters are returned.                          */
+/*--------------------------------------------------------------------------*/
+static int32_t MiscNotifyCounters(const scmi_caller_t *caller,
+    const msg_rmisc13_t *in, msg_tmisc13_t *out)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Return counters */
+    scmi_notify_counters_t counters;
+
+    RPC_SCMI_P2aCountersGet(caller->agentId, &counters,
+        MISC_NOTIFY_FLAG_RESET(in->flags) != 0U);
+
+    out->depth = counters.depth;
+    out->queued = counters.queued;
+    out->coalesced = counters.coalesced;
+    out->dropped = counters.dropped;
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get SCMI service time statistics                                         */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - in->type: Statistics type, 0 for channels, 1 for protocol messages     */
+/* - in->index: Index of the entry, entries without messages are skipped    */
+/* - out->id: Channel or protocol/message ID. For channels this is the      */
+/*   SCMI channel. For messages bits[15:8] are the protocol ID and          */
+/*   bits[7:0] the message ID                                               */
+/* - out->count: Number of messages                                         */
+/* - out->errors: Number of error responses                                 */
+/* - out->minTime: Minimum service time in nS                               */
+/* - out->avgTime: Average service time in nS                               */
+/* - out->maxTime: Maximum service time in nS                               */
+/* - out->hist: Service time histogram. Entry n counts messages taking less */
+/*   than 2^n uS, the last entry counts all longer messages                 */
+/*                                                                          */
+/* Process the MISC_SCMI_STATS message. Platform handler for                */
+/* SCMI_MiscScmiStats(). Read-only access to the statistics of the SCMI     */
+/* instance of the caller. Service time is measured from the doorbell to    */
+/* the response. Requires the SM to be built with SCMI_STATS defined.       */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_SUCCESS: if the statistics are returned.                        */
+/* - SM_ERR_NOT_FOUND: if the index is beyond the last entry.               */
+/* - SM_ERR_INVALID_PARAMETERS: if the type is invalid.                     */
+/* - SM_ERR_NOT_SUPPORTED: if statistics are not built in.                  */
+/*--------------------------------------------------------------------------*/
+static int32_t MiscScmiStats(const scmi_caller_t *caller,
+    const msg_rmisc14_t *in, msg_tmisc14_t *out)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    scmi_stats_t stats;
+
+    /* Get statistics */
+    status = RPC_SCMI_StatsGet(caller->scmiInst, in->type, in->index,
+        &stats);
+
+    /* Return statistics */
+    if (status == SM_ERR_SUCCESS)
+    {
+        out->id = stats.id;
+        out->count = stats.count;
+        out->errors = stats.errors;
+        out->minTime = stats.minTime;
+        out->avgTime = (uint32_t) (stats.totalTime / stats.count);
+        out->maxTime = stats.maxTime;
+        for (uint32_t bucket = 0U; bucket < SCMI_STATS_NUM_HIST; bucket++)
+        {
+            out->hist[bucket] = stats.hist[bucket];
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Configure packed notifications                                           */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - in->flags: Pack flags:                                                 */
+/*   Bits[31:1] Reserved, must be zero.                                     */
+/*   Bit[0] Enable. Set to 1 to receive packed notifications                */
+/*                                                                          */
+/* Process the MISC_NOTIFY_PACK message. Platform handler for               */
+/* SCMI_MiscNotifyPack(). When enabled, several notifications queued for    */
+/* the calling agent are sent in one MISC_PACKED_EVENT notification. A      */
+/* single queued notification and delayed responses are still sent as-is.   */
+/* Support is indicated in the protocol attributes.                         */
+/*                                                                          */
+/*  Access macros:                                                          */
+/* - MISC_NOTIFY_PACK_ENABLE() - Enable packing                             */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_SUCCESS: if packing is configured.                              */
+/* - SM_ERR_INVALID_PARAMETERS: if reserved flags are set.                  */
+/*--------------------------------------------------------------------------*/
+static int32_t MiscNotifyPack(const scmi_caller_t *caller,
+    const msg_rmisc15_t *in, const scmi_msg_status_t *out)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check flags */
+    if ((status == SM_ERR_SUCCESS) && ((in->flags & ~1U) != 0U))
+    {
+        status = SM_ERR_INVALID_PARAMETERS;
+    }
+
+    /* Configure packing */
+    if (status == SM_ERR_SUCCESS)
+    {
+        RPC_SCMI_P2aPackSet(caller->agentId,
+            MISC_NOTIFY_PACK_ENABLE(in->flags) != 0U);
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Negotiate the protocol version                                           */
 /*                                                                          */
@@ -1259,19 +1612,12 @@ static int32_t MiscSiInfo(const scmi_caller_t *caller,
 /*   successful return of this command must comply with the negotiated      */
 /*   version.                                                               */
 /* - SM_ERR_NOT_SUPPORTED: if the protocol version is not supported.        */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t MiscNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rmisc16_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check major version */
     if ((status == SM_ERR_SUCCESS) && (SCMI_VER_MAJOR(in->version)
         == SCMI_VER_MAJOR(PROTOCOL_VERSION)))
@@ -1321,7 +1667,7 @@ static int32_t MiscControlEvent(scmi_msg_id_t msgId,
 
             /* Queue notification */
             RPC_SCMI_P2aTxQ(dstAgent, msgId, (uint32_t*) &out,
-                sizeof(out), SCMI_NOTIFY_Q);
+                sizeof(out), SCMI_NOTIFY_Q, SCMI_NOTIFY_KEY_NONE);
         }
     }
 
@@ -1342,10 +1688,17 @@ static int32_t MiscResetAgentConfig(uint32_t lmId, uint32_t agentId,
 {
     int32_t status = SM_ERR_SUCCESS;
 
+    /* Disable packed notifications */
+    RPC_SCMI_P2aPackSet(agentId, false);
+
     /* Loop over all controls */
     for (uint32_t ctrlId = 0U; ctrlId < SM_NUM_CTRL; ctrlId++)
     {
-        (void) MiscControlUpdate(lmId, agentId, ctrlId, 0U);
+        /* Clear notifications the agent enabled */
+        if (s_ctrlNotify[ctrlId][agentId] != 0U)
+        {
+            (void) MiscControlUpdate(lmId, agentId, ctrlId, 0U);
+        }
     }
 
     /* Return status */
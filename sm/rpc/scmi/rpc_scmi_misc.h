@@ -60,6 +60,8 @@
 /** @{ */
 /*! Read control notification event */
 #define RPC_SCMI_NOTIFY_MISC_CONTROL_EVENT  0x0U
+/*! Read packed notification event */
+#define RPC_SCMI_NOTIFY_MISC_PACKED_EVENT   0x1U
 /** @} */
 
 /* Functions */
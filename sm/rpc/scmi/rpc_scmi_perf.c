@@ -47,7 +47,7 @@
 /* Protocol version */
 #define PROTOCOL_VERSION  0x40000U
 
-/* SCMI perf protocol message IDs and masks */
+/* SCMI perf protocol message IDs */
 #define COMMAND_PROTOCOL_VERSION               0x0U
 #define COMMAND_PROTOCOL_ATTRIBUTES            0x1U
 #define COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES    0x2U
@@ -57,12 +57,27 @@
 #define COMMAND_PERFORMANCE_LIMITS_GET         0x6U
 #define COMMAND_PERFORMANCE_LEVEL_SET          0x7U
 #define COMMAND_PERFORMANCE_LEVEL_GET          0x8U
+#define COMMAND_PERFORMANCE_NOTIFY_LIMITS      0x9U
+#define COMMAND_PERFORMANCE_NOTIFY_LEVEL       0xAU
+#define COMMAND_PERFORMANCE_DESCRIBE_FASTCHANNEL  0xBU
 #define COMMAND_NEGOTIATE_PROTOCOL_VERSION     0x10U
-#define COMMAND_SUPPORTED_MASK                 0x101FFUL
 
 /* SCMI max performance domain argument lengths */
 #define PERF_MAX_NAME        16U
 #define PERF_MAX_PERFLEVELS  SCMI_ARRAY(8U, perf_level_t)
+#define PERF_NUM_PERFLEVELS(C)  SCMI_ARRAY_CALLER(C, 8U, perf_level_t)
+
+/* SCMI performance FastChannel layout (words per domain) */
+#define PERF_FC_LEVEL_SET    0U
+#define PERF_FC_LEVEL_GET    1U
+#define PERF_FC_LIMITS_SET   2U
+#define PERF_FC_LIMITS_GET   4U
+#define PERF_FC_NUM_WORDS    6U
+#define PERF_FC_MAX_DOMAINS  ((SMT_BUFFER_SIZE - SMT_BUFFER_HEADER) \
+    / (PERF_FC_NUM_WORDS * 4U))
+
+/* SCMI performance FastChannel no request value */
+#define PERF_FC_NO_REQ  0xFFFFFFFFU
 
 /* SCMI performance power units */
 #define PERF_POWER_UNIT_ABSTRACT  0U
@@ -97,6 +112,12 @@
 /* SCMI performance level attributes */
 #define PERF_LEVEL_ATTR_LATENCY(x)  (((x) & 0xFFFFU) << 0U)
 
+/* SCMI performance FastChannel attributes */
+#define PERF_FC_ATTR_DOORBELL(x)  (((x) & 0x1U) << 0U)
+
+/* SCMI performance notification enable */
+#define PERF_NOTIFY_ENABLE(x)  (((x) & 0x1U) >> 0U)
+
 /* Local types */
 
 /* SCMI performance level */
@@ -280,6 +301,70 @@ typedef struct
     uint32_t performanceLevel;
 } msg_tperf8_t;
 
+/* Request type for PerformanceNotifyLimits() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Identifier for the performance domain */
+    uint32_t domainId;
+    /* Notification flags */
+    uint32_t notifyEnable;
+} msg_rperf9_t;
+
+/* Request type for PerformanceNotifyLevel() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Identifier for the performance domain */
+    uint32_t domainId;
+    /* Notification flags */
+    uint32_t notifyEnable;
+} msg_rperf10_t;
+
+/* Request type for PerformanceDescribeFastchannel() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Identifier for the performance domain */
+    uint32_t domainId;
+    /* Identifier for the message */
+    uint32_t messageId;
+} msg_rperf11_t;
+
+/* Response type for PerformanceDescribeFastchannel() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Return status */
+    int32_t status;
+    /* FastChannel attributes */
+    uint32_t attributes;
+    /* Rate limit */
+    uint32_t rateLimit;
+    /* Low address of the FastChannel */
+    uint32_t chanAddrLow;
+    /* High address of the FastChannel */
+    uint32_t chanAddrHigh;
+    /* Size of the FastChannel in bytes */
+    uint32_t chanSize;
+    /* Low address of the doorbell register */
+    uint32_t doorbellAddrLow;
+    /* High address of the doorbell register */
+    uint32_t doorbellAddrHigh;
+    /* Low mask of bits to set in the doorbell register */
+    uint32_t doorbellSetMaskLow;
+    /* High mask of bits to set in the doorbell register */
+    uint32_t doorbellSetMaskHigh;
+    /* Low mask of bits to preserve in the doorbell register */
+    uint32_t doorbellPreserveMaskLow;
+    /* High mask of bits to preserve in the doorbell register */
+    uint32_t doorbellPreserveMaskHigh;
+} msg_tperf11_t;
+
 /* Request type for NegotiateProtocolVersion() */
 typedef struct
 {
@@ -289,6 +374,57 @@ typedef struct
     uint32_t version;
 } msg_rperf16_t;
 
+/* Request type for PerformanceLevelChanged() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Refers to the agent that caused this event */
+    uint32_t agentId;
+    /* Identifier for the performance domain */
+    uint32_t domainId;
+    /* New performance level, or level index, of the domain */
+    uint32_t performanceLevel;
+} msg_rperf33_t;
+
+/* Local variables */
+
+/* Message descriptors, indexed by message ID */
+static const scmi_msg_desc_t s_perfMsgDesc[] =
+{
+    [COMMAND_PROTOCOL_VERSION] = SCMI_MSG_DESC(scmi_msg_header_t, msg_tperf0_t),
+    [COMMAND_PROTOCOL_ATTRIBUTES] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tperf1_t),
+    [COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES] =
+        SCMI_MSG_DESC(msg_rperf2_t, msg_tperf2_t),
+    [COMMAND_PERFORMANCE_DOMAIN_ATTRIBUTES] =
+        SCMI_MSG_DESC(msg_rperf3_t, msg_tperf3_t),
+    [COMMAND_PERFORMANCE_DESCRIBE_LEVELS] =
+        SCMI_MSG_DESC(msg_rperf4_t, msg_tperf4_t),
+    [COMMAND_PERFORMANCE_LIMITS_SET] =
+        SCMI_MSG_DESC(msg_rperf5_t, scmi_msg_status_t),
+    [COMMAND_PERFORMANCE_LIMITS_GET] =
+        SCMI_MSG_DESC(msg_rperf6_t, msg_tperf6_t),
+    [COMMAND_PERFORMANCE_LEVEL_SET] =
+        SCMI_MSG_DESC(msg_rperf7_t, scmi_msg_status_t),
+    [COMMAND_PERFORMANCE_LEVEL_GET] = SCMI_MSG_DESC(msg_rperf8_t, msg_tperf8_t),
+    [COMMAND_PERFORMANCE_NOTIFY_LIMITS] =
+        SCMI_MSG_DESC(msg_rperf9_t, scmi_msg_status_t),
+    [COMMAND_PERFORMANCE_NOTIFY_LEVEL] =
+        SCMI_MSG_DESC(msg_rperf10_t, scmi_msg_status_t),
+    [COMMAND_PERFORMANCE_DESCRIBE_FASTCHANNEL] =
+        SCMI_MSG_DESC(msg_rperf11_t, msg_tperf11_t),
+    [COMMAND_NEGOTIATE_PROTOCOL_VERSION] =
+        SCMI_MSG_DESC(msg_rperf16_t, scmi_msg_status_t)
+};
+
+/* FastChannel slot to domain map, built at init */
+static uint32_t s_fcDomain[SM_SCMI_NUM_AGNT][PERF_FC_MAX_DOMAINS];
+static uint32_t s_fcNumSlots[SM_SCMI_NUM_AGNT];
+
+/* Level change notification enables, bitmap per agent */
+static uint32_t s_perfNotify[SM_SCMI_NUM_AGNT];
+
 /* Local functions */
 
 static int32_t PerfProtocolVersion(const scmi_caller_t *caller,
@@ -309,10 +445,22 @@ static int32_t PerformanceLevelSet(const scmi_caller_t *caller,
     const msg_rperf7_t *in, const scmi_msg_status_t *out);
 static int32_t PerformanceLevelGet(const scmi_caller_t *caller,
     const msg_rperf8_t *in, msg_tperf8_t *out);
+static int32_t PerformanceNotifyLimits(const scmi_caller_t *caller,
+    const msg_rperf9_t *in, const scmi_msg_status_t *out);
+static int32_t PerformanceNotifyLevel(const scmi_caller_t *caller,
+    const msg_rperf10_t *in, const scmi_msg_status_t *out);
+static int32_t PerformanceDescribeFastchannel(const scmi_caller_t *caller,
+    const msg_rperf11_t *in, msg_tperf11_t *out);
 static int32_t PerfNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rperf16_t *in, const scmi_msg_status_t *out);
+static int32_t PerfLimitsGet(uint32_t lmId, uint32_t domainId,
+    uint32_t *rangeMax, uint32_t *rangeMin);
+static bool PerfFcSlotGet(uint32_t agentId, uint32_t domainId,
+    uint32_t *slot);
 static int32_t PerfResetAgentConfig(uint32_t lmId, uint32_t agentId,
     bool permissionsReset);
+static int32_t PerformanceLevelChanged(scmi_msg_id_t msgId,
+    const lmm_rpc_trigger_t *trigger);
 
 /*--------------------------------------------------------------------------*/
 /* Dispatch SCMI command                                                    */
@@ -324,72 +472,108 @@ static int32_t PerfResetAgentConfig(uint32_t lmId, uint32_t agentId,
 int32_t RPC_SCMI_PerfDispatchCommand(scmi_caller_t *caller,
     uint32_t messageId)
 {
-    int32_t status = SM_ERR_SUCCESS;
+    int32_t status;
     const scmi_msg_t *in = caller->msgCopy;
     scmi_msg_status_t *out = caller->msg;
-    uint32_t lenOut = sizeof(scmi_msg_status_t);
+    uint32_t lenOut;
+
+    /* Check message */
+    status = RPC_SCMI_A2pMsgCheck(caller, s_perfMsgDesc,
+        ARRAY_SIZE(s_perfMsgDesc), messageId, &lenOut);
 
     /* Handle standard messages */
-    switch(messageId)
+    if (status == SM_ERR_SUCCESS)
     {
-        case COMMAND_PROTOCOL_VERSION:
-            lenOut = sizeof(msg_tperf0_t);
-            status = PerfProtocolVersion(caller,
-                (const scmi_msg_header_t*) in, (msg_tperf0_t*) out);
-            break;
-        case COMMAND_PROTOCOL_ATTRIBUTES:
-            lenOut = sizeof(msg_tperf1_t);
-            status = PerfProtocolAttributes(caller,
-                (const scmi_msg_header_t*) in, (msg_tperf1_t*) out);
-            break;
-        case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
-            lenOut = sizeof(msg_tperf2_t);
-            status = PerfProtocolMessageAttributes(caller,
-                (const msg_rperf2_t*) in, (msg_tperf2_t*) out);
-            break;
-        case COMMAND_PERFORMANCE_DOMAIN_ATTRIBUTES:
-            lenOut = sizeof(msg_tperf3_t);
-            status = PerformanceDomainAttributes(caller,
-                (const msg_rperf3_t*) in, (msg_tperf3_t*) out);
-            break;
-        case COMMAND_PERFORMANCE_DESCRIBE_LEVELS:
-            lenOut = sizeof(msg_tperf4_t);
-            status = PerformanceDescribeLevels(caller,
-                (const msg_rperf4_t*) in, (msg_tperf4_t*) out, &lenOut);
-            break;
-        case COMMAND_PERFORMANCE_LIMITS_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = PerformanceLimitsSet(caller, (const msg_rperf5_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_PERFORMANCE_LIMITS_GET:
-            lenOut = sizeof(msg_tperf6_t);
-            status = PerformanceLimitsGet(caller, (const msg_rperf6_t*) in,
-                (msg_tperf6_t*) out);
-            break;
-        case COMMAND_PERFORMANCE_LEVEL_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = PerformanceLevelSet(caller, (const msg_rperf7_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_PERFORMANCE_LEVEL_GET:
-            lenOut = sizeof(msg_tperf8_t);
-            status = PerformanceLevelGet(caller, (const msg_rperf8_t*) in,
-                (msg_tperf8_t*) out);
-            break;
-        case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = PerfNegotiateProtocolVersion(caller,
-                (const msg_rperf16_t*) in, (const scmi_msg_status_t*) out);
+        switch(messageId)
+        {
+            case COMMAND_PROTOCOL_VERSION:
+                status = PerfProtocolVersion(caller,
+                    (const scmi_msg_header_t*) in, (msg_tperf0_t*) out);
+                break;
+            case COMMAND_PROTOCOL_ATTRIBUTES:
+                status = PerfProtocolAttributes(caller,
+                    (const scmi_msg_header_t*) in, (msg_tperf1_t*) out);
+                break;
+            case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
+                status = PerfProtocolMessageAttributes(caller,
+                    (const msg_rperf2_t*) in, (msg_tperf2_t*) out);
+                break;
+            case COMMAND_PERFORMANCE_DOMAIN_ATTRIBUTES:
+                status = PerformanceDomainAttributes(caller,
+                    (const msg_rperf3_t*) in, (msg_tperf3_t*) out);
+                break;
+            case COMMAND_PERFORMANCE_DESCRIBE_LEVELS:
+                status = PerformanceDescribeLevels(caller,
+                    (const msg_rperf4_t*) in, (msg_tperf4_t*) out, &lenOut);
+                break;
+            case COMMAND_PERFORMANCE_LIMITS_SET:
+                status = PerformanceLimitsSet(caller, (const msg_rperf5_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_PERFORMANCE_LIMITS_GET:
+                status = PerformanceLimitsGet(caller, (const msg_rperf6_t*) in,
+                    (msg_tperf6_t*) out);
+                break;
+            case COMMAND_PERFORMANCE_LEVEL_SET:
+                status = PerformanceLevelSet(caller, (const msg_rperf7_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_PERFORMANCE_LEVEL_GET:
+                status = PerformanceLevelGet(caller, (const msg_rperf8_t*) in,
+                    (msg_tperf8_t*) out);
+                break;
+            case COMMAND_PERFORMANCE_NOTIFY_LIMITS:
+                status = PerformanceNotifyLimits(caller,
+                    (const msg_rperf9_t*) in, (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_PERFORMANCE_NOTIFY_LEVEL:
+                status = PerformanceNotifyLevel(caller,
+                    (const msg_rperf10_t*) in, (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_PERFORMANCE_DESCRIBE_FASTCHANNEL:
+                status = PerformanceDescribeFastchannel(caller,
+                    (const msg_rperf11_t*) in, (msg_tperf11_t*) out);
+                break;
+            case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
+                status = PerfNegotiateProtocolVersion(caller,
+                    (const msg_rperf16_t*) in, (const scmi_msg_status_t*) out);
+                break;
+            default:
+                status = SM_ERR_NOT_SUPPORTED;
+                break;
+        }
+    }
+
+    /* Update length */
+    caller->lenMsg = lenOut;
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Dispatch SCMI notifications                                              */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - msgId: Message ID to dispatch                                          */
+/* - trigger: Trigger data                                                  */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_PerfDispatchNotification(scmi_msg_id_t msgId,
+    const lmm_rpc_trigger_t *trigger)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Handle notifications */
+    switch(msgId.messageId)
+    {
+        case RPC_SCMI_NOTIFY_PERFORMANCE_LEVEL_CHANGED:
+            status = PerformanceLevelChanged(msgId, trigger);
             break;
         default:
             status = SM_ERR_NOT_SUPPORTED;
             break;
     }
 
-    /* Update length */
-    caller->lenMsg = lenOut;
-
     /* Return status */
     return status;
 }
@@ -408,6 +592,92 @@ int32_t RPC_SCMI_PerfDispatchReset(uint32_t lmId, uint32_t agentId,
     return PerfResetAgentConfig(lmId, agentId, permissionsReset);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Init SCMI FastChannels                                                   */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - lmId: LM of the agent                                                  */
+/* - agentId: Agent owning the FastChannels                                 */
+/* - fc: Address of the FastChannel region                                  */
+/*                                                                          */
+/* Slots are assigned in domain order to the domains the agent has PRIV     */
+/* access to. Limits are filled in once as LIMITS_SET is not supported and  */
+/* the level tables are fixed.                                              */
+/*--------------------------------------------------------------------------*/
+void RPC_SCMI_PerfFastChannelInit(uint32_t lmId, uint32_t agentId,
+    uint32_t *fc)
+{
+    uint32_t numSlots = 0U;
+
+    /* Build slot map */
+    for (uint32_t domainId = 0U; domainId < SM_NUM_PERF; domainId++)
+    {
+        if ((numSlots < PERF_FC_MAX_DOMAINS)
+            && (SM_SCMI_PERM(g_scmiPerfPerms, agentId, domainId)
+            >= SM_SCMI_PERM_PRIV))
+        {
+            s_fcDomain[agentId][numSlots] = domainId;
+            numSlots++;
+        }
+    }
+    s_fcNumSlots[agentId] = numSlots;
+
+    /* Init slots */
+    for (uint32_t slot = 0U; slot < PERF_FC_MAX_DOMAINS; slot++)
+    {
+        uint32_t *dom = &fc[slot * PERF_FC_NUM_WORDS];
+        uint32_t rangeMax, rangeMin;
+
+        /* Mark level request as consumed */
+        dom[PERF_FC_LEVEL_SET] = PERF_FC_NO_REQ;
+
+        /* Fill in limits */
+        if ((slot < numSlots) && (PerfLimitsGet(lmId,
+            s_fcDomain[agentId][slot], &rangeMax, &rangeMin)
+            == SM_ERR_SUCCESS))
+        {
+            dom[PERF_FC_LIMITS_GET] = rangeMax;
+            dom[PERF_FC_LIMITS_GET + 1U] = rangeMin;
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Dispatch SCMI FastChannels                                               */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - lmId: LM of the agent                                                  */
+/* - agentId: Agent owning the FastChannels                                 */
+/* - fc: Address of the FastChannel region                                  */
+/*--------------------------------------------------------------------------*/
+void RPC_SCMI_PerfDispatchFastChannel(uint32_t lmId, uint32_t agentId,
+    uint32_t *fc)
+{
+    /* Loop over slots */
+    for (uint32_t slot = 0U; slot < s_fcNumSlots[agentId]; slot++)
+    {
+        uint32_t domainId = s_fcDomain[agentId][slot];
+        uint32_t *dom = &fc[slot * PERF_FC_NUM_WORDS];
+        uint32_t level = dom[PERF_FC_LEVEL_SET];
+
+        /* New level requested? */
+        if (level != PERF_FC_NO_REQ)
+        {
+            /* Consume request so the same level can be requested again */
+            dom[PERF_FC_LEVEL_SET] = PERF_FC_NO_REQ;
+
+            /* Errors cannot be reported via a FastChannel */
+            (void) LMM_PerfLevelSet(lmId, domainId, level);
+        }
+
+        /* Update current level */
+        if (LMM_PerfLevelGet(lmId, domainId, &level) == SM_ERR_SUCCESS)
+        {
+            dom[PERF_FC_LEVEL_GET] = level;
+        }
+    }
+}
+
 /*==========================================================================*/
 /* Custom Protocol Implementation                                           */
 /*==========================================================================*/
@@ -424,25 +694,14 @@ int32_t RPC_SCMI_PerfDispatchReset(uint32_t lmId, uint32_t agentId,
 /* SCMI_PerfProtocolVersion(). See section 4.5.3.1 in the SCMI spec.        */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PerfProtocolVersion(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tperf0_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return version */
-        out->version = PROTOCOL_VERSION;
-    }
+    /* Return version */
+    out->version = PROTOCOL_VERSION;
 
     /* Return status */
     return status;
@@ -486,35 +745,24 @@ static int32_t PerfProtocolVersion(const scmi_caller_t *caller,
 /* - PERF_PROTO_ATTR_NUM_DOMAINS() - Number of performance domains          */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PerfProtocolAttributes(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tperf1_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
+    /* Return number of performance domains */
+    out->attributes = PERF_PROTO_ATTR_NUM_DOMAINS((uint32_t)
+        SM_NUM_PERF);
 
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return number of performance domains */
-        out->attributes = PERF_PROTO_ATTR_NUM_DOMAINS((uint32_t)
-            SM_NUM_PERF);
-
-        /* Power consumption in mW */
-        out->attributes |= PERF_PROTO_ATTR_POWER_UNIT((uint32_t)
-            PERF_POWER_UNIT_MW);
-
-        /* Statistics not supported */
-        out->statisticsAddressLow = 0U;
-        out->statisticsAddressHigh = 0U;
-        out->statisticsLen = 0U;
-    }
+    /* Power consumption in mW */
+    out->attributes |= PERF_PROTO_ATTR_POWER_UNIT((uint32_t)
+        PERF_POWER_UNIT_MW);
+
+    /* Statistics not supported */
+    out->statisticsAddressLow = 0U;
+    out->statisticsAddressHigh = 0U;
+    out->statisticsLen = 0U;
 
     /* Return status */
     return status;
@@ -546,33 +794,30 @@ static int32_t PerfProtocolAttributes(const scmi_caller_t *caller,
 /*   use.                                                                   */
 /* - SM_ERR_NOT_FOUND: if the message identified by messageId is invalid    */
 /*   or not provided by this platform implementation.                       */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PerfProtocolMessageAttributes(const scmi_caller_t *caller,
     const msg_rperf2_t *in, msg_tperf2_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
+    /* Report FastChannel support */
+    if ((RPC_SCMI_FastChannelGet(caller->agentId) != NULL)
+        && ((in->messageId == COMMAND_PERFORMANCE_LEVEL_SET)
+        || (in->messageId == COMMAND_PERFORMANCE_LEVEL_GET)
+        || (in->messageId == COMMAND_PERFORMANCE_LIMITS_GET)))
     {
-        status = SM_ERR_PROTOCOL_ERROR;
+        out->attributes = PERF_MSG_ATTR_FAST(1UL);
     }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
+    else
     {
-        uint32_t mask = COMMAND_SUPPORTED_MASK;
-
-        /* Always zero */
         out->attributes = 0U;
+    }
 
-        /* Is message supported ? */
-        if ((in->messageId >= 32U) || (((mask >> in->messageId)
-            & 0x1U) == 0U))
-        {
-            status = SM_ERR_NOT_FOUND;
-        }
+    /* Is message supported ? */
+    if (!RPC_SCMI_A2pMsgSupported(s_perfMsgDesc,
+        ARRAY_SIZE(s_perfMsgDesc), in->messageId))
+    {
+        status = SM_ERR_NOT_FOUND;
     }
 
     /* Return status */
@@ -657,7 +902,6 @@ static int32_t PerfProtocolMessageAttributes(const scmi_caller_t *caller,
 /* Return errors:                                                           */
 /* - SM_ERR_SUCCESS: if valid performance domain attributes are found.      */
 /* - SM_ERR_NOT_FOUND: if domainId does not point to a valid domain.        */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PerformanceDomainAttributes(const scmi_caller_t *caller,
     const msg_rperf3_t *in, msg_tperf3_t *out)
@@ -666,12 +910,6 @@ static int32_t PerformanceDomainAttributes(const scmi_caller_t *caller,
     const uint8_t *nameAddr = (const uint8_t*) "";
     dev_sm_perf_info_t info;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check domain */
     if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_PERF))
     {
@@ -694,34 +932,42 @@ static int32_t PerformanceDomainAttributes(const scmi_caller_t *caller,
     /* Return results */
     if (status == SM_ERR_SUCCESS)
     {
+        uint32_t slot;
+
         /* Copy info */
         out->rateLimit = info.rateLimit;
         out->sustainedFreq = info.sustainedFreq;
         out->sustainedPerfLevel = info.sustainedPerfLevel;
 
-        /* No notifications */
+        /* Limit and level change notifications */
         out->attributes
-            = PERF_ATTR_LIMIT_NOTIFY(0UL)
-            | PERF_ATTR_LEVEL_NOTIFY(0UL)
+            = PERF_ATTR_LIMIT_NOTIFY(1UL)
+            | PERF_ATTR_LEVEL_NOTIFY(1UL)
             | PERF_ATTR_FAST(0UL)
             | PERF_ATTR_EXT_NAME(0UL)
             | PERF_ATTR_IDX_MODE(1UL)
             | PERF_RATE_LIMIT_USECONDS(0UL);
 
         /* Can set performance levels */
-        if ((g_scmiAgentConfig[caller->agentId].perfPerms[in->domainId]
+        if ((SM_SCMI_PERM(g_scmiPerfPerms, caller->agentId, in->domainId)
             >= SM_SCMI_PERM_PRIV))
         {
             out->attributes |= PERF_ATTR_LEVEL(1UL);
         }
 
         /* Can set limits */
-        if ((g_scmiAgentConfig[caller->agentId].perfPerms[in->domainId]
+        if ((SM_SCMI_PERM(g_scmiPerfPerms, caller->agentId, in->domainId)
             >= SM_SCMI_PERM_SET))
         {
             out->attributes |= PERF_ATTR_LIMIT(1UL);
         }
 
+        /* Has FastChannels */
+        if (PerfFcSlotGet(caller->agentId, in->domainId, &slot))
+        {
+            out->attributes |= PERF_ATTR_FAST(1UL);
+        }
+
         /* Copy out name */
         RPC_SCMI_StrCpy(out->name, nameAddr, PERF_MAX_NAME);
     }
@@ -773,7 +1019,6 @@ static int32_t PerformanceDomainAttributes(const scmi_caller_t *caller,
 /* - SM_ERR_SUCCESS: if valid performance levels are returned.              */
 /* - SM_ERR_NOT_FOUND: if domainId does not point to a valid domain.        */
 /* - SM_ERR_OUT_OF_RANGE: if levelIndex is out of range.                    */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PerformanceDescribeLevels(const scmi_caller_t *caller,
     const msg_rperf4_t *in, msg_tperf4_t *out, uint32_t *len)
@@ -781,12 +1026,6 @@ static int32_t PerformanceDescribeLevels(const scmi_caller_t *caller,
     int32_t status = SM_ERR_SUCCESS;
     uint32_t levels = 0U;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check domain */
     if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_PERF))
     {
@@ -813,7 +1052,7 @@ static int32_t PerformanceDescribeLevels(const scmi_caller_t *caller,
         uint32_t index;
 
         out->numLevels = 0U;
-        for (index = 0U; index < PERF_MAX_PERFLEVELS; index++)
+        for (index = 0U; index < PERF_NUM_PERFLEVELS(caller); index++)
         {
             dev_sm_perf_desc_t lmmDesc;
 
@@ -889,19 +1128,12 @@ static int32_t PerformanceDescribeLevels(const scmi_caller_t *caller,
 /* - SM_ERR_DENIED: if the calling agent is not permitted to change the     */
 /*   performance limits for the domain, as described by                     */
 /*   PERFORMANCE_DOMAIN_ATTRIBUTES.                                         */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PerformanceLimitsSet(const scmi_caller_t *caller,
     const msg_rperf5_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check domain */
     if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_PERF))
     {
@@ -910,7 +1142,7 @@ static int32_t PerformanceLimitsSet(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].perfPerms[in->domainId]
+        && (SM_SCMI_PERM(g_scmiPerfPerms, caller->agentId, in->domainId)
         < SM_SCMI_PERM_SET))
     {
         status = SM_ERR_DENIED;
@@ -941,19 +1173,11 @@ static int32_t PerformanceLimitsSet(const scmi_caller_t *caller,
 /* Return errors:                                                           */
 /* - SM_ERR_SUCCESS: if the performance limits are returned successfully.   */
 /* - SM_ERR_NOT_FOUND: if domainId does not point to a valid domain.        */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PerformanceLimitsGet(const scmi_caller_t *caller,
     const msg_rperf6_t *in, msg_tperf6_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
-    uint32_t numLevels;
-
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
 
     /* Check domain */
     if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_PERF))
@@ -961,49 +1185,11 @@ static int32_t PerformanceLimitsGet(const scmi_caller_t *caller,
         status = SM_ERR_NOT_FOUND;
     }
 
-    /* Get number of levels */
-    if (status == SM_ERR_SUCCESS)
-    {
-        status = LMM_PerfNumLevelsGet(caller->lmId, in->domainId,
-            &numLevels);
-    }
-
-    /* Get levels? */
+    /* Get limits */
     if (status == SM_ERR_SUCCESS)
     {
-        uint32_t index;
-
-        /* Set initial extremes */
-        out->rangeMin = 0xFFFFFFFFU;
-        out->rangeMax = 0x0U;
-
-        /* Loop over levels */
-        for (index = 0U; index < numLevels; index++)
-        {
-            dev_sm_perf_desc_t desc;
-
-            /* Get performance level */
-            status = LMM_PerfDescribe(caller->lmId, in->domainId,
-                index, &desc);
-
-            /* Error? */
-            if (status != SM_ERR_SUCCESS)
-            {
-                break;
-            }
-
-            /* Check min */
-            if (desc.value < out->rangeMin)
-            {
-                out->rangeMin = desc.value;
-            }
-
-            /* Check max */
-            if (desc.value > out->rangeMax)
-            {
-                out->rangeMax = desc.value;
-            }
-        }
+        status = PerfLimitsGet(caller->lmId, in->domainId, &out->rangeMax,
+            &out->rangeMin);
     }
 
     /* Return status */
@@ -1032,19 +1218,12 @@ static int32_t PerformanceLimitsGet(const scmi_caller_t *caller,
 /* - SM_ERR_DENIED: if the calling agent is not permitted to change the     */
 /*   performance level for a domain, as described by                        */
 /*   PERFORMANCE_DOMAIN_ATTRIBUTES.                                         */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PerformanceLevelSet(const scmi_caller_t *caller,
     const msg_rperf7_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check domain */
     if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_PERF))
     {
@@ -1053,7 +1232,7 @@ static int32_t PerformanceLevelSet(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].perfPerms[in->domainId]
+        && (SM_SCMI_PERM(g_scmiPerfPerms, caller->agentId, in->domainId)
         < SM_SCMI_PERM_PRIV))
     {
         status = SM_ERR_DENIED;
@@ -1085,19 +1264,12 @@ static int32_t PerformanceLevelSet(const scmi_caller_t *caller,
 /* Return errors:                                                           */
 /* - SM_ERR_SUCCESS: if the performance level is returned successfully      */
 /* - SM_ERR_NOT_FOUND: if domainId does not point to a valid domain.        */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PerformanceLevelGet(const scmi_caller_t *caller,
     const msg_rperf8_t *in, msg_tperf8_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check domain */
     if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_PERF))
     {
@@ -1116,6 +1288,243 @@ static int32_t PerformanceLevelGet(const scmi_caller_t *caller,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Configure performance limits notification                                */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - in->domainId: Identifier for the performance domain                    */
+/* - in->notifyEnable: Notification flags:                                  */
+/*   Bits[31:1] Reserved, must be zero.                                     */
+/*   Bit[0] Notify enable. This bit must be set to 1 if an agent wants to   */
+/*   receive PERFORMANCE_LIMITS_CHANGED notifications, and set to 0         */
+/*   otherwise.                                                             */
+/*                                                                          */
+/* Process the PERFORMANCE_NOTIFY_LIMITS message. Platform handler for      */
+/* SCMI_PerformanceNotifyLimits(). Requires access greater than or equal    */
+/* to NOTIFY. See section 4.5.3.11 in the SCMI spec.                        */
+/*                                                                          */
+/* The limits of a domain are fixed by its level table and cannot be set    */
+/* by agents, so no PERFORMANCE_LIMITS_CHANGED notification is ever         */
+/* generated. The request is accepted so agents can subscribe uniformly.    */
+/*                                                                          */
+/*  Access macros:                                                          */
+/* - PERF_NOTIFY_ENABLE() - Notify enable                                   */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_SUCCESS: if the notification state was successfully updated.    */
+/* - SM_ERR_NOT_FOUND: if domainId does not point to a valid domain.        */
+/* - SM_ERR_DENIED: if the calling agent is not permitted to request the    */
+/*   notification.                                                          */
+/* - SM_ERR_INVALID_PARAMETERS: if notifyEnable specifies values that are   */
+/*   either illegal or incorrect.                                           */
+/*--------------------------------------------------------------------------*/
+static int32_t PerformanceNotifyLimits(const scmi_caller_t *caller,
+    const msg_rperf9_t *in, const scmi_msg_status_t *out)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check domain */
+    if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_PERF))
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Check permissions */
+    if ((status == SM_ERR_SUCCESS)
+        && (SM_SCMI_PERM(g_scmiPerfPerms, caller->agentId, in->domainId)
+        < SM_SCMI_PERM_NOTIFY))
+    {
+        status = SM_ERR_DENIED;
+    }
+
+    /* Check flags */
+    if ((status == SM_ERR_SUCCESS) && ((in->notifyEnable & ~1U) != 0U))
+    {
+        status = SM_ERR_INVALID_PARAMETERS;
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Configure performance level notification                                 */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - in->domainId: Identifier for the performance domain                    */
+/* - in->notifyEnable: Notification flags:                                  */
+/*   Bits[31:1] Reserved, must be zero.                                     */
+/*   Bit[0] Notify enable. This bit must be set to 1 if an agent wants to   */
+/*   receive PERFORMANCE_LEVEL_CHANGED notifications, and set to 0          */
+/*   otherwise.                                                             */
+/*                                                                          */
+/* Process the PERFORMANCE_NOTIFY_LEVEL message. Platform handler for       */
+/* SCMI_PerformanceNotifyLevel(). Requires access greater than or equal to  */
+/* NOTIFY. See section 4.5.3.12 in the SCMI spec.                           */
+/*                                                                          */
+/*  Access macros:                                                          */
+/* - PERF_NOTIFY_ENABLE() - Notify enable                                   */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_SUCCESS: if the notification state was successfully updated.    */
+/* - SM_ERR_NOT_FOUND: if domainId does not point to a valid domain.        */
+/* - SM_ERR_DENIED: if the calling agent is not permitted to request the    */
+/*   notification.                                                          */
+/* - SM_ERR_INVALID_PARAMETERS: if notifyEnable specifies values that are   */
+/*   either illegal or incorrect.                                           */
+/*--------------------------------------------------------------------------*/
+static int32_t PerformanceNotifyLevel(const scmi_caller_t *caller,
+    const msg_rperf10_t *in, const scmi_msg_status_t *out)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check domain */
+    if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_PERF))
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Check permissions */
+    if ((status == SM_ERR_SUCCESS)
+        && (SM_SCMI_PERM(g_scmiPerfPerms, caller->agentId, in->domainId)
+        < SM_SCMI_PERM_NOTIFY))
+    {
+        status = SM_ERR_DENIED;
+    }
+
+    /* Check flags */
+    if ((status == SM_ERR_SUCCESS) && ((in->notifyEnable & ~1U) != 0U))
+    {
+        status = SM_ERR_INVALID_PARAMETERS;
+    }
+
+    /* Record notification enable */
+    if (status == SM_ERR_SUCCESS)
+    {
+        if (PERF_NOTIFY_ENABLE(in->notifyEnable) != 0U)
+        {
+            s_perfNotify[caller->agentId] |= (1UL << in->domainId);
+        }
+        else
+        {
+            s_perfNotify[caller->agentId] &= ~(1UL << in->domainId);
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get performance FastChannel info                                         */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - in->domainId: Identifier for the performance domain                    */
+/* - in->messageId: Identifier for the message                              */
+/* - out->attributes: FastChannel attributes:                               */
+/*   Bits[31:1] Reserved, must be zero.                                     */
+/*   Bit[0] Doorbell support. Always 0, the platform polls the channels     */
+/* - out->rateLimit: Rate limit in microseconds. 0 if not reported          */
+/* - out->chanAddrLow: Lower 32 bits of the FastChannel address             */
+/* - out->chanAddrHigh: Upper 32 bits of the FastChannel address            */
+/* - out->chanSize: Size of the FastChannel in bytes                        */
+/* - out->doorbell*: Doorbell info, always 0                                */
+/*                                                                          */
+/* Process the PERFORMANCE_DESCRIBE_FASTCHANNEL message. Platform handler   */
+/* for SCMI_PerformanceDescribeFastchannel(). See section 4.5.3.12 in the   */
+/* SCMI spec.                                                               */
+/*                                                                          */
+/* FastChannels are located in the a2p_fast SMT channel buffer of the       */
+/* agent and returned at the address of the buffer as seen by the agent.    */
+/* Each domain the agent has PRIV access to is assigned a block of   */
+/* PERF_FC_NUM_WORDS words. Channels are serviced when the doorbell of the  */
+/* a2p_fast channel is rung or on the periodic RPC poll.                    */
+/*                                                                          */
+/*  Access macros:                                                          */
+/* - PERF_FC_ATTR_DOORBELL() - Doorbell support                             */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_SUCCESS: if the FastChannel info is returned.                   */
+/* - SM_ERR_NOT_FOUND: if domainId does not point to a valid domain.        */
+/* - SM_ERR_NOT_SUPPORTED: if there is no FastChannel for the message and   */
+/*   domain.                                                                */
+/*--------------------------------------------------------------------------*/
+static int32_t PerformanceDescribeFastchannel(const scmi_caller_t *caller,
+    const msg_rperf11_t *in, msg_tperf11_t *out)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    uint64_t fc = RPC_SCMI_FastChannelAgentAddrGet(caller->agentId);
+    uint32_t slot = 0U;
+    uint32_t offset = 0U;
+    uint32_t size = 0U;
+
+    /* Check domain */
+    if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_PERF))
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Check domain has FastChannels */
+    if ((status == SM_ERR_SUCCESS) && ((fc == 0U)
+        || !PerfFcSlotGet(caller->agentId, in->domainId, &slot)))
+    {
+        status = SM_ERR_NOT_SUPPORTED;
+    }
+
+    /* Get channel location */
+    if (status == SM_ERR_SUCCESS)
+    {
+        switch (in->messageId)
+        {
+            case COMMAND_PERFORMANCE_LEVEL_SET:
+                offset = PERF_FC_LEVEL_SET;
+                size = 4U;
+                break;
+            case COMMAND_PERFORMANCE_LEVEL_GET:
+                offset = PERF_FC_LEVEL_GET;
+                size = 4U;
+                break;
+            case COMMAND_PERFORMANCE_LIMITS_GET:
+                offset = PERF_FC_LIMITS_GET;
+                size = 8U;
+                break;
+            default:
+                status = SM_ERR_NOT_SUPPORTED;
+                break;
+        }
+    }
+
+    /* Return results */
+    if (status == SM_ERR_SUCCESS)
+    {
+        uint64_t addr = fc + (((uint64_t) (slot * PERF_FC_NUM_WORDS)
+            + offset) * 4ULL);
+
+        /* Polled, no doorbell */
+        out->attributes = PERF_FC_ATTR_DOORBELL(0UL);
+        out->rateLimit = 0U;
+
+        /* Return channel */
+        out->chanAddrLow = (uint32_t) (addr & 0xFFFFFFFFU);
+        out->chanAddrHigh = (uint32_t) (addr >> 32U);
+        out->chanSize = size;
+
+        /* Doorbell not supported */
+        out->doorbellAddrLow = 0U;
+        out->doorbellAddrHigh = 0U;
+        out->doorbellSetMaskLow = 0U;
+        out->doorbellSetMaskHigh = 0U;
+        out->doorbellPreserveMaskLow = 0U;
+        out->doorbellPreserveMaskHigh = 0U;
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Negotiate the protocol version                                           */
 /*                                                                          */
@@ -1133,19 +1542,12 @@ static int32_t PerformanceLevelGet(const scmi_caller_t *caller,
 /*   successful return of this command must comply with the negotiated      */
 /*   version.                                                               */
 /* - SM_ERR_NOT_SUPPORTED: if the protocol version is not supported.        */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PerfNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rperf16_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check major version */
     if ((status == SM_ERR_SUCCESS) && (SCMI_VER_MAJOR(in->version)
         == SCMI_VER_MAJOR(PROTOCOL_VERSION)))
@@ -1165,6 +1567,45 @@ static int32_t PerfNegotiateProtocolVersion(const scmi_caller_t *caller,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Send performance level changed event                                     */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - msgId: Message ID to dispatch                                          */
+/* - trigger: Trigger data                                                  */
+/*--------------------------------------------------------------------------*/
+static int32_t PerformanceLevelChanged(scmi_msg_id_t msgId,
+    const lmm_rpc_trigger_t *trigger)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    uint32_t domainId = trigger->parm[0];
+
+    /* Loop over all agents */
+    for (uint32_t dstAgent = 0U; dstAgent < SM_SCMI_NUM_AGNT; dstAgent++)
+    {
+        bool enable = ((s_perfNotify[dstAgent] >> domainId) & 0x1U) != 0U;
+
+        /* Agent belong to instance? */
+        if ((g_scmiAgentConfig[dstAgent].scmiInst == trigger->rpcInst)
+            && enable)
+        {
+            msg_rperf33_t out;
+
+            /* Fill in data */
+            out.agentId = 0U;
+            out.domainId = domainId;
+            out.performanceLevel = trigger->parm[1];
+
+            /* Queue notification (coalesced per domain) */
+            RPC_SCMI_P2aTxQ(dstAgent, msgId, (uint32_t*) &out,
+                sizeof(out), SCMI_NOTIFY_Q, domainId);
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Reset agent configuration                                                */
 /*                                                                          */
@@ -1178,7 +1619,100 @@ static int32_t PerfResetAgentConfig(uint32_t lmId, uint32_t agentId,
 {
     int32_t status = SM_ERR_SUCCESS;
 
+    /* Disable notifications */
+    s_perfNotify[agentId] = 0U;
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get performance limits                                                   */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - lmId: LM of the caller                                                 */
+/* - domainId: Identifier for the performance domain                        */
+/* - rangeMax: Return pointer to the max level                              */
+/* - rangeMin: Return pointer to the min level                              */
+/*--------------------------------------------------------------------------*/
+static int32_t PerfLimitsGet(uint32_t lmId, uint32_t domainId,
+    uint32_t *rangeMax, uint32_t *rangeMin)
+{
+    int32_t status;
+    uint32_t numLevels;
+
+    /* Get number of levels */
+    status = LMM_PerfNumLevelsGet(lmId, domainId, &numLevels);
+
+    /* Get levels? */
+    if (status == SM_ERR_SUCCESS)
+    {
+        uint32_t index;
+
+        /* Set initial extremes */
+        *rangeMin = 0xFFFFFFFFU;
+        *rangeMax = 0x0U;
+
+        /* Loop over levels */
+        for (index = 0U; index < numLevels; index++)
+        {
+            dev_sm_perf_desc_t desc;
+
+            /* Get performance level */
+            status = LMM_PerfDescribe(lmId, domainId, index, &desc);
+
+            /* Error? */
+            if (status != SM_ERR_SUCCESS)
+            {
+                break;
+            }
+
+            /* Check min */
+            if (desc.value < *rangeMin)
+            {
+                *rangeMin = desc.value;
+            }
+
+            /* Check max */
+            if (desc.value > *rangeMax)
+            {
+                *rangeMax = desc.value;
+            }
+        }
+    }
+
     /* Return status */
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get FastChannel slot of a domain                                         */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - agentId: Agent owning the FastChannels                                 */
+/* - domainId: Identifier for the performance domain                        */
+/* - slot: Return pointer to the slot index                                 */
+/*                                                                          */
+/* Searches the slot map built by RPC_SCMI_PerfFastChannelInit(). Returns   */
+/* true if the domain has a slot.                                           */
+/*--------------------------------------------------------------------------*/
+static bool PerfFcSlotGet(uint32_t agentId, uint32_t domainId,
+    uint32_t *slot)
+{
+    bool rtn = false;
+
+    /* Search slot map */
+    for (uint32_t idx = 0U; idx < s_fcNumSlots[agentId]; idx++)
+    {
+        if (s_fcDomain[agentId][idx] == domainId)
+        {
+            *slot = idx;
+            rtn = true;
+            break;
+        }
+    }
+
+    /* Return result */
+    return rtn;
+}
+
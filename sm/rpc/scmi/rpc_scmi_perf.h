@@ -52,6 +52,18 @@
 
 #include "rpc_scmi.h"
 
+/* Defines */
+
+/*!
+ * @name SCMI perf notification message IDs
+ */
+/** @{ */
+/*! Performance limits changed */
+#define RPC_SCMI_NOTIFY_PERFORMANCE_LIMITS_CHANGED  0x0U
+/*! Performance level changed */
+#define RPC_SCMI_NOTIFY_PERFORMANCE_LEVEL_CHANGED   0x1U
+/** @} */
+
 /* Functions */
 
 /*!
@@ -78,6 +90,24 @@
 int32_t RPC_SCMI_PerfDispatchCommand(scmi_caller_t *caller,
     uint32_t messageId);
 
+/*!
+ * Dispatch perf protocol notification.
+ *
+ * @param[in]     msgId       Message to send
+ * @param[in]     trigger     Data associated with message
+ *
+ * This function requests the perf protocol send the requested notification
+ * to agents that requested it.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_INVALID_PARAMETERS if \a messageId isn't supported
+ * - others returned by queuing functions
+ */
+int32_t RPC_SCMI_PerfDispatchNotification(scmi_msg_id_t msgId,
+    const lmm_rpc_trigger_t *trigger);
+
 /*!
  * Dispatch SCMI perf protocol reset.
  *
@@ -96,6 +126,35 @@ int32_t RPC_SCMI_PerfDispatchCommand(scmi_caller_t *caller,
 int32_t RPC_SCMI_PerfDispatchReset(uint32_t lmId, uint32_t agentId,
     bool permissionsReset);
 
+/*!
+ * Init SCMI perf FastChannels.
+ *
+ * @param[in]     lmId              LM of the agent
+ * @param[in]     agentId           Agent owning the FastChannels
+ * @param[in]     fc                Address of the FastChannel region
+ *
+ * This function builds the slot to domain map of the agent, marks all
+ * level set FastChannels in the region as consumed and fills in the
+ * limits get FastChannels. Called when the FastChannel transport is
+ * initialized.
+ */
+void RPC_SCMI_PerfFastChannelInit(uint32_t lmId, uint32_t agentId,
+    uint32_t *fc);
+
+/*!
+ * Dispatch SCMI perf FastChannels.
+ *
+ * @param[in]     lmId              LM of the agent
+ * @param[in]     agentId           Agent owning the FastChannels
+ * @param[in]     fc                Address of the FastChannel region
+ *
+ * This function applies any level written to a level set FastChannel
+ * via LMM_PerfLevelSet(), marks the request consumed and updates the
+ * level get FastChannels with the current level.
+ */
+void RPC_SCMI_PerfDispatchFastChannel(uint32_t lmId, uint32_t agentId,
+    uint32_t *fc);
+
 /** @} */
 
 #endif /* RPC_SCMI_PERF_H */
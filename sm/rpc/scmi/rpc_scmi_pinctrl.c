@@ -47,7 +47,7 @@
 /* Protocol version */
 #define PROTOCOL_VERSION  0x10000U
 
-/* SCMI pinctrl protocol message IDs and masks */
+/* SCMI pinctrl protocol message IDs */
 #define COMMAND_PROTOCOL_VERSION             0x0U
 #define COMMAND_PROTOCOL_ATTRIBUTES          0x1U
 #define COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES  0x2U
@@ -58,11 +58,11 @@
 #define COMMAND_PINCTRL_REQUEST              0x8U
 #define COMMAND_PINCTRL_RELEASE              0x9U
 #define COMMAND_NEGOTIATE_PROTOCOL_VERSION   0x10U
-#define COMMAND_SUPPORTED_MASK               0x103EFUL
 
 /* SCMI max pin control argument lengths */
 #define PINCTRL_MAX_NAME       16U
 #define PINCTRL_MAX_CONFIGS    SCMI_ARRAY(8U, pin_config_t)
+#define PINCTRL_NUM_CONFIGS(C) SCMI_ARRAY_CALLER(C, 8U, pin_config_t)
 #define PINCTRL_MAX_CONFIGS_T  SCMI_ARRAY(8U, pin_config_t)
 
 /* SCMI pin control selectors */
@@ -265,6 +265,32 @@ typedef struct
     uint32_t version;
 } msg_rpinctrl16_t;
 
+/* Local variables */
+
+/* Message descriptors, indexed by message ID */
+static const scmi_msg_desc_t s_pinctrlMsgDesc[] =
+{
+    [COMMAND_PROTOCOL_VERSION] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tpinctrl0_t),
+    [COMMAND_PROTOCOL_ATTRIBUTES] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tpinctrl1_t),
+    [COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES] =
+        SCMI_MSG_DESC(msg_rpinctrl2_t, msg_tpinctrl2_t),
+    [COMMAND_PINCTRL_ATTRIBUTES] =
+        SCMI_MSG_DESC(msg_rpinctrl3_t, msg_tpinctrl3_t),
+    [COMMAND_PINCTRL_CONFIG_GET] =
+        SCMI_MSG_DESC(msg_rpinctrl5_t, msg_tpinctrl5_t),
+    [COMMAND_PINCTRL_CONFIG_SET] = SCMI_MSG_DESC_VAR(3U, scmi_msg_status_t),
+    [COMMAND_PINCTRL_FUNCTION_SELECT] =
+        SCMI_MSG_DESC(msg_rpinctrl7_t, scmi_msg_status_t),
+    [COMMAND_PINCTRL_REQUEST] =
+        SCMI_MSG_DESC(msg_rpinctrl8_t, scmi_msg_status_t),
+    [COMMAND_PINCTRL_RELEASE] =
+        SCMI_MSG_DESC(msg_rpinctrl9_t, scmi_msg_status_t),
+    [COMMAND_NEGOTIATE_PROTOCOL_VERSION] =
+        SCMI_MSG_DESC(msg_rpinctrl16_t, scmi_msg_status_t)
+};
+
 /* Local functions */
 
 static int32_t PinctrlProtocolVersion(const scmi_caller_t *caller,
@@ -300,68 +326,66 @@ static int32_t PinctrlResetAgentConfig(uint32_t lmId, uint32_t agentId,
 int32_t RPC_SCMI_PinctrlDispatchCommand(scmi_caller_t *caller,
     uint32_t messageId)
 {
-    int32_t status = SM_ERR_SUCCESS;
+    int32_t status;
     const scmi_msg_t *in = caller->msgCopy;
     scmi_msg_status_t *out = caller->msg;
-    uint32_t lenOut = sizeof(scmi_msg_status_t);
+    uint32_t lenOut;
+
+    /* Check message */
+    status = RPC_SCMI_A2pMsgCheck(caller, s_pinctrlMsgDesc,
+        ARRAY_SIZE(s_pinctrlMsgDesc), messageId, &lenOut);
 
     /* Handle standard messages */
-    switch(messageId)
+    if (status == SM_ERR_SUCCESS)
     {
-        case COMMAND_PROTOCOL_VERSION:
-            lenOut = sizeof(msg_tpinctrl0_t);
-            status = PinctrlProtocolVersion(caller,
-                (const scmi_msg_header_t*) in, (msg_tpinctrl0_t*) out);
-            break;
-        case COMMAND_PROTOCOL_ATTRIBUTES:
-            lenOut = sizeof(msg_tpinctrl1_t);
-            status = PinctrlProtocolAttributes(caller,
-                (const scmi_msg_header_t*) in, (msg_tpinctrl1_t*) out);
-            break;
-        case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
-            lenOut = sizeof(msg_tpinctrl2_t);
-            status = PinctrlProtocolMessageAttributes(caller,
-                (const msg_rpinctrl2_t*) in, (msg_tpinctrl2_t*) out);
-            break;
-        case COMMAND_PINCTRL_ATTRIBUTES:
-            lenOut = sizeof(msg_tpinctrl3_t);
-            status = PinctrlAttributes(caller, (const msg_rpinctrl3_t*) in,
-                (msg_tpinctrl3_t*) out);
-            break;
-        case COMMAND_PINCTRL_CONFIG_GET:
-            lenOut = sizeof(msg_tpinctrl5_t);
-            status = PinctrlConfigGet(caller, (const msg_rpinctrl5_t*) in,
-                (msg_tpinctrl5_t*) out, &lenOut);
-            break;
-        case COMMAND_PINCTRL_CONFIG_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = PinctrlConfigSet(caller, (const msg_rpinctrl6_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_PINCTRL_FUNCTION_SELECT:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = PinctrlFunctionSelect(caller,
-                (const msg_rpinctrl7_t*) in, (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_PINCTRL_REQUEST:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = PinctrlRequest(caller, (const msg_rpinctrl8_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_PINCTRL_RELEASE:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = PinctrlRelease(caller, (const msg_rpinctrl9_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = PinctrlNegotiateProtocolVersion(caller,
-                (const msg_rpinctrl16_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        default:
-            status = SM_ERR_NOT_SUPPORTED;
-            break;
+        switch(messageId)
+        {
+            case COMMAND_PROTOCOL_VERSION:
+                status = PinctrlProtocolVersion(caller,
+                    (const scmi_msg_header_t*) in, (msg_tpinctrl0_t*) out);
+                break;
+            case COMMAND_PROTOCOL_ATTRIBUTES:
+                status = PinctrlProtocolAttributes(caller,
+                    (const scmi_msg_header_t*) in, (msg_tpinctrl1_t*) out);
+                break;
+            case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
+                status = PinctrlProtocolMessageAttributes(caller,
+                    (const msg_rpinctrl2_t*) in, (msg_tpinctrl2_t*) out);
+                break;
+            case COMMAND_PINCTRL_ATTRIBUTES:
+                status = PinctrlAttributes(caller, (const msg_rpinctrl3_t*) in,
+                    (msg_tpinctrl3_t*) out);
+                break;
+            case COMMAND_PINCTRL_CONFIG_GET:
+                status = PinctrlConfigGet(caller, (const msg_rpinctrl5_t*) in,
+                    (msg_tpinctrl5_t*) out, &lenOut);
+                break;
+            case COMMAND_PINCTRL_CONFIG_SET:
+                status = PinctrlConfigSet(caller, (const msg_rpinctrl6_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_PINCTRL_FUNCTION_SELECT:
+                status = PinctrlFunctionSelect(caller,
+                    (const msg_rpinctrl7_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_PINCTRL_REQUEST:
+                status = PinctrlRequest(caller, (const msg_rpinctrl8_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_PINCTRL_RELEASE:
+                status = PinctrlRelease(caller, (const msg_rpinctrl9_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
+                status = PinctrlNegotiateProtocolVersion(caller,
+                    (const msg_rpinctrl16_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            default:
+                status = SM_ERR_NOT_SUPPORTED;
+                break;
+        }
     }
 
     /* Update length */
@@ -401,25 +425,14 @@ int32_t RPC_SCMI_PinctrlDispatchReset(uint32_t lmId, uint32_t agentId,
 /* SCMI_PinctrlProtocolVersion(). See section 4.11.2.1 in the SCMI spec.    */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PinctrlProtocolVersion(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tpinctrl0_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return version */
-        out->version = PROTOCOL_VERSION;
-    }
+    /* Return version */
+    out->version = PROTOCOL_VERSION;
 
     /* Return status */
     return status;
@@ -447,30 +460,19 @@ static int32_t PinctrlProtocolVersion(const scmi_caller_t *caller,
 /* - PINCTRL_PROTO_ATTR_HIGH_NUM_FUNCTIONS() - Number of functions          */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PinctrlProtocolAttributes(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tpinctrl1_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return number of pins, no groups */
-        out->attributesLow
-            = PINCTRL_PROTO_ATTR_LOW_NUM_GROUPS(0UL)
-            | PINCTRL_PROTO_ATTR_LOW_NUM_PINS((uint32_t) SM_NUM_PIN);
+    /* Return number of pins, no groups */
+    out->attributesLow
+        = PINCTRL_PROTO_ATTR_LOW_NUM_GROUPS(0UL)
+        | PINCTRL_PROTO_ATTR_LOW_NUM_PINS((uint32_t) SM_NUM_PIN);
 
-        /* No functions */
-        out->attributesHigh = PINCTRL_PROTO_ATTR_HIGH_NUM_FUNCTIONS(0U);
-    }
+    /* No functions */
+    out->attributesHigh = PINCTRL_PROTO_ATTR_HIGH_NUM_FUNCTIONS(0U);
 
     /* Return status */
     return status;
@@ -495,31 +497,20 @@ static int32_t PinctrlProtocolAttributes(const scmi_caller_t *caller,
 /*   use.                                                                   */
 /* - SM_ERR_NOT_FOUND: if the message identified by messageId is invalid    */
 /*   or not implemented.                                                    */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PinctrlProtocolMessageAttributes(const scmi_caller_t *caller,
     const msg_rpinctrl2_t *in, msg_tpinctrl2_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
+    /* Always zero */
+    out->attributes = 0U;
 
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
+    /* Is message supported ? */
+    if (!RPC_SCMI_A2pMsgSupported(s_pinctrlMsgDesc,
+        ARRAY_SIZE(s_pinctrlMsgDesc), in->messageId))
     {
-        /* Always zero */
-        out->attributes = 0U;
-
-        /* Is message supported ? */
-        if ((in->messageId >= 32U)
-            || (((COMMAND_SUPPORTED_MASK >> in->messageId) & 0x1U) == 0U))
-        {
-            status = SM_ERR_NOT_FOUND;
-        }
+        status = SM_ERR_NOT_FOUND;
     }
 
     /* Return status */
@@ -573,7 +564,6 @@ static int32_t PinctrlProtocolMessageAttributes(const scmi_caller_t *caller,
 /* - SM_ERR_SUCCESS: if valid attributes were returned.                     */
 /* - SM_ERR_NOT_FOUND: if the identifier field pertains to a                */
 /*   non-existent pin, group, or function.                                  */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PinctrlAttributes(const scmi_caller_t *caller,
     const msg_rpinctrl3_t *in, msg_tpinctrl3_t *out)
@@ -582,12 +572,6 @@ static int32_t PinctrlAttributes(const scmi_caller_t *caller,
     const uint8_t *nameAddr = (const uint8_t*) "";
     uint32_t sel = PINCTRL_FLAGS_SELECTOR(in->flags);
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check selector */
     if ((status == SM_ERR_SUCCESS) && (sel != PINCTRL_SEL_PIN))
     {
@@ -684,7 +668,6 @@ static int32_t PinctrlAttributes(const scmi_caller_t *caller,
 /* - SM_ERR_INVALID_PARAMETERS, if the attributes flag specifies            */
 /*   unsupported or invalid configurations.                                 */
 /* - SM_ERR_NOT_SUPPORTED: if the request is not supported.                 */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PinctrlConfigGet(const scmi_caller_t *caller,
     const msg_rpinctrl5_t *in, msg_tpinctrl5_t *out, uint32_t *len)
@@ -700,12 +683,6 @@ static int32_t PinctrlConfigGet(const scmi_caller_t *caller,
         PINCTRL_TYPE_CONFIG
     };
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check selector */
     if ((status == SM_ERR_SUCCESS) && (sel > PINCTRL_SEL_GROUP))
     {
@@ -736,7 +713,7 @@ static int32_t PinctrlConfigGet(const scmi_caller_t *caller,
         uint32_t index;
 
         out->numConfigs = 0U;
-        for (index = 0U; index < PINCTRL_MAX_CONFIGS; index++)
+        for (index = 0U; index < PINCTRL_NUM_CONFIGS(caller); index++)
         {
             uint32_t type;
             uint32_t value;
@@ -868,7 +845,7 @@ static int32_t PinctrlConfigSet(const scmi_caller_t *caller,
         uint32_t type = in->configs[cf].type;
         uint32_t value = in->configs[cf].value;
         uint32_t maxId = SM_NUM_PIN;
-        const uint8_t *perms = NULL;
+        const scmi_perm_t *perms = NULL;
 
         /* Daisy ID? */
         if (type == PINCTRL_TYPE_DAISY_ID)
@@ -882,17 +859,17 @@ static int32_t PinctrlConfigSet(const scmi_caller_t *caller,
         {
             case PINCTRL_TYPE_MUX:
                 type = DEV_SM_PIN_TYPE_MUX;
-                perms = g_scmiAgentConfig[caller->agentId].pinPerms;
+                perms = g_scmiPinPerms;
                 break;
             case PINCTRL_TYPE_CONFIG:
                 type = DEV_SM_PIN_TYPE_CONFIG;
-                perms = g_scmiAgentConfig[caller->agentId].pinPerms;
+                perms = g_scmiPinPerms;
                 break;
             case PINCTRL_TYPE_DAISY_CFG:
                 id = daisyId;
                 type = DEV_SM_PIN_TYPE_DAISY;
                 maxId = SM_NUM_DAISY;
-                perms = g_scmiAgentConfig[caller->agentId].daisyPerms;
+                perms = g_scmiDaisyPerms;
                 break;
             default:
                 status = SM_ERR_NOT_SUPPORTED;
@@ -907,7 +884,8 @@ static int32_t PinctrlConfigSet(const scmi_caller_t *caller,
 
         /* Check permissions */
         if ((status == SM_ERR_SUCCESS)
-            && (perms[id] < SM_SCMI_PERM_EXCLUSIVE))
+            && (SM_SCMI_PERM(perms, caller->agentId, id)
+            < SM_SCMI_PERM_EXCLUSIVE))
         {
             status = SM_ERR_DENIED;
         }
@@ -957,24 +935,14 @@ static int32_t PinctrlConfigSet(const scmi_caller_t *caller,
 /*   function is not supported by the pin or group.                         */
 /* - SM_ERR_DENIED: if the calling agent is not allowed to enable this      */
 /*   function on this pin.                                                  */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PinctrlFunctionSelect(const scmi_caller_t *caller,
     const msg_rpinctrl7_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Not supported */
-    if (status == SM_ERR_SUCCESS)
-    {
-        status = SM_ERR_NOT_SUPPORTED;
-    }
+    status = SM_ERR_NOT_SUPPORTED;
 
     /* Return status */
     return status;
@@ -1009,7 +977,6 @@ static int32_t PinctrlFunctionSelect(const scmi_caller_t *caller,
 /*   pin or group..                                                         */
 /* - SM_ERR_IN_USE: if the pin or group is currently under exclusive        */
 /*   control of another agent.                                              */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PinctrlRequest(const scmi_caller_t *caller,
     const msg_rpinctrl8_t *in, const scmi_msg_status_t *out)
@@ -1017,12 +984,6 @@ static int32_t PinctrlRequest(const scmi_caller_t *caller,
     int32_t status = SM_ERR_SUCCESS;
     uint32_t sel = PINCTRL_FLAGS_SELECTOR(in->flags);
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check selector */
     if ((status == SM_ERR_SUCCESS) && (sel != PINCTRL_SEL_PIN))
     {
@@ -1037,7 +998,7 @@ static int32_t PinctrlRequest(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].pinPerms[in->identifier]
+        && (SM_SCMI_PERM(g_scmiPinPerms, caller->agentId, in->identifier)
         < SM_SCMI_PERM_EXCLUSIVE))
     {
         status = SM_ERR_DENIED;
@@ -1069,7 +1030,6 @@ static int32_t PinctrlRequest(const scmi_caller_t *caller,
 /*   pin or group.                                                          */
 /* - SM_ERR_INVALID_PARAMETERS: if the input parameters specify             */
 /*   incorrect or illegal values.                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PinctrlRelease(const scmi_caller_t *caller,
     const msg_rpinctrl9_t *in, const scmi_msg_status_t *out)
@@ -1077,12 +1037,6 @@ static int32_t PinctrlRelease(const scmi_caller_t *caller,
     int32_t status = SM_ERR_SUCCESS;
     uint32_t sel = PINCTRL_FLAGS_SELECTOR(in->flags);
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check selector */
     if ((status == SM_ERR_SUCCESS) && (sel != PINCTRL_SEL_PIN))
     {
@@ -1097,7 +1051,7 @@ static int32_t PinctrlRelease(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].pinPerms[in->identifier]
+        && (SM_SCMI_PERM(g_scmiPinPerms, caller->agentId, in->identifier)
         < SM_SCMI_PERM_EXCLUSIVE))
     {
         status = SM_ERR_INVALID_PARAMETERS;
@@ -1124,19 +1078,12 @@ static int32_t PinctrlRelease(const scmi_caller_t *caller,
 /*   successful return of this command must comply with the negotiated      */
 /*   version.                                                               */
 /* - SM_ERR_NOT_SUPPORTED: if the protocol version is not supported.        */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PinctrlNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rpinctrl16_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check major version */
     if ((status == SM_ERR_SUCCESS) && (SCMI_VER_MAJOR(in->version)
         == SCMI_VER_MAJOR(PROTOCOL_VERSION)))
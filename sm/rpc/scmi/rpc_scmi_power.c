@@ -47,15 +47,16 @@
 /* Protocol version */
 #define PROTOCOL_VERSION  0x30001U
 
-/* SCMI power protocol message IDs and masks */
+/* SCMI power protocol message IDs */
 #define COMMAND_PROTOCOL_VERSION             0x0U
 #define COMMAND_PROTOCOL_ATTRIBUTES          0x1U
 #define COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES  0x2U
 #define COMMAND_POWER_DOMAIN_ATTRIBUTES      0x3U
 #define COMMAND_POWER_STATE_SET              0x4U
 #define COMMAND_POWER_STATE_GET              0x5U
+#define COMMAND_POWER_STATE_NOTIFY           0x6U
+#define COMMAND_POWER_STATE_CHANGE_REQUESTED_NOTIFY  0x7U
 #define COMMAND_NEGOTIATE_PROTOCOL_VERSION   0x10U
-#define COMMAND_SUPPORTED_MASK               0x1003FUL
 
 /* SCMI max power argument lengths */
 #define POWER_MAX_NAME  16U
@@ -79,6 +80,9 @@
 /* SCMI power state set flags */
 #define POWER_FLAGS_ASYNC(x)  (((x) & 0x1U) >> 0U)
 
+/* SCMI power notification enable */
+#define POWER_NOTIFY_ENABLE(x)  (((x) & 0x1U) >> 0U)
+
 /* Local types */
 
 /* Response type for ProtocolVersion() */
@@ -184,6 +188,28 @@ typedef struct
     uint32_t powerState;
 } msg_tpower5_t;
 
+/* Request type for PowerStateNotify() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Identifier for the power domain */
+    uint32_t domainId;
+    /* Notification flags */
+    uint32_t notifyEnable;
+} msg_rpower6_t;
+
+/* Request type for PowerStateChangeRequestedNotify() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Identifier for the power domain */
+    uint32_t domainId;
+    /* Notification flags */
+    uint32_t notifyEnable;
+} msg_rpower7_t;
+
 /* Request type for NegotiateProtocolVersion() */
 typedef struct
 {
@@ -193,6 +219,48 @@ typedef struct
     uint32_t version;
 } msg_rpower16_t;
 
+/* Request type for PowerStateChanged() and PowerStateChangeRequested() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Refers to the agent that caused this event */
+    uint32_t agentId;
+    /* Identifier for the power domain */
+    uint32_t domainId;
+    /* Parameter identifying the power state of the domain */
+    uint32_t powerState;
+} msg_rpower32_t;
+
+/* Local variables */
+
+/* Message descriptors, indexed by message ID */
+static const scmi_msg_desc_t s_powerMsgDesc[] =
+{
+    [COMMAND_PROTOCOL_VERSION] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tpower0_t),
+    [COMMAND_PROTOCOL_ATTRIBUTES] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tpower1_t),
+    [COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES] =
+        SCMI_MSG_DESC(msg_rpower2_t, msg_tpower2_t),
+    [COMMAND_POWER_DOMAIN_ATTRIBUTES] =
+        SCMI_MSG_DESC(msg_rpower3_t, msg_tpower3_t),
+    [COMMAND_POWER_STATE_SET] = SCMI_MSG_DESC(msg_rpower4_t, scmi_msg_status_t),
+    [COMMAND_POWER_STATE_GET] = SCMI_MSG_DESC(msg_rpower5_t, msg_tpower5_t),
+    [COMMAND_POWER_STATE_NOTIFY] =
+        SCMI_MSG_DESC(msg_rpower6_t, scmi_msg_status_t),
+    [COMMAND_POWER_STATE_CHANGE_REQUESTED_NOTIFY] =
+        SCMI_MSG_DESC(msg_rpower7_t, scmi_msg_status_t),
+    [COMMAND_NEGOTIATE_PROTOCOL_VERSION] =
+        SCMI_MSG_DESC(msg_rpower16_t, scmi_msg_status_t)
+};
+
+/* State change notification enables, bitmap per agent */
+static uint32_t s_powerNotify[SM_SCMI_NUM_AGNT];
+
+/* Change requested notification enables, bitmap per agent */
+static uint32_t s_powerReqNotify[SM_SCMI_NUM_AGNT];
+
 /* Local functions */
 
 static int32_t PowerProtocolVersion(const scmi_caller_t *caller,
@@ -207,8 +275,16 @@ static int32_t PowerStateSet(const scmi_caller_t *caller,
     const msg_rpower4_t *in, const scmi_msg_status_t *out);
 static int32_t PowerStateGet(const scmi_caller_t *caller,
     const msg_rpower5_t *in, msg_tpower5_t *out);
+static int32_t PowerStateNotify(const scmi_caller_t *caller,
+    const msg_rpower6_t *in, const scmi_msg_status_t *out);
+static int32_t PowerStateChangeRequestedNotify(const scmi_caller_t *caller,
+    const msg_rpower7_t *in, const scmi_msg_status_t *out);
 static int32_t PowerNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rpower16_t *in, const scmi_msg_status_t *out);
+static int32_t PowerStateChanged(scmi_msg_id_t msgId,
+    const lmm_rpc_trigger_t *trigger);
+static void PowerStateChangeRequested(const scmi_caller_t *caller,
+    uint32_t domainId, uint32_t powerState);
 static int32_t PowerResetAgentConfig(uint32_t lmId, uint32_t agentId,
     bool permissionsReset);
 
@@ -222,57 +298,92 @@ static int32_t PowerResetAgentConfig(uint32_t lmId, uint32_t agentId,
 int32_t RPC_SCMI_PowerDispatchCommand(scmi_caller_t *caller,
     uint32_t messageId)
 {
-    int32_t status = SM_ERR_SUCCESS;
+    int32_t status;
     const scmi_msg_t *in = caller->msgCopy;
     scmi_msg_status_t *out = caller->msg;
-    uint32_t lenOut = sizeof(scmi_msg_status_t);
+    uint32_t lenOut;
+
+    /* Check message */
+    status = RPC_SCMI_A2pMsgCheck(caller, s_powerMsgDesc,
+        ARRAY_SIZE(s_powerMsgDesc), messageId, &lenOut);
 
     /* Handle standard messages */
-    switch(messageId)
+    if (status == SM_ERR_SUCCESS)
     {
-        case COMMAND_PROTOCOL_VERSION:
-            lenOut = sizeof(msg_tpower0_t);
-            status = PowerProtocolVersion(caller,
-                (const scmi_msg_header_t*) in, (msg_tpower0_t*) out);
-            break;
-        case COMMAND_PROTOCOL_ATTRIBUTES:
-            lenOut = sizeof(msg_tpower1_t);
-            status = PowerProtocolAttributes(caller,
-                (const scmi_msg_header_t*) in, (msg_tpower1_t*) out);
-            break;
-        case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
-            lenOut = sizeof(msg_tpower2_t);
-            status = PowerProtocolMessageAttributes(caller,
-                (const msg_rpower2_t*) in, (msg_tpower2_t*) out);
-            break;
-        case COMMAND_POWER_DOMAIN_ATTRIBUTES:
-            lenOut = sizeof(msg_tpower3_t);
-            status = PowerDomainAttributes(caller, (const msg_rpower3_t*) in,
-                (msg_tpower3_t*) out);
-            break;
-        case COMMAND_POWER_STATE_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = PowerStateSet(caller, (const msg_rpower4_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_POWER_STATE_GET:
-            lenOut = sizeof(msg_tpower5_t);
-            status = PowerStateGet(caller, (const msg_rpower5_t*) in,
-                (msg_tpower5_t*) out);
-            break;
-        case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = PowerNegotiateProtocolVersion(caller,
-                (const msg_rpower16_t*) in, (const scmi_msg_status_t*) out);
+        switch(messageId)
+        {
+            case COMMAND_PROTOCOL_VERSION:
+                status = PowerProtocolVersion(caller,
+                    (const scmi_msg_header_t*) in, (msg_tpower0_t*) out);
+                break;
+            case COMMAND_PROTOCOL_ATTRIBUTES:
+                status = PowerProtocolAttributes(caller,
+                    (const scmi_msg_header_t*) in, (msg_tpower1_t*) out);
+                break;
+            case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
+                status = PowerProtocolMessageAttributes(caller,
+                    (const msg_rpower2_t*) in, (msg_tpower2_t*) out);
+                break;
+            case COMMAND_POWER_DOMAIN_ATTRIBUTES:
+                status = PowerDomainAttributes(caller,
+                    (const msg_rpower3_t*) in, (msg_tpower3_t*) out);
+                break;
+            case COMMAND_POWER_STATE_SET:
+                status = PowerStateSet(caller, (const msg_rpower4_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_POWER_STATE_GET:
+                status = PowerStateGet(caller, (const msg_rpower5_t*) in,
+                    (msg_tpower5_t*) out);
+                break;
+            case COMMAND_POWER_STATE_NOTIFY:
+                status = PowerStateNotify(caller, (const msg_rpower6_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_POWER_STATE_CHANGE_REQUESTED_NOTIFY:
+                status = PowerStateChangeRequestedNotify(caller,
+                    (const msg_rpower7_t*) in, (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
+                status = PowerNegotiateProtocolVersion(caller,
+                    (const msg_rpower16_t*) in, (const scmi_msg_status_t*) out);
+                break;
+            default:
+                status = SM_ERR_NOT_SUPPORTED;
+                break;
+        }
+    }
+
+    /* Update length */
+    caller->lenMsg = lenOut;
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Dispatch SCMI notifications                                              */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - msgId: Message ID to dispatch                                          */
+/* - trigger: Trigger data                                                  */
+/*--------------------------------------------------------------------------*/
+int32_t RPC_SCMI_PowerDispatchNotification(scmi_msg_id_t msgId,
+    const lmm_rpc_trigger_t *trigger)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Handle notifications */
+    switch(msgId.messageId)
+    {
+        case RPC_SCMI_NOTIFY_POWER_STATE_CHANGED:
+            status = PowerStateChanged(msgId, trigger);
             break;
         default:
             status = SM_ERR_NOT_SUPPORTED;
             break;
     }
 
-    /* Update length */
-    caller->lenMsg = lenOut;
-
     /* Return status */
     return status;
 }
@@ -297,7 +408,7 @@ int32_t RPC_SCMI_PowerDispatchReset(uint32_t lmId, uint32_t agentId,
 
 /* Local variables */
 
-static uint8_t s_powerState[SM_NUM_POWER][SM_SCMI_NUM_AGNT];
+static lmm_vote_level_t s_powerVote[SM_NUM_POWER];
 
 /* Local functions */
 
@@ -316,25 +427,14 @@ static int32_t PowerStateUpdate(uint32_t lmId, uint32_t agentId,
 /* SCMI_PowerProtocolVersion(). See section 4.3.2.1 in the SCMI spec.       */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PowerProtocolVersion(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tpower0_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return version */
-        out->version = PROTOCOL_VERSION;
-    }
+    /* Return version */
+    out->version = PROTOCOL_VERSION;
 
     /* Return status */
     return status;
@@ -363,30 +463,19 @@ static int32_t PowerProtocolVersion(const scmi_caller_t *caller,
 /* - POWER_PROTO_ATTR_NUM_DOMAINS() - Number of power domains               */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PowerProtocolAttributes(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tpower1_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
+    /* Return number of domains */
+    out->attributes = POWER_PROTO_ATTR_NUM_DOMAINS(SM_NUM_POWER);
 
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return number of domains */
-        out->attributes = POWER_PROTO_ATTR_NUM_DOMAINS(SM_NUM_POWER);
-
-        /* Statistics not supported */
-        out->statisticsAddressLow = 0U;
-        out->statisticsAddressHigh = 0U;
-        out->statisticsLen = 0U;
-    }
+    /* Statistics not supported */
+    out->statisticsAddressLow = 0U;
+    out->statisticsAddressHigh = 0U;
+    out->statisticsLen = 0U;
 
     /* Return status */
     return status;
@@ -411,33 +500,20 @@ static int32_t PowerProtocolAttributes(const scmi_caller_t *caller,
 /*   use.                                                                   */
 /* - SM_ERR_NOT_FOUND: if the message identified by messageId is invalid    */
 /*   or not implemented.                                                    */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PowerProtocolMessageAttributes(const scmi_caller_t *caller,
     const msg_rpower2_t *in, msg_tpower2_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
+    /* Always zero */
+    out->attributes = 0U;
 
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
+    /* Is message supported ? */
+    if (!RPC_SCMI_A2pMsgSupported(s_powerMsgDesc,
+        ARRAY_SIZE(s_powerMsgDesc), in->messageId))
     {
-        uint32_t mask = COMMAND_SUPPORTED_MASK;
-
-        /* Always zero */
-        out->attributes = 0U;
-
-        /* Is message supported ? */
-        if ((in->messageId >= 32U) || (((mask >> in->messageId)
-            & 0x1U) == 0U))
-        {
-            status = SM_ERR_NOT_FOUND;
-        }
+        status = SM_ERR_NOT_FOUND;
     }
 
     /* Return status */
@@ -491,7 +567,6 @@ static int32_t PowerProtocolMessageAttributes(const scmi_caller_t *caller,
 /* Return errors:                                                           */
 /* - SM_ERR_SUCCESS: if valid power domain attributes are returned.         */
 /* - SM_ERR_NOT_FOUND: if domainId pertains to a non-existent domain.       */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PowerDomainAttributes(const scmi_caller_t *caller,
     const msg_rpower3_t *in, msg_tpower3_t *out)
@@ -499,12 +574,6 @@ static int32_t PowerDomainAttributes(const scmi_caller_t *caller,
     int32_t status = SM_ERR_SUCCESS;
     const uint8_t *nameAddr = (const uint8_t*) "";
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check domain */
     if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_POWER))
     {
@@ -521,16 +590,16 @@ static int32_t PowerDomainAttributes(const scmi_caller_t *caller,
     /* Return results */
     if (status == SM_ERR_SUCCESS)
     {
-        /* Sync responses only, no notificaions */
+        /* Sync responses only, state change notifications */
         out->attributes
-            = POWER_ATTR_CHANGE(0UL)
+            = POWER_ATTR_CHANGE(1UL)
             | POWER_ATTR_ASYNC(0UL)
             | POWER_ATTR_SYNC(0UL)
-            | POWER_ATTR_CHANGE_REQ(0UL)
+            | POWER_ATTR_CHANGE_REQ(1UL)
             | POWER_ATTR_EXT_NAME(0UL);
 
         /* Adjust based on access */
-        if (g_scmiAgentConfig[caller->agentId].pdPerms[in->domainId]
+        if (SM_SCMI_PERM(g_scmiPdPerms, caller->agentId, in->domainId)
             >= SM_SCMI_PERM_SET)
         {
             out->attributes |= POWER_ATTR_SYNC(1UL);
@@ -581,7 +650,6 @@ static int32_t PowerDomainAttributes(const scmi_caller_t *caller,
 /* - SM_ERR_DENIED: if the calling agent is not allowed to set the state    */
 /*   of this power domain. An example would be if this power domain is      */
 /*   exclusive to another agent.                                            */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PowerStateSet(const scmi_caller_t *caller,
     const msg_rpower4_t *in, const scmi_msg_status_t *out)
@@ -591,12 +659,6 @@ static int32_t PowerStateSet(const scmi_caller_t *caller,
     uint32_t agentId = caller->agentId;
     uint8_t state = DEV_SM_POWER_STATE_OFF;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check domain */
     if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_POWER))
     {
@@ -605,7 +667,7 @@ static int32_t PowerStateSet(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[agentId].pdPerms[in->domainId]
+        && (SM_SCMI_PERM(g_scmiPdPerms, agentId, in->domainId)
         < SM_SCMI_PERM_SET))
     {
         status = SM_ERR_DENIED;
@@ -635,6 +697,13 @@ static int32_t PowerStateSet(const scmi_caller_t *caller,
                 break;
         }
 
+        /* Inform other agents of a valid request */
+        if (state < SM_NUM_POWER_STATE)
+        {
+            PowerStateChangeRequested(caller, in->domainId,
+                in->powerState);
+        }
+
         /* Update tracking */
         status = PowerStateUpdate(caller->lmId, agentId, in->domainId,
             state);
@@ -660,7 +729,6 @@ static int32_t PowerStateSet(const scmi_caller_t *caller,
 /* - SM_ERR_SUCCESS: if the current power state is returned successfully.   */
 /* - SM_ERR_NOT_FOUND: if domainId does not point to a valid power          */
 /*   domain.                                                                */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PowerStateGet(const scmi_caller_t *caller,
     const msg_rpower5_t *in, msg_tpower5_t *out)
@@ -668,12 +736,6 @@ static int32_t PowerStateGet(const scmi_caller_t *caller,
     int32_t status = SM_ERR_SUCCESS;
     uint8_t state;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check domain */
     if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_POWER))
     {
@@ -707,6 +769,144 @@ static int32_t PowerStateGet(const scmi_caller_t *caller,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Configure power state change notification                                */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - in->domainId: Identifier for the power domain                          */
+/* - in->notifyEnable: Notification flags:                                  */
+/*   Bits[31:1] Reserved, must be zero.                                     */
+/*   Bit[0] Notify enable. This bit must be set to 1 if an agent wants to   */
+/*   receive POWER_STATE_CHANGED                                            */
+/*   notifications, and set to 0 otherwise.                                 */
+/*                                                                          */
+/* Process the POWER_STATE_NOTIFY message. Platform                         */
+/* handler for SCMI_PowerStateNotify(). Requires access greater             */
+/* than or equal to NOTIFY. See section 4.3.2.8 in the SCMI spec.           */
+/*                                                                          */
+/*  Access macros:                                                          */
+/* - POWER_NOTIFY_ENABLE() - Notify enable                                  */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_SUCCESS: if the notification state was successfully updated.    */
+/* - SM_ERR_NOT_FOUND: if domainId does not point to a valid domain.        */
+/* - SM_ERR_DENIED: if the calling agent is not permitted to request the    */
+/*   notification.                                                          */
+/* - SM_ERR_INVALID_PARAMETERS: if notifyEnable specifies values that are   */
+/*   either illegal or incorrect.                                           */
+/*--------------------------------------------------------------------------*/
+static int32_t PowerStateNotify(const scmi_caller_t *caller,
+    const msg_rpower6_t *in, const scmi_msg_status_t *out)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check domain */
+    if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_POWER))
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Check permissions */
+    if ((status == SM_ERR_SUCCESS)
+        && (SM_SCMI_PERM(g_scmiPdPerms, caller->agentId, in->domainId)
+        < SM_SCMI_PERM_NOTIFY))
+    {
+        status = SM_ERR_DENIED;
+    }
+
+    /* Check flags */
+    if ((status == SM_ERR_SUCCESS) && ((in->notifyEnable & ~1U) != 0U))
+    {
+        status = SM_ERR_INVALID_PARAMETERS;
+    }
+
+    /* Record notification enable */
+    if (status == SM_ERR_SUCCESS)
+    {
+        if (POWER_NOTIFY_ENABLE(in->notifyEnable) != 0U)
+        {
+            s_powerNotify[caller->agentId] |= (1UL << in->domainId);
+        }
+        else
+        {
+            s_powerNotify[caller->agentId] &= ~(1UL << in->domainId);
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Configure power state change requested notification                      */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - in->domainId: Identifier for the power domain                          */
+/* - in->notifyEnable: Notification flags:                                  */
+/*   Bits[31:1] Reserved, must be zero.                                     */
+/*   Bit[0] Notify enable. This bit must be set to 1 if an agent wants to   */
+/*   receive POWER_STATE_CHANGE_REQUESTED                                   */
+/*   notifications, and set to 0 otherwise.                                 */
+/*                                                                          */
+/* Process the POWER_STATE_CHANGE_REQUESTED_NOTIFY message. Platform        */
+/* handler for SCMI_PowerStateChangeRequestedNotify(). Requires access      */
+/* greater than or equal to NOTIFY. See section 4.3.2.9 in the SCMI spec.   */
+/*                                                                          */
+/*  Access macros:                                                          */
+/* - POWER_NOTIFY_ENABLE() - Notify enable                                  */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_SUCCESS: if the notification state was successfully updated.    */
+/* - SM_ERR_NOT_FOUND: if domainId does not point to a valid domain.        */
+/* - SM_ERR_DENIED: if the calling agent is not permitted to request the    */
+/*   notification.                                                          */
+/* - SM_ERR_INVALID_PARAMETERS: if notifyEnable specifies values that are   */
+/*   either illegal or incorrect.                                           */
+/*--------------------------------------------------------------------------*/
+static int32_t PowerStateChangeRequestedNotify(const scmi_caller_t *caller,
+    const msg_rpower7_t *in, const scmi_msg_status_t *out)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check domain */
+    if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_POWER))
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Check permissions */
+    if ((status == SM_ERR_SUCCESS)
+        && (SM_SCMI_PERM(g_scmiPdPerms, caller->agentId, in->domainId)
+        < SM_SCMI_PERM_NOTIFY))
+    {
+        status = SM_ERR_DENIED;
+    }
+
+    /* Check flags */
+    if ((status == SM_ERR_SUCCESS) && ((in->notifyEnable & ~1U) != 0U))
+    {
+        status = SM_ERR_INVALID_PARAMETERS;
+    }
+
+    /* Record notification enable */
+    if (status == SM_ERR_SUCCESS)
+    {
+        if (POWER_NOTIFY_ENABLE(in->notifyEnable) != 0U)
+        {
+            s_powerReqNotify[caller->agentId] |= (1UL << in->domainId);
+        }
+        else
+        {
+            s_powerReqNotify[caller->agentId] &= ~(1UL << in->domainId);
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Negotiate the protocol version                                           */
 /*                                                                          */
@@ -724,19 +924,12 @@ static int32_t PowerStateGet(const scmi_caller_t *caller,
 /*   successful return of this command must comply with the negotiated      */
 /*   version.                                                               */
 /* - SM_ERR_NOT_SUPPORTED: if the protocol version is not supported.        */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t PowerNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rpower16_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check major version */
     if ((status == SM_ERR_SUCCESS) && (SCMI_VER_MAJOR(in->version)
         == SCMI_VER_MAJOR(PROTOCOL_VERSION)))
@@ -756,6 +949,100 @@ static int32_t PowerNegotiateProtocolVersion(const scmi_caller_t *caller,
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Send power state changed event                                           */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - msgId: Message ID to dispatch                                          */
+/* - trigger: Trigger data                                                  */
+/*--------------------------------------------------------------------------*/
+static int32_t PowerStateChanged(scmi_msg_id_t msgId,
+    const lmm_rpc_trigger_t *trigger)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    uint32_t domainId = trigger->parm[0];
+
+    /* Loop over all agents */
+    for (uint32_t dstAgent = 0U; dstAgent < SM_SCMI_NUM_AGNT; dstAgent++)
+    {
+        bool enable = ((s_powerNotify[dstAgent] >> domainId) & 0x1U) != 0U;
+
+        /* Agent belong to instance? */
+        if ((g_scmiAgentConfig[dstAgent].scmiInst == trigger->rpcInst)
+            && enable)
+        {
+            msg_rpower32_t out;
+
+            /* Fill in data */
+            out.agentId = 0U;
+            out.domainId = domainId;
+            switch (trigger->parm[1])
+            {
+                case DEV_SM_POWER_STATE_OFF:
+                    out.powerState = POWER_DOMAIN_STATE_OFF;
+                    break;
+                case DEV_SM_POWER_STATE_ON:
+                    out.powerState = POWER_DOMAIN_STATE_ON;
+                    break;
+                default:
+                    out.powerState = trigger->parm[1];
+                    break;
+            }
+
+            /* Queue notification (coalesced per domain) */
+            RPC_SCMI_P2aTxQ(dstAgent, msgId, (uint32_t*) &out,
+                sizeof(out), SCMI_NOTIFY_Q, domainId);
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Send power state change requested event                                  */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info of the requesting agent                            */
+/* - domainId: Identifier for the power domain                              */
+/* - powerState: Requested SCMI power state                                 */
+/*                                                                          */
+/* Requests are aggregated per SCMI instance, so only the other agents of   */
+/* the caller's instance are informed.                                      */
+/*--------------------------------------------------------------------------*/
+static void PowerStateChangeRequested(const scmi_caller_t *caller,
+    uint32_t domainId, uint32_t powerState)
+{
+    scmi_msg_id_t msgId =
+    {
+        .protocolId = SCMI_PROTOCOL_POWER,
+        .messageId = RPC_SCMI_NOTIFY_POWER_STATE_CHANGE_REQUESTED
+    };
+
+    /* Loop over all agents */
+    for (uint32_t dstAgent = 0U; dstAgent < SM_SCMI_NUM_AGNT; dstAgent++)
+    {
+        bool enable = ((s_powerReqNotify[dstAgent] >> domainId) & 0x1U)
+            != 0U;
+
+        /* Other agent of the same instance? */
+        if ((g_scmiAgentConfig[dstAgent].scmiInst == caller->scmiInst)
+            && (dstAgent != caller->agentId) && enable)
+        {
+            msg_rpower32_t out;
+
+            /* Fill in data */
+            out.agentId = caller->instAgentId;
+            out.domainId = domainId;
+            out.powerState = powerState;
+
+            /* Queue notification (coalesced per domain) */
+            RPC_SCMI_P2aTxQ(dstAgent, msgId, (uint32_t*) &out,
+                sizeof(out), SCMI_NOTIFY_Q, domainId);
+        }
+    }
+}
+
 /*--------------------------------------------------------------------------*/
 /* Reset agent configuration                                                */
 /*                                                                          */
@@ -769,11 +1056,16 @@ static int32_t PowerResetAgentConfig(uint32_t lmId, uint32_t agentId,
 {
     int32_t status = SM_ERR_SUCCESS;
 
+    /* Disable notifications */
+    s_powerNotify[agentId] = 0U;
+    s_powerReqNotify[agentId] = 0U;
+
     /* Loop over all power domains */
     for (uint32_t domainId = 0U; domainId < SM_NUM_POWER; domainId++)
     {
         /* Turn off power */
-        if (s_powerState[domainId][agentId] != DEV_SM_POWER_STATE_OFF)
+        if (LMM_VoteLevelGet(&s_powerVote[domainId], agentId)
+            != DEV_SM_POWER_STATE_OFF)
         {
             (void) PowerStateUpdate(lmId, agentId, domainId,
                 DEV_SM_POWER_STATE_OFF);
@@ -808,24 +1100,19 @@ static int32_t PowerStateUpdate(uint32_t lmId, uint32_t agentId,
         uint32_t scmiInst = g_scmiAgentConfig[agentId].scmiInst;
         uint32_t firstAgent = g_scmiConfig[scmiInst].firstAgent;
         uint32_t numAgents = g_scmiConfig[scmiInst].numAgents;
+        uint32_t mask = ((1UL << numAgents) - 1UL) << firstAgent;
+        uint32_t maxPowerState = DEV_SM_POWER_STATE_OFF;
 
-        uint8_t maxPowerState = DEV_SM_POWER_STATE_OFF;
-
-        /* Record agent power state for this domain */
-        s_powerState[domainId][agentId] = (uint8_t) powerState;
+        /* Record agent power state and aggregate over the instance */
+        status = LMM_VoteLevelSet(&s_powerVote[domainId], mask, agentId,
+            powerState, LMM_VOTE_MAX, &maxPowerState, NULL);
 
-        /* Calculate new aggregate state for the domain */
-        for (uint32_t a = firstAgent; a < (firstAgent + numAgents); a++)
+        /* Inform LMM of power state, LMM will check if changed */
+        if (status == SM_ERR_SUCCESS)
         {
-            /* Keep max state */
-            if (s_powerState[domainId][a] > maxPowerState)
-            {
-                maxPowerState = s_powerState[domainId][a];
-            }
+            status = LMM_PowerStateSet(lmId, domainId,
+                (uint8_t) maxPowerState);
         }
-
-        /* Inform LMM of power state, LMM will check if changed */
-        status = LMM_PowerStateSet(lmId, domainId, maxPowerState);
     }
 
     /* Return status */
@@ -52,6 +52,18 @@
 
 #include "rpc_scmi.h"
 
+/* Defines */
+
+/*!
+ * @name SCMI power notification message IDs
+ */
+/** @{ */
+/*! Power state changed */
+#define RPC_SCMI_NOTIFY_POWER_STATE_CHANGED            0x0U
+/*! Power state change requested */
+#define RPC_SCMI_NOTIFY_POWER_STATE_CHANGE_REQUESTED  0x1U
+/** @} */
+
 /* Functions */
 
 /*!
@@ -78,6 +90,24 @@
 int32_t RPC_SCMI_PowerDispatchCommand(scmi_caller_t *caller,
     uint32_t messageId);
 
+/*!
+ * Dispatch power protocol notification.
+ *
+ * @param[in]     msgId       Message to send
+ * @param[in]     trigger     Data associated with message
+ *
+ * This function requests the power protocol send the requested notification
+ * to agents that requested it.
+ *
+ * @return Returns the status (::SM_ERR_SUCCESS = success).
+ *
+ * Return errors (see @ref STATUS "SM error codes"):
+ * - ::SM_ERR_INVALID_PARAMETERS if \a messageId isn't supported
+ * - others returned by queuing functions
+ */
+int32_t RPC_SCMI_PowerDispatchNotification(scmi_msg_id_t msgId,
+    const lmm_rpc_trigger_t *trigger);
+
 /*!
  * Dispatch SCMI power protocol reset.
  *
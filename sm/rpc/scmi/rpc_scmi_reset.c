@@ -47,14 +47,13 @@
 /* Protocol version */
 #define PROTOCOL_VERSION  0x30001U
 
-/* SCMI reset protocol message IDs and masks */
+/* SCMI reset protocol message IDs */
 #define COMMAND_PROTOCOL_VERSION             0x0U
 #define COMMAND_PROTOCOL_ATTRIBUTES          0x1U
 #define COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES  0x2U
 #define COMMAND_RESET_DOMAIN_ATTRIBUTES      0x3U
 #define COMMAND_RESET                        0x4U
 #define COMMAND_NEGOTIATE_PROTOCOL_VERSION   0x10U
-#define COMMAND_SUPPORTED_MASK               0x1001FUL
 
 /* SCMI max reset argument lengths */
 #define RESET_MAX_NAME  16U
@@ -170,6 +169,24 @@ typedef struct
     uint32_t version;
 } msg_rreset16_t;
 
+/* Local variables */
+
+/* Message descriptors, indexed by message ID */
+static const scmi_msg_desc_t s_resetMsgDesc[] =
+{
+    [COMMAND_PROTOCOL_VERSION] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_treset0_t),
+    [COMMAND_PROTOCOL_ATTRIBUTES] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_treset1_t),
+    [COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES] =
+        SCMI_MSG_DESC(msg_rreset2_t, msg_treset2_t),
+    [COMMAND_RESET_DOMAIN_ATTRIBUTES] =
+        SCMI_MSG_DESC(msg_rreset3_t, msg_treset3_t),
+    [COMMAND_RESET] = SCMI_MSG_DESC(msg_rreset4_t, scmi_msg_status_t),
+    [COMMAND_NEGOTIATE_PROTOCOL_VERSION] =
+        SCMI_MSG_DESC(msg_rreset16_t, scmi_msg_status_t)
+};
+
 /* Local functions */
 
 static int32_t ResetProtocolVersion(const scmi_caller_t *caller,
@@ -197,47 +214,48 @@ static int32_t ResetResetAgentConfig(uint32_t lmId, uint32_t agentId,
 int32_t RPC_SCMI_ResetDispatchCommand(scmi_caller_t *caller,
     uint32_t messageId)
 {
-    int32_t status = SM_ERR_SUCCESS;
+    int32_t status;
     const scmi_msg_t *in = caller->msgCopy;
     scmi_msg_status_t *out = caller->msg;
-    uint32_t lenOut = sizeof(scmi_msg_status_t);
+    uint32_t lenOut;
+
+    /* Check message */
+    status = RPC_SCMI_A2pMsgCheck(caller, s_resetMsgDesc,
+        ARRAY_SIZE(s_resetMsgDesc), messageId, &lenOut);
 
     /* Handle standard messages */
-    switch(messageId)
+    if (status == SM_ERR_SUCCESS)
     {
-        case COMMAND_PROTOCOL_VERSION:
-            lenOut = sizeof(msg_treset0_t);
-            status = ResetProtocolVersion(caller,
-                (const scmi_msg_header_t*) in, (msg_treset0_t*) out);
-            break;
-        case COMMAND_PROTOCOL_ATTRIBUTES:
-            lenOut = sizeof(msg_treset1_t);
-            status = ResetProtocolAttributes(caller,
-                (const scmi_msg_header_t*) in, (msg_treset1_t*) out);
-            break;
-        case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
-            lenOut = sizeof(msg_treset2_t);
-            status = ResetProtocolMessageAttributes(caller,
-                (const msg_rreset2_t*) in, (msg_treset2_t*) out);
-            break;
-        case COMMAND_RESET_DOMAIN_ATTRIBUTES:
-            lenOut = sizeof(msg_treset3_t);
-            status = ResetDomainAttributes(caller, (const msg_rreset3_t*) in,
-                (msg_treset3_t*) out);
-            break;
-        case COMMAND_RESET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = Reset(caller, (const msg_rreset4_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = ResetNegotiateProtocolVersion(caller,
-                (const msg_rreset16_t*) in, (const scmi_msg_status_t*) out);
-            break;
-        default:
-            status = SM_ERR_NOT_SUPPORTED;
-            break;
+        switch(messageId)
+        {
+            case COMMAND_PROTOCOL_VERSION:
+                status = ResetProtocolVersion(caller,
+                    (const scmi_msg_header_t*) in, (msg_treset0_t*) out);
+                break;
+            case COMMAND_PROTOCOL_ATTRIBUTES:
+                status = ResetProtocolAttributes(caller,
+                    (const scmi_msg_header_t*) in, (msg_treset1_t*) out);
+                break;
+            case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
+                status = ResetProtocolMessageAttributes(caller,
+                    (const msg_rreset2_t*) in, (msg_treset2_t*) out);
+                break;
+            case COMMAND_RESET_DOMAIN_ATTRIBUTES:
+                status = ResetDomainAttributes(caller,
+                    (const msg_rreset3_t*) in, (msg_treset3_t*) out);
+                break;
+            case COMMAND_RESET:
+                status = Reset(caller, (const msg_rreset4_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
+                status = ResetNegotiateProtocolVersion(caller,
+                    (const msg_rreset16_t*) in, (const scmi_msg_status_t*) out);
+                break;
+            default:
+                status = SM_ERR_NOT_SUPPORTED;
+                break;
+        }
     }
 
     /* Update length */
@@ -277,25 +295,14 @@ int32_t RPC_SCMI_ResetDispatchReset(uint32_t lmId, uint32_t agentId,
 /* SCMI_ResetProtocolVersion(). See section 4.8.2.1 in the SCMI spec.       */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t ResetProtocolVersion(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_treset0_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return version */
-        out->version = PROTOCOL_VERSION;
-    }
+    /* Return version */
+    out->version = PROTOCOL_VERSION;
 
     /* Return status */
     return status;
@@ -317,26 +324,15 @@ static int32_t ResetProtocolVersion(const scmi_caller_t *caller,
 /* - RESET_PROTO_ATTR_NUM_RESETS() - Number of reset domains                */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t ResetProtocolAttributes(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_treset1_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return number of resets */
-        out->attributes = RESET_PROTO_ATTR_NUM_RESETS((uint32_t)
-            SM_NUM_RESET);
-    }
+    /* Return number of resets */
+    out->attributes = RESET_PROTO_ATTR_NUM_RESETS((uint32_t)
+        SM_NUM_RESET);
 
     /* Return status */
     return status;
@@ -361,33 +357,20 @@ static int32_t ResetProtocolAttributes(const scmi_caller_t *caller,
 /*   use.                                                                   */
 /* - SM_ERR_NOT_FOUND: if the message identified by messageId is invalid    */
 /*   or not provided by this platform implementation.                       */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t ResetProtocolMessageAttributes(const scmi_caller_t *caller,
     const msg_rreset2_t *in, msg_treset2_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
+    /* Always zero */
+    out->attributes = 0U;
 
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
+    /* Is message supported ? */
+    if (!RPC_SCMI_A2pMsgSupported(s_resetMsgDesc,
+        ARRAY_SIZE(s_resetMsgDesc), in->messageId))
     {
-        uint32_t mask = COMMAND_SUPPORTED_MASK;
-
-        /* Always zero */
-        out->attributes = 0U;
-
-        /* Is message supported ? */
-        if ((in->messageId >= 32U) || (((mask >> in->messageId)
-            & 0x1U) == 0U))
-        {
-            status = SM_ERR_NOT_FOUND;
-        }
+        status = SM_ERR_NOT_FOUND;
     }
 
     /* Return status */
@@ -429,7 +412,6 @@ static int32_t ResetProtocolMessageAttributes(const scmi_caller_t *caller,
 /* Return errors:                                                           */
 /* - SM_ERR_SUCCESS: if valid reset domain attributes were returned.        */
 /* - SM_ERR_NOT_FOUND: if domainId pertains to a non-existent domain.       */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t ResetDomainAttributes(const scmi_caller_t *caller,
     const msg_rreset3_t *in, msg_treset3_t *out)
@@ -437,12 +419,6 @@ static int32_t ResetDomainAttributes(const scmi_caller_t *caller,
     int32_t status = SM_ERR_SUCCESS;
     const uint8_t *nameAddr = (const uint8_t*) "";
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check domain */
     if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_RESET))
     {
@@ -518,7 +494,6 @@ static int32_t ResetDomainAttributes(const scmi_caller_t *caller,
 /*   are other active users of the reset domain.                            */
 /* - SM_ERR_DENIED: if the calling agent is not allowed to reset the        */
 /*   specified reset domain.                                                */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t Reset(const scmi_caller_t *caller, const msg_rreset4_t *in,
     const scmi_msg_status_t *out)
@@ -526,12 +501,6 @@ static int32_t Reset(const scmi_caller_t *caller, const msg_rreset4_t *in,
     int32_t status = SM_ERR_SUCCESS;
     uint8_t lmmState = DEV_SM_RST_COLD;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check domain */
     if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_RESET))
     {
@@ -540,7 +509,7 @@ static int32_t Reset(const scmi_caller_t *caller, const msg_rreset4_t *in,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].rstPerms[in->domainId]
+        && (SM_SCMI_PERM(g_scmiRstPerms, caller->agentId, in->domainId)
         < SM_SCMI_PERM_EXCLUSIVE))
     {
         status = SM_ERR_DENIED;
@@ -611,19 +580,12 @@ static int32_t Reset(const scmi_caller_t *caller, const msg_rreset4_t *in,
 /*   successful return of this command must comply with the negotiated      */
 /*   version.                                                               */
 /* - SM_ERR_NOT_SUPPORTED: if the protocol version is not supported.        */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t ResetNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rreset16_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check major version */
     if ((status == SM_ERR_SUCCESS) && (SCMI_VER_MAJOR(in->version)
         == SCMI_VER_MAJOR(PROTOCOL_VERSION)))
@@ -47,7 +47,7 @@
 /* Protocol version */
 #define PROTOCOL_VERSION  0x30001U
 
-/* SCMI sensor protocol message IDs and masks */
+/* SCMI sensor protocol message IDs */
 #define COMMAND_PROTOCOL_VERSION             0x0U
 #define COMMAND_PROTOCOL_ATTRIBUTES          0x1U
 #define COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES  0x2U
@@ -57,12 +57,13 @@
 #define COMMAND_SENSOR_READING_GET           0x6U
 #define COMMAND_SENSOR_CONFIG_GET            0x9U
 #define COMMAND_SENSOR_CONFIG_SET            0xAU
+#define COMMAND_SENSOR_CONTINUOUS_UPDATE_NOTIFY  0xBU
 #define COMMAND_NEGOTIATE_PROTOCOL_VERSION   0x10U
-#define COMMAND_SUPPORTED_MASK               0x1067FUL
 
 /* SCMI max sensor argument lengths */
 #define SENSOR_MAX_NAME      16U
 #define SENSOR_MAX_DESC      SCMI_ARRAY(8U, sensor_desc_t)
+#define SENSOR_NUM_DESC(C)   SCMI_ARRAY_CALLER(C, 8U, sensor_desc_t)
 #define SENSOR_MAX_READINGS  SCMI_ARRAY(4U, sensor_reading_t)
 
 /* SCMI sensor TP events */
@@ -71,6 +72,13 @@
 #define SENSOR_TP_NEG   2U
 #define SENSOR_TP_BOTH  3U
 
+/* SCMI sensor update intervals (mS) */
+#define SENSOR_UPDATE_DEFAULT_MSEC  1000U
+#define SENSOR_UPDATE_MIN_MSEC      10U
+
+/* Max pending async reads per agent */
+#define SENSOR_MAX_PENDING  2U
+
 /* Local macros */
 
 /* SCMI sensor protocol attributes */
@@ -103,8 +111,12 @@
 #define SENSOR_TP_EV_CTRL_TRIP_ID(x)  (((x) & 0xFF0U) >> 4U)
 #define SENSOR_TP_EV_CTRL(x)          (((x) & 0x3U) >> 0U)
 
+/* SCMI sensor continuous update notify enable */
+#define SENSOR_UPDATE_NOTIFY_ENABLE(x)  (((x) & 0x1U) >> 0U)
+
 /* SCMI sensor read flags */
 #define SENSOR_READ_FLAGS_ASYNC(x)  (((x) & 0x1U) >> 0U)
+#define SENSOR_READ_FLAGS_FRESH(x)  (((x) & 0x2U) >> 1U)
 
 /* SCMI sensor config (get) */
 #define SENSOR_CONFIG_GET_UPDATE_INTV_SEC(x)  (((x) & 0xFFFFU) << 16U)
@@ -301,6 +313,17 @@ typedef struct
     uint32_t sensorConfig;
 } msg_rsensor10_t;
 
+/* Request type for SensorContinuousUpdateNotify() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Identifier for the sensor */
+    uint32_t sensorId;
+    /* Notify enable */
+    uint32_t notifyEnable;
+} msg_rsensor11_t;
+
 /* Request type for NegotiateProtocolVersion() */
 typedef struct
 {
@@ -323,6 +346,88 @@ typedef struct
     uint32_t tripPointDesc;
 } msg_rsensor32_t;
 
+/* Request type for SensorUpdate() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Refers to the agent that caused this event */
+    uint32_t agentId;
+    /* Identifier for the sensor that was updated */
+    uint32_t sensorId;
+    /* Sensor reading */
+    sensor_reading_t readings[1];
+} msg_rsensor33_t;
+
+/* Delayed response type for SensorReadingGet() */
+typedef struct
+{
+    /* Header word */
+    uint32_t header;
+    /* Return status */
+    int32_t status;
+    /* Identifier for the sensor */
+    uint32_t sensorId;
+    /* Sensor reading */
+    sensor_reading_t readings[1];
+} msg_dsensor6_t;
+
+/* Pending async sensor read */
+typedef struct
+{
+    /* Header of the SENSOR_READING_GET message */
+    uint32_t header;
+    /* LM of the agent */
+    uint32_t lmId;
+    /* Identifier for the sensor */
+    uint32_t sensorId;
+} sensor_async_t;
+
+/* Async sensor read queue */
+typedef struct
+{
+    uint32_t tail;
+    uint32_t count;
+    sensor_async_t req[SENSOR_MAX_PENDING];
+} sensor_async_queue_t;
+
+/* Local variables */
+
+/* Message descriptors, indexed by message ID */
+static const scmi_msg_desc_t s_sensorMsgDesc[] =
+{
+    [COMMAND_PROTOCOL_VERSION] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tsensor0_t),
+    [COMMAND_PROTOCOL_ATTRIBUTES] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tsensor1_t),
+    [COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES] =
+        SCMI_MSG_DESC(msg_rsensor2_t, msg_tsensor2_t),
+    [COMMAND_SENSOR_DESCRIPTION_GET] =
+        SCMI_MSG_DESC(msg_rsensor3_t, msg_tsensor3_t),
+    [COMMAND_SENSOR_TRIP_POINT_NOTIFY] =
+        SCMI_MSG_DESC(msg_rsensor4_t, scmi_msg_status_t),
+    [COMMAND_SENSOR_TRIP_POINT_CONFIG] =
+        SCMI_MSG_DESC(msg_rsensor5_t, scmi_msg_status_t),
+    [COMMAND_SENSOR_READING_GET] =
+        SCMI_MSG_DESC(msg_rsensor6_t, msg_tsensor6_t),
+    [COMMAND_SENSOR_CONFIG_GET] = SCMI_MSG_DESC(msg_rsensor9_t, msg_tsensor9_t),
+    [COMMAND_SENSOR_CONFIG_SET] =
+        SCMI_MSG_DESC(msg_rsensor10_t, scmi_msg_status_t),
+    [COMMAND_SENSOR_CONTINUOUS_UPDATE_NOTIFY] =
+        SCMI_MSG_DESC(msg_rsensor11_t, scmi_msg_status_t),
+    [COMMAND_NEGOTIATE_PROTOCOL_VERSION] =
+        SCMI_MSG_DESC(msg_rsensor16_t, scmi_msg_status_t)
+};
+
+/* Update interval (mS, 0 = default) per agent and sensor */
+static uint32_t s_updateIntv[SM_SCMI_NUM_AGNT][SM_NUM_SENSOR];
+
+/* Next update time (uS, 0 = disabled) per agent and sensor */
+static uint64_t s_updateDue[SM_SCMI_NUM_AGNT][SM_NUM_SENSOR];
+
+static sensor_async_queue_t s_asyncQueue[SM_SCMI_NUM_AGNT];
+static uint32_t s_asyncLastAgent;
+
 /* Local functions */
 
 static int32_t SensorProtocolVersion(const scmi_caller_t *caller,
@@ -343,12 +448,21 @@ static int32_t SensorConfigGet(const scmi_caller_t *caller,
     const msg_rsensor9_t *in, msg_tsensor9_t *out);
 static int32_t SensorConfigSet(const scmi_caller_t *caller,
     const msg_rsensor10_t *in, const scmi_msg_status_t *out);
+static int32_t SensorContinuousUpdateNotify(const scmi_caller_t *caller,
+    const msg_rsensor11_t *in, const scmi_msg_status_t *out);
 static int32_t SensorNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rsensor16_t *in, const scmi_msg_status_t *out);
 static int32_t SensorTripPointEvent(scmi_msg_id_t msgId,
     const lmm_rpc_trigger_t *trigger);
 static int32_t SensorResetAgentConfig(uint32_t lmId, uint32_t agentId,
     bool permissionsReset);
+static int32_t SensorUpdateIntvDecode(uint32_t sensorConfig,
+    uint32_t *msec);
+static uint32_t SensorUpdateIntvEncode(uint32_t msec);
+static uint32_t SensorUpdateIntvGet(uint32_t agentId, uint32_t sensorId);
+static bool SensorUpdateDue(uint32_t agentId, uint32_t sensorId,
+    uint64_t now);
+static bool SensorAsyncGet(uint32_t *agentId);
 
 /*--------------------------------------------------------------------------*/
 /* Dispatch SCMI command                                                    */
@@ -360,67 +474,70 @@ static int32_t SensorResetAgentConfig(uint32_t lmId, uint32_t agentId,
 int32_t RPC_SCMI_SensorDispatchCommand(scmi_caller_t *caller,
     uint32_t messageId)
 {
-    int32_t status = SM_ERR_SUCCESS;
+    int32_t status;
     const scmi_msg_t *in = caller->msgCopy;
     scmi_msg_status_t *out = caller->msg;
-    uint32_t lenOut = sizeof(scmi_msg_status_t);
+    uint32_t lenOut;
+
+    /* Check message */
+    status = RPC_SCMI_A2pMsgCheck(caller, s_sensorMsgDesc,
+        ARRAY_SIZE(s_sensorMsgDesc), messageId, &lenOut);
 
     /* Handle standard messages */
-    switch(messageId)
+    if (status == SM_ERR_SUCCESS)
     {
-        case COMMAND_PROTOCOL_VERSION:
-            lenOut = sizeof(msg_tsensor0_t);
-            status = SensorProtocolVersion(caller,
-                (const scmi_msg_header_t*) in, (msg_tsensor0_t*) out);
-            break;
-        case COMMAND_PROTOCOL_ATTRIBUTES:
-            lenOut = sizeof(msg_tsensor1_t);
-            status = SensorProtocolAttributes(caller,
-                (const scmi_msg_header_t*) in, (msg_tsensor1_t*) out);
-            break;
-        case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
-            lenOut = sizeof(msg_tsensor2_t);
-            status = SensorProtocolMessageAttributes(caller,
-                (const msg_rsensor2_t*) in, (msg_tsensor2_t*) out);
-            break;
-        case COMMAND_SENSOR_DESCRIPTION_GET:
-            lenOut = sizeof(msg_tsensor3_t);
-            status = SensorDescriptionGet(caller, (const msg_rsensor3_t*) in,
-                (msg_tsensor3_t*) out, &lenOut);
-            break;
-        case COMMAND_SENSOR_TRIP_POINT_NOTIFY:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = SensorTripPointNotify(caller, (const msg_rsensor4_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_SENSOR_TRIP_POINT_CONFIG:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = SensorTripPointConfig(caller, (const msg_rsensor5_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_SENSOR_READING_GET:
-            lenOut = sizeof(msg_tsensor6_t);
-            status = SensorReadingGet(caller, (const msg_rsensor6_t*) in,
-                (msg_tsensor6_t*) out, &lenOut);
-            break;
-        case COMMAND_SENSOR_CONFIG_GET:
-            lenOut = sizeof(msg_tsensor9_t);
-            status = SensorConfigGet(caller, (const msg_rsensor9_t*) in,
-                (msg_tsensor9_t*) out);
-            break;
-        case COMMAND_SENSOR_CONFIG_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = SensorConfigSet(caller, (const msg_rsensor10_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = SensorNegotiateProtocolVersion(caller,
-                (const msg_rsensor16_t*) in, (const scmi_msg_status_t*) out);
-            break;
-        default:
-            status = SM_ERR_NOT_SUPPORTED;
-            break;
+        switch(messageId)
+        {
+            case COMMAND_PROTOCOL_VERSION:
+                status = SensorProtocolVersion(caller,
+                    (const scmi_msg_header_t*) in, (msg_tsensor0_t*) out);
+                break;
+            case COMMAND_PROTOCOL_ATTRIBUTES:
+                status = SensorProtocolAttributes(caller,
+                    (const scmi_msg_header_t*) in, (msg_tsensor1_t*) out);
+                break;
+            case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
+                status = SensorProtocolMessageAttributes(caller,
+                    (const msg_rsensor2_t*) in, (msg_tsensor2_t*) out);
+                break;
+            case COMMAND_SENSOR_DESCRIPTION_GET:
+                status = SensorDescriptionGet(caller,
+                    (const msg_rsensor3_t*) in, (msg_tsensor3_t*) out, &lenOut);
+                break;
+            case COMMAND_SENSOR_TRIP_POINT_NOTIFY:
+                status = SensorTripPointNotify(caller,
+                    (const msg_rsensor4_t*) in, (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_SENSOR_TRIP_POINT_CONFIG:
+                status = SensorTripPointConfig(caller,
+                    (const msg_rsensor5_t*) in, (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_SENSOR_READING_GET:
+                status = SensorReadingGet(caller, (const msg_rsensor6_t*) in,
+                    (msg_tsensor6_t*) out, &lenOut);
+                break;
+            case COMMAND_SENSOR_CONFIG_GET:
+                status = SensorConfigGet(caller, (const msg_rsensor9_t*) in,
+                    (msg_tsensor9_t*) out);
+                break;
+            case COMMAND_SENSOR_CONFIG_SET:
+                status = SensorConfigSet(caller, (const msg_rsensor10_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_SENSOR_CONTINUOUS_UPDATE_NOTIFY:
+                status = SensorContinuousUpdateNotify(caller,
+                    (const msg_rsensor11_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
+                status = SensorNegotiateProtocolVersion(caller,
+                    (const msg_rsensor16_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            default:
+                status = SM_ERR_NOT_SUPPORTED;
+                break;
+        }
     }
 
     /* Update length */
@@ -471,6 +588,170 @@ int32_t RPC_SCMI_SensorDispatchReset(uint32_t lmId, uint32_t agentId,
     return SensorResetAgentConfig(lmId, agentId, permissionsReset);
 }
 
+/*--------------------------------------------------------------------------*/
+/* Check for due sensor updates                                             */
+/*--------------------------------------------------------------------------*/
+bool RPC_SCMI_SensorUpdatePending(void)
+{
+    bool rtn = false;
+    uint64_t now = DEV_SM_Usec64Get();
+
+    /* Loop over all agents and sensors */
+    for (uint32_t agentId = 0U; agentId < SM_SCMI_NUM_AGNT; agentId++)
+    {
+        for (uint32_t sensorId = 0U; sensorId < SM_NUM_SENSOR; sensorId++)
+        {
+            if (SensorUpdateDue(agentId, sensorId, now))
+            {
+                rtn = true;
+                break;
+            }
+        }
+
+        if (rtn)
+        {
+            break;
+        }
+    }
+
+    /* Return result */
+    return rtn;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Sample sensors and send update notifications                             */
+/*--------------------------------------------------------------------------*/
+void RPC_SCMI_SensorUpdateDispatch(void)
+{
+    uint64_t now = DEV_SM_Usec64Get();
+    scmi_msg_id_t msgId =
+    {
+        .protocolId = SCMI_PROTOCOL_SENSOR,
+        .messageId = RPC_SCMI_NOTIFY_SENSOR_UPDATE
+    };
+
+    /* Loop over all sensors */
+    for (uint32_t sensorId = 0U; sensorId < SM_NUM_SENSOR; sensorId++)
+    {
+        int32_t status = SM_ERR_SUCCESS;
+        bool sampled = false;
+        int64_t sensorValue = 0;
+        uint64_t sensorTimestamp = 0U;
+
+        /* Loop over all agents */
+        for (uint32_t agentId = 0U; agentId < SM_SCMI_NUM_AGNT; agentId++)
+        {
+            if (SensorUpdateDue(agentId, sensorId, now))
+            {
+                uint32_t lmId = g_scmiConfig[
+                    g_scmiAgentConfig[agentId].scmiInst].lmId;
+                uint64_t intv = ((uint64_t) SensorUpdateIntvGet(agentId,
+                    sensorId)) * 1000ULL;
+
+                /* Sample once for all agents due */
+                if (!sampled)
+                {
+                    bool enabled = false;
+                    bool timestampReporting;
+
+                    status = LMM_SensorIsEnabled(lmId, sensorId, &enabled,
+                        &timestampReporting);
+                    if ((status == SM_ERR_SUCCESS) && !enabled)
+                    {
+                        status = SM_ERR_PROTOCOL_ERROR;
+                    }
+                    if (status == SM_ERR_SUCCESS)
+                    {
+                        status = LMM_SensorReadingGet(lmId, sensorId,
+                            &sensorValue, &sensorTimestamp);
+                    }
+                    sampled = true;
+                }
+
+                /* Queue notification (coalesced per sensor) */
+                if (status == SM_ERR_SUCCESS)
+                {
+                    msg_rsensor33_t out;
+
+                    out.agentId = 0U;
+                    out.sensorId = sensorId;
+                    out.readings[0].sensorValueLow = SM_INT64_L(sensorValue);
+                    out.readings[0].sensorValueHigh
+                        = SM_INT64_H(sensorValue);
+                    out.readings[0].timestampLow
+                        = SM_UINT64_L(sensorTimestamp);
+                    out.readings[0].timestampHigh
+                        = SM_UINT64_H(sensorTimestamp);
+
+                    RPC_SCMI_P2aTxQ(agentId, msgId, (uint32_t*) &out,
+                        sizeof(out), SCMI_NOTIFY_Q, sensorId);
+                }
+
+                /* Schedule next update, skip missed intervals */
+                s_updateDue[agentId][sensorId] += intv;
+                if (s_updateDue[agentId][sensorId] <= now)
+                {
+                    s_updateDue[agentId][sensorId] = now + intv;
+                }
+            }
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check for pending async sensor reads                                     */
+/*--------------------------------------------------------------------------*/
+bool RPC_SCMI_SensorAsyncPending(void)
+{
+    uint32_t agentId;
+
+    /* Return result */
+    return SensorAsyncGet(&agentId);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Execute a pending async sensor read                                      */
+/*--------------------------------------------------------------------------*/
+void RPC_SCMI_SensorAsyncDispatch(void)
+{
+    uint32_t agentId;
+
+    /* Get next request ready to execute */
+    if (SensorAsyncGet(&agentId))
+    {
+        sensor_async_queue_t *queue = &s_asyncQueue[agentId];
+        const sensor_async_t *req = &queue->req[queue->tail];
+        int64_t sensorValue = 0;
+        uint64_t sensorTimestamp = 0U;
+        msg_dsensor6_t out;
+
+        /* Take a fresh sample, slow sensors are read here */
+        out.status = LMM_SensorSample(req->lmId, req->sensorId);
+
+        /* Get sensor reading */
+        if (out.status == SM_ERR_SUCCESS)
+        {
+            out.status = LMM_SensorReadingGet(req->lmId, req->sensorId,
+                &sensorValue, &sensorTimestamp);
+        }
+
+        /* Queue delayed response */
+        out.sensorId = req->sensorId;
+        out.readings[0].sensorValueLow = SM_INT64_L(sensorValue);
+        out.readings[0].sensorValueHigh = SM_INT64_H(sensorValue);
+        out.readings[0].timestampLow = SM_UINT64_L(sensorTimestamp);
+        out.readings[0].timestampHigh = SM_UINT64_H(sensorTimestamp);
+
+        RPC_SCMI_P2aRespTxQ(agentId, req->header, (uint32_t*) &out,
+            sizeof(out));
+
+        /* Consume request */
+        queue->tail = (queue->tail + 1U) % SENSOR_MAX_PENDING;
+        queue->count--;
+        s_asyncLastAgent = agentId;
+    }
+}
+
 /*==========================================================================*/
 /* Custom Protocol Implementation                                           */
 /*==========================================================================*/
@@ -491,25 +772,14 @@ static uint32_t s_sensorNotify[SM_SCMI_NUM_AGNT];
 /* SCMI_SensorProtocolVersion(). See section 4.7.2.1 in the SCMI spec.      */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t SensorProtocolVersion(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tsensor0_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return version */
-        out->version = PROTOCOL_VERSION;
-    }
+    /* Return version */
+    out->version = PROTOCOL_VERSION;
 
     /* Return status */
     return status;
@@ -551,32 +821,21 @@ static int32_t SensorProtocolVersion(const scmi_caller_t *caller,
 /*   and managed by the platform                                            */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t SensorProtocolAttributes(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tsensor1_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
+    /* Return number of sensors and async calls */
+    out->attributes
+        = SENSOR_PROTO_ATTR_MAX_PENDING(SENSOR_MAX_PENDING)
+        | SENSOR_PROTO_ATTR_NUM_SENSORS(SM_NUM_SENSOR);
 
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return number of sensors, no async calls */
-        out->attributes
-            = SENSOR_PROTO_ATTR_MAX_PENDING(0UL)
-            | SENSOR_PROTO_ATTR_NUM_SENSORS(SM_NUM_SENSOR);
-
-        /* Statistics not supported */
-        out->sensorRegAddressLow = 0U;
-        out->sensorRegAddressHigh = 0U;
-        out->sensorRegLen = 0U;
-    }
+    /* Statistics not supported */
+    out->sensorRegAddressLow = 0U;
+    out->sensorRegAddressHigh = 0U;
+    out->sensorRegLen = 0U;
 
     /* Return status */
     return status;
@@ -601,33 +860,20 @@ static int32_t SensorProtocolAttributes(const scmi_caller_t *caller,
 /*   use.                                                                   */
 /* - SM_ERR_NOT_FOUND: if the message identified by messageId is not        */
 /*   provided by this platform implementation.                              */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t SensorProtocolMessageAttributes(const scmi_caller_t *caller,
     const msg_rsensor2_t *in, msg_tsensor2_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
+    /* Always zero */
+    out->attributes = 0U;
 
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
+    /* Is message supported ? */
+    if (!RPC_SCMI_A2pMsgSupported(s_sensorMsgDesc,
+        ARRAY_SIZE(s_sensorMsgDesc), in->messageId))
     {
-        uint32_t mask = COMMAND_SUPPORTED_MASK;
-
-        /* Always zero */
-        out->attributes = 0U;
-
-        /* Is message supported ? */
-        if ((in->messageId >= 32U) || (((mask >> in->messageId)
-            & 0x1U) == 0U))
-        {
-            status = SM_ERR_NOT_FOUND;
-        }
+        status = SM_ERR_NOT_FOUND;
     }
 
     /* Return status */
@@ -660,19 +906,12 @@ static int32_t SensorProtocolMessageAttributes(const scmi_caller_t *caller,
 /* Return errors:                                                           */
 /* - SM_ERR_SUCCESS: if the sensor description was returned successfully.   */
 /* - SM_ERR_INVALID_PARAMETERS: if descIndex out of range.                  */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t SensorDescriptionGet(const scmi_caller_t *caller,
     const msg_rsensor3_t *in, msg_tsensor3_t *out, uint32_t *len)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check description bounds */
     if ((status == SM_ERR_SUCCESS) && (in->descIndex >= SM_NUM_SENSOR))
     {
@@ -685,7 +924,7 @@ static int32_t SensorDescriptionGet(const scmi_caller_t *caller,
         uint32_t sensor;
 
         out->numSensorFlags = 0U;
-        for (sensor = 0U; sensor < SENSOR_MAX_DESC; sensor++)
+        for (sensor = 0U; sensor < SENSOR_NUM_DESC(caller); sensor++)
         {
             dev_sm_sensor_desc_t lmmDesc;
             const uint8_t *nameAddr = (const uint8_t*) "";
@@ -724,7 +963,9 @@ static int32_t SensorDescriptionGet(const scmi_caller_t *caller,
 
                 /* Sensor attributes (low) */
                 attributes = SENSOR_ATTR_LOW_NUM_TP(
-                    (uint32_t) lmmDesc.numTripPoints);
+                    (uint32_t) lmmDesc.numTripPoints)
+                    | SENSOR_ATTR_LOW_CONTINUOUS(1U)
+                    | SENSOR_ATTR_LOW_ASYNC(lmmDesc.asyncSupport ? 1U : 0U);
                 if (lmmDesc.timestampSupport)
                 {
                     attributes |= SENSOR_ATTR_LOW_TIME_SUPPORT(1U);
@@ -792,7 +1033,6 @@ static int32_t SensorDescriptionGet(const scmi_caller_t *caller,
 /*   event notifications for the sensor.                                    */
 /* - SM_ERR_DENIED: if the calling agent is not permitted to set a trip     */
 /*   point on this sensor.                                                  */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t SensorTripPointNotify(const scmi_caller_t *caller,
     const msg_rsensor4_t *in, const scmi_msg_status_t *out)
@@ -800,12 +1040,6 @@ static int32_t SensorTripPointNotify(const scmi_caller_t *caller,
     int32_t status = SM_ERR_SUCCESS;
     bool enable = SENSOR_EV_CTRL_ENABLE(in->sensorEventControl) != 0U;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check sensor */
     if ((status == SM_ERR_SUCCESS) && (in->sensorId >= SM_NUM_SENSOR))
     {
@@ -814,7 +1048,7 @@ static int32_t SensorTripPointNotify(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].sensorPerms[in->sensorId]
+        && (SM_SCMI_PERM(g_scmiSensorPerms, caller->agentId, in->sensorId)
         < SM_SCMI_PERM_NOTIFY))
     {
         status = SM_ERR_DENIED;
@@ -881,19 +1115,12 @@ static int32_t SensorTripPointNotify(const scmi_caller_t *caller,
 /*   event notifications for the sensor.                                    */
 /* - SM_ERR_DENIED: if the calling agent is not permitted to set a trip     */
 /*   point on this sensor.                                                  */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t SensorTripPointConfig(const scmi_caller_t *caller,
     const msg_rsensor5_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check sensor */
     if ((status == SM_ERR_SUCCESS) && (in->sensorId >= SM_NUM_SENSOR))
     {
@@ -902,7 +1129,7 @@ static int32_t SensorTripPointConfig(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].sensorPerms[in->sensorId]
+        && (SM_SCMI_PERM(g_scmiSensorPerms, caller->agentId, in->sensorId)
         < SM_SCMI_PERM_EXCLUSIVE))
     {
         status = SM_ERR_DENIED;
@@ -947,8 +1174,15 @@ static int32_t SensorTripPointConfig(const scmi_caller_t *caller,
 /* Process the SENSOR_READING_GET message. Platform handler for             */
 /* SCMI_SensorReadingGet(). See section 4.7.2.12 in the SCMI spec.          */
 /*                                                                          */
+/* Async requests are only accepted for sensors advertising async support.  */
+/* They are queued per agent and executed by the RPC handler after the      */
+/* response is sent. A fresh sample is always taken. The reading is         */
+/* returned with the SENSOR_READING_COMPLETE delayed response on the        */
+/* agent's P2A channel.                                                     */
+/*                                                                          */
 /*  Access macros:                                                          */
 /* - SENSOR_READ_FLAGS_ASYNC() - Async flag                                 */
+/* - SENSOR_READ_FLAGS_FRESH() - Force fresh sample (vendor extension)      */
 /*                                                                          */
 /* Return errors:                                                           */
 /* - SM_ERR_SUCCESS: if the reading was successfully returned for a         */
@@ -957,34 +1191,47 @@ static int32_t SensorTripPointConfig(const scmi_caller_t *caller,
 /* - SM_ERR_NOT_FOUND: if sensorId does not point to an existing sensor.    */
 /* - SM_ERR_INVALID_PARAMETERS: if the flags input specifies illegal or     */
 /*   invalid settings.                                                      */
+/* - SM_ERR_BUSY: if there are too many asynchronous reads pending. The     */
+/*   PROTOCOL_ATTRIBUTES function provides the maximum number of pending    */
+/*   asynchronous reads supported by the platform.                          */
+/* - SM_ERR_NOT_SUPPORTED: if an async read is requested and the agent has  */
+/*   no notification channel to send the delayed response on.               */
 /* - SM_ERR_PROTOCOL_ERROR: if the function is used to read updates from    */
 /*   a disabled sensor.                                                     */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t SensorReadingGet(const scmi_caller_t *caller,
     const msg_rsensor6_t *in, msg_tsensor6_t *out, uint32_t *len)
 {
     int32_t status = SM_ERR_SUCCESS;
     bool async = SENSOR_READ_FLAGS_ASYNC(in->flags) != 0U;
+    bool fresh = SENSOR_READ_FLAGS_FRESH(in->flags) != 0U;
     int64_t sensorValue = 0;
     uint64_t sensorTimestamp = 0U;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check sensor */
     if ((status == SM_ERR_SUCCESS) && (in->sensorId >= SM_NUM_SENSOR))
     {
         status = SM_ERR_NOT_FOUND;
     }
 
-    /* Check for delayed response */
+    /* Check async supported */
     if ((status == SM_ERR_SUCCESS) && async)
     {
-        status = SM_ERR_INVALID_PARAMETERS;
+        dev_sm_sensor_desc_t lmmDesc;
+
+        status = LMM_SensorDescribe(caller->lmId, in->sensorId, &lmmDesc);
+
+        if ((status == SM_ERR_SUCCESS) && !lmmDesc.asyncSupport)
+        {
+            status = SM_ERR_INVALID_PARAMETERS;
+        }
+    }
+
+    /* Check delayed response can be sent */
+    if ((status == SM_ERR_SUCCESS) && async
+        && !RPC_SCMI_P2aTxQValid(caller->agentId, SCMI_NOTIFY_Q))
+    {
+        status = SM_ERR_NOT_SUPPORTED;
     }
 
     /* Check if enabled */
@@ -1002,14 +1249,45 @@ static int32_t SensorReadingGet(const scmi_caller_t *caller,
         }
     }
 
+    /* Queue async read, executed after the response is sent */
+    if ((status == SM_ERR_SUCCESS) && async)
+    {
+        sensor_async_queue_t *queue = &s_asyncQueue[caller->agentId];
+
+        /* Check queue space */
+        if (queue->count >= SENSOR_MAX_PENDING)
+        {
+            status = SM_ERR_BUSY;
+        }
+        else
+        {
+            sensor_async_t *req = &queue->req[(queue->tail
+                + queue->count) % SENSOR_MAX_PENDING];
+
+            req->header = caller->header;
+            req->lmId = caller->lmId;
+            req->sensorId = in->sensorId;
+            queue->count++;
+
+            /* Readings follow in the delayed response */
+            *len = sizeof(scmi_msg_status_t);
+        }
+    }
+
+    /* Bypass any cached value */
+    if ((status == SM_ERR_SUCCESS) && !async && fresh)
+    {
+        status = LMM_SensorSample(caller->lmId, in->sensorId);
+    }
+
     /* Get sensor reading */
-    if (status == SM_ERR_SUCCESS)
+    if ((status == SM_ERR_SUCCESS) && !async)
     {
         status = LMM_SensorReadingGet(caller->lmId, in->sensorId,
             &sensorValue, &sensorTimestamp);
     }
 
-    if (status == SM_ERR_SUCCESS)
+    if ((status == SM_ERR_SUCCESS) && !async)
     {
         /* Record result */
         out->readings[0].sensorValueHigh = SM_INT64_H(sensorValue);
@@ -1066,7 +1344,6 @@ static int32_t SensorReadingGet(const scmi_caller_t *caller,
 /* - SM_ERR_SUCCESS: if the sensor configuration was returned               */
 /*   successfully.                                                          */
 /* - SM_ERR_NOT_FOUND: if sensorId does not point to an existing sensor.    */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t SensorConfigGet(const scmi_caller_t *caller,
     const msg_rsensor9_t *in, msg_tsensor9_t *out)
@@ -1075,12 +1352,6 @@ static int32_t SensorConfigGet(const scmi_caller_t *caller,
     bool enabled;
     bool timestampReporting;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check sensor */
     if ((status == SM_ERR_SUCCESS) && (in->sensorId >= SM_NUM_SENSOR))
     {
@@ -1097,9 +1368,8 @@ static int32_t SensorConfigGet(const scmi_caller_t *caller,
     /* Return results */
     if (status == SM_ERR_SUCCESS)
     {
-        out->sensorConfig
-            = SENSOR_CONFIG_GET_UPDATE_INTV_SEC(0UL)
-            | SENSOR_CONFIG_GET_UPDATE_INTV_EXP(0UL);
+        out->sensorConfig = SensorUpdateIntvEncode(
+            SensorUpdateIntvGet(caller->agentId, in->sensorId));
 
         if (enabled)
         {
@@ -1172,7 +1442,6 @@ static int32_t SensorConfigGet(const scmi_caller_t *caller,
 /*   function is not supported by the sensor.                               */
 /* - SM_ERR_DENIED: if the calling agent is not permitted to configure      */
 /*   this sensor.                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t SensorConfigSet(const scmi_caller_t *caller,
     const msg_rsensor10_t *in, const scmi_msg_status_t *out)
@@ -1181,12 +1450,7 @@ static int32_t SensorConfigSet(const scmi_caller_t *caller,
     bool enable = SENSOR_CONFIG_SET_ENABLE(in->sensorConfig) != 0U;
     bool timestampReporting
         = SENSOR_CONFIG_SET_TS_ENABLE(in->sensorConfig) != 0U;
-
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
+    uint32_t msec = 0U;
 
     /* Check sensor */
     if ((status == SM_ERR_SUCCESS) && (in->sensorId >= SM_NUM_SENSOR))
@@ -1196,18 +1460,97 @@ static int32_t SensorConfigSet(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].sensorPerms[in->sensorId]
+        && (SM_SCMI_PERM(g_scmiSensorPerms, caller->agentId, in->sensorId)
         < SM_SCMI_PERM_SET))
     {
         status = SM_ERR_DENIED;
     }
 
+    /* Decode update interval */
+    if (status == SM_ERR_SUCCESS)
+    {
+        status = SensorUpdateIntvDecode(in->sensorConfig, &msec);
+    }
+
     if (status == SM_ERR_SUCCESS)
     {
         status = LMM_SensorEnable(caller->lmId, in->sensorId, enable,
             timestampReporting);
     }
 
+    /* Record update interval, restart pending updates */
+    if ((status == SM_ERR_SUCCESS) && (msec != 0U))
+    {
+        s_updateIntv[caller->agentId][in->sensorId] = msec;
+        if (s_updateDue[caller->agentId][in->sensorId] != 0ULL)
+        {
+            s_updateDue[caller->agentId][in->sensorId] = DEV_SM_Usec64Get()
+                + (((uint64_t) msec) * 1000ULL);
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Configure sensor continuous update notification                          */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - caller: Caller info                                                    */
+/* - in->sensorId: Identifier for the sensor                                */
+/* - in->notifyEnable: Notify enable:                                       */
+/*   Bits[31:1] Reserved.                                                   */
+/*   Bit[0] Set to 1 to send SENSOR_UPDATE notifications at the update      */
+/*   interval configured with SENSOR_CONFIG_SET. Set to 0 to stop them      */
+/*                                                                          */
+/* Process the SENSOR_CONTINUOUS_UPDATE_NOTIFY message. Platform handler    */
+/* for SCMI_SensorContinuousUpdateNotify(). Requires access greater than or */
+/* equal to NOTIFY. See section 4.7.2.13 in the SCMI spec.                  */
+/*                                                                          */
+/*  Access macros:                                                          */
+/* - SENSOR_UPDATE_NOTIFY_ENABLE() - Notify enable                          */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_SUCCESS: if the notification state was successfully updated.    */
+/* - SM_ERR_NOT_FOUND: if sensorId does not point to an existing sensor.    */
+/* - SM_ERR_DENIED: if the calling agent is not permitted to request        */
+/*   notifications for this sensor.                                         */
+/*--------------------------------------------------------------------------*/
+static int32_t SensorContinuousUpdateNotify(const scmi_caller_t *caller,
+    const msg_rsensor11_t *in, const scmi_msg_status_t *out)
+{
+    int32_t status = SM_ERR_SUCCESS;
+
+    /* Check sensor */
+    if ((status == SM_ERR_SUCCESS) && (in->sensorId >= SM_NUM_SENSOR))
+    {
+        status = SM_ERR_NOT_FOUND;
+    }
+
+    /* Check permissions */
+    if ((status == SM_ERR_SUCCESS)
+        && (SM_SCMI_PERM(g_scmiSensorPerms, caller->agentId, in->sensorId)
+        < SM_SCMI_PERM_NOTIFY))
+    {
+        status = SM_ERR_DENIED;
+    }
+
+    /* Schedule first update or stop updates */
+    if (status == SM_ERR_SUCCESS)
+    {
+        if (SENSOR_UPDATE_NOTIFY_ENABLE(in->notifyEnable) != 0U)
+        {
+            s_updateDue[caller->agentId][in->sensorId] = DEV_SM_Usec64Get()
+                + (((uint64_t) SensorUpdateIntvGet(caller->agentId,
+                in->sensorId)) * 1000ULL);
+        }
+        else
+        {
+            s_updateDue[caller->agentId][in->sensorId] = 0ULL;
+        }
+    }
+
     /* Return status */
     return status;
 }
@@ -1229,19 +1572,12 @@ static int32_t SensorConfigSet(const scmi_caller_t *caller,
 /*   successful return of this command must comply with the negotiated      */
 /*   version.                                                               */
 /* - SM_ERR_NOT_SUPPORTED: if the protocol version is not supported.        */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t SensorNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rsensor16_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check major version */
     if ((status == SM_ERR_SUCCESS) && (SCMI_VER_MAJOR(in->version)
         == SCMI_VER_MAJOR(PROTOCOL_VERSION)))
@@ -1294,9 +1630,9 @@ static int32_t SensorTripPointEvent(scmi_msg_id_t msgId,
             out.sensorId = sensorId;
             out.tripPointDesc = tripPointDesc;
 
-            /* Queue notification */
+            /* Queue notification (coalesced per sensor) */
             RPC_SCMI_P2aTxQ(dstAgent, msgId, (uint32_t*) &out,
-                sizeof(out), SCMI_NOTIFY_Q);
+                sizeof(out), SCMI_NOTIFY_Q, sensorId);
         }
     }
 
@@ -1320,7 +1656,225 @@ static int32_t SensorResetAgentConfig(uint32_t lmId, uint32_t agentId,
     /* Disable notifications */
     s_sensorNotify[agentId] = 0U;
 
+    /* Stop updates and restore default intervals */
+    for (uint32_t sensorId = 0U; sensorId < SM_NUM_SENSOR; sensorId++)
+    {
+        s_updateDue[agentId][sensorId] = 0ULL;
+        s_updateIntv[agentId][sensorId] = 0U;
+    }
+
+    /* Drop pending async reads */
+    s_asyncQueue[agentId].tail = 0U;
+    s_asyncQueue[agentId].count = 0U;
+
     /* Return status */
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Decode sensor update interval                                            */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - sensorConfig: Sensor config as passed to SENSOR_CONFIG_SET             */
+/* - msec: Pointer to return interval in mS, 0 if not to be updated         */
+/*                                                                          */
+/* Converts [sec] x 10^[exponent] seconds to mS, rounding as requested by   */
+/* the round bits. Intervals shorter than the sampling period are raised to */
+/* the sampling period.                                                     */
+/*                                                                          */
+/* Return errors:                                                           */
+/* - SM_ERR_INVALID_PARAMETERS: if the interval is too long.                */
+/*--------------------------------------------------------------------------*/
+static int32_t SensorUpdateIntvDecode(uint32_t sensorConfig,
+    uint32_t *msec)
+{
+    int32_t status = SM_ERR_SUCCESS;
+    uint64_t val = SENSOR_CONFIG_SET_UPDATE_INTV_SEC(sensorConfig);
+    uint32_t exp = SENSOR_CONFIG_SET_UPDATE_INTV_EXP(sensorConfig);
+    uint32_t round = SENSOR_CONFIG_SET_ROUND(sensorConfig);
+    int32_t pow10 = 3;
+
+    /* Sign extend exponent, add 3 for mS */
+    if (exp >= 16U)
+    {
+        pow10 += ((int32_t) exp) - 32;
+    }
+    else
+    {
+        pow10 += (int32_t) exp;
+    }
+
+    /* Scale up */
+    while ((val != 0ULL) && (pow10 > 0) && (status == SM_ERR_SUCCESS))
+    {
+        val *= 10ULL;
+        pow10--;
+        if (val > 0xFFFFFFFFULL)
+        {
+            status = SM_ERR_INVALID_PARAMETERS;
+        }
+    }
+
+    /* Scale down and round */
+    if ((val != 0ULL) && (pow10 < 0))
+    {
+        uint64_t div = 1ULL;
+        uint64_t rem;
+
+        while (pow10 < 0)
+        {
+            div *= 10ULL;
+            pow10++;
+        }
+        rem = val % div;
+        val /= div;
+
+        /* Bit[1] autonomous, else Bit[0] up */
+        if ((round & 0x2U) != 0U)
+        {
+            if ((rem * 2ULL) >= div)
+            {
+                val++;
+            }
+        }
+        else if (((round & 0x1U) != 0U) && (rem != 0ULL))
+        {
+            val++;
+        }
+        else
+        {
+            ; /* Intentional empty else */
+        }
+
+        /* Too short to round down to zero */
+        if (val == 0ULL)
+        {
+            val = SENSOR_UPDATE_MIN_MSEC;
+        }
+    }
+
+    /* Return interval */
+    if (status == SM_ERR_SUCCESS)
+    {
+        if ((val != 0ULL) && (val < SENSOR_UPDATE_MIN_MSEC))
+        {
+            val = SENSOR_UPDATE_MIN_MSEC;
+        }
+        *msec = (uint32_t) val;
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Encode sensor update interval                                            */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - msec: Interval in mS                                                   */
+/*                                                                          */
+/* Returns the interval as the update interval field of SENSOR_CONFIG_GET,  */
+/* in seconds if exact or too big for mS, else in mS.                       */
+/*--------------------------------------------------------------------------*/
+static uint32_t SensorUpdateIntvEncode(uint32_t msec)
+{
+    uint32_t sec;
+    uint32_t exp = 0U;
+
+    if (((msec % 1000U) != 0U) && (msec <= 0xFFFFU))
+    {
+        /* mS, exponent -3 */
+        sec = msec;
+        exp = 0x1DU;
+    }
+    else
+    {
+        /* Seconds */
+        sec = (msec + 500U) / 1000U;
+        if (sec > 0xFFFFU)
+        {
+            sec = 0xFFFFU;
+        }
+    }
+
+    /* Return field */
+    return SENSOR_CONFIG_GET_UPDATE_INTV_SEC(sec)
+        | SENSOR_CONFIG_GET_UPDATE_INTV_EXP(exp);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get sensor update interval                                               */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - agentId: Agent                                                         */
+/* - sensorId: Sensor                                                       */
+/*                                                                          */
+/* Returns the update interval in mS for the agent and sensor.              */
+/*--------------------------------------------------------------------------*/
+static uint32_t SensorUpdateIntvGet(uint32_t agentId, uint32_t sensorId)
+{
+    uint32_t msec = s_updateIntv[agentId][sensorId];
+
+    /* Use default if not configured */
+    if (msec == 0U)
+    {
+        msec = SENSOR_UPDATE_DEFAULT_MSEC;
+    }
+
+    /* Return interval */
+    return msec;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Check if sensor update is due                                            */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - agentId: Agent                                                         */
+/* - sensorId: Sensor                                                       */
+/* - now: Current time in uS                                                */
+/*                                                                          */
+/* Returns true if updates are enabled and the next one is due.             */
+/*--------------------------------------------------------------------------*/
+static bool SensorUpdateDue(uint32_t agentId, uint32_t sensorId,
+    uint64_t now)
+{
+    uint64_t due = s_updateDue[agentId][sensorId];
+
+    /* Return result */
+    return (due != 0ULL) && (due <= now);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get next agent with an async sensor read ready to execute                */
+/*                                                                          */
+/* Parameters:                                                              */
+/* - agentId: Pointer to return the agent                                   */
+/*                                                                          */
+/* Agents are served round-robin. A request is held back until the agent's  */
+/* P2A queue has space for the delayed response.                            */
+/*                                                                          */
+/* Returns true if a request is ready.                                      */
+/*--------------------------------------------------------------------------*/
+static bool SensorAsyncGet(uint32_t *agentId)
+{
+    bool rtn = false;
+
+    /* Loop over agents starting after the last one served */
+    for (uint32_t idx = 1U; idx <= SM_SCMI_NUM_AGNT; idx++)
+    {
+        uint32_t agent = (s_asyncLastAgent + idx) % SM_SCMI_NUM_AGNT;
+
+        if ((s_asyncQueue[agent].count != 0U)
+            && (!RPC_SCMI_P2aTxQFull(agent, sizeof(msg_dsensor6_t),
+            SCMI_NOTIFY_Q)))
+        {
+            *agentId = agent;
+            rtn = true;
+            break;
+        }
+    }
+
+    /* Return result */
+    return rtn;
+}
+
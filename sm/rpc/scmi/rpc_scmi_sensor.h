@@ -60,6 +60,8 @@
 /** @{ */
 /*! Read sensor event */
 #define RPC_SCMI_NOTIFY_SENSOR_TRIP_POINT_EVENT  0x0U
+/*! Read sensor update */
+#define RPC_SCMI_NOTIFY_SENSOR_UPDATE            0x1U
 /** @} */
 
 /* Functions */
@@ -124,6 +126,46 @@ int32_t RPC_SCMI_SensorDispatchNotification(scmi_msg_id_t msgId,
 int32_t RPC_SCMI_SensorDispatchReset(uint32_t lmId, uint32_t agentId,
     bool permissionsReset);
 
+/*!
+ * Check for due sensor update notifications.
+ *
+ * Called from the SM tick to decide if the SCMI RPC handler needs to run.
+ *
+ * @return Returns true if an agent is due a SENSOR_UPDATE notification.
+ */
+bool RPC_SCMI_SensorUpdatePending(void);
+
+/*!
+ * Sample sensors and send update notifications.
+ *
+ * This function reads each sensor with an update due for any agent once
+ * and queues a SENSOR_UPDATE notification to each of those agents. The
+ * next update is then scheduled one update interval later. Called from
+ * the SCMI RPC handler once no commands are pending so slow sensors (e.g.
+ * PMIC over I2C) are not read in the tick.
+ */
+void RPC_SCMI_SensorUpdateDispatch(void);
+
+/*!
+ * Check for pending async sensor reads.
+ *
+ * A read is only reported once there is space in the agent's P2A queue
+ * for the delayed response.
+ *
+ * @return Returns true if a read is ready to execute.
+ */
+bool RPC_SCMI_SensorAsyncPending(void);
+
+/*!
+ * Execute a pending async sensor read.
+ *
+ * This function takes a fresh sample for one async SENSOR_READING_GET
+ * request queued by an agent and queues the SENSOR_READING_COMPLETE
+ * delayed response. Agents are served round-robin. Called from the SCMI
+ * RPC handler once no commands are pending.
+ */
+void RPC_SCMI_SensorAsyncDispatch(void);
+
 /** @} */
 
 #endif /* RPC_SCMI_SENSOR_H */
@@ -47,14 +47,13 @@
 /* Protocol version */
 #define PROTOCOL_VERSION  0x20001U
 
-/* SCMI sys protocol message IDs and masks */
+/* SCMI sys protocol message IDs */
 #define COMMAND_PROTOCOL_VERSION             0x0U
 #define COMMAND_PROTOCOL_ATTRIBUTES          0x1U
 #define COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES  0x2U
 #define COMMAND_SYSTEM_POWER_STATE_SET       0x3U
 #define COMMAND_SYSTEM_POWER_STATE_NOTIFY    0x5U
 #define COMMAND_NEGOTIATE_PROTOCOL_VERSION   0x10U
-#define COMMAND_SUPPORTED_MASK               0x1002FUL
 
 /* SCMI system power states */
 #define SYS_STATE_SHUTDOWN       0x00000000U
@@ -172,6 +171,24 @@ typedef struct
     uint32_t timeout;
 } msg_rsys32_t;
 
+/* Local variables */
+
+/* Message descriptors, indexed by message ID */
+static const scmi_msg_desc_t s_sysMsgDesc[] =
+{
+    [COMMAND_PROTOCOL_VERSION] = SCMI_MSG_DESC(scmi_msg_header_t, msg_tsys0_t),
+    [COMMAND_PROTOCOL_ATTRIBUTES] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tsys1_t),
+    [COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES] =
+        SCMI_MSG_DESC(msg_rsys2_t, msg_tsys2_t),
+    [COMMAND_SYSTEM_POWER_STATE_SET] =
+        SCMI_MSG_DESC(msg_rsys3_t, scmi_msg_status_t),
+    [COMMAND_SYSTEM_POWER_STATE_NOTIFY] =
+        SCMI_MSG_DESC(msg_rsys5_t, scmi_msg_status_t),
+    [COMMAND_NEGOTIATE_PROTOCOL_VERSION] =
+        SCMI_MSG_DESC(msg_rsys16_t, scmi_msg_status_t)
+};
+
 /* Local functions */
 
 static int32_t SysProtocolVersion(const scmi_caller_t *caller,
@@ -201,47 +218,48 @@ static int32_t SysResetAgentConfig(uint32_t lmId, uint32_t agentId,
 int32_t RPC_SCMI_SysDispatchCommand(scmi_caller_t *caller,
     uint32_t messageId)
 {
-    int32_t status = SM_ERR_SUCCESS;
+    int32_t status;
     const scmi_msg_t *in = caller->msgCopy;
     scmi_msg_status_t *out = caller->msg;
-    uint32_t lenOut = sizeof(scmi_msg_status_t);
+    uint32_t lenOut;
+
+    /* Check message */
+    status = RPC_SCMI_A2pMsgCheck(caller, s_sysMsgDesc,
+        ARRAY_SIZE(s_sysMsgDesc), messageId, &lenOut);
 
     /* Handle standard messages */
-    switch(messageId)
+    if (status == SM_ERR_SUCCESS)
     {
-        case COMMAND_PROTOCOL_VERSION:
-            lenOut = sizeof(msg_tsys0_t);
-            status = SysProtocolVersion(caller, (const scmi_msg_header_t*) in,
-                (msg_tsys0_t*) out);
-            break;
-        case COMMAND_PROTOCOL_ATTRIBUTES:
-            lenOut = sizeof(msg_tsys1_t);
-            status = SysProtocolAttributes(caller,
-                (const scmi_msg_header_t*) in, (msg_tsys1_t*) out);
-            break;
-        case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
-            lenOut = sizeof(msg_tsys2_t);
-            status = SysProtocolMessageAttributes(caller,
-                (const msg_rsys2_t*) in, (msg_tsys2_t*) out);
-            break;
-        case COMMAND_SYSTEM_POWER_STATE_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = SystemPowerStateSet(caller, (const msg_rsys3_t*) in,
-                (const scmi_msg_status_t*) out, &lenOut);
-            break;
-        case COMMAND_SYSTEM_POWER_STATE_NOTIFY:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = SystemPowerStateNotify(caller, (const msg_rsys5_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = SysNegotiateProtocolVersion(caller,
-                (const msg_rsys16_t*) in, (const scmi_msg_status_t*) out);
-            break;
-        default:
-            status = SM_ERR_NOT_SUPPORTED;
-            break;
+        switch(messageId)
+        {
+            case COMMAND_PROTOCOL_VERSION:
+                status = SysProtocolVersion(caller,
+                    (const scmi_msg_header_t*) in, (msg_tsys0_t*) out);
+                break;
+            case COMMAND_PROTOCOL_ATTRIBUTES:
+                status = SysProtocolAttributes(caller,
+                    (const scmi_msg_header_t*) in, (msg_tsys1_t*) out);
+                break;
+            case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
+                status = SysProtocolMessageAttributes(caller,
+                    (const msg_rsys2_t*) in, (msg_tsys2_t*) out);
+                break;
+            case COMMAND_SYSTEM_POWER_STATE_SET:
+                status = SystemPowerStateSet(caller, (const msg_rsys3_t*) in,
+                    (const scmi_msg_status_t*) out, &lenOut);
+                break;
+            case COMMAND_SYSTEM_POWER_STATE_NOTIFY:
+                status = SystemPowerStateNotify(caller, (const msg_rsys5_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
+                status = SysNegotiateProtocolVersion(caller,
+                    (const msg_rsys16_t*) in, (const scmi_msg_status_t*) out);
+                break;
+            default:
+                status = SM_ERR_NOT_SUPPORTED;
+                break;
+        }
     }
 
     /* Update length */
@@ -320,25 +338,14 @@ static int32_t SystemPowerMode(uint32_t lmId, uint32_t agentId,
 /* SCMI_SysProtocolVersion(). See section 4.4.2.1 in the SCMI spec.         */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t SysProtocolVersion(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tsys0_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return version */
-        out->version = PROTOCOL_VERSION;
-    }
+    /* Return version */
+    out->version = PROTOCOL_VERSION;
 
     /* Return status */
     return status;
@@ -356,25 +363,14 @@ static int32_t SysProtocolVersion(const scmi_caller_t *caller,
 /* SCMI_SysProtocolAttributes(). See section 4.4.2.3 in the SCMI spec.      */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t SysProtocolAttributes(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tsys1_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* No attributes */
-        out->attributes = 0U;
-    }
+    /* No attributes */
+    out->attributes = 0U;
 
     /* Return status */
     return status;
@@ -415,33 +411,20 @@ static int32_t SysProtocolAttributes(const scmi_caller_t *caller,
 /* - SM_ERR_NOT_SUPPORTED: when message ID is set to the                    */
 /*   SYSTEM_POWER_STATE_NOTIFY function identifier and notifications are    */
 /*   not supported.                                                         */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t SysProtocolMessageAttributes(const scmi_caller_t *caller,
     const msg_rsys2_t *in, msg_tsys2_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
+    /* Initially zero */
+    out->attributes = 0U;
 
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
+    /* Is message supported ? */
+    if (!RPC_SCMI_A2pMsgSupported(s_sysMsgDesc,
+        ARRAY_SIZE(s_sysMsgDesc), in->messageId))
     {
-        uint32_t mask = COMMAND_SUPPORTED_MASK;
-
-        /* Initially zero */
-        out->attributes = 0U;
-
-        /* Is message supported ? */
-        if ((in->messageId >= 32U) || (((mask >> in->messageId)
-            & 0x1U) == 0U))
-        {
-            status = SM_ERR_NOT_FOUND;
-        }
+        status = SM_ERR_NOT_FOUND;
     }
 
     /* State transitions supported? */
@@ -513,7 +496,6 @@ static int32_t SysProtocolMessageAttributes(const scmi_caller_t *caller,
 /* - SM_ERR_DENIED: for system suspend requests when there are              */
 /*   application processors, other than the caller, in a running or idle    */
 /*   state.                                                                 */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t SystemPowerStateSet(const scmi_caller_t *caller,
     const msg_rsys3_t *in, const scmi_msg_status_t *out, uint32_t *len)
@@ -523,43 +505,34 @@ static int32_t SystemPowerStateSet(const scmi_caller_t *caller,
     bool mode = (in->systemState & SYS_STATE_MODE) == SYS_STATE_MODE;
     uint32_t agentId = caller->agentId;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check permissions */
-    if (status == SM_ERR_SUCCESS)
-    {
-        uint8_t reqPerm = SM_SCMI_PERM_SET;
-
-        /* Determine perms */
-        if (!graceful)
-        {
-            /* Check target power state */
-            if (in->systemState < SYS_STATE_FULL_SHUTDOWN)
-            {
-                reqPerm = SM_SCMI_PERM_PRIV;
-            }
-            else
-            {
-                reqPerm = SM_SCMI_PERM_EXCLUSIVE;
-            }
-        }
+    uint8_t reqPerm = SM_SCMI_PERM_SET;
 
-        /* Support mode */
-        if (mode)
+    /* Determine perms */
+    if (!graceful)
+    {
+        /* Check target power state */
+        if (in->systemState < SYS_STATE_FULL_SHUTDOWN)
         {
             reqPerm = SM_SCMI_PERM_PRIV;
         }
-
-        if (g_scmiAgentConfig[agentId].sysPerms < reqPerm)
+        else
         {
-            status = SM_ERR_DENIED;
+            reqPerm = SM_SCMI_PERM_EXCLUSIVE;
         }
     }
 
+    /* Support mode */
+    if (mode)
+    {
+        reqPerm = SM_SCMI_PERM_PRIV;
+    }
+
+    if (g_scmiAgentConfig[agentId].sysPerms < reqPerm)
+    {
+        status = SM_ERR_DENIED;
+    }
+
     if (status == SM_ERR_SUCCESS)
     {
         uint32_t lmId = caller->lmId;
@@ -614,19 +587,12 @@ static int32_t SystemPowerStateSet(const scmi_caller_t *caller,
 /*   available to the calling agent.                                        */
 /* - SM_ERR_INVALID_PARAMETERS: if notify_enable specifies invalid or       */
 /*   impermissible values.                                                  */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t SystemPowerStateNotify(const scmi_caller_t *caller,
     const msg_rsys5_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
         && (g_scmiAgentConfig[caller->agentId].sysPerms
@@ -663,19 +629,12 @@ static int32_t SystemPowerStateNotify(const scmi_caller_t *caller,
 /*   successful return of this command must comply with the negotiated      */
 /*   version.                                                               */
 /* - SM_ERR_NOT_SUPPORTED: if the protocol version is not supported.        */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t SysNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rsys16_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check major version */
     if ((status == SM_ERR_SUCCESS) && (SCMI_VER_MAJOR(in->version)
         == SCMI_VER_MAJOR(PROTOCOL_VERSION)))
@@ -724,7 +683,7 @@ static int32_t SystemPowerStateNotifier(scmi_msg_id_t msgId,
 
             /* Queue notification */
             RPC_SCMI_P2aTxQ(dstAgent, msgId, (uint32_t*) &out,
-                sizeof(out), SCMI_NOTIFY_Q);
+                sizeof(out), SCMI_NOTIFY_Q, SCMI_NOTIFY_KEY_NONE);
         }
     }
 
@@ -47,7 +47,7 @@
 /* Protocol version */
 #define PROTOCOL_VERSION  0x20001U
 
-/* SCMI voltage protocol message IDs and masks */
+/* SCMI voltage protocol message IDs */
 #define COMMAND_PROTOCOL_VERSION             0x0U
 #define COMMAND_PROTOCOL_ATTRIBUTES          0x1U
 #define COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES  0x2U
@@ -58,7 +58,6 @@
 #define COMMAND_VOLTAGE_LEVEL_SET            0x7U
 #define COMMAND_VOLTAGE_LEVEL_GET            0x8U
 #define COMMAND_NEGOTIATE_PROTOCOL_VERSION   0x10U
-#define COMMAND_SUPPORTED_MASK               0x101FFUL
 
 /* SCMI max voltage argument lengths */
 #define VOLTAGE_MAX_NAME     16U
@@ -254,6 +253,33 @@ typedef struct
     uint32_t version;
 } msg_rvoltage16_t;
 
+/* Local variables */
+
+/* Message descriptors, indexed by message ID */
+static const scmi_msg_desc_t s_voltageMsgDesc[] =
+{
+    [COMMAND_PROTOCOL_VERSION] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tvoltage0_t),
+    [COMMAND_PROTOCOL_ATTRIBUTES] =
+        SCMI_MSG_DESC(scmi_msg_header_t, msg_tvoltage1_t),
+    [COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES] =
+        SCMI_MSG_DESC(msg_rvoltage2_t, msg_tvoltage2_t),
+    [COMMAND_VOLTAGE_DOMAIN_ATTRIBUTES] =
+        SCMI_MSG_DESC(msg_rvoltage3_t, msg_tvoltage3_t),
+    [COMMAND_VOLTAGE_DESCRIBE_LEVELS] =
+        SCMI_MSG_DESC(msg_rvoltage4_t, msg_tvoltage4_t),
+    [COMMAND_VOLTAGE_CONFIG_SET] =
+        SCMI_MSG_DESC(msg_rvoltage5_t, scmi_msg_status_t),
+    [COMMAND_VOLTAGE_CONFIG_GET] =
+        SCMI_MSG_DESC(msg_rvoltage6_t, msg_tvoltage6_t),
+    [COMMAND_VOLTAGE_LEVEL_SET] =
+        SCMI_MSG_DESC(msg_rvoltage7_t, scmi_msg_status_t),
+    [COMMAND_VOLTAGE_LEVEL_GET] =
+        SCMI_MSG_DESC(msg_rvoltage8_t, msg_tvoltage8_t),
+    [COMMAND_NEGOTIATE_PROTOCOL_VERSION] =
+        SCMI_MSG_DESC(msg_rvoltage16_t, scmi_msg_status_t)
+};
+
 /* Local functions */
 
 static int32_t VoltageProtocolVersion(const scmi_caller_t *caller,
@@ -289,69 +315,66 @@ static int32_t VoltageResetAgentConfig(uint32_t lmId, uint32_t agentId,
 int32_t RPC_SCMI_VoltageDispatchCommand(scmi_caller_t *caller,
     uint32_t messageId)
 {
-    int32_t status = SM_ERR_SUCCESS;
+    int32_t status;
     const scmi_msg_t *in = caller->msgCopy;
     scmi_msg_status_t *out = caller->msg;
-    uint32_t lenOut = sizeof(scmi_msg_status_t);
+    uint32_t lenOut;
+
+    /* Check message */
+    status = RPC_SCMI_A2pMsgCheck(caller, s_voltageMsgDesc,
+        ARRAY_SIZE(s_voltageMsgDesc), messageId, &lenOut);
 
     /* Handle standard messages */
-    switch(messageId)
+    if (status == SM_ERR_SUCCESS)
     {
-        case COMMAND_PROTOCOL_VERSION:
-            lenOut = sizeof(msg_tvoltage0_t);
-            status = VoltageProtocolVersion(caller,
-                (const scmi_msg_header_t*) in, (msg_tvoltage0_t*) out);
-            break;
-        case COMMAND_PROTOCOL_ATTRIBUTES:
-            lenOut = sizeof(msg_tvoltage1_t);
-            status = VoltageProtocolAttributes(caller,
-                (const scmi_msg_header_t*) in, (msg_tvoltage1_t*) out);
-            break;
-        case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
-            lenOut = sizeof(msg_tvoltage2_t);
-            status = VoltageProtocolMessageAttributes(caller,
-                (const msg_rvoltage2_t*) in, (msg_tvoltage2_t*) out);
-            break;
-        case COMMAND_VOLTAGE_DOMAIN_ATTRIBUTES:
-            lenOut = sizeof(msg_tvoltage3_t);
-            status = VoltageDomainAttributes(caller,
-                (const msg_rvoltage3_t*) in, (msg_tvoltage3_t*) out);
-            break;
-        case COMMAND_VOLTAGE_DESCRIBE_LEVELS:
-            lenOut = sizeof(msg_tvoltage4_t);
-            status = VoltageDescribeLevels(caller,
-                (const msg_rvoltage4_t*) in, (msg_tvoltage4_t*) out,
-                &lenOut);
-            break;
-        case COMMAND_VOLTAGE_CONFIG_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = VoltageConfigSet(caller, (const msg_rvoltage5_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_VOLTAGE_CONFIG_GET:
-            lenOut = sizeof(msg_tvoltage6_t);
-            status = VoltageConfigGet(caller, (const msg_rvoltage6_t*) in,
-                (msg_tvoltage6_t*) out);
-            break;
-        case COMMAND_VOLTAGE_LEVEL_SET:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = VoltageLevelSet(caller, (const msg_rvoltage7_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        case COMMAND_VOLTAGE_LEVEL_GET:
-            lenOut = sizeof(msg_tvoltage8_t);
-            status = VoltageLevelGet(caller, (const msg_rvoltage8_t*) in,
-                (msg_tvoltage8_t*) out);
-            break;
-        case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
-            lenOut = sizeof(const scmi_msg_status_t);
-            status = VoltageNegotiateProtocolVersion(caller,
-                (const msg_rvoltage16_t*) in,
-                (const scmi_msg_status_t*) out);
-            break;
-        default:
-            status = SM_ERR_NOT_SUPPORTED;
-            break;
+        switch(messageId)
+        {
+            case COMMAND_PROTOCOL_VERSION:
+                status = VoltageProtocolVersion(caller,
+                    (const scmi_msg_header_t*) in, (msg_tvoltage0_t*) out);
+                break;
+            case COMMAND_PROTOCOL_ATTRIBUTES:
+                status = VoltageProtocolAttributes(caller,
+                    (const scmi_msg_header_t*) in, (msg_tvoltage1_t*) out);
+                break;
+            case COMMAND_PROTOCOL_MESSAGE_ATTRIBUTES:
+                status = VoltageProtocolMessageAttributes(caller,
+                    (const msg_rvoltage2_t*) in, (msg_tvoltage2_t*) out);
+                break;
+            case COMMAND_VOLTAGE_DOMAIN_ATTRIBUTES:
+                status = VoltageDomainAttributes(caller,
+                    (const msg_rvoltage3_t*) in, (msg_tvoltage3_t*) out);
+                break;
+            case COMMAND_VOLTAGE_DESCRIBE_LEVELS:
+                status = VoltageDescribeLevels(caller,
+                    (const msg_rvoltage4_t*) in, (msg_tvoltage4_t*) out,
+                    &lenOut);
+                break;
+            case COMMAND_VOLTAGE_CONFIG_SET:
+                status = VoltageConfigSet(caller, (const msg_rvoltage5_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_VOLTAGE_CONFIG_GET:
+                status = VoltageConfigGet(caller, (const msg_rvoltage6_t*) in,
+                    (msg_tvoltage6_t*) out);
+                break;
+            case COMMAND_VOLTAGE_LEVEL_SET:
+                status = VoltageLevelSet(caller, (const msg_rvoltage7_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            case COMMAND_VOLTAGE_LEVEL_GET:
+                status = VoltageLevelGet(caller, (const msg_rvoltage8_t*) in,
+                    (msg_tvoltage8_t*) out);
+                break;
+            case COMMAND_NEGOTIATE_PROTOCOL_VERSION:
+                status = VoltageNegotiateProtocolVersion(caller,
+                    (const msg_rvoltage16_t*) in,
+                    (const scmi_msg_status_t*) out);
+                break;
+            default:
+                status = SM_ERR_NOT_SUPPORTED;
+                break;
+        }
     }
 
     /* Update length */
@@ -381,7 +404,7 @@ int32_t RPC_SCMI_VoltageDispatchReset(uint32_t lmId, uint32_t agentId,
 
 /* Local variables */
 
-static uint8_t s_voltState[SM_NUM_VOLT][SM_SCMI_NUM_AGNT];
+static lmm_vote_level_t s_voltVote[SM_NUM_VOLT];
 
 /* Local functions */
 
@@ -400,25 +423,14 @@ static int32_t VoltageConfigUpdate(uint32_t lmId, uint32_t agentId,
 /* SCMI_VoltageProtocolVersion(). See section 4.9.2.1 in the SCMI spec.     */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t VoltageProtocolVersion(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tvoltage0_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return version */
-        out->version = PROTOCOL_VERSION;
-    }
+    /* Return version */
+    out->version = PROTOCOL_VERSION;
 
     /* Return status */
     return status;
@@ -440,25 +452,14 @@ static int32_t VoltageProtocolVersion(const scmi_caller_t *caller,
 /* - VOLTAGE_PROTO_ATTR_NUM_VOLTS() - Number of voltage domains             */
 /*                                                                          */
 /* Return errors:                                                           */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t VoltageProtocolAttributes(const scmi_caller_t *caller,
     const scmi_msg_header_t *in, msg_tvoltage1_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
-    {
-        /* Return number of voltage domains */
-        out->attributes = VOLTAGE_PROTO_ATTR_NUM_VOLTS(SM_NUM_VOLT);
-    }
+    /* Return number of voltage domains */
+    out->attributes = VOLTAGE_PROTO_ATTR_NUM_VOLTS(SM_NUM_VOLT);
 
     /* Return status */
     return status;
@@ -483,33 +484,20 @@ static int32_t VoltageProtocolAttributes(const scmi_caller_t *caller,
 /*   use.                                                                   */
 /* - SM_ERR_NOT_FOUND: if the message identified by messageId is invalid    */
 /*   or not provided by this platform implementation.                       */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t VoltageProtocolMessageAttributes(const scmi_caller_t *caller,
     const msg_rvoltage2_t *in, msg_tvoltage2_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
+    /* Always zero */
+    out->attributes = 0U;
 
-    /* Return data */
-    if (status == SM_ERR_SUCCESS)
+    /* Is message supported ? */
+    if (!RPC_SCMI_A2pMsgSupported(s_voltageMsgDesc,
+        ARRAY_SIZE(s_voltageMsgDesc), in->messageId))
     {
-        uint32_t mask = COMMAND_SUPPORTED_MASK;
-
-        /* Always zero */
-        out->attributes = 0U;
-
-        /* Is message supported ? */
-        if ((in->messageId >= 32U) || (((mask >> in->messageId)
-            & 0x1U) == 0U))
-        {
-            status = SM_ERR_NOT_FOUND;
-        }
+        status = SM_ERR_NOT_FOUND;
     }
 
     /* Return status */
@@ -549,7 +537,6 @@ static int32_t VoltageProtocolMessageAttributes(const scmi_caller_t *caller,
 /* Return errors:                                                           */
 /* - SM_ERR_SUCCESS: if valid power domain attributes are returned.         */
 /* - SM_ERR_NOT_FOUND: if domainId pertains to a non-existent domain.       */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t VoltageDomainAttributes(const scmi_caller_t *caller,
     const msg_rvoltage3_t *in, msg_tvoltage3_t *out)
@@ -557,12 +544,6 @@ static int32_t VoltageDomainAttributes(const scmi_caller_t *caller,
     int32_t status = SM_ERR_SUCCESS;
     const uint8_t *nameAddr = (const uint8_t*) "";
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check domain */
     if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_VOLT))
     {
@@ -640,7 +621,6 @@ static int32_t VoltageDomainAttributes(const scmi_caller_t *caller,
 /*   exist.                                                                 */
 /* - SM_ERR_OUT_OF_RANGE: if the levelIndex is outside of valid range.      */
 /* - SM_ERR_NOT_SUPPORTED: if the request is not supported.                 */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t VoltageDescribeLevels(const scmi_caller_t *caller,
     const msg_rvoltage4_t *in, msg_tvoltage4_t *out, uint32_t *len)
@@ -648,12 +628,6 @@ static int32_t VoltageDescribeLevels(const scmi_caller_t *caller,
     int32_t status = SM_ERR_SUCCESS;
     dev_sm_voltage_range_t range = {0, 0, 0};
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check domain */
     if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_VOLT))
     {
@@ -720,7 +694,6 @@ static int32_t VoltageDescribeLevels(const scmi_caller_t *caller,
 /* - SM_ERR_DENIED: if the calling agent is not allowed to set the          */
 /*   configuration of this voltage domain. An example would be if this      */
 /*   voltage domain is exclusive to another agent.                          */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t VoltageConfigSet(const scmi_caller_t *caller,
     const msg_rvoltage5_t *in, const scmi_msg_status_t *out)
@@ -729,12 +702,6 @@ static int32_t VoltageConfigSet(const scmi_caller_t *caller,
     uint32_t agentId = caller->agentId;
     uint8_t voltMode = (uint8_t) VOLTAGE_CONFIG_SET_MODE(in->config);
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check domain */
     if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_VOLT))
     {
@@ -743,7 +710,7 @@ static int32_t VoltageConfigSet(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].voltPerms[in->domainId]
+        && (SM_SCMI_PERM(g_scmiVoltPerms, caller->agentId, in->domainId)
         < SM_SCMI_PERM_SET))
     {
         status = SM_ERR_DENIED;
@@ -804,7 +771,6 @@ static int32_t VoltageConfigSet(const scmi_caller_t *caller,
 /* - SM_ERR_NOT_FOUND: if domainId does not point to a valid voltage        */
 /*   domain.                                                                */
 /* - SM_ERR_NOT_SUPPORTED: if the request is not supported.                 */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t VoltageConfigGet(const scmi_caller_t *caller,
     const msg_rvoltage6_t *in, msg_tvoltage6_t *out)
@@ -812,12 +778,6 @@ static int32_t VoltageConfigGet(const scmi_caller_t *caller,
     int32_t status = SM_ERR_SUCCESS;
     uint8_t voltMode;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check domain */
     if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_VOLT))
     {
@@ -887,19 +847,12 @@ static int32_t VoltageConfigGet(const scmi_caller_t *caller,
 /* - SM_ERR_DENIED: if the calling agent is not allowed to set the          */
 /*   voltage level of this voltage domain. An example would be if this      */
 /*   voltage domain is exclusive to another agent.                          */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t VoltageLevelSet(const scmi_caller_t *caller,
     const msg_rvoltage7_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check domain */
     if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_VOLT))
     {
@@ -908,7 +861,7 @@ static int32_t VoltageLevelSet(const scmi_caller_t *caller,
 
     /* Check permissions */
     if ((status == SM_ERR_SUCCESS)
-        && (g_scmiAgentConfig[caller->agentId].voltPerms[in->domainId]
+        && (SM_SCMI_PERM(g_scmiVoltPerms, caller->agentId, in->domainId)
         < SM_SCMI_PERM_EXCLUSIVE))
     {
         status = SM_ERR_DENIED;
@@ -950,19 +903,12 @@ static int32_t VoltageLevelSet(const scmi_caller_t *caller,
 /* - SM_ERR_NOT_FOUND: if domainId does not point to a valid voltage        */
 /*   domain.                                                                */
 /* - SM_ERR_NOT_SUPPORTED: if the request is not supported.                 */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t VoltageLevelGet(const scmi_caller_t *caller,
     const msg_rvoltage8_t *in, msg_tvoltage8_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check domain */
     if ((status == SM_ERR_SUCCESS) && (in->domainId >= SM_NUM_VOLT))
     {
@@ -997,19 +943,12 @@ static int32_t VoltageLevelGet(const scmi_caller_t *caller,
 /*   successful return of this command must comply with the negotiated      */
 /*   version.                                                               */
 /* - SM_ERR_NOT_SUPPORTED: if the protocol version is not supported.        */
-/* - SM_ERR_PROTOCOL_ERROR: if the incoming payload is too small.           */
 /*--------------------------------------------------------------------------*/
 static int32_t VoltageNegotiateProtocolVersion(const scmi_caller_t *caller,
     const msg_rvoltage16_t *in, const scmi_msg_status_t *out)
 {
     int32_t status = SM_ERR_SUCCESS;
 
-    /* Check request length */
-    if (caller->lenCopy < sizeof(*in))
-    {
-        status = SM_ERR_PROTOCOL_ERROR;
-    }
-
     /* Check major version */
     if ((status == SM_ERR_SUCCESS) && (SCMI_VER_MAJOR(in->version)
         == SCMI_VER_MAJOR(PROTOCOL_VERSION)))
@@ -1046,7 +985,8 @@ static int32_t VoltageResetAgentConfig(uint32_t lmId, uint32_t agentId,
     for (uint32_t domainId = 0U; domainId < SM_NUM_VOLT; domainId++)
     {
         /* Turn off power */
-        if (s_voltState[domainId][agentId] != VOLTAGE_DOMAIN_MODES_OFF)
+        if (LMM_VoteLevelGet(&s_voltVote[domainId], agentId)
+            != VOLTAGE_DOMAIN_MODES_OFF)
         {
             VoltageConfigUpdate(lmId, agentId, domainId,
                 VOLTAGE_DOMAIN_MODES_OFF);
@@ -1071,25 +1011,24 @@ static int32_t VoltageResetAgentConfig(uint32_t lmId, uint32_t agentId,
 static int32_t VoltageConfigUpdate(uint32_t lmId, uint32_t agentId,
     uint32_t domainId, uint8_t mode)
 {
+    int32_t status;
     uint32_t scmiInst = g_scmiAgentConfig[agentId].scmiInst;
     uint32_t firstAgent = g_scmiConfig[scmiInst].firstAgent;
     uint32_t numAgents = g_scmiConfig[scmiInst].numAgents;
-    uint8_t maxvoltMode = VOLTAGE_DOMAIN_MODES_OFF;
+    uint32_t mask = ((1UL << numAgents) - 1UL) << firstAgent;
+    uint32_t maxvoltMode = VOLTAGE_DOMAIN_MODES_OFF;
 
-    /* Record agent voltage mode for this domain */
-    s_voltState[domainId][agentId] = mode;
+    /* Record agent voltage mode and aggregate over the instance */
+    status = LMM_VoteLevelSet(&s_voltVote[domainId], mask, agentId, mode,
+        LMM_VOTE_MAX, &maxvoltMode, NULL);
 
-    /* Calculate new aggregate state for the domain */
-    for (uint32_t a = firstAgent; a < (firstAgent + numAgents); a++)
+    /* Inform LMM of voltage mode, LMM will check if changed */
+    if (status == SM_ERR_SUCCESS)
     {
-        /* Keep max state */
-        if (s_voltState[domainId][a] > maxvoltMode)
-        {
-            maxvoltMode = s_voltState[domainId][a];
-        }
+        status = LMM_VoltageModeSet(lmId, domainId, (uint8_t) maxvoltMode);
     }
 
-    /* Inform LMM of voltage mode, LMM will check if changed */
-    return LMM_VoltageModeSet(lmId, domainId, maxvoltMode);
+    /* Return status */
+    return status;
 }
 
@@ -81,6 +81,7 @@ static const rpc_smt_chn_config_t s_smtConfig[SM_NUM_SMT_CHN] =
 /* Local functions */
 
 static rpc_smt_buf_t *RPC_SMT_SmaGet(uint32_t smtChannel);
+static uint32_t RPC_SMT_SmaSizeGet(uint32_t smtChannel);
 static int32_t RPC_SMT_DoorbellRing(uint32_t smtChannel);
 
 /*--------------------------------------------------------------------------*/
@@ -125,7 +126,9 @@ int32_t RPC_SMT_Init(uint32_t smtChannel, bool noIrq, uint32_t initCount)
     if (status == SM_ERR_SUCCESS)
     {
         /* Clear buffer + ECC */
-        for (uint32_t word = 0U; word < (SMT_BUFFER_SIZE / 4U); word++)
+        uint32_t numWords = RPC_SMT_SmaSizeGet(smtChannel) / 4U;
+
+        for (uint32_t word = 0U; word < numWords; word++)
         {
             uint32_t *sma = (uint32_t*) buf;
             sma[word] = 0U;
@@ -159,6 +162,48 @@ void *RPC_SMT_HdrAddrGet(uint32_t smtChannel)
     return rtn;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get SMT payload address as seen by the agent                             */
+/*--------------------------------------------------------------------------*/
+uint64_t RPC_SMT_HdrAgentAddrGet(uint32_t smtChannel)
+{
+    uint64_t rtn = 0U;
+    const rpc_smt_buf_t *buf = RPC_SMT_SmaGet(smtChannel);
+
+    /* Get agent address of buffer */
+    if (buf != NULL)
+    {
+        switch (s_smtConfig[smtChannel].mbType)
+        {
+#ifdef USES_MB_LOOPBACK
+            case SM_MB_LOOPBACK:
+                rtn = MB_LOOPBACK_SmaAgentGet(
+                    s_smtConfig[smtChannel].mbInst,
+                    s_smtConfig[smtChannel].mbDoorbell);
+                break;
+#endif
+#ifdef USES_MB_MU
+            case SM_MB_MU:
+                rtn = MB_MU_SmaAgentGet(
+                    s_smtConfig[smtChannel].mbInst,
+                    s_smtConfig[smtChannel].mbDoorbell);
+                break;
+#endif
+            default:
+                ; /* Intentional empty default */
+                break;
+        }
+    }
+
+    /* Offset to header */
+    if (rtn != 0U)
+    {
+        rtn += (uint64_t) (((uintptr_t) &buf->header) - ((uintptr_t) buf));
+    }
+
+    return rtn;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Get SMT channel free status                                              */
 /*--------------------------------------------------------------------------*/
@@ -268,6 +313,14 @@ int32_t RPC_SMT_IsAborted(uint32_t smtChannel)
     return status;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get SMT max message length                                               */
+/*--------------------------------------------------------------------------*/
+uint32_t RPC_SMT_MaxLenGet(uint32_t smtChannel)
+{
+    return RPC_SMT_SmaSizeGet(smtChannel) - SMT_BUFFER_HEADER;
+}
+
 /*--------------------------------------------------------------------------*/
 /* SMT send                                                                 */
 /*--------------------------------------------------------------------------*/
@@ -278,7 +331,7 @@ int32_t RPC_SMT_Tx(uint32_t smtChannel, uint32_t len, bool callee,
     rpc_smt_buf_t *buf = RPC_SMT_SmaGet(smtChannel);
 
     /* Check length */
-    if (len > (SMT_BUFFER_SIZE - SMT_BUFFER_HEADER))
+    if (len > RPC_SMT_MaxLenGet(smtChannel))
     {
         status = SM_ERR_PROTOCOL_ERROR;
     }
@@ -380,30 +433,31 @@ int32_t RPC_SMT_Rx(uint32_t smtChannel, void* msgRx, uint32_t *len)
 
     /* Copy the minimum */
     size = (*len < buf->length) ? *len : buf->length;
+    size = MIN(size, RPC_SMT_MaxLenGet(smtChannel));
 
     /* Record the length */
     *len = size;
 
-    /* Copy payload */
-    memcpy(msgRx, (void*) &buf->header, size);
-
-    /* Check the CRC */
+    /* Copy payload and check the CRC */
     switch (impStatus)
     {
         case SM_SMT_CRC_XOR:
-            if (buf->impCrc != CRC_Xor((const uint32_t*) msgRx, *len / 4U))
+            if (buf->impCrc != CRC_XorCopy((uint32_t*) msgRx,
+                (const uint32_t*) &buf->header, size))
             {
                 status = SM_ERR_CRC_ERROR;
             }
             break;
         case SM_SMT_CRC_CRC32:
-            if (buf->impCrc != CRC_Crc32((const uint8_t*) msgRx, *len))
+            /* Copy then CRC the copy, faster than the fused loop */
+            memcpy(msgRx, (void*) &buf->header, size);
+            if (buf->impCrc != CRC_Crc32((const uint8_t*) msgRx, size))
             {
                 status = SM_ERR_CRC_ERROR;
             }
             break;
         default:
-            ; /* Intentional empty while */
+            memcpy(msgRx, (void*) &buf->header, size);
             break;
     }
 
@@ -444,6 +498,37 @@ static rpc_smt_buf_t *RPC_SMT_SmaGet(uint32_t smtChannel)
     return buf;
 }
 
+/*--------------------------------------------------------------------------*/
+/* Get SMT SMA size                                                         */
+/*--------------------------------------------------------------------------*/
+static uint32_t RPC_SMT_SmaSizeGet(uint32_t smtChannel)
+{
+    uint32_t size = SMT_BUFFER_SIZE;
+
+    switch (s_smtConfig[smtChannel].mbType)
+    {
+#ifdef USES_MB_LOOPBACK
+        case SM_MB_LOOPBACK:
+            size = MB_LOOPBACK_SmaSizeGet(
+                s_smtConfig[smtChannel].mbInst,
+                s_smtConfig[smtChannel].mbDoorbell);
+            break;
+#endif
+#ifdef USES_MB_MU
+        case SM_MB_MU:
+            size = MB_MU_SmaSizeGet(
+                s_smtConfig[smtChannel].mbInst,
+                s_smtConfig[smtChannel].mbDoorbell);
+            break;
+#endif
+        default:
+            ; /* Intentional empty default */
+            break;
+    }
+
+    return size;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Trigger MB doorbell                                                      */
 /*--------------------------------------------------------------------------*/
@@ -51,15 +51,22 @@
 /* Includes */
 
 #include "sm.h"
+#include "config_smt.h"
 
 /* Defines */
 
-/*! SMT buffer size */
+/*! SMT buffer size (default) */
 #define SMT_BUFFER_SIZE     128U
+/*! SMT buffer size (largest configured) */
+#ifdef SM_SMT_MAX_BUF_SIZE
+#define SMT_BUFFER_MAX      SM_SMT_MAX_BUF_SIZE
+#else
+#define SMT_BUFFER_MAX      SMT_BUFFER_SIZE
+#endif
 /*! SMT buffer header size */
 #define SMT_BUFFER_HEADER   24U
-/*! SMT buffer payload size */
-#define SMT_BUFFER_PAYLOAD  (SMT_BUFFER_SIZE - SMT_BUFFER_HEADER - 4U)
+/*! SMT buffer payload size (largest configured) */
+#define SMT_BUFFER_PAYLOAD  (SMT_BUFFER_MAX - SMT_BUFFER_HEADER - 4U)
 
 /* Functions */
 
@@ -93,6 +100,32 @@ int32_t RPC_SMT_Init(uint32_t smtChannel, bool noIrq, uint32_t initCount);
  */
 void *RPC_SMT_HdrAddrGet(uint32_t smtChannel);
 
+/*!
+ * Get SMT payload address as seen by the agent.
+ *
+ * @param[in]     smtChannel  SMT channel
+ *
+ * This function gets the address of the header/payload returned by
+ * RPC_SMT_HdrAddrGet() in the memory map of the agent. Use it for any
+ * address inside the buffer reported to the agent.
+ *
+ * @return Returns the agent buffer address, 0 if none.
+ */
+uint64_t RPC_SMT_HdrAgentAddrGet(uint32_t smtChannel);
+
+/*!
+ * Get SMT max message length.
+ *
+ * @param[in]     smtChannel  SMT channel
+ *
+ * This function returns the max length of a message (header and payload)
+ * that can be sent on the channel. This depends on the configured size of
+ * the shared memory buffer.
+ *
+ * @return Returns the max length in bytes.
+ */
+uint32_t RPC_SMT_MaxLenGet(uint32_t smtChannel);
+
 /*!
  * Get SMT channel status.
  *
@@ -169,7 +202,8 @@ int32_t RPC_SMT_IsAborted(uint32_t smtChannel);
  * @return Returns the status (::SM_ERR_SUCCESS = success).
  *
  * Return errors (see @ref STATUS "SM error codes"):
- * - ::SM_ERR_PROTOCOL_ERROR if the len is greater than the buffer size
+ * - ::SM_ERR_PROTOCOL_ERROR if the len is greater than the channel buffer
+ *   size
  * - others returned by RPC_SMT_DoorbellRing()
  */
 int32_t RPC_SMT_Tx(uint32_t smtChannel, uint32_t len, bool callee,
@@ -119,6 +119,13 @@ void TEST_DevSmClock(void)
             NECHECK(DEV_SM_ClockRateSet(clockId, 0U, 3U),
                 SM_ERR_INVALID_PARAMETERS);
 
+            /* Parent search is a flag on top of the round rule */
+            CHECK(DEV_SM_ClockRateSet(clockId, 80U,
+                DEV_SM_CLOCK_ROUND_PARENT | DEV_SM_CLOCK_ROUND_AUTO));
+            NECHECK(DEV_SM_ClockRateSet(clockId, 80U,
+                DEV_SM_CLOCK_ROUND_PARENT | 3U),
+                SM_ERR_INVALID_PARAMETERS);
+
             /* Make sure clockId is not clock 0*/
             if(clockId == DEV_SM_CLK_0)
             {
@@ -0,0 +1,211 @@
+/*
+** ###################################################################
+**
+** Copyright 2025 NXP
+**
+** Redistribution and use in source and binary forms, with or without modification,
+** are permitted provided that the following conditions are met:
+**
+** o Redistributions of source code must retain the above copyright notice, this list
+**   of conditions and the following disclaimer.
+**
+** o Redistributions in binary form must reproduce the above copyright notice, this
+**   list of conditions and the following disclaimer in the documentation and/or
+**   other materials provided with the distribution.
+**
+** o Neither the name of the copyright holder nor the names of its
+**   contributors may be used to endorse or promote products derived from this
+**   software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+** ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+** WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+** DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+** ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+** (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+** LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+** ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+** SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+**
+** ###################################################################
+*/
+
+/*==========================================================================*/
+/* Unit test for the LMM vote aggregation API.                              */
+/*==========================================================================*/
+
+/* Include Config */
+
+/* Includes */
+
+#include "test.h"
+#include "lmm.h"
+
+/* Local defines */
+
+/* Local types */
+
+/* Local variables */
+
+/* Local functions */
+
+/*--------------------------------------------------------------------------*/
+/* Test LMM vote                                                            */
+/*--------------------------------------------------------------------------*/
+void TEST_LmmVote(void)
+{
+    uint32_t value = 0U;
+    bool changed = false;
+
+    printf("**** LMM Vote API Tests ***\n\n");
+
+    /* Bitmap votes */
+    {
+        uint32_t voters = 0U;
+
+        printf("LMM_VoteBitSet(OR)\n");
+        CHECK(LMM_VoteBitSet(&voters, LMM_VOTE_ALL, 1U, true, LMM_VOTE_OR,
+            &value, &changed));
+        BCHECK((value == 1U) && changed);
+        CHECK(LMM_VoteBitSet(&voters, LMM_VOTE_ALL, 2U, true, LMM_VOTE_OR,
+            &value, &changed));
+        BCHECK((value == 1U) && !changed);
+        CHECK(LMM_VoteBitSet(&voters, LMM_VOTE_ALL, 1U, false, LMM_VOTE_OR,
+            &value, &changed));
+        BCHECK((value == 1U) && !changed);
+
+        /* Voter outside of mask */
+        CHECK(LMM_VoteBitSet(&voters, BIT32(1U), 1U, false, LMM_VOTE_OR,
+            &value, &changed));
+        BCHECK((value == 0U) && !changed);
+
+        printf("LMM_VoteBitSet(REF)\n");
+        CHECK(LMM_VoteBitSet(&voters, LMM_VOTE_ALL, 31U, true,
+            LMM_VOTE_REF, &value, &changed));
+        BCHECK((value == 2U) && changed);
+        CHECK(LMM_VoteBitSet(&voters, LMM_VOTE_ALL, 31U, true,
+            LMM_VOTE_REF, &value, &changed));
+        BCHECK((value == 2U) && !changed);
+        CHECK(LMM_VoteBitSet(&voters, LMM_VOTE_ALL, 2U, false,
+            LMM_VOTE_REF, NULL, NULL));
+        CHECK(LMM_VoteBitSet(&voters, LMM_VOTE_ALL, 31U, false,
+            LMM_VOTE_REF, &value, &changed));
+        BCHECK((value == 0U) && changed);
+        BCHECK(voters == 0U);
+    }
+
+    /* Level votes */
+    {
+        lmm_vote_level_t vote = { 0 };
+
+        printf("LMM_VoteLevelSet(MAX)\n");
+        CHECK(LMM_VoteLevelSet(&vote, LMM_VOTE_ALL, 0U, 2U, LMM_VOTE_MAX,
+            &value, &changed));
+        BCHECK((value == 2U) && changed);
+        CHECK(LMM_VoteLevelSet(&vote, LMM_VOTE_ALL, 5U, 3U, LMM_VOTE_MAX,
+            &value, &changed));
+        BCHECK((value == 3U) && changed);
+        CHECK(LMM_VoteLevelSet(&vote, LMM_VOTE_ALL, 7U, 1U, LMM_VOTE_MAX,
+            &value, &changed));
+        BCHECK((value == 3U) && !changed);
+
+        printf("LMM_VoteLevelGet()\n");
+        BCHECK(LMM_VoteLevelGet(&vote, 0U) == 2U);
+        BCHECK(LMM_VoteLevelGet(&vote, 5U) == 3U);
+        BCHECK(LMM_VoteLevelGet(&vote, 6U) == 0U);
+        BCHECK(LMM_VoteLevelGet(&vote, LMM_VOTE_MAX_VOTER) == 0U);
+
+        printf("LMM_VoteLevelSet(MIN)\n");
+        CHECK(LMM_VoteLevelSet(&vote, LMM_VOTE_ALL, 6U, 0U, LMM_VOTE_MIN,
+            &value, &changed));
+        BCHECK((value == 1U) && !changed);
+        CHECK(LMM_VoteLevelSet(&vote, LMM_VOTE_ALL, 7U, 0U, LMM_VOTE_MIN,
+            &value, &changed));
+        BCHECK((value == 2U) && changed);
+
+        /* Aggregate limited to masked voters */
+        CHECK(LMM_VoteLevelSet(&vote, BIT32(0U), 0U, 2U, LMM_VOTE_MAX,
+            &value, &changed));
+        BCHECK((value == 2U) && !changed);
+        CHECK(LMM_VoteLevelSet(&vote, BIT32(0U), 0U, 0U, LMM_VOTE_MAX,
+            &value, &changed));
+        BCHECK((value == 0U) && changed);
+
+        /* Invalid parameters */
+        NECHECK(LMM_VoteLevelSet(&vote, LMM_VOTE_ALL, 0U,
+            BIT32(LMM_VOTE_NUM_PLANE), LMM_VOTE_MAX, NULL, NULL),
+            SM_ERR_INVALID_PARAMETERS);
+        NECHECK(LMM_VoteLevelSet(&vote, LMM_VOTE_ALL, LMM_VOTE_MAX_VOTER,
+            1U, LMM_VOTE_MAX, NULL, NULL), SM_ERR_INVALID_PARAMETERS);
+        NECHECK(LMM_VoteLevelSet(&vote, LMM_VOTE_ALL, 0U, 1U, LMM_VOTE_OR,
+            NULL, NULL), SM_ERR_INVALID_PARAMETERS);
+    }
+
+    /* Invalid bitmap parameters */
+    {
+        uint32_t voters = 0U;
+
+        NECHECK(LMM_VoteBitSet(&voters, LMM_VOTE_ALL, LMM_VOTE_MAX_VOTER,
+            true, LMM_VOTE_OR, NULL, NULL), SM_ERR_INVALID_PARAMETERS);
+        NECHECK(LMM_VoteBitSet(&voters, LMM_VOTE_ALL, 0U, true,
+            LMM_VOTE_MAX, NULL, NULL), SM_ERR_INVALID_PARAMETERS);
+    }
+
+    /* Write suppression */
+    {
+        uint32_t sync[LMM_VOTE_WORDS(40U)] = { 0 };
+        lmm_vote_stats_t stats;
+
+        printf("LMM_VoteWriteNeeded()\n");
+        CHECK(LMM_VoteStatsGet(LMM_VOTE_TYPE_VOLT, &stats, true));
+
+        /* Not in sync, write even if unchanged */
+        BCHECK(LMM_VoteWriteNeeded(LMM_VOTE_TYPE_VOLT, sync, 33U, false));
+        LMM_VoteWriteDone(sync, 33U, SM_ERR_SUCCESS);
+        BCHECK(!LMM_VoteWriteNeeded(LMM_VOTE_TYPE_VOLT, sync, 33U, false));
+        BCHECK(LMM_VoteWriteNeeded(LMM_VOTE_TYPE_VOLT, sync, 33U, true));
+
+        /* Failed write */
+        LMM_VoteWriteDone(sync, 33U, SM_ERR_POWER);
+        BCHECK(LMM_VoteWriteNeeded(LMM_VOTE_TYPE_VOLT, sync, 33U, false));
+
+        /* Changed outside of votes */
+        LMM_VoteWriteDone(sync, 33U, SM_ERR_SUCCESS);
+        LMM_VoteSyncClear(sync, 33U);
+        BCHECK(LMM_VoteWriteNeeded(LMM_VOTE_TYPE_VOLT, sync, 33U, false));
+
+        printf("LMM_VoteStatsGet()\n");
+        CHECK(LMM_VoteStatsGet(LMM_VOTE_TYPE_VOLT, &stats, true));
+        printf("  updates=%u, writes=%u, suppressed=%u\n", stats.updates,
+            stats.writes, stats.suppressed);
+        BCHECK(stats.updates == 5U);
+        BCHECK(stats.writes == 4U);
+        BCHECK(stats.suppressed == 1U);
+        CHECK(LMM_VoteStatsGet(LMM_VOTE_TYPE_VOLT, &stats, false));
+        BCHECK(stats.updates == 0U);
+
+        NECHECK(LMM_VoteStatsGet(LMM_VOTE_NUM_TYPE, &stats, false),
+            SM_ERR_NOT_FOUND);
+    }
+
+    /* Repeated clock vote is not written to the device */
+    {
+        uint32_t lmId = 1U;
+        uint32_t clockId = 0U;
+        lmm_vote_stats_t stats;
+
+        printf("LMM_ClockEnable(%u, %u, true)\n", lmId, clockId);
+        CHECK(LMM_ClockEnable(lmId, clockId, true));
+        CHECK(LMM_VoteStatsGet(LMM_VOTE_TYPE_CLOCK, &stats, true));
+        CHECK(LMM_ClockEnable(lmId, clockId, true));
+        CHECK(LMM_VoteStatsGet(LMM_VOTE_TYPE_CLOCK, &stats, false));
+        BCHECK(stats.updates == 1U);
+        BCHECK(stats.suppressed == 1U);
+        CHECK(LMM_ClockEnable(lmId, clockId, false));
+    }
+
+    printf("\n");
+}
+
@@ -42,9 +42,12 @@
 
 #include "test_scmi.h"
 #include "scmi_internal.h"
+#include "rpc_scmi.h"
 
 /* Local defines */
 
+#define SCMI_LAT_LOOPS  1000U
+
 /* Local types */
 
 /* Local variables */
@@ -146,6 +149,62 @@ void TEST_Scmi(void)
             SCMI_ERR_INVALID_PARAMETERS);
     }
 
+    /* Doorbell to dispatch latency */
+    {
+        uint32_t ver = 0U;
+        uint64_t start;
+        uint32_t usec;
+
+        printf("**** SCMI Test Dispatch Latency ***\n\n");
+
+        start = DEV_SM_Usec64Get();
+        for (uint32_t i = 0U; i < SCMI_LAT_LOOPS; i++)
+        {
+            CHECK(SCMI_BaseProtocolVersion(SM_TEST_DEFAULT_CHN, &ver));
+        }
+        usec = (uint32_t) (DEV_SM_Usec64Get() - start);
+
+        printf("Round trip (%u loops, usec): total=%u, nsec/msg=%u\n",
+            SCMI_LAT_LOOPS, usec, (usec * 1000U) / SCMI_LAT_LOOPS);
+    }
+
+    /* Message trace */
+    {
+        scmi_trace_t entry = { 0 };
+
+        printf("**** SCMI Test Trace ***\n\n");
+
+#ifdef SCMI_TRACE
+        /* Most recent is the last loop above */
+        CHECK(RPC_SCMI_TraceGet(0U, &entry));
+        BCHECK(entry.type == SCMI_TRACE_A2P);
+        BCHECK(entry.channel == SM_TEST_DEFAULT_CHN);
+        BCHECK((entry.header & 0x3FFFFU) == (SCMI_MSG_PROTOCOL_VERSION
+            | (SCMI_PROTOCOL_BASE << 10U)));
+        BCHECK(entry.status == SM_ERR_SUCCESS);
+
+        /* Ring is full */
+        CHECK(RPC_SCMI_TraceGet(SM_SCMI_TRACE_NUM - 1U, &entry));
+        NECHECK(RPC_SCMI_TraceGet(SM_SCMI_TRACE_NUM, &entry),
+            SM_ERR_NOT_FOUND);
+
+        /* Clear */
+        CHECK(RPC_SCMI_TraceClear());
+        NECHECK(RPC_SCMI_TraceGet(0U, &entry), SM_ERR_NOT_FOUND);
+
+#ifdef MONITOR
+        uint32_t ver = 0U;
+
+        /* Filtered dump */
+        CHECK(SCMI_BaseProtocolVersion(SM_TEST_DEFAULT_CHN, &ver));
+        CHECK(RPC_SCMI_TraceDump(SM_TEST_DEFAULT_CHN, SCMI_PROTOCOL_BASE));
+#endif
+#else
+        NECHECK(RPC_SCMI_TraceGet(0U, &entry), SM_ERR_NOT_SUPPORTED);
+        NECHECK(RPC_SCMI_TraceClear(), SM_ERR_NOT_SUPPORTED);
+#endif
+    }
+
     printf("\n");
 }
 
@@ -195,7 +195,7 @@ void TEST_ScmiBase(void)
         &channel, &resource, &lmId);
     while (status == SM_ERR_SUCCESS)
     {
-        uint8_t perm = g_scmiAgentConfig[agentId].basePerms[resource];
+        uint8_t perm = SM_SCMI_PERM(g_scmiBasePerms, agentId, resource);
 
         /* Test functions with no perm required */
         TEST_ScmiBaseNone(channel);
@@ -54,6 +54,7 @@
 static void TEST_ScmiButtonNone(uint32_t channel, uint32_t resource);
 static void TEST_ScmiButtonNotify(bool pass, uint32_t channel,
     uint32_t resource);
+static void TEST_ScmiButtonCoalesce(uint32_t channel, uint32_t agentId);
 
 /*--------------------------------------------------------------------------*/
 /* Test SCMI BBM button protocol                                            */
@@ -120,7 +121,7 @@ void TEST_ScmiBbmButton(void)
         &channel, &resource, &lmId);
     while (status == SM_ERR_SUCCESS)
     {
-        uint8_t perm = g_scmiAgentConfig[agentId].buttonPerms[resource];
+        uint8_t perm = SM_SCMI_PERM(g_scmiButtonPerms, agentId, resource);
 
         /* Test functions with no perm required */
         TEST_ScmiButtonNone(channel, resource);
@@ -128,6 +129,12 @@ void TEST_ScmiBbmButton(void)
         /* Test functions with NOTIFY perm required */
         TEST_ScmiButtonNotify(perm >= SM_SCMI_PERM_SET, channel, resource);
 
+        /* Test notification coalescing */
+        if (perm >= SM_SCMI_PERM_NOTIFY)
+        {
+            TEST_ScmiButtonCoalesce(channel, agentId);
+        }
+
         /* Get next test case */
         status = TEST_ConfigNextGet(TEST_BUTTON, &agentId,
             &channel, &resource, &lmId);
@@ -221,3 +228,63 @@ static void TEST_ScmiButtonNotify(bool pass, uint32_t channel,
 #endif
 }
 
+/*--------------------------------------------------------------------------*/
+/* Test coalescing of queued button notifications                           */
+/*--------------------------------------------------------------------------*/
+static void TEST_ScmiButtonCoalesce(uint32_t channel, uint32_t agentId)
+{
+#ifdef SIMU
+    scmi_msg_id_t msgId =
+    {
+        .protocolId = SCMI_PROTOCOL_BBM,
+        .messageId = RPC_SCMI_NOTIFY_BBM_BUTTON_EVENT
+    };
+    lmm_rpc_trigger_t trigger = { 0 };
+    uint32_t depth = 0U;
+    uint32_t queued = 0U;
+    uint32_t coalesced = 0U;
+    uint32_t dropped = 0U;
+    uint32_t flags = 0U;
+    uint32_t protocolId, messageId;
+
+    trigger.rpcInst = g_scmiAgentConfig[agentId].scmiInst;
+
+    /* Reset counters */
+    printf("SCMI_MiscNotifyCounters(%u)\n", channel);
+    CHECK(SCMI_MiscNotifyCounters(channel, SCMI_MISC_NOTIFY_FLAG_RESET(1U),
+        &depth, NULL, NULL, NULL));
+    printf("  depth=%u\n", depth);
+    BCHECK(depth >= 2U);
+
+    /* Burst of events, first sent, remaining merged into one */
+    CHECK(SCMI_BbmButtonNotify(channel, SCMI_BBM_NOTIFY_BUTTON_DETECT(1U)));
+    for (uint32_t idx = 0U; idx < 4U; idx++)
+    {
+        CHECK(RPC_SCMI_BbmDispatchNotification(msgId, &trigger));
+    }
+
+    /* Check counters */
+    CHECK(SCMI_MiscNotifyCounters(channel, 0U, NULL, &queued, &coalesced,
+        &dropped));
+    printf("  queued=%u, coalesced=%u, dropped=%u\n", queued, coalesced,
+        dropped);
+    BCHECK((queued == 2U) && (coalesced == 2U) && (dropped == 0U));
+
+    /* Receive both notifications */
+    CHECK(SCMI_BbmButtonEvent(channel + 1U, &flags));
+    BCHECK(flags == SCMI_BBM_EVENT_BUTTON_DETECTED(1U));
+    CHECK(SCMI_BbmButtonEvent(channel + 1U, &flags));
+    BCHECK(flags == SCMI_BBM_EVENT_BUTTON_DETECTED(1U));
+    NECHECK(SCMI_P2aPending(channel + 1U, &protocolId, &messageId),
+        SCMI_ERR_PROTOCOL_ERROR);
+
+    /* Disable and reset counters */
+    CHECK(SCMI_BbmButtonNotify(channel, 0U));
+    CHECK(SCMI_MiscNotifyCounters(channel, SCMI_MISC_NOTIFY_FLAG_RESET(1U),
+        NULL, NULL, NULL, NULL));
+    CHECK(SCMI_MiscNotifyCounters(channel, 0U, NULL, &queued, &coalesced,
+        &dropped));
+    BCHECK((queued == 0U) && (coalesced == 0U) && (dropped == 0U));
+#endif
+}
+
@@ -102,7 +102,7 @@ void TEST_ScmiBbmGpr(void)
         &channel, &resource, &lmId);
     while (status == SCMI_ERR_SUCCESS)
     {
-        uint8_t perm = g_scmiAgentConfig[agentId].gprPerms[resource];
+        uint8_t perm = SM_SCMI_PERM(g_scmiGprPerms, agentId, resource);
 
         /* Test functions with GET perm required */
         TEST_ScmiGprGet(perm >= SM_SCMI_PERM_GET, channel, resource);
@@ -168,7 +168,7 @@ void TEST_ScmiBbmRtc(void)
         &channel, &resource, &lmId);
     while (status == SM_ERR_SUCCESS)
     {
-        uint8_t perm = g_scmiAgentConfig[agentId].rtcPerms[resource];
+        uint8_t perm = SM_SCMI_PERM(g_scmiRtcPerms, agentId, resource);
 
         /* Test functions with no perm required */
         TEST_ScmiRtcNone(channel, resource);
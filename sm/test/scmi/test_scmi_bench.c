@@ -0,0 +1,452 @@
+/*
+** ###################################################################
+**
+** Copyright 2025 NXP
+**
+** Redistribution and use in source and binary forms, with or without modification,
+** are permitted provided that the following conditions are met:
+**
+** o Redistributions of source code must retain the above copyright notice, this list
+**   of conditions and the following disclaimer.
+**
+** o Redistributions in binary form must reproduce the above copyright notice, this
+**   list of conditions and the following disclaimer in the documentation and/or
+**   other materials provided with the distribution.
+**
+** o Neither the name of the copyright holder nor the names of its
+**   contributors may be used to endorse or promote products derived from this
+**   software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+** ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+** WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+** DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+** ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+** (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+** LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+** ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+** SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+**
+** ###################################################################
+*/
+
+/*==========================================================================*/
+/* SCMI load generator and latency benchmark.                               */
+/*                                                                          */
+/* Build with t=scmi_bench (simu config). Each test config entry of the     */
+/* protocols below acts as a synthetic agent, driven round-robin over the   */
+/* loopback channels. Entries without access are dropped during warm-up.    */
+/* The per-iteration mix and loop count can be changed by defining          */
+/* SCMI_BENCH_MIX and SCMI_BENCH_LOOPS. After the mix, each agent is reset  */
+/* to time reverting what the mix changed. Results are printed as CSV lines */
+/* prefixed with "BENCH,".                                                  */
+/*==========================================================================*/
+
+/* Include Config */
+
+/* Includes */
+
+#include "test_scmi.h"
+#include "rpc_scmi_base.h"
+#include "rpc_scmi_bbm.h"
+
+/* Local defines */
+
+/* Number of benchmark iterations */
+#ifndef SCMI_BENCH_LOOPS
+#define SCMI_BENCH_LOOPS  1000U
+#endif
+
+/* Operations per iteration, in s_benchOps[] order */
+#ifndef SCMI_BENCH_MIX
+#define SCMI_BENCH_MIX  4U, 1U, 2U, 2U, 1U, 1U
+#endif
+
+/* Max operations of one type per iteration */
+#define SCMI_BENCH_MAX_WEIGHT  4U
+
+/* Number of benchmark operations */
+#define SCMI_BENCH_NUM_OP  6U
+
+/* Max samples per operation */
+#define SCMI_BENCH_MAX_SAMPLES  (SCMI_BENCH_LOOPS * SCMI_BENCH_MAX_WEIGHT)
+
+/* Local types */
+
+typedef int32_t (*bench_func_t)(uint32_t channel, uint32_t rsrc,
+    uint32_t agentId, uint64_t *start);
+
+typedef struct
+{
+    string name;
+    uint8_t testId;
+    bench_func_t func;
+} bench_op_t;
+
+typedef struct
+{
+    uint32_t agentId;
+    uint32_t channel;
+    uint32_t rsrc;
+} bench_agent_t;
+
+/* Local functions */
+
+static int32_t TEST_ScmiBenchClockGet(uint32_t channel, uint32_t rsrc,
+    uint32_t agentId, uint64_t *start);
+static int32_t TEST_ScmiBenchClockSet(uint32_t channel, uint32_t rsrc,
+    uint32_t agentId, uint64_t *start);
+static int32_t TEST_ScmiBenchPerfSet(uint32_t channel, uint32_t rsrc,
+    uint32_t agentId, uint64_t *start);
+static int32_t TEST_ScmiBenchSensor(uint32_t channel, uint32_t rsrc,
+    uint32_t agentId, uint64_t *start);
+static int32_t TEST_ScmiBenchPinctrl(uint32_t channel, uint32_t rsrc,
+    uint32_t agentId, uint64_t *start);
+static int32_t TEST_ScmiBenchNotify(uint32_t channel, uint32_t rsrc,
+    uint32_t agentId, uint64_t *start);
+static void TEST_ScmiBenchSetup(bool enable);
+static void TEST_ScmiBenchReport(string name, uint32_t agents,
+    uint32_t *samples, uint32_t count, uint32_t errors);
+static int TEST_ScmiBenchCompare(const void *a, const void *b);
+
+/* Local variables */
+
+static const bench_op_t s_benchOps[SCMI_BENCH_NUM_OP] =
+{
+    {"clock.rate_get", TEST_CLK, TEST_ScmiBenchClockGet},
+    {"clock.rate_set", TEST_CLK, TEST_ScmiBenchClockSet},
+    {"perf.level_set", TEST_PERF, TEST_ScmiBenchPerfSet},
+    {"sensor.reading_get", TEST_SENSOR, TEST_ScmiBenchSensor},
+    {"pinctrl.config_get", TEST_PIN, TEST_ScmiBenchPinctrl},
+    {"bbm.button_notify", TEST_BUTTON, TEST_ScmiBenchNotify}
+};
+
+static const uint32_t s_benchMix[SCMI_BENCH_NUM_OP] =
+{
+    SCMI_BENCH_MIX
+};
+
+static bench_agent_t s_benchAgents[SCMI_BENCH_NUM_OP][SM_SCMI_NUM_TEST];
+static uint32_t s_benchNumAgents[SCMI_BENCH_NUM_OP];
+static uint32_t s_benchSamples[SCMI_BENCH_NUM_OP][SCMI_BENCH_MAX_SAMPLES];
+static uint32_t s_benchCount[SCMI_BENCH_NUM_OP];
+static uint32_t s_benchReset[SM_SCMI_NUM_AGNT];
+
+/*--------------------------------------------------------------------------*/
+/* Benchmark SCMI                                                           */
+/*--------------------------------------------------------------------------*/
+void TEST_ScmiBench(void)
+{
+    uint32_t errors[SCMI_BENCH_NUM_OP] = { 0 };
+    uint32_t next[SCMI_BENCH_NUM_OP] = { 0 };
+    uint32_t resetErrors = 0U;
+    uint32_t total = 0U;
+    uint64_t wall;
+
+    printf("**** SCMI Benchmark ***\n\n");
+
+    /* Collect the agents for each operation */
+    for (uint32_t op = 0U; op < SCMI_BENCH_NUM_OP; op++)
+    {
+        int32_t status;
+        uint32_t lmId;
+        bench_agent_t *agent = &s_benchAgents[op][0];
+
+        BCHECK(s_benchMix[op] <= SCMI_BENCH_MAX_WEIGHT);
+
+        status = TEST_ConfigFirstGet(s_benchOps[op].testId, &agent->agentId,
+            &agent->channel, &agent->rsrc, &lmId);
+        while (status == SM_ERR_SUCCESS)
+        {
+            s_benchNumAgents[op]++;
+            agent = &s_benchAgents[op][s_benchNumAgents[op]];
+
+            status = TEST_ConfigNextGet(s_benchOps[op].testId,
+                &agent->agentId, &agent->channel, &agent->rsrc, &lmId);
+        }
+    }
+
+    /* Enable sensors and notifications */
+    TEST_ScmiBenchSetup(true);
+
+    /* Warm up, drop agents without access */
+    for (uint32_t op = 0U; op < SCMI_BENCH_NUM_OP; op++)
+    {
+        uint32_t num = 0U;
+
+        for (uint32_t idx = 0U; idx < s_benchNumAgents[op]; idx++)
+        {
+            const bench_agent_t *agent = &s_benchAgents[op][idx];
+            uint64_t start;
+
+            if (s_benchOps[op].func(agent->channel, agent->rsrc,
+                agent->agentId, &start) == SM_ERR_SUCCESS)
+            {
+                s_benchAgents[op][num] = *agent;
+                num++;
+            }
+        }
+        s_benchNumAgents[op] = num;
+    }
+
+    /* Run mix */
+    wall = DEV_SM_Nsec64Get();
+    for (uint32_t loop = 0U; loop < SCMI_BENCH_LOOPS; loop++)
+    {
+        for (uint32_t op = 0U; op < SCMI_BENCH_NUM_OP; op++)
+        {
+            uint32_t reps = (s_benchNumAgents[op] != 0U) ? s_benchMix[op]
+                : 0U;
+
+            for (uint32_t rep = 0U; rep < reps; rep++)
+            {
+                const bench_agent_t *agent = &s_benchAgents[op][next[op]];
+                uint64_t start = DEV_SM_Nsec64Get();
+
+                /* Run operation */
+                if (s_benchOps[op].func(agent->channel, agent->rsrc,
+                    agent->agentId, &start) != SM_ERR_SUCCESS)
+                {
+                    errors[op]++;
+                }
+
+                /* Record latency */
+                s_benchSamples[op][s_benchCount[op]] =
+                    (uint32_t) (DEV_SM_Nsec64Get() - start);
+                s_benchCount[op]++;
+
+                /* Round-robin over agents */
+                next[op] = (next[op] + 1U) % s_benchNumAgents[op];
+            }
+        }
+    }
+    wall = DEV_SM_Nsec64Get() - wall;
+
+    /* Reset agents, reverts what the mix changed */
+    for (uint32_t agentId = 0U; agentId < SM_SCMI_NUM_AGNT; agentId++)
+    {
+        uint32_t scmiInst = g_scmiAgentConfig[agentId].scmiInst;
+        uint64_t start = DEV_SM_Nsec64Get();
+
+        if (RPC_SCMI_BaseDispatchReset(g_scmiConfig[scmiInst].lmId,
+            agentId, false) != SM_ERR_SUCCESS)
+        {
+            resetErrors++;
+        }
+
+        s_benchReset[agentId] = (uint32_t) (DEV_SM_Nsec64Get() - start);
+    }
+
+    /* Restore */
+    TEST_ScmiBenchSetup(false);
+
+    /* Report */
+    printf("BENCH,op,agents,count,errors,ops_per_sec,p50_ns,p99_ns,"
+        "max_ns\n");
+    for (uint32_t op = 0U; op < SCMI_BENCH_NUM_OP; op++)
+    {
+        TEST_ScmiBenchReport(s_benchOps[op].name, s_benchNumAgents[op],
+            s_benchSamples[op], s_benchCount[op], errors[op]);
+        total += s_benchCount[op];
+    }
+    TEST_ScmiBenchReport("base.agent_reset", SM_SCMI_NUM_AGNT, s_benchReset,
+        SM_SCMI_NUM_AGNT, resetErrors);
+    printf("BENCH,total,,%u,,%u,,,\n", total,
+        (uint32_t) ((((uint64_t) total) * 1000000000ULL) / wall));
+
+    printf("\n");
+
+    /* Exit */
+    BRD_SM_Exit(SM_ERR_SUCCESS);
+}
+
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Get clock rate                                                           */
+/*--------------------------------------------------------------------------*/
+static int32_t TEST_ScmiBenchClockGet(uint32_t channel, uint32_t rsrc,
+    uint32_t agentId, uint64_t *start)
+{
+    scmi_clock_rate_t rate = { 0 };
+
+    return SCMI_ClockRateGet(channel, rsrc, &rate);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Set clock rate to the current rate                                       */
+/*--------------------------------------------------------------------------*/
+static int32_t TEST_ScmiBenchClockSet(uint32_t channel, uint32_t rsrc,
+    uint32_t agentId, uint64_t *start)
+{
+    int32_t status;
+    scmi_clock_rate_t rate = { 0 };
+
+    status = SCMI_ClockRateGet(channel, rsrc, &rate);
+
+    /* Time only the set */
+    if (status == SM_ERR_SUCCESS)
+    {
+        *start = DEV_SM_Nsec64Get();
+        status = SCMI_ClockRateSet(channel, rsrc,
+            SCMI_CLOCK_RATE_FLAGS_ROUND(SCMI_CLOCK_ROUND_AUTO), rate);
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Set performance level to the current level                               */
+/*--------------------------------------------------------------------------*/
+static int32_t TEST_ScmiBenchPerfSet(uint32_t channel, uint32_t rsrc,
+    uint32_t agentId, uint64_t *start)
+{
+    int32_t status;
+    uint32_t level = 0U;
+
+    status = SCMI_PerformanceLevelGet(channel, rsrc, &level);
+
+    /* Time only the set */
+    if (status == SM_ERR_SUCCESS)
+    {
+        *start = DEV_SM_Nsec64Get();
+        status = SCMI_PerformanceLevelSet(channel, rsrc, level);
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Read sensor                                                              */
+/*--------------------------------------------------------------------------*/
+static int32_t TEST_ScmiBenchSensor(uint32_t channel, uint32_t rsrc,
+    uint32_t agentId, uint64_t *start)
+{
+    scmi_sensor_reading_t readings[SCMI_SENSOR_MAX_READINGS] = { 0 };
+
+    return SCMI_SensorReadingGet(channel, rsrc, 0U, readings);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Get all pin configs                                                      */
+/*--------------------------------------------------------------------------*/
+static int32_t TEST_ScmiBenchPinctrl(uint32_t channel, uint32_t rsrc,
+    uint32_t agentId, uint64_t *start)
+{
+    uint32_t numConfigs = 0U;
+    scmi_pin_config_t configs[SCMI_PINCTRL_MAX_CONFIGS] = { 0 };
+
+    return SCMI_PinctrlConfigGet(channel, rsrc,
+        SCMI_PINCTRL_GET_ATTR_GET_ALL(1UL), &numConfigs, configs);
+}
+
+/*--------------------------------------------------------------------------*/
+/* Trigger button notification and receive it                               */
+/*--------------------------------------------------------------------------*/
+static int32_t TEST_ScmiBenchNotify(uint32_t channel, uint32_t rsrc,
+    uint32_t agentId, uint64_t *start)
+{
+    int32_t status;
+    scmi_msg_id_t msgId =
+    {
+        .protocolId = SCMI_PROTOCOL_BBM,
+        .messageId = RPC_SCMI_NOTIFY_BBM_BUTTON_EVENT
+    };
+    lmm_rpc_trigger_t trigger = { 0 };
+    uint32_t protocolId, messageId;
+    uint32_t flags = 0U;
+
+    /* Queue notification */
+    trigger.rpcInst = g_scmiAgentConfig[agentId].scmiInst;
+    status = RPC_SCMI_BbmDispatchNotification(msgId, &trigger);
+
+    /* Check delivered, agent may not have notifications enabled */
+    if (status == SM_ERR_SUCCESS)
+    {
+        status = SCMI_P2aPending(channel + 1U, &protocolId, &messageId);
+    }
+
+    /* Receive on the P2A channel */
+    if (status == SM_ERR_SUCCESS)
+    {
+        status = SCMI_BbmButtonEvent(channel + 1U, &flags);
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Enable/disable sensors and notifications used by the benchmark           */
+/*--------------------------------------------------------------------------*/
+static void TEST_ScmiBenchSetup(bool enable)
+{
+    uint32_t en = enable ? 1U : 0U;
+
+    /* Ignore errors from agents without access */
+    for (uint32_t op = 0U; op < SCMI_BENCH_NUM_OP; op++)
+    {
+        for (uint32_t idx = 0U; idx < s_benchNumAgents[op]; idx++)
+        {
+            const bench_agent_t *agent = &s_benchAgents[op][idx];
+
+            /* Enable sensors */
+            if (s_benchOps[op].testId == TEST_SENSOR)
+            {
+                (void) SCMI_SensorConfigSet(agent->channel, agent->rsrc,
+                    SCMI_SENSOR_CONFIG_SET_ENABLE(en));
+            }
+
+            /* Enable button notifications */
+            if (s_benchOps[op].testId == TEST_BUTTON)
+            {
+                (void) SCMI_BbmButtonNotify(agent->channel,
+                    SCMI_BBM_NOTIFY_BUTTON_DETECT(en));
+            }
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Print results for an operation                                           */
+/*--------------------------------------------------------------------------*/
+static void TEST_ScmiBenchReport(string name, uint32_t agents,
+    uint32_t *samples, uint32_t count, uint32_t errors)
+{
+    uint64_t sum = 0ULL;
+
+    if (count > 0U)
+    {
+        qsort(samples, count, sizeof(uint32_t), TEST_ScmiBenchCompare);
+        for (uint32_t idx = 0U; idx < count; idx++)
+        {
+            sum += samples[idx];
+        }
+
+        /* Service rate from summed latency */
+        uint32_t rate = (uint32_t) ((((uint64_t) count) * 1000000000ULL)
+            / ((sum > 0ULL) ? sum : 1ULL));
+
+        /* Nearest-rank percentiles */
+        printf("BENCH,%s,%u,%u,%u,%u,%u,%u,%u\n", name, agents, count,
+            errors, rate,
+            samples[((count * 50U) + 99U) / 100U - 1U],
+            samples[((count * 99U) + 99U) / 100U - 1U],
+            samples[count - 1U]);
+    }
+}
+
+/*--------------------------------------------------------------------------*/
+/* Compare samples for sorting                                              */
+/*--------------------------------------------------------------------------*/
+static int TEST_ScmiBenchCompare(const void *a, const void *b)
+{
+    uint32_t x = *((const uint32_t *) a);
+    uint32_t y = *((const uint32_t *) b);
+
+    return (x > y) - (x < y);
+}
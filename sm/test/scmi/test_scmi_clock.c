@@ -41,6 +41,7 @@
 /* Includes */
 
 #include "test_scmi.h"
+#include "scmi_internal.h"
 #include "lmm.h"
 
 /* Local defines */
@@ -51,11 +52,13 @@
 
 /* Local functions */
 
-static void TEST_ScmiClockNone(uint32_t channel, uint32_t clockId);
+static void TEST_ScmiClockNone(uint8_t perm, uint32_t channel,
+    uint32_t clockId);
 static void TEST_ScmiClockSet(bool pass, uint32_t channel,
     uint32_t clockId);
 static void TEST_ScmiClockExclusive(bool pass, uint32_t channel,
     uint32_t clockId, uint32_t lmId);
+static void TEST_ScmiClockNoNotify(uint32_t agentId, uint32_t channel);
 
 /*--------------------------------------------------------------------------*/
 /* Test SCMI clock protocol                                                 */
@@ -93,6 +96,8 @@ void TEST_ScmiClock(void)
         maxPending = SCMI_CLOCK_PROTO_ATTR_MAX_PENDING(attributes);
         printf("  numClocks=%u\n", numClocks);
         printf("  maxPending=%u\n", maxPending);
+
+        BCHECK(maxPending != 0U);
     }
 
     /* Test message attributes */
@@ -214,15 +219,28 @@ void TEST_ScmiClock(void)
             0U, &numParent, &parents), SM_ERR_INVALID_PARAMETERS);
     }
 
+    /* Clock Rate Notify */
+    {
+        /* Test notify for invalid clock */
+        NECHECK(SCMI_ClockRateNotify(SM_TEST_DEFAULT_CHN, numClocks,
+            0U), SCMI_ERR_NOT_FOUND);
+        NECHECK(SCMI_ClockRateChangeRequestedNotify(SM_TEST_DEFAULT_CHN,
+            numClocks, 0U), SCMI_ERR_NOT_FOUND);
+
+        /* Branch -- Invalid Channel */
+        NECHECK(SCMI_ClockRateNotify(SM_SCMI_NUM_CHN, 0U, 0U),
+            SCMI_ERR_INVALID_PARAMETERS);
+    }
+
     /* Loop over clock test domains */
     status = TEST_ConfigFirstGet(TEST_CLK, &agentId,
         &channel, &clockId, &lmId);
     while (status == SM_ERR_SUCCESS)
     {
-        uint8_t perm = g_scmiAgentConfig[agentId].clkPerms[clockId];
+        uint8_t perm = SM_SCMI_PERM(g_scmiClkPerms, agentId, clockId);
 
         /* Test functions with no perm required */
-        TEST_ScmiClockNone(channel, clockId);
+        TEST_ScmiClockNone(perm, channel, clockId);
 
         /* Test functions with SET perm required */
         TEST_ScmiClockSet(perm >= SM_SCMI_PERM_SET, channel, clockId);
@@ -236,6 +254,33 @@ void TEST_ScmiClock(void)
             &channel, &clockId, &lmId);
     }
 
+    /* Loop over agents without a notification channel */
+    for (channel = 0U; channel < SM_SCMI_NUM_CHN; channel++)
+    {
+        if (g_scmiChannelConfig[channel].type == SM_SCMI_CHN_A2P)
+        {
+            bool notify = false;
+
+            agentId = g_scmiChannelConfig[channel].agentId;
+
+            /* Find notification channel of the agent */
+            for (uint32_t chn = 0U; chn < SM_SCMI_NUM_CHN; chn++)
+            {
+                if ((g_scmiChannelConfig[chn].agentId == agentId)
+                    && (g_scmiChannelConfig[chn].type
+                    == SM_SCMI_CHN_P2A_NOTIFY))
+                {
+                    notify = true;
+                }
+            }
+
+            if (!notify)
+            {
+                TEST_ScmiClockNoNotify(agentId, channel);
+            }
+        }
+    }
+
     printf("\n");
 }
 
@@ -244,7 +289,8 @@ void TEST_ScmiClock(void)
 /*--------------------------------------------------------------------------*/
 /* Test SCMI clock functions with no access                                 */
 /*--------------------------------------------------------------------------*/
-static void TEST_ScmiClockNone(uint32_t channel, uint32_t clockId)
+static void TEST_ScmiClockNone(uint8_t perm, uint32_t channel,
+    uint32_t clockId)
 {
     uint32_t attributes = 0U;
     uint8_t name[SCMI_CLOCK_MAX_NAME];
@@ -267,9 +313,39 @@ static void TEST_ScmiClockNone(uint32_t channel, uint32_t clockId)
         SCMI_CLOCK_ATTR_PARENT(attributes));
     printf("  name=%s\n",  name);
 
+    BCHECK(SCMI_CLOCK_ATTR_CHANGE(attributes) == 1U);
+    BCHECK(SCMI_CLOCK_ATTR_CHANGE_REQ(attributes) == 1U);
+
     CHECK(SCMI_ClockAttributes(channel, clockId, NULL,
         NULL));
 
+    /* Test clock notify */
+    {
+        printf("SCMI_ClockRateNotify(%u, %u)\n", channel, clockId);
+        XCHECK(perm >= SM_SCMI_PERM_NOTIFY,
+            SCMI_ClockRateNotify(channel, clockId,
+            SCMI_CLOCK_NOTIFY_ENABLE(1U)));
+        XCHECK(perm >= SM_SCMI_PERM_NOTIFY,
+            SCMI_ClockRateNotify(channel, clockId, 0U));
+
+        printf("SCMI_ClockRateChangeRequestedNotify(%u, %u)\n", channel,
+            clockId);
+        XCHECK(perm >= SM_SCMI_PERM_NOTIFY,
+            SCMI_ClockRateChangeRequestedNotify(channel, clockId,
+            SCMI_CLOCK_NOTIFY_ENABLE(1U)));
+        XCHECK(perm >= SM_SCMI_PERM_NOTIFY,
+            SCMI_ClockRateChangeRequestedNotify(channel, clockId, 0U));
+
+        /* Invalid flags */
+        if (perm >= SM_SCMI_PERM_NOTIFY)
+        {
+            NECHECK(SCMI_ClockRateNotify(channel, clockId, 2U),
+                SCMI_ERR_INVALID_PARAMETERS);
+            NECHECK(SCMI_ClockRateChangeRequestedNotify(channel,
+                clockId, 2U), SCMI_ERR_INVALID_PARAMETERS);
+        }
+    }
+
     printf("SCMI_ClockDescribeRates(%u, %u)\n", channel, clockId);
     CHECK(SCMI_ClockDescribeRates(channel, clockId, 0U,
         &numRatesFlags, rates));
@@ -415,12 +491,161 @@ static void TEST_ScmiClockExclusive(bool pass, uint32_t channel,
         CHECK(SCMI_ClockRateGet(channel, clockId, NULL));
     }
 
-    /* Test ClockRateSet for invalid async flag */
+    /* Test best parent selection */
+    if (pass)
+    {
+        uint32_t attributes = 0U;
+        uint32_t extendedConfigVal = 0U;
+        uint32_t extAttr = SCMI_CLOCK_CONFIG_SET_EXT_CONFIG(
+            SCMI_CLOCK_EXT_CONFIG_PARENT_SEL)
+            | SCMI_CLOCK_CONFIG_SET_ENABLE(3U);
+        uint32_t extFlags = SCMI_CLOCK_CONFIG_FLAGS_EXT_CONFIG(
+            SCMI_CLOCK_EXT_CONFIG_PARENT_SEL);
+
+        CHECK(SCMI_ClockAttributes(channel, clockId, &attributes, NULL));
+        if (SCMI_CLOCK_ATTR_EXT_CONFIG(attributes) == 1U)
+        {
+            printf("SCMI_ClockConfigSet(%u, %u, PARENT_SEL, 1)\n", channel,
+                clockId);
+            CHECK(SCMI_ClockConfigSet(channel, clockId, extAttr, 1U));
+            CHECK(SCMI_ClockConfigGet(channel, clockId, extFlags, NULL,
+                NULL, &extendedConfigVal));
+            BCHECK(extendedConfigVal == 1U);
+
+            flags = SCMI_CLOCK_RATE_FLAGS_ROUND(SCMI_CLOCK_ROUND_AUTO);
+            CHECK(SCMI_ClockRateSet(channel, clockId, flags, rate));
+
+            NECHECK(SCMI_ClockConfigSet(channel, clockId, extAttr, 2U),
+                SCMI_ERR_INVALID_PARAMETERS);
+
+            printf("SCMI_ClockConfigSet(%u, %u, PARENT_SEL, 0)\n", channel,
+                clockId);
+            CHECK(SCMI_ClockConfigSet(channel, clockId, extAttr, 0U));
+            CHECK(SCMI_ClockConfigGet(channel, clockId, extFlags, NULL,
+                NULL, &extendedConfigVal));
+            BCHECK(extendedConfigVal == 0U);
+        }
+        else
+        {
+            NECHECK(SCMI_ClockConfigSet(channel, clockId, extAttr, 1U),
+                SCMI_ERR_INVALID_PARAMETERS);
+        }
+
+        /* Unchanged enable requires an extended config */
+        NECHECK(SCMI_ClockConfigSet(channel, clockId,
+            SCMI_CLOCK_CONFIG_SET_ENABLE(3U), 0U),
+            SCMI_ERR_INVALID_PARAMETERS);
+
+        /* Extended config without the value word */
+        {
+            uint32_t header = 0U;
+            uint32_t *msg = NULL;
+
+            printf("SCMI_ClockConfigSet(%u, %u, PARENT_SEL) short\n",
+                channel, clockId);
+            CHECK(SCMI_BufInit(channel, (void **) &msg));
+            msg[1] = clockId;
+            msg[2] = extAttr;
+            CHECK(SCMI_A2pTx(channel, SCMI_PROTOCOL_CLOCK,
+                SCMI_MSG_CLOCK_CONFIG_SET, 3U * sizeof(uint32_t), &header));
+            NECHECK(SCMI_A2pRx(channel, sizeof(uint32_t) * 2U, header),
+                SCMI_ERR_PROTOCOL_ERROR);
+        }
+    }
+
+    /* Test rate change notifications */
+    if (pass)
+    {
+        scmi_clock_rate_t newRate = {24000000U, 0U};
+        uint32_t protocolId, messageId;
+
+        /* Enable notifications */
+        printf("SCMI_ClockRateNotify(%u, %u, 1)\n", channel, clockId);
+        CHECK(SCMI_ClockRateNotify(channel, clockId,
+            SCMI_CLOCK_NOTIFY_ENABLE(1U)));
+        CHECK(SCMI_ClockRateChangeRequestedNotify(channel, clockId,
+            SCMI_CLOCK_NOTIFY_ENABLE(1U)));
+
+        /* Change rate */
+        printf("SCMI_ClockRateSet(%u, %u, 0x%08X, %u)\n", channel, clockId,
+            flags, newRate.lower);
+        CHECK(SCMI_ClockRateSet(channel, clockId, flags, newRate));
+        CHECK(SCMI_ClockRateGet(channel, clockId, &newRate));
+
+        /* Rate changed notification */
+        if (newRate.lower != rate.lower)
+        {
+            uint32_t agentId = 1U;
+            uint32_t evClock = 0U;
+            scmi_clock_rate_t evRate = {0U, 0U};
+
+            printf("SCMI_ClockRateChanged(%u)\n", channel + 1U);
+            CHECK(SCMI_ClockRateChanged(channel + 1U, &agentId,
+                &evClock, &evRate));
+            printf("  clockId=%u, rate=%u\n", evClock, evRate.lower);
+            BCHECK(agentId == 0U);
+            BCHECK(evClock == clockId);
+            BCHECK(evRate.lower == newRate.lower);
+            BCHECK(evRate.upper == newRate.upper);
+
+            /* Restore rate */
+            CHECK(SCMI_ClockRateSet(channel, clockId, flags, rate));
+            CHECK(SCMI_ClockRateChanged(channel + 1U, NULL, &evClock,
+                &evRate));
+            BCHECK(evClock == clockId);
+            BCHECK(evRate.lower == rate.lower);
+        }
+
+        /* No notification if rate unchanged or for own requests */
+        CHECK(SCMI_ClockRateSet(channel, clockId, flags, rate));
+        NECHECK(SCMI_P2aPending(channel + 1U, &protocolId, &messageId),
+            SCMI_ERR_PROTOCOL_ERROR);
+
+        /* Disable notifications */
+        CHECK(SCMI_ClockRateNotify(channel, clockId, 0U));
+        CHECK(SCMI_ClockRateChangeRequestedNotify(channel, clockId, 0U));
+    }
+
+    /* Test async ClockRateSet */
     {
-        uint32_t asyncflag = SCMI_CLOCK_RATE_FLAGS_ASYNC(1U);
+        uint32_t asyncflag = SCMI_CLOCK_RATE_FLAGS_ASYNC(1U)
+            | SCMI_CLOCK_RATE_FLAGS_ROUND(SCMI_CLOCK_ROUND_AUTO);
 
-        NCHECK(SCMI_ClockRateSet(channel, clockId,
+        printf("SCMI_ClockRateSet(%u, %u, 0x%08X, %u)\n", channel,
+            clockId, asyncflag, rate.lower);
+        XCHECK(pass, SCMI_ClockRateSet(channel, clockId,
             asyncflag, rate));
+
+        if (pass)
+        {
+            uint32_t completeId = 0U;
+            scmi_clock_rate_t completeRate = {0U, 0U};
+
+            /* Collect delayed response */
+            printf("SCMI_ClockRateSetComplete(%u)\n", channel + 1U);
+            CHECK(SCMI_ClockRateSetComplete(channel + 1U, &completeId,
+                &completeRate));
+            printf("  clockId=%u\n", completeId);
+            printf("  rate=%u\n", completeRate.lower);
+            BCHECK(completeId == clockId);
+
+            CHECK(SCMI_ClockRateGet(channel, clockId, &rate));
+            BCHECK(completeRate.lower == rate.lower);
+            BCHECK(completeRate.upper == rate.upper);
+
+            /* Async without delayed response */
+            asyncflag |= SCMI_CLOCK_RATE_FLAGS_NO_RESP(1U);
+            printf("SCMI_ClockRateSet(%u, %u, 0x%08X, %u)\n", channel,
+                clockId, asyncflag, rate.lower);
+            CHECK(SCMI_ClockRateSet(channel, clockId, asyncflag, rate));
+            {
+                uint32_t protocolId = 0U;
+                uint32_t messageId = 0U;
+
+                NECHECK(SCMI_P2aPending(channel + 1U, &protocolId,
+                    &messageId), SCMI_ERR_PROTOCOL_ERROR);
+            }
+        }
     }
 
 #ifdef SIMU
@@ -457,6 +682,35 @@ static void TEST_ScmiClockExclusive(bool pass, uint32_t channel,
 
         BCHECK(SCMI_CLOCK_ATTR_ENABLED(attributes) == 0U);
     }
+
+    /* Reset leaves clocks untouched by the agent */
+    if (pass)
+    {
+        uint64_t oldRate = 0ULL;
+        uint64_t setRate = 0ULL;
+        uint64_t curRate = 0ULL;
+
+        /* Change rate outside of the agent */
+        CHECK(LMM_ClockRateGet(lmId, clockId, &oldRate));
+        printf("LMM_ClockRateSet(%u, %u)\n", lmId, clockId);
+        CHECK(LMM_ClockRateSet(lmId, clockId, oldRate + 1000000ULL,
+            DEV_SM_CLOCK_ROUND_DOWN));
+        CHECK(LMM_ClockRateGet(lmId, clockId, &setRate));
+
+        /* Reset */
+        printf("LMM_SystemLmReset(%u, %u)\n", 0U, lmId);
+        CHECK(LMM_SystemLmReset(0U, 0U, lmId, true, false,
+            &g_swReason));
+
+        /* Ensure rate was not reverted */
+        CHECK(LMM_ClockRateGet(lmId, clockId, &curRate));
+        printf("  rate=%u\n", (uint32_t) curRate);
+        BCHECK(curRate == setRate);
+
+        /* Restore rate */
+        CHECK(LMM_ClockRateSet(lmId, clockId, oldRate,
+            DEV_SM_CLOCK_ROUND_DOWN));
+    }
 #endif
 
     /* Test for parentget and parentset*/
@@ -489,3 +743,54 @@ static void TEST_ScmiClockExclusive(bool pass, uint32_t channel,
     }
 }
 
+/*--------------------------------------------------------------------------*/
+/* Test SCMI clock functions for agent with no notification channel         */
+/*--------------------------------------------------------------------------*/
+static void TEST_ScmiClockNoNotify(uint32_t agentId, uint32_t channel)
+{
+    /* Find a clock the agent can set */
+    for (uint32_t clockId = 0U; clockId < SM_NUM_CLOCK; clockId++)
+    {
+        if (SM_SCMI_PERM(g_scmiClkPerms, agentId, clockId)
+            >= SM_SCMI_PERM_EXCLUSIVE)
+        {
+            uint32_t attributes = 0U;
+            uint32_t maxPending;
+            scmi_clock_rate_t rate = {0U, 0U};
+            uint32_t asyncflag = SCMI_CLOCK_RATE_FLAGS_ASYNC(1U)
+                | SCMI_CLOCK_RATE_FLAGS_ROUND(SCMI_CLOCK_ROUND_AUTO);
+
+            printf("**** Clock No Notify Tests (agent %u) ***\n\n",
+                agentId);
+
+            CHECK(SCMI_ClockProtocolAttributes(channel, &attributes));
+            maxPending = SCMI_CLOCK_PROTO_ATTR_MAX_PENDING(attributes);
+            CHECK(SCMI_ClockRateGet(channel, clockId, &rate));
+
+            /* Delayed response cannot be sent */
+            printf("SCMI_ClockRateSet(%u, %u, 0x%08X, %u)\n", channel,
+                clockId, asyncflag, rate.lower);
+            for (uint32_t idx = 0U; idx <= maxPending; idx++)
+            {
+                NECHECK(SCMI_ClockRateSet(channel, clockId, asyncflag,
+                    rate), SCMI_ERR_NOT_SUPPORTED);
+            }
+
+            /* Async without delayed response never stalls */
+            asyncflag |= SCMI_CLOCK_RATE_FLAGS_NO_RESP(1U);
+            printf("SCMI_ClockRateSet(%u, %u, 0x%08X, %u)\n", channel,
+                clockId, asyncflag, rate.lower);
+            for (uint32_t idx = 0U; idx <= maxPending; idx++)
+            {
+                CHECK(SCMI_ClockRateSet(channel, clockId, asyncflag,
+                    rate));
+            }
+
+            /* Sync still works */
+            CHECK(SCMI_ClockRateSet(channel, clockId,
+                SCMI_CLOCK_RATE_FLAGS_ROUND(SCMI_CLOCK_ROUND_AUTO), rate));
+            break;
+        }
+    }
+}
+
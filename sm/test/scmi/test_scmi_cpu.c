@@ -165,7 +165,7 @@ void TEST_ScmiCpu(void)
         &channel, &domainId, &lmId);
     while (status == SM_ERR_SUCCESS)
     {
-        uint8_t perm = g_scmiAgentConfig[agentId].cpuPerms[domainId];
+        uint8_t perm = SM_SCMI_PERM(g_scmiCpuPerms, agentId, domainId);
 
         /* Test functions with no perm required */
         TEST_ScmiCpuNone(channel, domainId);
@@ -200,7 +200,7 @@ void TEST_ScmiLmm(void)
         &channel, &lm, &lmId);
     while (status == SM_ERR_SUCCESS)
     {
-        uint8_t perm = g_scmiAgentConfig[agentId].lmmPerms[lm];
+        uint8_t perm = SM_SCMI_PERM(g_scmiLmmPerms, agentId, lm);
 
         /* Test functions with GET perm required */
         TEST_ScmiLmmGet(perm >= SM_SCMI_PERM_GET, channel, lm);
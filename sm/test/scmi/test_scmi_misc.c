@@ -58,6 +58,10 @@ static void TEST_ScmiMiscNotify(bool pass, uint32_t channel,
     uint32_t ctrlId);
 static void TEST_ScmiMiscExclusive(bool pass, uint32_t channel,
     uint32_t ctrlId, uint32_t lmId);
+#ifdef SIMU
+static void TEST_ScmiMiscPack(uint32_t channel, uint32_t ctrlId,
+    uint32_t agentId);
+#endif
 
 /*--------------------------------------------------------------------------*/
 /* Test SCMI control protocol                                               */
@@ -260,6 +264,117 @@ void TEST_ScmiMisc(void)
             NULL, NULL));
     }
 
+    /* Test batch */
+    {
+        uint32_t numStatus = 0U;
+        int32_t cmdStatus[SCMI_MISC_MAX_STATUS] = { 0 };
+        uint32_t cmds[] =
+        {
+            4U, SCMI_MISC_BATCH_HEADER(SCMI_PROTOCOL_MISC, 0U),
+            4U, SCMI_MISC_BATCH_HEADER(SCMI_PROTOCOL_MISC, 30U),
+            8U, SCMI_MISC_BATCH_HEADER(SCMI_PROTOCOL_MISC,
+                SCMI_MSG_MISC_REASON_ATTRIBUTES), 0U,
+            12U, SCMI_MISC_BATCH_HEADER(SCMI_PROTOCOL_MISC,
+                SCMI_MSG_MISC_BATCH), 0U, 0U
+        };
+        uint32_t numWords = sizeof(cmds) / sizeof(uint32_t);
+
+        printf("SCMI_MiscBatch(%u)\n", SM_TEST_DEFAULT_CHN);
+        CHECK(SCMI_MiscBatch(SM_TEST_DEFAULT_CHN, 0U, 4U, numWords, cmds,
+            &numStatus, cmdStatus));
+        printf("  numStatus=%u\n", numStatus);
+        BCHECK(numStatus == 4U);
+        BCHECK(cmdStatus[0] == SCMI_ERR_SUCCESS);
+        BCHECK(cmdStatus[1] == SCMI_ERR_NOT_SUPPORTED);
+        BCHECK(cmdStatus[2] == SCMI_ERR_SUCCESS);
+        BCHECK(cmdStatus[3] == SCMI_ERR_NOT_SUPPORTED);
+
+        /* Stop on error */
+        CHECK(SCMI_MiscBatch(SM_TEST_DEFAULT_CHN,
+            SCMI_MISC_BATCH_FLAG_STOP(1U), 4U, numWords, cmds, &numStatus,
+            cmdStatus));
+        BCHECK(numStatus == 2U);
+
+        /* Empty batch */
+        CHECK(SCMI_MiscBatch(SM_TEST_DEFAULT_CHN, 0U, 0U, 0U, cmds,
+            &numStatus, NULL));
+        BCHECK(numStatus == 0U);
+
+        /* Branch -- Command list too short */
+        NECHECK(SCMI_MiscBatch(SM_TEST_DEFAULT_CHN, 0U, 5U, numWords, cmds,
+            NULL, NULL), SCMI_ERR_PROTOCOL_ERROR);
+
+        /* Branch -- Bad command length */
+        cmds[0] = 6U;
+        NECHECK(SCMI_MiscBatch(SM_TEST_DEFAULT_CHN, 0U, 1U, numWords, cmds,
+            NULL, NULL), SCMI_ERR_PROTOCOL_ERROR);
+        cmds[0] = 4U;
+
+        /* Branch -- Too many commands */
+        NECHECK(SCMI_MiscBatch(SM_TEST_DEFAULT_CHN, 0U,
+            SCMI_MISC_MAX_STATUS + 1024U, numWords, cmds, NULL, NULL),
+            SCMI_ERR_INVALID_PARAMETERS);
+
+        /* Branch -- Invalid Channel */
+        NECHECK(SCMI_MiscBatch(SM_SCMI_NUM_CHN, 0U, 0U, 0U, cmds,
+            NULL, NULL), SCMI_ERR_INVALID_PARAMETERS);
+    }
+
+    /* Test SCMI statistics */
+    {
+        uint32_t id = 0U;
+        uint32_t count = 0U;
+        uint32_t minTime = 0U;
+        uint32_t avgTime = 0U;
+        uint32_t maxTime = 0U;
+        uint32_t hist[SCMI_MISC_MAX_HIST] = { 0 };
+
+        printf("SCMI_MiscScmiStats(%u)\n", SM_TEST_DEFAULT_CHN);
+#ifdef SCMI_STATS
+        uint32_t total = 0U;
+
+        /* Channel stats */
+        CHECK(SCMI_MiscScmiStats(SM_TEST_DEFAULT_CHN,
+            SCMI_MISC_STATS_TYPE_CHANNEL, 0U, &id, &count, NULL, &minTime,
+            &avgTime, &maxTime, hist));
+        printf("  chn=%u, count=%u, min=%u, avg=%u, max=%u\n", id, count,
+            minTime, avgTime, maxTime);
+        BCHECK(count != 0U);
+        BCHECK((minTime <= avgTime) && (avgTime <= maxTime));
+        for (uint32_t bucket = 0U; bucket < SCMI_MISC_MAX_HIST; bucket++)
+        {
+            total += hist[bucket];
+        }
+        BCHECK(total == count);
+
+        /* Message stats */
+        CHECK(SCMI_MiscScmiStats(SM_TEST_DEFAULT_CHN,
+            SCMI_MISC_STATS_TYPE_MSG, 0U, &id, &count, NULL, NULL,
+            NULL, NULL, NULL));
+        printf("  protocolId=0x%X, messageId=0x%X, count=%u\n",
+            (id >> 8U) & 0xFFU, id & 0xFFU, count);
+        BCHECK(count != 0U);
+
+        /* Branch -- Invalid index */
+        NECHECK(SCMI_MiscScmiStats(SM_TEST_DEFAULT_CHN,
+            SCMI_MISC_STATS_TYPE_MSG, 256U, NULL, NULL, NULL, NULL, NULL,
+            NULL, NULL), SCMI_ERR_NOT_FOUND);
+
+        /* Branch -- Invalid type */
+        NECHECK(SCMI_MiscScmiStats(SM_TEST_DEFAULT_CHN, 2U, 0U, NULL,
+            NULL, NULL, NULL, NULL, NULL, NULL),
+            SCMI_ERR_INVALID_PARAMETERS);
+#else
+        NECHECK(SCMI_MiscScmiStats(SM_TEST_DEFAULT_CHN,
+            SCMI_MISC_STATS_TYPE_CHANNEL, 0U, &id, &count, NULL, &minTime,
+            &avgTime, &maxTime, hist), SCMI_ERR_NOT_SUPPORTED);
+#endif
+
+        /* Branch -- Invalid Channel */
+        NECHECK(SCMI_MiscScmiStats(SM_SCMI_NUM_CHN, 0U, 0U, NULL, NULL,
+            NULL, NULL, NULL, NULL, NULL), SCMI_ERR_INVALID_PARAMETERS);
+    }
+
     /* Invalid notification */
     {
         scmi_msg_id_t msgId =
@@ -278,7 +393,7 @@ void TEST_ScmiMisc(void)
         &channel, &ctrlId, &lmId);
     while (status == SM_ERR_SUCCESS)
     {
-        uint8_t perm = g_scmiAgentConfig[agentId].ctrlPerms[ctrlId];
+        uint8_t perm = SM_SCMI_PERM(g_scmiCtrlPerms, agentId, ctrlId);
 
         /* Test functions with GET perm required */
         TEST_ScmiMiscGet(perm >= SM_SCMI_PERM_GET, channel, ctrlId);
@@ -286,6 +401,14 @@ void TEST_ScmiMisc(void)
         /* Test functions with notify perms required */
         TEST_ScmiMiscNotify(perm >= SM_SCMI_PERM_NOTIFY,channel, ctrlId);
 
+#ifdef SIMU
+        /* Test packed notifications */
+        if (perm >= SM_SCMI_PERM_NOTIFY)
+        {
+            TEST_ScmiMiscPack(channel, ctrlId, agentId);
+        }
+#endif
+
         /* Test functions with EXCLUSIVE perm required */
         TEST_ScmiMiscExclusive(perm >= SM_SCMI_PERM_EXCLUSIVE, channel,
             ctrlId, lmId);
@@ -454,3 +577,75 @@ static void TEST_ScmiMiscExclusive(bool pass, uint32_t channel,
     }
 }
 
+#ifdef SIMU
+/*--------------------------------------------------------------------------*/
+/* Test SCMI packed notifications                                           */
+/*--------------------------------------------------------------------------*/
+static void TEST_ScmiMiscPack(uint32_t channel, uint32_t ctrlId,
+    uint32_t agentId)
+{
+    uint32_t attributes = 0U;
+    uint32_t numEvents = 0U;
+    uint32_t numWords = 0U;
+    uint32_t events[SCMI_MISC_MAX_EVENTS];
+    uint32_t protocolId, messageId;
+    scmi_msg_id_t msgId =
+    {
+        .protocolId = SCMI_PROTOCOL_MISC,
+        .messageId = RPC_SCMI_NOTIFY_MISC_CONTROL_EVENT
+    };
+    lmm_rpc_trigger_t trigger = { 0 };
+
+    /* Check support */
+    CHECK(SCMI_MiscProtocolAttributes(channel, &attributes));
+    BCHECK(SCMI_MISC_PROTO_ATTR_NOTIFY_PACK(attributes) == 1U);
+
+    /* Enable packing */
+    printf("SCMI_MiscNotifyPack(%u)\n", channel);
+
+    /* Reserved flags */
+    NECHECK(SCMI_MiscNotifyPack(channel, 0x2U),
+        SCMI_ERR_INVALID_PARAMETERS);
+
+    CHECK(SCMI_MiscNotifyPack(channel, SCMI_MISC_NOTIFY_PACK_ENABLE(1U)));
+
+    /* Request notification */
+    CHECK(SCMI_MiscControlNotify(channel, ctrlId, 1U));
+
+    /* Send one event as-is, queue three while it is in flight */
+    trigger.rpcInst = g_scmiAgentConfig[agentId].scmiInst;
+    trigger.parm[0] = ctrlId;
+    trigger.parm[1] = 1U;
+    for (uint32_t idx = 0U; idx < 4U; idx++)
+    {
+        CHECK(RPC_SCMI_MiscDispatchNotification(msgId, &trigger));
+    }
+
+    /* Read first event */
+    CHECK(SCMI_MiscControlEvent(channel + 1U, NULL, NULL));
+
+    /* Read packed event */
+    printf("SCMI_MiscPackedEvent(%u)\n", channel + 1U);
+    CHECK(SCMI_MiscPackedEvent(channel + 1U, &numEvents, &numWords,
+        events));
+    printf("  numEvents=%u, numWords=%u\n", numEvents, numWords);
+    BCHECK(numEvents == 3U);
+    BCHECK(numWords == 12U);
+    if (numWords == 12U)
+    {
+        BCHECK(events[0] == ((SCMI_PROTOCOL_MISC << 10U) | (0x3U << 8U)
+            | SCMI_MSG_MISC_CONTROL_EVENT));
+        BCHECK(events[1] == 8U);
+        BCHECK(events[2] == ctrlId);
+        BCHECK(events[10] == ctrlId);
+        BCHECK(events[11] == 1U);
+    }
+
+    /* Nothing else pending */
+    NECHECK(SCMI_P2aPending(channel + 1U, &protocolId, &messageId),
+        SCMI_ERR_PROTOCOL_ERROR);
+
+    /* Disable packing */
+    CHECK(SCMI_MiscNotifyPack(channel, SCMI_MISC_NOTIFY_PACK_ENABLE(0U)));
+}
+#endif
@@ -57,6 +57,8 @@ static void TEST_ScmiPerfSet(bool pass, uint32_t channel,
     uint32_t domainId);
 static void TEST_ScmiPerfPriv(bool pass, uint32_t channel,
     uint32_t domainId, uint32_t lmId);
+static void TEST_ScmiPerfFast(uint32_t agentId, uint32_t channel,
+    uint32_t numDomains);
 
 /*--------------------------------------------------------------------------*/
 /* Test SCMI performance protocol                                           */
@@ -167,6 +169,14 @@ void TEST_ScmiPerf(void)
             rangeMax, rangeMin), SCMI_ERR_NOT_FOUND);
     }
 
+    /* Notify -- Invalid domainId */
+    {
+        NECHECK(SCMI_PerformanceNotifyLimits(SM_TEST_DEFAULT_CHN,
+            numDomains, 0U), SCMI_ERR_NOT_FOUND);
+        NECHECK(SCMI_PerformanceNotifyLevel(SM_TEST_DEFAULT_CHN,
+            numDomains, 0U), SCMI_ERR_NOT_FOUND);
+    }
+
     /* Limit Get */
     {
         /* Limit Get -- Invalid domainId */
@@ -205,12 +215,33 @@ void TEST_ScmiPerf(void)
             0U, skipIndex, NULL, NULL));
     }
 
+    /* Loop over FastChannel agents */
+    for (uint32_t fcChn = 0U; fcChn < SM_SCMI_NUM_CHN; fcChn++)
+    {
+        if (g_scmiChannelConfig[fcChn].type == SM_SCMI_CHN_A2P_FAST)
+        {
+            uint32_t fcAgent = g_scmiChannelConfig[fcChn].agentId;
+
+            /* Find A2P channel of the agent */
+            for (channel = 0U; channel < SM_SCMI_NUM_CHN; channel++)
+            {
+                if ((g_scmiChannelConfig[channel].agentId == fcAgent)
+                    && (g_scmiChannelConfig[channel].type
+                    == SM_SCMI_CHN_A2P))
+                {
+                    TEST_ScmiPerfFast(fcAgent, channel, numDomains);
+                    break;
+                }
+            }
+        }
+    }
+
     /* Loop over performance test domains */
     status = TEST_ConfigFirstGet(TEST_PERF, &agentId,
         &channel, &domainId, &lmId);
     while (status == SM_ERR_SUCCESS)
     {
-        uint8_t perm = g_scmiAgentConfig[agentId].perfPerms[domainId];
+        uint8_t perm = SM_SCMI_PERM(g_scmiPerfPerms, agentId, domainId);
 
         /* Test functions with no perm required */
         TEST_ScmiPerfNone(perm, channel, domainId);
@@ -338,8 +369,28 @@ static void TEST_ScmiPerfNone(uint8_t perm, uint32_t channel,
         printf("  sustainedFreq=%u\n", sustainedFreq);
         printf("  sustainedPerfLevel=%u\n", sustainedPerfLevel);
         printf("  name=%s\n",  name);
+
+        BCHECK(SCMI_PERF_ATTR_LIMIT_NOTIFY(attributes) == 1UL);
+        BCHECK(SCMI_PERF_ATTR_LEVEL_NOTIFY(attributes) == 1UL);
     }
 
+    /* Notify Limits */
+    {
+        printf("SCMI_PerformanceNotifyLimits(%u, %u)\n", channel,
+            domainId);
+        XCHECK(perm >= SM_SCMI_PERM_NOTIFY,
+            SCMI_PerformanceNotifyLimits(channel, domainId,
+            SCMI_PERF_NOTIFY_ENABLE(1U)));
+        XCHECK(perm >= SM_SCMI_PERM_NOTIFY,
+            SCMI_PerformanceNotifyLimits(channel, domainId, 0U));
+
+        /* Invalid flags */
+        if (perm >= SM_SCMI_PERM_NOTIFY)
+        {
+            NECHECK(SCMI_PerformanceNotifyLevel(channel, domainId, 2U),
+                SCMI_ERR_INVALID_PARAMETERS);
+        }
+    }
 }
 
 /*--------------------------------------------------------------------------*/
@@ -408,6 +459,59 @@ static void TEST_ScmiPerfPriv(bool pass, uint32_t channel,
         CHECK(SCMI_PerformanceLevelGet(channel, domainId, NULL));
     }
 
+    /* Level change notification */
+    if (pass)
+    {
+        uint32_t numLevels = 0U;
+        uint32_t maxLevel;
+        uint32_t newLevel = 0U;
+        uint32_t protocolId = 0U;
+        uint32_t messageId = 0U;
+
+        /* Get highest level index */
+        CHECK(SCMI_PerformanceDescribeLevels(channel, domainId, 0U,
+            &numLevels, NULL));
+        maxLevel = SCMI_PERF_NUM_LEVELS_NUM_LEVELS(numLevels)
+            + SCMI_PERF_NUM_LEVELS_REMAING_LEVELS(numLevels) - 1U;
+
+        printf("SCMI_PerformanceNotifyLevel(%u, %u, 1)\n", channel,
+            domainId);
+        CHECK(SCMI_PerformanceNotifyLevel(channel, domainId,
+            SCMI_PERF_NOTIFY_ENABLE(1U)));
+
+        /* Move level, notification expected if aggregate changes */
+        CHECK(SCMI_PerformanceLevelSet(channel, domainId,
+            (perfLevel == maxLevel) ? 0U : maxLevel));
+        CHECK(SCMI_PerformanceLevelGet(channel, domainId, &newLevel));
+        if (newLevel != perfLevel)
+        {
+            uint32_t agentId = 1U;
+            uint32_t evDomain = 0U;
+            uint32_t evLevel = 0U;
+
+            printf("SCMI_PerformanceLevelChanged(%u)\n", channel + 1U);
+            CHECK(SCMI_PerformanceLevelChanged(channel + 1U, &agentId,
+                &evDomain, &evLevel));
+            printf("  domainId=%u, level=%u\n", evDomain, evLevel);
+            BCHECK(agentId == 0U);
+            BCHECK(evDomain == domainId);
+            BCHECK(evLevel == newLevel);
+
+            /* Restore level */
+            CHECK(SCMI_PerformanceLevelSet(channel, domainId, perfLevel));
+            CHECK(SCMI_PerformanceLevelChanged(channel + 1U, NULL,
+                NULL, &newLevel));
+            BCHECK(newLevel == perfLevel);
+        }
+
+        /* No notification if level unchanged */
+        CHECK(SCMI_PerformanceLevelSet(channel, domainId, perfLevel));
+        NECHECK(SCMI_P2aPending(channel + 1U, &protocolId, &messageId),
+            SCMI_ERR_PROTOCOL_ERROR);
+
+        CHECK(SCMI_PerformanceNotifyLevel(channel, domainId, 0U));
+    }
+
 /* Reset Config */
 #ifdef SIMU
     if (pass)
@@ -420,3 +524,104 @@ static void TEST_ScmiPerfPriv(bool pass, uint32_t channel,
 #endif
 }
 
+/*--------------------------------------------------------------------------*/
+/* Test SCMI performance FastChannels                                       */
+/*--------------------------------------------------------------------------*/
+static void TEST_ScmiPerfFast(uint32_t agentId, uint32_t channel,
+    uint32_t numDomains)
+{
+    /* Describe -- Invalid domainId */
+    NECHECK(SCMI_PerformanceDescribeFastchannel(channel, numDomains,
+        SCMI_MSG_PERFORMANCE_LEVEL_SET, NULL, NULL, NULL, NULL, NULL),
+        SCMI_ERR_NOT_FOUND);
+
+    /* Loop over domains */
+    for (uint32_t domainId = 0U; domainId < numDomains; domainId++)
+    {
+        uint8_t perm = SM_SCMI_PERM(g_scmiPerfPerms, agentId, domainId);
+
+        if (perm >= SM_SCMI_PERM_PRIV)
+        {
+            uint32_t attributes = 0U;
+            uint32_t addrLow = 0U;
+            uint32_t addrHigh = 0U;
+            uint32_t size = 0U;
+            uint32_t level = 0U;
+            uint32_t newLevel = 0U;
+            uint32_t rangeMax = 0U;
+            uint32_t rangeMin = 0U;
+            volatile uint32_t *fcSet;
+            volatile const uint32_t *fcGet;
+            volatile const uint32_t *fcLimits;
+
+            printf("SCMI_PerformanceDescribeFastchannel(%u, %u, LEVEL_SET)\n",
+                channel, domainId);
+            CHECK(SCMI_PerformanceDescribeFastchannel(channel, domainId,
+                SCMI_MSG_PERFORMANCE_LEVEL_SET, &attributes, NULL,
+                &addrLow, &addrHigh, &size));
+            printf("  addr=0x%08X%08X, size=%u\n", addrHigh, addrLow, size);
+            BCHECK(SCMI_PERF_FC_ATTR_DOORBELL(attributes) == 0U);
+            BCHECK(size == 4U);
+            fcSet = (volatile uint32_t*) ((uintptr_t) ((((uint64_t)
+                addrHigh) << 32U) | addrLow));
+
+            printf("SCMI_PerformanceDescribeFastchannel(%u, %u, LEVEL_GET)\n",
+                channel, domainId);
+            CHECK(SCMI_PerformanceDescribeFastchannel(channel, domainId,
+                SCMI_MSG_PERFORMANCE_LEVEL_GET, NULL, NULL,
+                &addrLow, &addrHigh, &size));
+            BCHECK(size == 4U);
+            fcGet = (volatile const uint32_t*) ((uintptr_t) ((((uint64_t)
+                addrHigh) << 32U) | addrLow));
+
+            printf("SCMI_PerformanceDescribeFastchannel(%u, %u, LIMITS_GET)\n",
+                channel, domainId);
+            CHECK(SCMI_PerformanceDescribeFastchannel(channel, domainId,
+                SCMI_MSG_PERFORMANCE_LIMITS_GET, NULL, NULL,
+                &addrLow, &addrHigh, &size));
+            BCHECK(size == 8U);
+            fcLimits = (volatile const uint32_t*) ((uintptr_t) ((((uint64_t)
+                addrHigh) << 32U) | addrLow));
+            CHECK(SCMI_PerformanceLimitsGet(channel, domainId, &rangeMax,
+                &rangeMin));
+            BCHECK(fcLimits[0] == rangeMax);
+            BCHECK(fcLimits[1] == rangeMin);
+
+            /* Limits set has no FastChannel */
+            NECHECK(SCMI_PerformanceDescribeFastchannel(channel, domainId,
+                SCMI_MSG_PERFORMANCE_LIMITS_SET, NULL, NULL, NULL, NULL,
+                NULL), SCMI_ERR_NOT_SUPPORTED);
+
+            /* Set lowest level via FastChannel and poll */
+            CHECK(SCMI_PerformanceLevelGet(channel, domainId, &level));
+            *fcSet = newLevel;
+            LMM_RpcPoll();
+            CHECK(SCMI_PerformanceLevelGet(channel, domainId, &newLevel));
+            printf("  fc level=%u, get=%u\n", newLevel, *fcGet);
+            BCHECK(newLevel == 0U);
+            BCHECK(*fcGet == newLevel);
+            BCHECK(*fcSet == 0xFFFFFFFFU);
+
+            /* Request the same level again after a message level set */
+            CHECK(SCMI_PerformanceLevelSet(channel, domainId, level));
+            *fcSet = newLevel;
+            LMM_RpcPoll();
+            CHECK(SCMI_PerformanceLevelGet(channel, domainId, &newLevel));
+            BCHECK(newLevel == 0U);
+            BCHECK(*fcSet == 0xFFFFFFFFU);
+
+            /* Restore level */
+            *fcSet = level;
+            LMM_RpcPoll();
+            BCHECK(*fcGet == level);
+        }
+        else
+        {
+            /* No FastChannels without PRIV */
+            NECHECK(SCMI_PerformanceDescribeFastchannel(channel, domainId,
+                SCMI_MSG_PERFORMANCE_LEVEL_GET, NULL, NULL, NULL, NULL,
+                NULL), SCMI_ERR_NOT_SUPPORTED);
+        }
+    }
+}
+
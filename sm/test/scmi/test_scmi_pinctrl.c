@@ -319,7 +319,7 @@ void TEST_ScmiPinctrl(void)
         &channel, &identifier, &lmId);
     while (status == SM_ERR_SUCCESS)
     {
-        uint8_t perm = g_scmiAgentConfig[agentId].pinPerms[identifier];
+        uint8_t perm = SM_SCMI_PERM(g_scmiPinPerms, agentId, identifier);
 
         /* Test functions with no perm required */
         TEST_ScmiPinctrlNone(channel, identifier);
@@ -51,7 +51,8 @@
 
 /* Local functions */
 
-static void TEST_ScmiPowerNone(uint32_t channel, uint32_t domainId);
+static void TEST_ScmiPowerNone(uint8_t perm, uint32_t channel,
+    uint32_t domainId);
 static void TEST_ScmiPowerSet(bool pass, uint32_t channel,
     uint32_t domainId, uint32_t lmId);
 
@@ -163,15 +164,28 @@ void TEST_ScmiPower(void)
 
     }
 
+    /* Power State Notify */
+    {
+        /* Test notify for invalid domain */
+        NECHECK(SCMI_PowerStateNotify(SM_TEST_DEFAULT_CHN, numDomains,
+            0U), SCMI_ERR_NOT_FOUND);
+        NECHECK(SCMI_PowerStateChangeRequestedNotify(SM_TEST_DEFAULT_CHN,
+            numDomains, 0U), SCMI_ERR_NOT_FOUND);
+
+        /* Branch -- Invalid Channel */
+        NECHECK(SCMI_PowerStateNotify(SM_SCMI_NUM_CHN, 0U, 0U),
+            SCMI_ERR_INVALID_PARAMETERS);
+    }
+
     /* Loop over power test domains */
     status = TEST_ConfigFirstGet(TEST_PD, &agentId,
         &channel, &domainId, &lmId);
     while (status == SM_ERR_SUCCESS)
     {
-        uint8_t perm = g_scmiAgentConfig[agentId].pdPerms[domainId];
+        uint8_t perm = SM_SCMI_PERM(g_scmiPdPerms, agentId, domainId);
 
         /* Test functions with no perm required */
-        TEST_ScmiPowerNone(channel, domainId);
+        TEST_ScmiPowerNone(perm, channel, domainId);
 
         /* Test functions with SET perm required */
         TEST_ScmiPowerSet(perm >= SM_SCMI_PERM_SET, channel, domainId,
@@ -190,7 +204,8 @@ void TEST_ScmiPower(void)
 /*--------------------------------------------------------------------------*/
 /* Test SCMI power functions with no access                                 */
 /*--------------------------------------------------------------------------*/
-static void TEST_ScmiPowerNone(uint32_t channel, uint32_t domainId)
+static void TEST_ScmiPowerNone(uint8_t perm, uint32_t channel,
+    uint32_t domainId)
 {
     /* Test power attributes */
     {
@@ -212,6 +227,36 @@ static void TEST_ScmiPowerNone(uint32_t channel, uint32_t domainId)
         printf("  domainChangeNote=%u\n",
             SCMI_POWER_ATTR_CHANGE(attributes));
         printf("  name=%s\n",  name);
+
+        BCHECK(SCMI_POWER_ATTR_CHANGE(attributes) == 1U);
+        BCHECK(SCMI_POWER_ATTR_CHANGE_REQ(attributes) == 1U);
+    }
+
+    /* Test power notify */
+    {
+        printf("SCMI_PowerStateNotify(%u, %u)\n", channel, domainId);
+        XCHECK(perm >= SM_SCMI_PERM_NOTIFY,
+            SCMI_PowerStateNotify(channel, domainId,
+            SCMI_POWER_NOTIFY_ENABLE(1U)));
+        XCHECK(perm >= SM_SCMI_PERM_NOTIFY,
+            SCMI_PowerStateNotify(channel, domainId, 0U));
+
+        printf("SCMI_PowerStateChangeRequestedNotify(%u, %u)\n", channel,
+            domainId);
+        XCHECK(perm >= SM_SCMI_PERM_NOTIFY,
+            SCMI_PowerStateChangeRequestedNotify(channel, domainId,
+            SCMI_POWER_NOTIFY_ENABLE(1U)));
+        XCHECK(perm >= SM_SCMI_PERM_NOTIFY,
+            SCMI_PowerStateChangeRequestedNotify(channel, domainId, 0U));
+
+        /* Invalid flags */
+        if (perm >= SM_SCMI_PERM_NOTIFY)
+        {
+            NECHECK(SCMI_PowerStateNotify(channel, domainId, 2U),
+                SCMI_ERR_INVALID_PARAMETERS);
+            NECHECK(SCMI_PowerStateChangeRequestedNotify(channel,
+                domainId, 2U), SCMI_ERR_INVALID_PARAMETERS);
+        }
     }
 
     /* Test power get */
@@ -234,6 +279,17 @@ static void TEST_ScmiPowerSet(bool pass, uint32_t channel,
     /* Adequate Set Permissions */
     if (pass)
     {
+        uint32_t initState = 0U;
+        uint32_t protocolId, messageId;
+
+        /* Enable notifications */
+        CHECK(SCMI_PowerStateGet(channel, domainId, &initState));
+        printf("SCMI_PowerStateNotify(%u, %u, 1)\n", channel, domainId);
+        CHECK(SCMI_PowerStateNotify(channel, domainId,
+            SCMI_POWER_NOTIFY_ENABLE(1U)));
+        CHECK(SCMI_PowerStateChangeRequestedNotify(channel, domainId,
+            SCMI_POWER_NOTIFY_ENABLE(1U)));
+
         /* Test Power Set OFF */
         printf("SCMI_PowerStateSet(%u, %u, 0, STATE_OFF)\n",
             channel, domainId);
@@ -252,6 +308,23 @@ static void TEST_ScmiPowerSet(bool pass, uint32_t channel,
             BCHECK(powerState == SCMI_POWER_DOMAIN_STATE_OFF);
         }
 
+        /* State changed notification if domain was on */
+        if (initState != SCMI_POWER_DOMAIN_STATE_OFF)
+        {
+            uint32_t agentId = 1U;
+            uint32_t evDomain = 0U;
+            uint32_t evState = 0U;
+
+            printf("SCMI_PowerStateChanged(%u)\n", channel + 1U);
+            CHECK(SCMI_PowerStateChanged(channel + 1U, &agentId,
+                &evDomain, &evState));
+            printf("  domainId=%u, powerState=0x%08x\n", evDomain,
+                evState);
+            BCHECK(agentId == 0U);
+            BCHECK(evDomain == domainId);
+            BCHECK(evState == SCMI_POWER_DOMAIN_STATE_OFF);
+        }
+
         /* Test power Set ON*/
         printf("SCMI_PowerStateSet(%u, %u, 0, STATE_ON)\n",
             channel, domainId);
@@ -278,6 +351,28 @@ static void TEST_ScmiPowerSet(bool pass, uint32_t channel,
             BCHECK(powerState == SCMI_POWER_DOMAIN_STATE_ON);
         }
 
+        /* State changed notification for power up */
+        {
+            uint32_t evDomain = 0U;
+            uint32_t evState = 1U;
+
+            printf("SCMI_PowerStateChanged(%u)\n", channel + 1U);
+            CHECK(SCMI_PowerStateChanged(channel + 1U, NULL,
+                &evDomain, &evState));
+            BCHECK(evDomain == domainId);
+            BCHECK(evState == SCMI_POWER_DOMAIN_STATE_ON);
+        }
+
+        /* No notification if state unchanged or for own requests */
+        CHECK(SCMI_PowerStateSet(channel, domainId,
+            0U, SCMI_POWER_DOMAIN_STATE_ON));
+        NECHECK(SCMI_P2aPending(channel + 1U, &protocolId, &messageId),
+            SCMI_ERR_PROTOCOL_ERROR);
+
+        /* Disable notifications */
+        CHECK(SCMI_PowerStateNotify(channel, domainId, 0U));
+        CHECK(SCMI_PowerStateChangeRequestedNotify(channel, domainId, 0U));
+
 #ifdef SIMU
 
         /* Reset */
@@ -149,7 +149,7 @@ void TEST_ScmiReset(void)
         &channel, &domainId, &lmId);
     while(status == SCMI_ERR_SUCCESS)
     {
-        uint8_t perm = g_scmiAgentConfig[agentId].rstPerms[domainId];
+        uint8_t perm = SM_SCMI_PERM(g_scmiRstPerms, agentId, domainId);
 
         /* Test functions with no perm required */
         TEST_ScmiResetNone(channel, domainId);
@@ -62,6 +62,11 @@ static void TEST_ScmiSensorExclusive(bool pass, uint32_t channel,
     uint32_t sensorId, uint32_t lmId);
 static void TEST_ScmiSensorNone(uint32_t channel,
     uint32_t sensorId);
+static void TEST_ScmiSensorNoNotify(uint32_t agentId, uint32_t channel);
+#ifdef SIMU
+static void TEST_ScmiSensorUpdate(uint8_t perm, uint32_t channel,
+    uint32_t sensorId);
+#endif
 
 /*--------------------------------------------------------------------------*/
 /* Test SCMI sensor protocol                                                */
@@ -294,7 +299,7 @@ void TEST_ScmiSensor(void)
         &channel, &sensorId, &lmId);
     while (status == SM_ERR_SUCCESS)
     {
-        uint8_t perm = g_scmiAgentConfig[agentId].sensorPerms[sensorId];
+        uint8_t perm = SM_SCMI_PERM(g_scmiSensorPerms, agentId, sensorId);
 
         /* Test functions with NONE perm required */
         TEST_ScmiSensorNone(channel, sensorId);
@@ -310,11 +315,43 @@ void TEST_ScmiSensor(void)
         TEST_ScmiSensorExclusive(perm >= SM_SCMI_PERM_EXCLUSIVE,
             channel, sensorId, lmId);
 
+#ifdef SIMU
+        /* Test continuous update notifications */
+        TEST_ScmiSensorUpdate(perm, channel, sensorId);
+#endif
+
         /* Get next test case */
         status = TEST_ConfigNextGet(TEST_SENSOR, &agentId,
             &channel, &sensorId, &lmId);
     }
 
+    /* Loop over agents without a notification channel */
+    for (channel = 0U; channel < SM_SCMI_NUM_CHN; channel++)
+    {
+        if (g_scmiChannelConfig[channel].type == SM_SCMI_CHN_A2P)
+        {
+            bool notify = false;
+
+            agentId = g_scmiChannelConfig[channel].agentId;
+
+            /* Find notification channel of the agent */
+            for (uint32_t chn = 0U; chn < SM_SCMI_NUM_CHN; chn++)
+            {
+                if ((g_scmiChannelConfig[chn].agentId == agentId)
+                    && (g_scmiChannelConfig[chn].type
+                    == SM_SCMI_CHN_P2A_NOTIFY))
+                {
+                    notify = true;
+                }
+            }
+
+            if (!notify)
+            {
+                TEST_ScmiSensorNoNotify(agentId, channel);
+            }
+        }
+    }
+
     printf("\n");
 }
 
@@ -418,6 +455,13 @@ static void TEST_ScmiSensorSet(bool pass, uint32_t channel,
 
         CHECK(SCMI_SensorReadingGet(channel, sensorId,
             flags, NULL));
+
+        /* Force a fresh sample */
+        flags = SCMI_SENSOR_READ_FLAGS_FRESH(1U);
+        printf("SCMI_SensorReadingGet(%u, %u, 0x%08X)\n", channel,
+            sensorId, flags);
+        CHECK(SCMI_SensorReadingGet(channel, sensorId,
+            flags, readings));
     }
 
     /* Test config set with sensor timestamp disabled */
@@ -431,7 +475,7 @@ static void TEST_ScmiSensorSet(bool pass, uint32_t channel,
             sensorConfig));
     }
 
-    /* Test for error for an async call in SensorReadingGet */
+    /* Test async call in SensorReadingGet */
     {
         scmi_sensor_reading_t readings[SCMI_SENSOR_MAX_READINGS]
             = { 0 };
@@ -439,8 +483,37 @@ static void TEST_ScmiSensorSet(bool pass, uint32_t channel,
 
         printf("SCMI_SensorReadingGet(%u, %u)\n",
             SM_TEST_DEFAULT_CHN, sensorId);
-        NCHECK(SCMI_SensorReadingGet(channel, sensorId,
-            flags,readings));
+        if (pass && (SCMI_SENSOR_ATTR_LOW_ASYNC(
+            s_desc[descIndex].sensorAttributesLow) != 0U))
+        {
+            uint32_t completeId = 0U;
+            scmi_sensor_reading_t completeReading = { 0 };
+
+            CHECK(SCMI_SensorReadingGet(channel, sensorId,
+                flags, readings));
+
+            /* Collect delayed response */
+            printf("SCMI_SensorReadingComplete(%u)\n", channel + 1U);
+            CHECK(SCMI_SensorReadingComplete(channel + 1U, &completeId,
+                &completeReading));
+            printf("  sensorId=%u\n", completeId);
+            printf("  value=%d\n", completeReading.sensorValueLow);
+            BCHECK(completeId == sensorId);
+
+            /* No more delayed responses */
+            {
+                uint32_t protocolId = 0U;
+                uint32_t messageId = 0U;
+
+                NECHECK(SCMI_P2aPending(channel + 1U, &protocolId,
+                    &messageId), SCMI_ERR_PROTOCOL_ERROR);
+            }
+        }
+        else
+        {
+            NCHECK(SCMI_SensorReadingGet(channel, sensorId,
+                flags,readings));
+        }
     }
 
     /* Should fail with an error after trying to use protocol
@@ -640,3 +713,156 @@ static void TEST_ScmiSensorExclusive(bool pass, uint32_t channel,
 #endif
 }
 
+/*--------------------------------------------------------------------------*/
+/* Test SCMI sensor functions for agent with no notification channel        */
+/*--------------------------------------------------------------------------*/
+static void TEST_ScmiSensorNoNotify(uint32_t agentId, uint32_t channel)
+{
+    uint32_t attributes = 0U;
+    uint32_t maxPending;
+
+    CHECK(SCMI_SensorProtocolAttributes(channel, &attributes, NULL, NULL,
+        NULL));
+    maxPending = SCMI_SENSOR_PROTO_ATTR_MAX_PENDING(attributes);
+
+    /* Find an async sensor the agent can enable */
+    for (uint32_t sensorId = 0U; sensorId < SM_NUM_SENSOR; sensorId++)
+    {
+        scmi_sensor_desc_t desc[SCMI_SENSOR_MAX_DESC];
+        uint32_t numSensorFlags = 0U;
+
+        if (SM_SCMI_PERM(g_scmiSensorPerms, agentId, sensorId)
+            < SM_SCMI_PERM_SET)
+        {
+            continue;
+        }
+
+        CHECK(SCMI_SensorDescriptionGet(channel, sensorId,
+            &numSensorFlags, desc));
+        if (SCMI_SENSOR_ATTR_LOW_ASYNC(desc[0].sensorAttributesLow) != 0U)
+        {
+            scmi_sensor_reading_t readings[SCMI_SENSOR_MAX_READINGS]
+                = { 0 };
+            uint32_t flags = SCMI_SENSOR_READ_FLAGS_ASYNC(1U);
+
+            printf("**** Sensor No Notify Tests (agent %u) ***\n\n",
+                agentId);
+
+            CHECK(SCMI_SensorConfigSet(channel, sensorId,
+                SCMI_SENSOR_CONFIG_SET_ENABLE(1U)));
+
+            /* Delayed response cannot be sent */
+            printf("SCMI_SensorReadingGet(%u, %u, 0x%08X)\n", channel,
+                sensorId, flags);
+            for (uint32_t idx = 0U; idx <= maxPending; idx++)
+            {
+                NECHECK(SCMI_SensorReadingGet(channel, sensorId, flags,
+                    readings), SCMI_ERR_NOT_SUPPORTED);
+            }
+
+            /* Sync still works */
+            CHECK(SCMI_SensorReadingGet(channel, sensorId,
+                SCMI_SENSOR_READ_FLAGS_ASYNC(0U), readings));
+
+            CHECK(SCMI_SensorConfigSet(channel, sensorId,
+                SCMI_SENSOR_CONFIG_SET_ENABLE(0U)));
+            break;
+        }
+    }
+}
+
+#ifdef SIMU
+/*--------------------------------------------------------------------------*/
+/* Test SCMI sensor continuous update notifications                         */
+/*--------------------------------------------------------------------------*/
+static void TEST_ScmiSensorUpdate(uint8_t perm, uint32_t channel,
+    uint32_t sensorId)
+{
+    /* Adequate permissions */
+    if (perm >= SM_SCMI_PERM_SET)
+    {
+        uint32_t sensorConfig = 0U;
+        uint32_t agent = 0xFFU;
+        uint32_t sensor = 0xFFU;
+        scmi_sensor_reading_t reading = { 0 };
+
+        /* Set interval of 2 S */
+        printf("SCMI_SensorConfigSet(%u, %u, 2S)\n", channel, sensorId);
+        CHECK(SCMI_SensorConfigSet(channel, sensorId,
+            SCMI_SENSOR_CONFIG_SET_ENABLE(1U)
+            | SCMI_SENSOR_CONFIG_SET_UPDATE_INTV_SEC(2U)));
+        CHECK(SCMI_SensorConfigGet(channel, sensorId, &sensorConfig));
+        BCHECK(SCMI_SENSOR_CONFIG_GET_UPDATE_INTV_SEC(sensorConfig) == 2U);
+        BCHECK(SCMI_SENSOR_CONFIG_GET_UPDATE_INTV_EXP(sensorConfig) == 0U);
+
+        /* Set interval of 1.5 mS, rounds up to minimum */
+        CHECK(SCMI_SensorConfigSet(channel, sensorId,
+            SCMI_SENSOR_CONFIG_SET_ENABLE(1U)
+            | SCMI_SENSOR_CONFIG_SET_UPDATE_INTV_SEC(15U)
+            | SCMI_SENSOR_CONFIG_SET_UPDATE_INTV_EXP(0x1CU)
+            | SCMI_SENSOR_CONFIG_SET_ROUND(1U)));
+        CHECK(SCMI_SensorConfigGet(channel, sensorId, &sensorConfig));
+        printf("  sec=%u, exp=0x%X\n",
+            SCMI_SENSOR_CONFIG_GET_UPDATE_INTV_SEC(sensorConfig),
+            SCMI_SENSOR_CONFIG_GET_UPDATE_INTV_EXP(sensorConfig));
+        BCHECK(SCMI_SENSOR_CONFIG_GET_UPDATE_INTV_SEC(sensorConfig) == 10U);
+        BCHECK(SCMI_SENSOR_CONFIG_GET_UPDATE_INTV_EXP(sensorConfig)
+            == 0x1DU);
+
+        /* Branch -- Interval too long */
+        NECHECK(SCMI_SensorConfigSet(channel, sensorId,
+            SCMI_SENSOR_CONFIG_SET_ENABLE(1U)
+            | SCMI_SENSOR_CONFIG_SET_UPDATE_INTV_SEC(0xFFFFU)
+            | SCMI_SENSOR_CONFIG_SET_UPDATE_INTV_EXP(15U)),
+            SCMI_ERR_INVALID_PARAMETERS);
+
+        /* Request updates */
+        if (perm >= SM_SCMI_PERM_NOTIFY)
+        {
+            uint64_t end;
+
+            printf("SCMI_SensorContinuousUpdateNotify(%u, %u)\n",
+                channel, sensorId);
+            CHECK(SCMI_SensorContinuousUpdateNotify(channel, sensorId,
+                SCMI_SENSOR_UPDATE_NOTIFY_ENABLE(1U)));
+
+            /* Wait past the interval and tick */
+            end = DEV_SM_Usec64Get() + 20000ULL;
+            while (DEV_SM_Usec64Get() < end)
+            {
+                ; /* Intentional empty while */
+            }
+            LMM_RpcPoll();
+
+            /* Read update */
+            printf("SCMI_SensorUpdate(%u)\n", channel + 1U);
+            CHECK(SCMI_SensorUpdate(channel + 1U, &agent, &sensor,
+                &reading));
+            printf("  sensorId=%u, value=%d\n", sensor,
+                reading.sensorValueLow);
+            BCHECK(agent == 0U);
+            BCHECK(sensor == sensorId);
+
+            /* Stop updates */
+            CHECK(SCMI_SensorContinuousUpdateNotify(channel, sensorId,
+                SCMI_SENSOR_UPDATE_NOTIFY_ENABLE(0U)));
+        }
+
+        /* Restore default interval */
+        CHECK(SCMI_SensorConfigSet(channel, sensorId,
+            SCMI_SENSOR_CONFIG_SET_ENABLE(1U)
+            | SCMI_SENSOR_CONFIG_SET_UPDATE_INTV_SEC(1U)));
+    }
+
+    /* Access denied */
+    if (perm < SM_SCMI_PERM_NOTIFY)
+    {
+        NECHECK(SCMI_SensorContinuousUpdateNotify(channel, sensorId,
+            SCMI_SENSOR_UPDATE_NOTIFY_ENABLE(1U)), SCMI_ERR_DENIED);
+    }
+
+    /* Branch -- Invalid sensor */
+    NECHECK(SCMI_SensorContinuousUpdateNotify(channel, SM_NUM_SENSOR,
+        SCMI_SENSOR_UPDATE_NOTIFY_ENABLE(1U)), SCMI_ERR_NOT_FOUND);
+}
+#endif
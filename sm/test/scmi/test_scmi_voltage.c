@@ -202,7 +202,7 @@ void TEST_ScmiVoltage(void)
         &channel, &domainId, &lmId);
     while (status == SCMI_ERR_SUCCESS)
     {
-        uint8_t perm = g_scmiAgentConfig[agentId].voltPerms[domainId];
+        uint8_t perm = SM_SCMI_PERM(g_scmiVoltPerms, agentId, domainId);
 
         /* Test functions with no perm required */
         TEST_ScmiVoltageNone(channel, domainId);
@@ -190,6 +190,7 @@ void TEST_LmmPower(void);
 void TEST_LmmSys(void);
 void TEST_LmmCpu(void);
 void TEST_LmmVoltage(void);
+void TEST_LmmVote(void);
 void TEST_Scmi(void);
 void TEST_ScmiBase(void);
 void TEST_ScmiPower(void);
@@ -207,6 +208,7 @@ void TEST_ScmiBbmButton(void);
 void TEST_ScmiMisc(void);
 void TEST_ScmiReset(void);
 void TEST_ScmiFusa(void);
+void TEST_UtilitiesCrc(void);
 void TEST_UtilitiesConfig(void);
 #endif
 
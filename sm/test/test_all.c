@@ -87,6 +87,7 @@ void TEST_All(void)
     TEST_LmmSys();
     TEST_LmmCpu();
     TEST_LmmVoltage();
+    TEST_LmmVote();
 #endif
 
     /* Run SCMI tests */
@@ -109,6 +110,7 @@ void TEST_All(void)
     TEST_ScmiMisc();
 
     /* Run Utility tests */
+    TEST_UtilitiesCrc();
     TEST_UtilitiesConfig();
 
     /* Exit */
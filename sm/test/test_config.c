@@ -73,7 +73,8 @@ int32_t TEST_Config(void)
     {
         /* Configure client channel */
         status = SMT_ChannelConfig(channel, s_testConfig[channel].mbInst,
-            s_testConfig[channel].mbDoorbell, s_testConfig[channel].sma);
+            s_testConfig[channel].mbDoorbell, s_testConfig[channel].sma,
+            s_testConfig[channel].size);
 
         /* Exit if error */
         if (status != SM_ERR_SUCCESS)
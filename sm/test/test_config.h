@@ -97,6 +97,7 @@ typedef struct
     uint8_t mbDoorbell;  /*!< Mailbox doorbell to use */
     uint8_t agentId;     /*!< Agent ID the test is from */
     uint32_t sma;        /*!< Shared memory address */
+    uint32_t size;       /*!< Shared memory buffer size (0=default) */
 } test_chn_config_t;
 
 /*!
@@ -0,0 +1,193 @@
+/*
+** ###################################################################
+**
+** Copyright 2023 NXP
+**
+** Redistribution and use in source and binary forms, with or without modification,
+** are permitted provided that the following conditions are met:
+**
+** o Redistributions of source code must retain the above copyright notice, this list
+**   of conditions and the following disclaimer.
+**
+** o Redistributions in binary form must reproduce the above copyright notice, this
+**   list of conditions and the following disclaimer in the documentation and/or
+**   other materials provided with the distribution.
+**
+** o Neither the name of the copyright holder nor the names of its
+**   contributors may be used to endorse or promote products derived from this
+**   software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+** ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+** WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+** DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+** ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+** (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+** LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+** ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+** SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+**
+** ###################################################################
+*/
+
+
+/*==========================================================================*/
+/* Unit test and benchmark for the CRC functions                            */
+/*==========================================================================*/
+
+/* Includes */
+
+#include "test.h"
+#include "crc.h"
+#include "string.h"
+
+/* Local defines */
+
+/* Benchmark buffer size in words (max SMT payload) */
+#define CRC_BENCH_WORDS  32U
+
+/* Benchmark iterations */
+#define CRC_BENCH_LOOPS  10000U
+
+/* Local types */
+
+/* Local variables */
+
+static uint32_t s_crcSrc[CRC_BENCH_WORDS + 1U];
+static uint32_t s_crcDst[CRC_BENCH_WORDS + 1U];
+
+/* Local functions */
+
+static uint32_t TEST_Crc32Nibble(const uint8_t *addr, uint32_t size);
+
+/*--------------------------------------------------------------------------*/
+/* CRC tests                                                                */
+/*--------------------------------------------------------------------------*/
+void TEST_UtilitiesCrc(void)
+{
+    static const uint8_t s_check[] = "123456789";
+    const uint8_t *src8 = (const uint8_t*) s_crcSrc;
+    const uint8_t *dst8 = (const uint8_t*) s_crcDst;
+    uint32_t bytes = CRC_BENCH_WORDS * 4U;
+
+    printf("**** CRC Tests ***\n\n");
+
+    /* Fill source with a pattern */
+    for (uint32_t i = 0U; i < (CRC_BENCH_WORDS + 1U); i++)
+    {
+        s_crcSrc[i] = (i * 0x9E3779B9U) ^ 0xA5A55A5AU;
+    }
+
+    /* Check value */
+    printf("CRC_Crc32(check)\n");
+    BCHECK(CRC_Crc32(s_check, 9U) == 0xCBF43926U);
+
+    /* Compare against reference for all lengths and alignments */
+    printf("CRC_Crc32() vs reference\n");
+    for (uint32_t off = 0U; off < 4U; off++)
+    {
+        for (uint32_t len = 0U; len <= (bytes - off); len++)
+        {
+            BCHECK(CRC_Crc32(&src8[off], len)
+                == TEST_Crc32Nibble(&src8[off], len));
+        }
+    }
+
+    /* Check copy variants for all lengths */
+    printf("CRC_Crc32Copy()/CRC_XorCopy()\n");
+    for (uint32_t len = 0U; len <= bytes; len++)
+    {
+        memset(s_crcDst, 0xFF, sizeof(s_crcDst));
+        BCHECK(CRC_Crc32Copy(s_crcDst, s_crcSrc, len)
+            == TEST_Crc32Nibble(src8, len));
+        BCHECK(memcmp(s_crcDst, s_crcSrc, len) == 0);
+        BCHECK(dst8[len] == 0xFFU);
+
+        memset(s_crcDst, 0xFF, sizeof(s_crcDst));
+        BCHECK(CRC_XorCopy(s_crcDst, s_crcSrc, len)
+            == CRC_Xor(s_crcSrc, len / 4U));
+        BCHECK(memcmp(s_crcDst, s_crcSrc, len) == 0);
+        BCHECK(dst8[len] == 0xFFU);
+    }
+
+    /* Benchmark */
+    {
+        uint64_t start;
+        uint32_t crc = 0U;
+        uint32_t tNibble, tSlice, tSplit, tFused;
+
+        start = DEV_SM_Usec64Get();
+        for (uint32_t i = 0U; i < CRC_BENCH_LOOPS; i++)
+        {
+            crc ^= TEST_Crc32Nibble(src8, bytes);
+        }
+        tNibble = (uint32_t) (DEV_SM_Usec64Get() - start);
+
+        start = DEV_SM_Usec64Get();
+        for (uint32_t i = 0U; i < CRC_BENCH_LOOPS; i++)
+        {
+            crc ^= CRC_Crc32(src8, bytes);
+        }
+        tSlice = (uint32_t) (DEV_SM_Usec64Get() - start);
+
+        start = DEV_SM_Usec64Get();
+        for (uint32_t i = 0U; i < CRC_BENCH_LOOPS; i++)
+        {
+            memcpy(s_crcDst, s_crcSrc, bytes);
+            crc ^= CRC_Crc32(dst8, bytes);
+        }
+        tSplit = (uint32_t) (DEV_SM_Usec64Get() - start);
+
+        start = DEV_SM_Usec64Get();
+        for (uint32_t i = 0U; i < CRC_BENCH_LOOPS; i++)
+        {
+            crc ^= CRC_Crc32Copy(s_crcDst, s_crcSrc, bytes);
+        }
+        tFused = (uint32_t) (DEV_SM_Usec64Get() - start);
+
+        printf("CRC32 benchmark (%u loops x %u bytes, usec):\n",
+            CRC_BENCH_LOOPS, bytes);
+        printf("  nibble=%u, slice4=%u, copy+crc=%u, fused=%u (0x%08X)\n",
+            tNibble, tSlice, tSplit, tFused, crc);
+    }
+
+    printf("\n");
+}
+
+/*==========================================================================*/
+
+/*--------------------------------------------------------------------------*/
+/* Reference nibble-table CRC32                                             */
+/*--------------------------------------------------------------------------*/
+static uint32_t TEST_Crc32Nibble(const uint8_t *addr, uint32_t size)
+{
+    const uint8_t *a = addr;
+    uint32_t sz = size;
+    uint32_t crc = 0U;
+
+    /* Poly table */
+    static uint32_t const s_crcTable[] =
+    {
+        0x4DBDF21CU, 0x500AE278U, 0x76D3D2D4U, 0x6B64C2B0U,
+        0x3B61B38CU, 0x26D6A3E8U, 0x000F9344U, 0x1DB88320U,
+        0xA005713CU, 0xBDB26158U, 0x9B6B51F4U, 0x86DC4190U,
+        0xD6D930ACU, 0xCB6E20C8U, 0xEDB71064U, 0xF0000000U
+    };
+
+    /* Loop over data */
+    while (sz > 0U)
+    {
+        crc = (crc >> 4U) ^ s_crcTable[(crc ^ (((uint32_t)(*a)) >> 0U))
+                & 0x0FU];
+        crc = (crc >> 4U) ^ s_crcTable[(crc ^ (((uint32_t) (*a)) >> 4U))
+                & 0x0FU];
+        a++;
+        sz--;
+    }
+
+    /* Return CRC */
+    return crc;
+}
+
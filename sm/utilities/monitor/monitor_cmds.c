@@ -50,6 +50,8 @@
 #endif
 #include "lmm.h"
 #include "dev_sm_api.h"
+#include "rpc_scmi.h"
+#include "rpc_scmi_config.h"
 #ifdef DEVICE_HAS_ELE
 #include "fsl_ele.h"
 #endif
@@ -128,6 +130,8 @@ static int32_t MONITOR_CmdFuse(int32_t argc, const char * const argv[],
 static int32_t MONITOR_CmdPmic(int32_t argc, const char * const argv[],
     int32_t rw);
 #endif
+static int32_t MONITOR_CmdStats(int32_t argc, const char * const argv[]);
+static int32_t MONITOR_CmdTrace(int32_t argc, const char * const argv[]);
 static int32_t MONITOR_CmdCustom(int32_t argc, const char * const argv[]);
 
 /* Local Variables */
@@ -193,6 +197,8 @@ int32_t MONITOR_Dispatch(char *line)
         "fuse.w",
         "pmic.r",
         "pmic.w",
+        "stats",
+        "trace",
         "custom"
     };
 
@@ -355,7 +361,13 @@ int32_t MONITOR_Dispatch(char *line)
                 status = MONITOR_CmdPmic(argc - 1, &argv[1], WRITE);
                 break;
 #endif
-            case 47:  /* custom */
+            case 47:  /* stats */
+                status = MONITOR_CmdStats(argc - 1, &argv[1]);
+                break;
+            case 48:  /* trace */
+                status = MONITOR_CmdTrace(argc - 1, &argv[1]);
+                break;
+            case 49:  /* custom */
                 status = MONITOR_CmdCustom(argc - 1, &argv[1]);
                 break;
             default:
@@ -474,6 +486,11 @@ static int32_t MONITOR_CmdInfo(int32_t argc, const char * const argv[])
         printf("Boot set      = %d\n", passover->imgSetSel + 1U);
     }
 
+    /* Display SCMI permission footprint */
+    printf("SCMI perms    = %u bytes (%u unpacked)\n",
+        (uint32_t) (SM_SCMI_PERM_NUM_RSRC * sizeof(scmi_perm_t)),
+        (uint32_t) (SM_SCMI_PERM_NUM_RSRC * SM_SCMI_NUM_AGNT));
+
 #ifdef BOARD_HAS_PMIC
     uint8_t dev;
     uint8_t *val;
@@ -2739,6 +2756,133 @@ static int32_t MONITOR_CmdPmic(int32_t argc, const char * const argv[],
 }
 #endif
 
+/*--------------------------------------------------------------------------*/
+/* Stats command                                                            */
+/*--------------------------------------------------------------------------*/
+static int32_t MONITOR_CmdStats(int32_t argc, const char * const argv[])
+{
+    int32_t status = SM_ERR_SUCCESS;
+    bool reset = false;
+
+    /* Reset requested? */
+    if (argc > 0)
+    {
+        static string const statsModes[] =
+        {
+            "reset"
+        };
+
+        if (MONITOR_Find(statsModes, 1, argv[0]) == 0)
+        {
+            reset = true;
+        }
+        else
+        {
+            status = SM_ERR_INVALID_PARAMETERS;
+        }
+    }
+
+    /* Dump vote statistics */
+    if (status == SM_ERR_SUCCESS)
+    {
+        static string const voteTypes[LMM_VOTE_NUM_TYPE] =
+        {
+            "clock",
+            "power",
+            "perf",
+            "volt"
+        };
+
+        for (uint32_t type = 0U; type < LMM_VOTE_NUM_TYPE; type++)
+        {
+            lmm_vote_stats_t stats;
+
+            if (LMM_VoteStatsGet(type, &stats, reset) == SM_ERR_SUCCESS)
+            {
+                printf("Vote stats (%s): updates=%u, writes=%u, "
+                    "suppressed=%u\n", voteTypes[type], stats.updates,
+                    stats.writes, stats.suppressed);
+            }
+        }
+    }
+
+    /* Dump statistics, SCMI stats are optional */
+    if (status == SM_ERR_SUCCESS)
+    {
+        status = LMM_StatsDump(reset);
+        if (status == SM_ERR_NOT_SUPPORTED)
+        {
+            status = SM_ERR_SUCCESS;
+        }
+    }
+
+    /* Return status */
+    return status;
+}
+
+/*--------------------------------------------------------------------------*/
+/* Trace command                                                            */
+/*--------------------------------------------------------------------------*/
+static int32_t MONITOR_CmdTrace(int32_t argc, const char * const argv[])
+{
+    int32_t status = SM_ERR_SUCCESS;
+    int32_t mode = 0;
+
+    static string const traceModes[] =
+    {
+        "dump",
+        "filter",
+        "export",
+        "clear"
+    };
+
+    /* Get mode */
+    if (argc > 0)
+    {
+        mode = MONITOR_Find(traceModes, (int32_t) ARRAY_SIZE(traceModes),
+            argv[0]);
+    }
+
+    switch (mode)
+    {
+        case 0:  /* dump */
+            {
+                uint32_t scmiChannel = SCMI_TRACE_ANY;
+
+                if (argc > 1)
+                {
+                    scmiChannel = strtoul(argv[1], NULL, 0);
+                }
+                status = RPC_SCMI_TraceDump(scmiChannel, SCMI_TRACE_ANY);
+            }
+            break;
+        case 1:  /* filter */
+            if (argc > 1)
+            {
+                uint32_t protocolId = strtoul(argv[1], NULL, 0);
+
+                status = RPC_SCMI_TraceDump(SCMI_TRACE_ANY, protocolId);
+            }
+            else
+            {
+                status = SM_ERR_MISSING_PARAMETERS;
+            }
+            break;
+        case 2:  /* export */
+            status = RPC_SCMI_TraceExport();
+            break;
+        case 3:  /* clear */
+            status = RPC_SCMI_TraceClear();
+            break;
+        default:
+            status = SM_ERR_INVALID_PARAMETERS;
+            break;
+    }
+
+    /* Return status */
+    return status;
+}
+
 /*--------------------------------------------------------------------------*/
 /* Custom command                                                           */
 /*--------------------------------------------------------------------------*/